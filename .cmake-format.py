@@ -396,7 +396,8 @@ with section("parse"):
                                                    'NO_PARCELPORT_TCP',
                                                    'NO_PARCELPORT_LCI',
                                                    'NO_PARCELPORT_MPI',
-                                                   'NO_PARCELPORT_GASNET'],
+                                                   'NO_PARCELPORT_GASNET',
+                                                   'NO_PARCELPORT_SHMEM'],
                                          'nargs': '2+'}},
     'add_hpx_source_group': { 'kwargs': { 'CLASS': 1,
                                           'NAME': 1,
@@ -412,7 +413,8 @@ with section("parse"):
                                           'RUN_SERIAL',
                                           'NO_PARCELPORT_TCP',
                                           'NO_PARCELPORT_LCI',
-                                          'NO_PARCELPORT_MPI'],
+                                          'NO_PARCELPORT_MPI',
+                                          'NO_PARCELPORT_SHMEM'],
                                 'nargs': '2+'}},
     'add_hpx_test_target_dependencies': { 'kwargs': {'PSEUDO_DEPS_NAME': 1},
                                           'pargs': {'flags': [], 'nargs': '2+'}},
@@ -440,7 +442,8 @@ with section("parse"):
                                                 'RUN_SERIAL',
                                                 'NO_PARCELPORT_TCP',
                                                 'NO_PARCELPORT_LCI',
-                                                'NO_PARCELPORT_MPI'],
+                                                'NO_PARCELPORT_MPI',
+                                                'NO_PARCELPORT_SHMEM'],
                                       'nargs': '2+'}},
     'add_parcelport': { 'kwargs': { 'COMPILE_FLAGS': '+',
                                     'DEPENDENCIES': '+',
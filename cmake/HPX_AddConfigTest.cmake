@@ -241,6 +241,15 @@ function(hpx_check_for_unistd_h)
   )
 endfunction()
 
+# ##############################################################################
+function(hpx_check_for_linux_io_uring)
+  add_hpx_config_test(
+    HPX_WITH_LINUX_IO_URING
+    SOURCE cmake/tests/linux_io_uring.cpp
+    FILE ${ARGN}
+  )
+endfunction()
+
 # ##############################################################################
 function(hpx_check_for_builtin_forward_move)
   add_hpx_config_test(
@@ -6,7 +6,7 @@
 
 function(add_hpx_test category name)
   set(options FAILURE_EXPECTED RUN_SERIAL NO_PARCELPORT_TCP NO_PARCELPORT_MPI
-              NO_PARCELPORT_LCI NO_PARCELPORT_GASNET
+              NO_PARCELPORT_LCI NO_PARCELPORT_GASNET NO_PARCELPORT_SHMEM
   )
   set(one_value_args EXECUTABLE LOCALITIES THREADS_PER_LOCALITY TIMEOUT
                      RUNWRAPPER
@@ -233,6 +233,33 @@ function(add_hpx_test category name)
         endif()
       endif()
     endif()
+    # the shared-memory parcelport relies on the tcp parcelport for
+    # bootstrapping
+    if(HPX_WITH_PARCELPORT_SHMEM
+       AND HPX_WITH_PARCELPORT_TCP
+       AND NOT ${${name}_NO_PARCELPORT_SHMEM}
+    )
+      set(_add_test FALSE)
+      if(DEFINED ${name}_PARCELPORTS)
+        set(PP_FOUND -1)
+        list(FIND ${name}_PARCELPORTS "shmem" PP_FOUND)
+        if(NOT PP_FOUND EQUAL -1)
+          set(_add_test TRUE)
+        endif()
+      else()
+        set(_add_test TRUE)
+      endif()
+      if(_add_test)
+        set(_full_name "${category}.distributed.shmem.${name}")
+        add_test(NAME "${_full_name}" COMMAND ${cmd} "-p" "shmem" ${args})
+        set_tests_properties("${_full_name}" PROPERTIES RUN_SERIAL TRUE)
+        if(${name}_TIMEOUT)
+          set_tests_properties(
+            "${_full_name}" PROPERTIES TIMEOUT ${${name}_TIMEOUT}
+          )
+        endif()
+      endif()
+    endif()
   endif()
 endfunction(add_hpx_test)
 
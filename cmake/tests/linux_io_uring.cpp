@@ -0,0 +1,26 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+////////////////////////////////////////////////////////////////////////////////
+
+// test for the io_uring features used by the TCP parcelport
+#include <linux/io_uring.h>
+#include <sys/syscall.h>
+
+int main()
+{
+    io_uring_sqe sqe{};
+    sqe.opcode = IORING_OP_SENDMSG_ZC;
+    sqe.ioprio = IORING_RECV_MULTISHOT;
+    sqe.flags = IOSQE_BUFFER_SELECT;
+
+    io_uring_buf_reg reg{};
+    reg.bgid = 0;
+
+    unsigned const opcodes[] = {
+        IORING_REGISTER_PBUF_RING, IORING_REGISTER_EVENTFD, __NR_io_uring_setup};
+    return static_cast<int>(opcodes[0] == 0 && reg.bgid == sqe.flags);
+}
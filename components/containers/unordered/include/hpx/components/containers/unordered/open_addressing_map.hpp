@@ -0,0 +1,634 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/components/containers/unordered/open_addressing_map.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/serialization/serialization_fwd.hpp>
+#include <hpx/serialization/serialize.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// The open_addressing_map is an associative container storing its
+    /// elements in a single flat array of slots using linear probing. Each
+    /// slot is described by a control byte which marks it as being empty,
+    /// erased, or occupied. Occupied slots additionally store seven bits of
+    /// the hash of the key, which allows to reject most of the non-matching
+    /// slots without comparing keys.
+    ///
+    /// The interface is a subset of the interface of std::unordered_map.
+    /// Contrary to std::unordered_map, inserting elements may invalidate
+    /// references to other elements.
+    template <typename Key, typename T, typename Hash = std::hash<Key>,
+        typename KeyEqual = std::equal_to<Key>>
+    class open_addressing_map
+    {
+        static constexpr std::uint8_t empty_slot = 0x00;
+        static constexpr std::uint8_t erased_slot = 0x01;
+        static constexpr std::uint8_t occupied_bit = 0x80;
+
+        static constexpr std::size_t min_capacity = 8;
+
+    public:
+        using key_type = Key;
+        using mapped_type = T;
+        using value_type = std::pair<Key const, T>;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using hasher = Hash;
+        using key_equal = KeyEqual;
+        using reference = value_type&;
+        using const_reference = value_type const&;
+
+    private:
+        template <bool IsConst>
+        class iterator_impl
+        {
+            using map_type = std::conditional_t<IsConst,
+                open_addressing_map const, open_addressing_map>;
+
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = typename open_addressing_map::value_type;
+            using difference_type = std::ptrdiff_t;
+            using pointer = std::conditional_t<IsConst, value_type const*,
+                value_type*>;
+            using reference = std::conditional_t<IsConst, value_type const&,
+                value_type&>;
+
+            iterator_impl() = default;
+
+            template <bool OtherIsConst,
+                typename Enable = std::enable_if_t<IsConst && !OtherIsConst>>
+            iterator_impl(iterator_impl<OtherIsConst> const& rhs) noexcept
+              : map_(rhs.map_)
+              , pos_(rhs.pos_)
+            {
+            }
+
+            reference operator*() const noexcept
+            {
+                return map_->slots_[pos_];
+            }
+
+            pointer operator->() const noexcept
+            {
+                return &map_->slots_[pos_];
+            }
+
+            iterator_impl& operator++() noexcept
+            {
+                ++pos_;
+                skip_free_slots();
+                return *this;
+            }
+
+            iterator_impl operator++(int) noexcept
+            {
+                iterator_impl tmp(*this);
+                ++*this;
+                return tmp;
+            }
+
+            friend bool operator==(
+                iterator_impl const& lhs, iterator_impl const& rhs) noexcept
+            {
+                return lhs.pos_ == rhs.pos_;
+            }
+
+            friend bool operator!=(
+                iterator_impl const& lhs, iterator_impl const& rhs) noexcept
+            {
+                return lhs.pos_ != rhs.pos_;
+            }
+
+        private:
+            friend class open_addressing_map;
+
+            template <bool>
+            friend class iterator_impl;
+
+            iterator_impl(map_type* map, size_type pos) noexcept
+              : map_(map)
+              , pos_(pos)
+            {
+            }
+
+            void skip_free_slots() noexcept
+            {
+                while (pos_ < map_->capacity_ &&
+                    !(map_->ctrl_[pos_] & occupied_bit))
+                {
+                    ++pos_;
+                }
+            }
+
+            map_type* map_ = nullptr;
+            size_type pos_ = 0;
+        };
+
+    public:
+        using iterator = iterator_impl<false>;
+        using const_iterator = iterator_impl<true>;
+
+        ///////////////////////////////////////////////////////////////////////
+        open_addressing_map() = default;
+
+        explicit open_addressing_map(size_type bucket_count,
+            Hash const& hash = Hash(), KeyEqual const& equal = KeyEqual())
+          : hash_(hash)
+          , equal_(equal)
+        {
+            reserve(bucket_count);
+        }
+
+        open_addressing_map(open_addressing_map const& rhs)
+          : hash_(rhs.hash_)
+          , equal_(rhs.equal_)
+        {
+            if (rhs.size_ == 0)
+            {
+                return;
+            }
+
+            // the elements are copied into the same slots as they were
+            // stored in the source, erased slots have to be preserved as
+            // well as those may be part of probing sequences
+            allocate(rhs.capacity_);
+            try
+            {
+                for (size_type pos = 0; pos != capacity_; ++pos)
+                {
+                    if (rhs.ctrl_[pos] & occupied_bit)
+                    {
+                        ::new (static_cast<void*>(slots_ + pos))
+                            value_type(rhs.slots_[pos]);
+                        ++size_;
+                    }
+                    ctrl_[pos] = rhs.ctrl_[pos];
+                }
+                erased_ = rhs.erased_;
+            }
+            catch (...)
+            {
+                destroy_and_deallocate();
+                throw;
+            }
+        }
+
+        open_addressing_map(open_addressing_map&& rhs) noexcept
+          : hash_(HPX_MOVE(rhs.hash_))
+          , equal_(HPX_MOVE(rhs.equal_))
+          , ctrl_(HPX_MOVE(rhs.ctrl_))
+          , slots_(rhs.slots_)
+          , capacity_(rhs.capacity_)
+          , size_(rhs.size_)
+          , erased_(rhs.erased_)
+        {
+            rhs.slots_ = nullptr;
+            rhs.capacity_ = rhs.size_ = rhs.erased_ = 0;
+        }
+
+        open_addressing_map& operator=(open_addressing_map const& rhs)
+        {
+            if (this != &rhs)
+            {
+                open_addressing_map tmp(rhs);
+                swap(tmp);
+            }
+            return *this;
+        }
+
+        open_addressing_map& operator=(open_addressing_map&& rhs) noexcept
+        {
+            if (this != &rhs)
+            {
+                open_addressing_map tmp(HPX_MOVE(rhs));
+                swap(tmp);
+            }
+            return *this;
+        }
+
+        ~open_addressing_map()
+        {
+            destroy_and_deallocate();
+        }
+
+        void swap(open_addressing_map& rhs) noexcept
+        {
+            using std::swap;
+            swap(hash_, rhs.hash_);
+            swap(equal_, rhs.equal_);
+            swap(ctrl_, rhs.ctrl_);
+            swap(slots_, rhs.slots_);
+            swap(capacity_, rhs.capacity_);
+            swap(size_, rhs.size_);
+            swap(erased_, rhs.erased_);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        iterator begin() noexcept
+        {
+            iterator it(this, 0);
+            it.skip_free_slots();
+            return it;
+        }
+        const_iterator begin() const noexcept
+        {
+            const_iterator it(this, 0);
+            it.skip_free_slots();
+            return it;
+        }
+        const_iterator cbegin() const noexcept
+        {
+            return begin();
+        }
+
+        iterator end() noexcept
+        {
+            return iterator(this, capacity_);
+        }
+        const_iterator end() const noexcept
+        {
+            return const_iterator(this, capacity_);
+        }
+        const_iterator cend() const noexcept
+        {
+            return end();
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        size_type size() const noexcept
+        {
+            return size_;
+        }
+
+        bool empty() const noexcept
+        {
+            return size_ == 0;
+        }
+
+        size_type max_size() const noexcept
+        {
+            return (std::numeric_limits<difference_type>::max)() /
+                sizeof(value_type);
+        }
+
+        /// Returns the number of slots currently allocated
+        size_type capacity() const noexcept
+        {
+            return capacity_;
+        }
+
+        hasher hash_function() const
+        {
+            return hash_;
+        }
+
+        key_equal key_eq() const
+        {
+            return equal_;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        iterator find(Key const& key)
+        {
+            return iterator(this, find_index(key));
+        }
+
+        const_iterator find(Key const& key) const
+        {
+            return const_iterator(this, find_index(key));
+        }
+
+        size_type count(Key const& key) const
+        {
+            return find_index(key) != capacity_ ? 1 : 0;
+        }
+
+        T& operator[](Key const& key)
+        {
+            return try_emplace(key).first->second;
+        }
+
+        template <typename... Ts>
+        std::pair<iterator, bool> try_emplace(Key const& key, Ts&&... ts)
+        {
+            reserve_for_insertion();
+
+            std::size_t const h = hash_of(key);
+            std::uint8_t const tag = tag_of(h);
+            size_type const mask = capacity_ - 1;
+
+            // look for the key and remember the first free slot on the way
+            size_type insert_pos = capacity_;
+            for (size_type pos = h & mask; /**/; pos = (pos + 1) & mask)
+            {
+                std::uint8_t const c = ctrl_[pos];
+                if (c == empty_slot)
+                {
+                    if (insert_pos == capacity_)
+                        insert_pos = pos;
+                    break;
+                }
+                if (c == erased_slot)
+                {
+                    if (insert_pos == capacity_)
+                        insert_pos = pos;
+                }
+                else if (c == tag && equal_(slots_[pos].first, key))
+                {
+                    return {iterator(this, pos), false};
+                }
+            }
+
+            ::new (static_cast<void*>(slots_ + insert_pos))
+                value_type(std::piecewise_construct, std::forward_as_tuple(key),
+                    std::forward_as_tuple(HPX_FORWARD(Ts, ts)...));
+
+            if (ctrl_[insert_pos] == erased_slot)
+                --erased_;
+            ctrl_[insert_pos] = tag;
+            ++size_;
+
+            return {iterator(this, insert_pos), true};
+        }
+
+        template <typename M>
+        std::pair<iterator, bool> insert_or_assign(Key const& key, M&& obj)
+        {
+            auto result = try_emplace(key, HPX_FORWARD(M, obj));
+            if (!result.second)
+            {
+                result.first->second = HPX_FORWARD(M, obj);
+            }
+            return result;
+        }
+
+        std::pair<iterator, bool> insert(value_type const& value)
+        {
+            return try_emplace(value.first, value.second);
+        }
+
+        size_type erase(Key const& key)
+        {
+            size_type const pos = find_index(key);
+            if (pos == capacity_)
+            {
+                return 0;
+            }
+
+            slots_[pos].~value_type();
+            --size_;
+
+            // A slot followed by an empty slot is not part of any probing
+            // sequence and can be marked as being empty right away.
+            if (ctrl_[(pos + 1) & (capacity_ - 1)] == empty_slot)
+            {
+                ctrl_[pos] = empty_slot;
+            }
+            else
+            {
+                ctrl_[pos] = erased_slot;
+                ++erased_;
+            }
+            return 1;
+        }
+
+        void clear() noexcept
+        {
+            destroy_elements();
+            if (capacity_ != 0)
+            {
+                std::memset(ctrl_.get(), empty_slot, capacity_);
+            }
+            size_ = 0;
+            erased_ = 0;
+        }
+
+        /// Make sure that at least \a count elements can be stored without
+        /// reallocation.
+        void reserve(size_type count)
+        {
+            size_type const capacity = capacity_for(count);
+            if (capacity > capacity_)
+            {
+                rehash(capacity);
+            }
+        }
+
+    private:
+        // keep at least an eighth of all slots empty
+        static constexpr bool exceeds_max_load(
+            size_type count, size_type capacity) noexcept
+        {
+            return count * 8 > capacity * 7;
+        }
+
+        static size_type capacity_for(size_type count) noexcept
+        {
+            size_type capacity = min_capacity;
+            while (exceeds_max_load(count, capacity))
+            {
+                capacity <<= 1;
+            }
+            return capacity;
+        }
+
+        // std::hash is the identity for integral types on most platforms,
+        // make sure that the lower bits used for selecting the slot depend on
+        // all bits of the hash value
+        std::size_t hash_of(Key const& key) const
+        {
+            std::uint64_t h = static_cast<std::uint64_t>(hash_(key));
+            h ^= h >> 33;
+            h *= 0xff51afd7ed558ccdull;
+            h ^= h >> 33;
+            return static_cast<std::size_t>(h);
+        }
+
+        static constexpr std::uint8_t tag_of(std::size_t h) noexcept
+        {
+            return static_cast<std::uint8_t>(
+                occupied_bit | ((h >> (sizeof(std::size_t) * 8 - 7)) & 0x7f));
+        }
+
+        size_type find_index(Key const& key) const
+        {
+            if (size_ == 0)
+            {
+                return capacity_;
+            }
+
+            std::size_t const h = hash_of(key);
+            std::uint8_t const tag = tag_of(h);
+            size_type const mask = capacity_ - 1;
+
+            for (size_type pos = h & mask; /**/; pos = (pos + 1) & mask)
+            {
+                std::uint8_t const c = ctrl_[pos];
+                if (c == empty_slot)
+                {
+                    return capacity_;
+                }
+                if (c == tag && equal_(slots_[pos].first, key))
+                {
+                    return pos;
+                }
+            }
+        }
+
+        void reserve_for_insertion()
+        {
+            if (!exceeds_max_load(size_ + erased_ + 1, capacity_))
+            {
+                return;
+            }
+
+            // drop the erased slots without growing the table as long as
+            // those make up a sufficiently large part of the used slots
+            if (capacity_ != 0 && size_ * 32 <= capacity_ * 25)
+            {
+                rehash(capacity_);
+            }
+            else
+            {
+                rehash((std::max)(capacity_ * 2, capacity_for(size_ + 1)));
+            }
+        }
+
+        void rehash(size_type capacity)
+        {
+            HPX_ASSERT(capacity != 0 && (capacity & (capacity - 1)) == 0);
+
+            open_addressing_map tmp;
+            tmp.hash_ = hash_;
+            tmp.equal_ = equal_;
+            tmp.allocate(capacity);
+
+            size_type const mask = capacity - 1;
+            for (size_type i = 0; i != capacity_; ++i)
+            {
+                if (!(ctrl_[i] & occupied_bit))
+                {
+                    continue;
+                }
+
+                std::size_t const h = tmp.hash_of(slots_[i].first);
+
+                size_type pos = h & mask;
+                while (tmp.ctrl_[pos] != empty_slot)
+                {
+                    pos = (pos + 1) & mask;
+                }
+
+                ::new (static_cast<void*>(tmp.slots_ + pos))
+                    value_type(std::move_if_noexcept(slots_[i]));
+                tmp.ctrl_[pos] = ctrl_[i];
+                ++tmp.size_;
+            }
+
+            swap(tmp);
+        }
+
+        void allocate(size_type capacity)
+        {
+            HPX_ASSERT(slots_ == nullptr);
+
+            ctrl_.reset(new std::uint8_t[capacity]);
+            std::memset(ctrl_.get(), empty_slot, capacity);
+
+            slots_ = std::allocator<value_type>().allocate(capacity);
+            capacity_ = capacity;
+        }
+
+        void destroy_elements() noexcept
+        {
+            if (!std::is_trivially_destructible_v<value_type>)
+            {
+                for (size_type i = 0; i != capacity_ && size_ != 0; ++i)
+                {
+                    if (ctrl_[i] & occupied_bit)
+                    {
+                        slots_[i].~value_type();
+                    }
+                }
+            }
+        }
+
+        void destroy_and_deallocate() noexcept
+        {
+            if (slots_ != nullptr)
+            {
+                destroy_elements();
+                std::allocator<value_type>().deallocate(slots_, capacity_);
+                slots_ = nullptr;
+            }
+            ctrl_.reset();
+            capacity_ = size_ = erased_ = 0;
+        }
+
+        Hash hash_;
+        KeyEqual equal_;
+
+        std::unique_ptr<std::uint8_t[]> ctrl_;
+        value_type* slots_ = nullptr;
+        size_type capacity_ = 0;
+        size_type size_ = 0;
+        size_type erased_ = 0;
+    };
+}}    // namespace hpx::detail
+
+namespace hpx { namespace serialization {
+
+    template <typename Key, typename T, typename Hash, typename KeyEqual>
+    void serialize(input_archive& ar,
+        hpx::detail::open_addressing_map<Key, T, Hash, KeyEqual>& m, unsigned)
+    {
+        std::uint64_t size = 0;
+        ar >> size;    //-V128
+
+        m.clear();
+        m.reserve(static_cast<std::size_t>(size));
+        for (std::uint64_t i = 0; i != size; ++i)
+        {
+            Key key;
+            T value;
+            ar >> key >> value;
+            m.insert_or_assign(key, HPX_MOVE(value));
+        }
+    }
+
+    template <typename Key, typename T, typename Hash, typename KeyEqual>
+    void serialize(output_archive& ar,
+        hpx::detail::open_addressing_map<Key, T, Hash, KeyEqual> const& m,
+        unsigned)
+    {
+        std::uint64_t const size = m.size();
+        ar << size;
+
+        for (auto const& value : m)
+        {
+            ar << value.first << value.second;
+        }
+    }
+}}    // namespace hpx::serialization
@@ -12,7 +12,7 @@
 ///
 /// \brief The partition_unordered_map as the hpx component is defined here.
 ///
-/// The partition_unordered_map is the wrapper to the stl unordered_map class
+/// The partition_unordered_map is a wrapper to an open addressing hash map
 /// except all API'are defined as component action. All the API's in client
 /// classes are asynchronous API which return the futures.
 
@@ -29,6 +29,8 @@
 #include <hpx/components_base/server/component.hpp>
 #include <hpx/components_base/server/component_base.hpp>
 #include <hpx/components_base/server/locking_hook.hpp>
+#include <hpx/datastructures/optional.hpp>
+#include <hpx/datastructures/serialization/optional.hpp>
 #include <hpx/modules/collectives.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/functional.hpp>
@@ -36,21 +38,53 @@
 #include <hpx/preprocessor/expand.hpp>
 #include <hpx/preprocessor/nargs.hpp>
 #include <hpx/runtime_components/component_factory.hpp>
+#include <hpx/serialization/vector.hpp>
 #include <hpx/type_support/unused.hpp>
 
+#include <hpx/components/containers/unordered/open_addressing_map.hpp>
+
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <memory>
 #include <string>
 #include <tuple>
-#include <unordered_map>
 #include <utility>
 #include <vector>
 
 namespace hpx { namespace server {
-    /// \brief This is the basic wrapper class for stl unordered_map.
+
+    /// The result of a bulk lookup in a partition_unordered_map. Missing keys
+    /// are reported as empty optionals. The version of the partition at the
+    /// time of the lookup allows the caller to decide whether values cached
+    /// earlier are still valid.
+    template <typename T>
+    struct partition_unordered_map_find_result
+    {
+        std::vector<hpx::optional<T>> values;
+        std::uint64_t version = 0;
+
+    private:
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        void serialize(Archive& ar, unsigned)
+        {
+            // clang-format off
+            ar & values & version;
+            // clang-format on
+        }
+    };
+
+    /// \brief This is the basic wrapper class for the hash map storing the
+    ///        elements of one partition.
     ///
     /// This contain the implementation of the partition_unordered_map's
-    /// component functionality.
+    /// component functionality. The elements are stored in an open
+    /// addressing hash map. Every modification of the partition increments
+    /// its version, which is used by clients caching the values of remote
+    /// partitions to detect stale entries.
     template <typename Key, typename T, typename Hash = std::hash<Key>,
         typename KeyEqual = std::equal_to<Key>>
     class partition_unordered_map
@@ -58,7 +92,9 @@ namespace hpx { namespace server {
             partition_unordered_map<Key, T, Hash, KeyEqual>>>
     {
     public:
-        typedef std::unordered_map<Key, T, Hash, KeyEqual> data_type;
+        typedef hpx::detail::open_addressing_map<Key, T, Hash, KeyEqual>
+            data_type;
+        typedef partition_unordered_map_find_result<T> find_result_type;
 
         typedef typename data_type::size_type size_type;
         typedef typename data_type::iterator iterator_type;
@@ -70,6 +106,12 @@ namespace hpx { namespace server {
 
     private:
         data_type partition_unordered_map_;
+        std::atomic<std::uint64_t> version_{0};
+
+        void increment_version() noexcept
+        {
+            version_.fetch_add(1, std::memory_order_acq_rel);
+        }
 
     public:
         ///////////////////////////////////////////////////////////////////////
@@ -95,6 +137,7 @@ namespace hpx { namespace server {
         partition_unordered_map(partition_unordered_map const& rhs)
           : base_type(rhs)
           , partition_unordered_map_(rhs.partition_unordered_map_)
+          , version_(rhs.version_.load(std::memory_order_acquire))
         {
         }
 
@@ -104,6 +147,7 @@ namespace hpx { namespace server {
             {
                 this->base_type::operator=(rhs);
                 partition_unordered_map_ = rhs.partition_unordered_map_;
+                increment_version();
             }
             return *this;
         }
@@ -111,6 +155,7 @@ namespace hpx { namespace server {
         partition_unordered_map(partition_unordered_map&& rhs) noexcept
           : base_type(HPX_MOVE(rhs))
           , partition_unordered_map_(HPX_MOVE(rhs.partition_unordered_map_))
+          , version_(rhs.version_.load(std::memory_order_acquire))
         {
         }
 
@@ -122,6 +167,7 @@ namespace hpx { namespace server {
                 this->base_type::operator=(HPX_MOVE(rhs));
                 partition_unordered_map_ =
                     HPX_MOVE(rhs.partition_unordered_map_);
+                increment_version();
             }
             return *this;
         }
@@ -134,6 +180,13 @@ namespace hpx { namespace server {
         void set_copied_data(data_type&& d)
         {
             partition_unordered_map_ = HPX_MOVE(d);
+            increment_version();
+        }
+
+        /// Return the current version of this partition
+        std::uint64_t get_version() const
+        {
+            return version_.load(std::memory_order_acquire);
         }
 
         ///////////////////////////////////////////////////////////////////////
@@ -220,10 +273,11 @@ namespace hpx { namespace server {
             if (!erase)
                 return it->second;
 
-            auto on_exit = hpx::experimental::scope_exit(
-                [this, &it] { partition_unordered_map_.erase(it); });
+            T result = HPX_MOVE(it->second);
+            partition_unordered_map_.erase(key);
+            increment_version();
 
-            return it->second;
+            return result;
         }
 
         /// Return the element at the position \a pos in the partition_unordered_map
@@ -256,6 +310,34 @@ namespace hpx { namespace server {
             return result;
         }
 
+        /// Look up the values for all of the given keys in this partition.
+        ///
+        /// \param keys  The keys of the elements to look up
+        ///
+        /// \return Return the values of the elements (empty if the key was
+        ///         not found) and the version of the partition.
+        ///
+        find_result_type find_values(std::vector<Key> const& keys) const
+        {
+            find_result_type result;
+            result.values.reserve(keys.size());
+            result.version = version_.load(std::memory_order_acquire);
+
+            for (Key const& key : keys)
+            {
+                auto it = partition_unordered_map_.find(key);
+                if (it == partition_unordered_map_.end())
+                {
+                    result.values.emplace_back();
+                }
+                else
+                {
+                    result.values.emplace_back(it->second);
+                }
+            }
+            return result;
+        }
+
         ///////////////////////////////////////////////////////////////////////
         // Modifiers API's in server class
         ///////////////////////////////////////////////////////////////////////
@@ -269,7 +351,8 @@ namespace hpx { namespace server {
         ///
         void set_value(Key const& pos, T const& val)
         {
-            partition_unordered_map_[pos] = val;
+            partition_unordered_map_.insert_or_assign(pos, val);
+            increment_version();
         }
 
         /// Copy the value of \a val for the elements at positions \a pos in
@@ -282,10 +365,32 @@ namespace hpx { namespace server {
         void set_values(std::vector<Key> const& keys, std::vector<T> const& val)
         {
             HPX_ASSERT(keys.size() == val.size());
-            HPX_ASSERT(keys.size() <= partition_unordered_map_.size());
 
             for (std::size_t i = 0; i != keys.size(); ++i)
-                partition_unordered_map_[keys[i]] = val[i];
+                partition_unordered_map_.insert_or_assign(keys[i], val[i]);
+            increment_version();
+        }
+
+        /// Insert or assign the values \a vals for the keys \a keys in a
+        /// single step.
+        ///
+        /// \param keys  The keys of the elements to insert
+        /// \param vals  The values to be copied
+        ///
+        /// \return Return the version of the partition after the insertion.
+        ///         The version is incremented exactly once.
+        ///
+        std::uint64_t insert_values(
+            std::vector<Key> const& keys, std::vector<T> const& vals)
+        {
+            HPX_ASSERT(keys.size() == vals.size());
+
+            partition_unordered_map_.reserve(
+                partition_unordered_map_.size() + keys.size());
+            for (std::size_t i = 0; i != keys.size(); ++i)
+                partition_unordered_map_.insert_or_assign(keys[i], vals[i]);
+
+            return version_.fetch_add(1, std::memory_order_acq_rel) + 1;
         }
 
         /// Remove all elements from the vector leaving the
@@ -294,12 +399,16 @@ namespace hpx { namespace server {
         void clear()
         {
             partition_unordered_map_.clear();
+            increment_version();
         }
 
         /// Erase the given element
         std::size_t erase(Key const& key)
         {
-            return partition_unordered_map_.erase(key);
+            std::size_t const count = partition_unordered_map_.erase(key);
+            if (count != 0)
+                increment_version();
+            return count;
         }
 
         /// Macros to define HPX component actions for all exported functions.
@@ -307,9 +416,13 @@ namespace hpx { namespace server {
 
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partition_unordered_map, get_value)
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partition_unordered_map, get_values)
+        HPX_DEFINE_COMPONENT_DIRECT_ACTION(partition_unordered_map, find_values)
+        HPX_DEFINE_COMPONENT_DIRECT_ACTION(partition_unordered_map, get_version)
 
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partition_unordered_map, set_value)
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partition_unordered_map, set_values)
+        HPX_DEFINE_COMPONENT_DIRECT_ACTION(
+            partition_unordered_map, insert_values)
 
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partition_unordered_map, erase)
 
@@ -352,12 +465,21 @@ namespace hpx { namespace server {
     HPX_REGISTER_ACTION_DECLARATION(                                           \
         HPX_PP_CAT(partition_unordered_map, __LINE__)::get_values_action,      \
         HPX_PP_CAT(__unordered_map_get_values_action_, name))                  \
+    HPX_REGISTER_ACTION_DECLARATION(                                           \
+        HPX_PP_CAT(partition_unordered_map, __LINE__)::find_values_action,     \
+        HPX_PP_CAT(__unordered_map_find_values_action_, name))                 \
+    HPX_REGISTER_ACTION_DECLARATION(                                           \
+        HPX_PP_CAT(partition_unordered_map, __LINE__)::get_version_action,     \
+        HPX_PP_CAT(__unordered_map_get_version_action_, name))                 \
     HPX_REGISTER_ACTION_DECLARATION(                                           \
         HPX_PP_CAT(partition_unordered_map, __LINE__)::set_value_action,       \
         HPX_PP_CAT(__unordered_map_set_value_action_, name))                   \
     HPX_REGISTER_ACTION_DECLARATION(                                           \
         HPX_PP_CAT(partition_unordered_map, __LINE__)::set_values_action,      \
         HPX_PP_CAT(__unordered_map_set_values_action_, name))                  \
+    HPX_REGISTER_ACTION_DECLARATION(                                           \
+        HPX_PP_CAT(partition_unordered_map, __LINE__)::insert_values_action,   \
+        HPX_PP_CAT(__unordered_map_insert_values_action_, name))               \
     HPX_REGISTER_ACTION_DECLARATION(                                           \
         HPX_PP_CAT(partition_unordered_map, __LINE__)::size_action,            \
         HPX_PP_CAT(__unordered_map_size_action_, name))                        \
@@ -409,12 +531,21 @@ namespace hpx { namespace server {
     HPX_REGISTER_ACTION(                                                       \
         HPX_PP_CAT(partition_unordered_map, __LINE__)::get_values_action,      \
         HPX_PP_CAT(__unordered_map_get_values_action_, name))                  \
+    HPX_REGISTER_ACTION(                                                       \
+        HPX_PP_CAT(partition_unordered_map, __LINE__)::find_values_action,     \
+        HPX_PP_CAT(__unordered_map_find_values_action_, name))                 \
+    HPX_REGISTER_ACTION(                                                       \
+        HPX_PP_CAT(partition_unordered_map, __LINE__)::get_version_action,     \
+        HPX_PP_CAT(__unordered_map_get_version_action_, name))                 \
     HPX_REGISTER_ACTION(                                                       \
         HPX_PP_CAT(partition_unordered_map, __LINE__)::set_value_action,       \
         HPX_PP_CAT(__unordered_map_set_value_action_, name))                   \
     HPX_REGISTER_ACTION(                                                       \
         HPX_PP_CAT(partition_unordered_map, __LINE__)::set_values_action,      \
         HPX_PP_CAT(__unordered_map_set_values_action_, name))                  \
+    HPX_REGISTER_ACTION(                                                       \
+        HPX_PP_CAT(partition_unordered_map, __LINE__)::insert_values_action,   \
+        HPX_PP_CAT(__unordered_map_insert_values_action_, name))               \
     HPX_REGISTER_ACTION(                                                       \
         HPX_PP_CAT(partition_unordered_map, __LINE__)::size_action,            \
         HPX_PP_CAT(__unordered_map_size_action_, name))                        \
@@ -664,6 +795,77 @@ namespace hpx {
                 this->get_id(), key);
         }
 
+        /// Look up the values for all of the given keys in the
+        /// partition_unordered_map component.
+        ///
+        /// \param keys  The keys of the elements to look up
+        ///
+        /// \return This returns the values (empty if the key was not found)
+        ///         and the version of the partition
+        ///
+        typename server_type::find_result_type find_values(
+            launch::sync_policy, std::vector<Key> const& keys) const
+        {
+            return find_values(keys).get();
+        }
+
+        /// Look up the values for all of the given keys in the
+        /// partition_unordered_map component.
+        ///
+        /// \param keys  The keys of the elements to look up
+        ///
+        /// \return This returns the hpx::future holding the values (empty if
+        ///         the key was not found) and the version of the partition
+        ///
+        future<typename server_type::find_result_type> find_values(
+            std::vector<Key> const& keys) const
+        {
+            HPX_ASSERT(this->get_id());
+            return hpx::async<typename server_type::find_values_action>(
+                this->get_id(), keys);
+        }
+
+        /// Insert or assign the values \a vals for the keys \a keys in the
+        /// partition_unordered_map component.
+        ///
+        /// \param keys  The keys of the elements to insert
+        /// \param vals  The values to be copied
+        ///
+        /// \return This returns the version of the partition after the
+        ///         insertion
+        ///
+        std::uint64_t insert_values(launch::sync_policy,
+            std::vector<Key> const& keys, std::vector<T> const& vals)
+        {
+            return insert_values(keys, vals).get();
+        }
+
+        /// Insert or assign the values \a vals for the keys \a keys in the
+        /// partition_unordered_map component.
+        ///
+        /// \param keys  The keys of the elements to insert
+        /// \param vals  The values to be copied
+        ///
+        /// \return This returns the hpx::future holding the version of the
+        ///         partition after the insertion
+        ///
+        future<std::uint64_t> insert_values(
+            std::vector<Key> const& keys, std::vector<T> const& vals)
+        {
+            HPX_ASSERT(this->get_id());
+            return hpx::async<typename server_type::insert_values_action>(
+                this->get_id(), keys, vals);
+        }
+
+        /// Return the version of the partition_unordered_map component. The
+        /// version is incremented on every modification of the partition.
+        future<std::uint64_t> get_version() const
+        {
+            HPX_ASSERT(this->get_id());
+            return hpx::async<typename server_type::get_version_action>(
+                this->get_id());
+        }
+
         /// Get/set all the data of this partition
         future<typename server_type::data_type> get_data() const
         {
@@ -12,9 +12,11 @@
 #include <hpx/actions_base/traits/is_distribution_policy.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/async_combinators/wait_all.hpp>
+#include <hpx/async_combinators/when_all.hpp>
 #include <hpx/components/client_base.hpp>
 #include <hpx/components/get_ptr.hpp>
 #include <hpx/components_base/component_type.hpp>
+#include <hpx/datastructures/optional.hpp>
 #include <hpx/distribution_policies/container_distribution_policy.hpp>
 #include <hpx/functional/bind_front.hpp>
 #include <hpx/runtime_components/distributed_metadata_base.hpp>
@@ -23,8 +25,10 @@
 #include <hpx/serialization/serialize.hpp>
 #include <hpx/serialization/unordered_map.hpp>
 #include <hpx/serialization/vector.hpp>
+#include <hpx/synchronization/spinlock.hpp>
 #include <hpx/type_support/unused.hpp>
 
+#include <hpx/components/containers/unordered/open_addressing_map.hpp>
 #include <hpx/components/containers/unordered/partition_unordered_map_component.hpp>
 #include <hpx/components/containers/unordered/unordered_map_segmented_iterator.hpp>
 
@@ -32,6 +36,7 @@
 #include <cstdint>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <type_traits>
 #include <utility>
@@ -333,6 +338,157 @@ namespace hpx {
         // global ID's of the underlying partitioned_vector_partitions.
         partitions_vector_type partitions_;
 
+        // The values read from a remote partition are cached locally if
+        // caching is enabled. The cache of a partition is valid for one
+        // version of that partition only, it is dropped as soon as a newer
+        // version of the partition is observed.
+        struct partition_cache
+        {
+            typedef hpx::detail::open_addressing_map<Key, T,
+                detail::unordered_hasher<Hash>,
+                detail::unordered_comparator<KeyEqual>>
+                cache_data_type;
+
+            partition_cache(detail::unordered_hasher<Hash> const& hasher,
+                detail::unordered_comparator<KeyEqual> const& equal)
+              : values_(0, hasher, equal)
+            {
+            }
+
+            hpx::optional<T> find(Key const& key)
+            {
+                std::lock_guard<hpx::spinlock> l(mtx_);
+                auto it = values_.find(key);
+                if (it == values_.end())
+                    return hpx::optional<T>();
+                return hpx::optional<T>(it->second);
+            }
+
+            void erase(Key const& key)
+            {
+                std::lock_guard<hpx::spinlock> l(mtx_);
+                values_.erase(key);
+            }
+
+            void erase(std::vector<Key> const& keys)
+            {
+                std::lock_guard<hpx::spinlock> l(mtx_);
+                for (Key const& key : keys)
+                    values_.erase(key);
+            }
+
+            // Drop all cached values if the given version is newer than the
+            // version of the cached values. Returns false if the given
+            // version is older than the cached values.
+            bool synchronize(std::uint64_t version)
+            {
+                if (has_version_ && version < version_)
+                    return false;
+
+                if (!has_version_ || version != version_)
+                {
+                    values_.clear();
+                    version_ = version;
+                    has_version_ = true;
+                }
+                return true;
+            }
+
+            void validate(std::uint64_t version)
+            {
+                std::lock_guard<hpx::spinlock> l(mtx_);
+                synchronize(version);
+            }
+
+            // Store the result of a lookup in the partition
+            void update(std::vector<Key> const& keys,
+                typename partition_unordered_map_server::find_result_type const&
+                    result)
+            {
+                std::lock_guard<hpx::spinlock> l(mtx_);
+                if (!synchronize(result.version))
+                    return;
+
+                for (std::size_t i = 0; i != keys.size(); ++i)
+                {
+                    if (result.values[i])
+                        values_.insert_or_assign(keys[i], *result.values[i]);
+                }
+            }
+
+            // Store the values written by this client. The cached values
+            // remain valid only if no other modification of the partition
+            // happened in between.
+            void update(std::vector<Key> const& keys,
+                std::vector<T> const& vals, std::uint64_t version)
+            {
+                std::lock_guard<hpx::spinlock> l(mtx_);
+                if (!has_version_ || version != version_ + 1)
+                {
+                    if (has_version_ && version <= version_)
+                        return;
+                    values_.clear();
+                }
+                version_ = version;
+                has_version_ = true;
+
+                for (std::size_t i = 0; i != keys.size(); ++i)
+                    values_.insert_or_assign(keys[i], vals[i]);
+            }
+
+            void clear()
+            {
+                std::lock_guard<hpx::spinlock> l(mtx_);
+                values_.clear();
+                has_version_ = false;
+            }
+
+            hpx::spinlock mtx_;
+            std::uint64_t version_ = 0;
+            bool has_version_ = false;
+            cache_data_type values_;
+        };
+
+        // The caches for all partitions, empty if caching is disabled. Local
+        // partitions are never cached.
+        std::vector<std::shared_ptr<partition_cache>> caches_;
+
+        std::shared_ptr<partition_cache> get_cache(size_type part) const
+        {
+            if (caches_.empty())
+                return std::shared_ptr<partition_cache>();
+            return caches_[part];
+        }
+
+        void reset_caches(bool enable)
+        {
+            caches_.clear();
+            if (!enable)
+                return;
+
+            caches_.reserve(partitions_.size());
+            for (partition_data const& part_data : partitions_)
+            {
+                if (part_data.local_data_)
+                {
+                    caches_.emplace_back();
+                }
+                else
+                {
+                    caches_.push_back(std::make_shared<partition_cache>(
+                        this->hasher_, this->equal_));
+                }
+            }
+        }
+
+        [[noreturn]] static void throw_key_not_found()
+        {
+            HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                "unordered_map::get_value",
+                "unable to find requested key in this partition of the "
+                "unordered_map");
+        }
+
         ///////////////////////////////////////////////////////////////////////
         // Connect this unordered_map to the existing unordered_mapusing the
         // given symbolic name.
@@ -343,6 +499,7 @@ namespace hpx {
 
             std::move(data.partitions_.begin(), data.partitions_.end(),
                 std::back_inserter(partitions_));
+            reset_caches(!caches_.empty());
 
             base_type::reset(HPX_MOVE(id));
         }
@@ -499,6 +656,7 @@ namespace hpx {
             hpx::wait_all(ptrs);
 
             std::swap(partitions_, partitions);
+            reset_caches(rhs.is_caching_enabled());
         }
 
     public:
@@ -597,6 +755,7 @@ namespace hpx {
           : base_type(HPX_MOVE(static_cast<base_type&&>(rhs)))
           , hash_base_type(HPX_MOVE(static_cast<hash_base_type&&>(rhs)))
           , partitions_(HPX_MOVE(rhs.partitions_))
+          , caches_(HPX_MOVE(rhs.caches_))
         {
         }
 
@@ -616,6 +775,7 @@ namespace hpx {
                     HPX_MOVE(static_cast<hash_base_type&&>(rhs)));
 
                 partitions_ = HPX_MOVE(rhs.partitions_);
+                caches_ = HPX_MOVE(rhs.caches_);
             }
             return *this;
         }
@@ -680,6 +840,9 @@ namespace hpx {
             if (part_data.local_data_)
                 return part_data.local_data_->get_value(pos, erase);
 
+            if (!caches_.empty())
+                return get_value(part, pos, erase).get();
+
             return partition_unordered_map_client(part_data.partition_)
                 .get_value(launch::sync, pos, erase);
         }
@@ -717,8 +880,37 @@ namespace hpx {
                     partitions_[part].local_data_->get_value(pos, erase));
             }
 
+            std::shared_ptr<partition_cache> cache = get_cache(part);
+            if (!cache)
+            {
+                return partition_unordered_map_client(
+                    partitions_[part].partition_)
+                    .get_value(pos, erase);
+            }
+
+            if (erase)
+            {
+                cache->erase(pos);
+                return partition_unordered_map_client(
+                    partitions_[part].partition_)
+                    .get_value(pos, erase);
+            }
+
+            if (hpx::optional<T> value = cache->find(pos))
+                return make_ready_future(HPX_MOVE(*value));
+
+            std::vector<Key> keys(1, pos);
             return partition_unordered_map_client(partitions_[part].partition_)
-                .get_value(pos, erase);
+                .find_values(keys)
+                .then([cache = HPX_MOVE(cache), keys](
+                          future<typename partition_unordered_map_server::
+                                  find_result_type>&& f) -> T {
+                    auto result = f.get();
+                    cache->update(keys, result);
+                    if (!result.values[0])
+                        throw_key_not_found();
+                    return HPX_MOVE(*result.values[0]);
+                });
         }
 
         /// Copy the value of \a val in the element at position \a pos in
@@ -754,6 +946,8 @@ namespace hpx {
             }
             else
             {
+                if (!caches_.empty())
+                    caches_[part]->erase(pos);
                 partition_unordered_map_client(part_data.partition_)
                     .set_value(launch::sync, pos, HPX_FORWARD(T_, val));
             }
@@ -796,10 +990,280 @@ namespace hpx {
                 return make_ready_future();
             }
 
+            if (!caches_.empty())
+                caches_[part]->erase(pos);
+
             return partition_unordered_map_client(part_data.partition_)
                 .set_value(pos, HPX_FORWARD(T_, val));
         }
 
+        /// Insert or assign the \a count key/value pairs starting at \a first
+        /// into the unordered_map container.
+        ///
+        /// \param first  Iterator referring to the first key/value pair, the
+        ///               referenced objects must expose the members \a first
+        ///               (the key) and \a second (the value)
+        /// \param count  Number of key/value pairs to insert
+        ///
+        /// \note The keys are grouped by partition and all keys belonging
+        ///       to the same remote partition are sent using a single action.
+        ///
+        template <typename InIter>
+        void insert_n(launch::sync_policy, InIter first, std::size_t count)
+        {
+            insert_n(first, count).get();
+        }
+
+        /// Asynchronously insert or assign the \a count key/value pairs
+        /// starting at \a first into the unordered_map container.
+        ///
+        /// \param first  Iterator referring to the first key/value pair, the
+        ///               referenced objects must expose the members \a first
+        ///               (the key) and \a second (the value)
+        /// \param count  Number of key/value pairs to insert
+        ///
+        /// \return This returns the hpx::future of type void which gets ready
+        ///         once all values have been inserted.
+        ///
+        template <typename InIter>
+        future<void> insert_n(InIter first, std::size_t count)
+        {
+            std::vector<std::vector<Key>> keys(partitions_.size());
+            std::vector<std::vector<T>> vals(partitions_.size());
+            for (std::size_t i = 0; i != count; ++i, ++first)
+            {
+                auto const& kv = *first;
+                std::size_t const part = get_partition(kv.first);
+                keys[part].push_back(kv.first);
+                vals[part].push_back(kv.second);
+            }
+
+            std::vector<future<void>> results;
+            for (std::size_t part = 0; part != partitions_.size(); ++part)
+            {
+                if (keys[part].empty())
+                    continue;
+
+                partition_data const& part_data = partitions_[part];
+                if (part_data.local_data_)
+                {
+                    part_data.local_data_->insert_values(
+                        keys[part], vals[part]);
+                    continue;
+                }
+
+                std::shared_ptr<partition_cache> cache = get_cache(part);
+                if (!cache)
+                {
+                    results.push_back(
+                        partition_unordered_map_client(part_data.partition_)
+                            .insert_values(keys[part], vals[part])
+                            .then([](future<std::uint64_t>&& f) { f.get(); }));
+                    continue;
+                }
+
+                // make sure the old values are not seen anymore while the
+                // insertion is in flight
+                cache->erase(keys[part]);
+                results.push_back(
+                    partition_unordered_map_client(part_data.partition_)
+                        .insert_values(keys[part], vals[part])
+                        .then([cache = HPX_MOVE(cache),
+                                  keys = HPX_MOVE(keys[part]),
+                                  vals = HPX_MOVE(vals[part])](
+                                  future<std::uint64_t>&& f) {
+                            cache->update(keys, vals, f.get());
+                        }));
+            }
+
+            if (results.empty())
+                return make_ready_future();
+
+            return hpx::when_all(results).then(
+                [](future<std::vector<future<void>>>&& f) {
+                    for (future<void>& r : f.get())
+                        r.get();    // rethrow exceptions
+                });
+        }
+
+        /// Look up the values of the \a count keys starting at \a first in
+        /// the unordered_map container.
+        ///
+        /// \param first  Iterator referring to the first key to look up
+        /// \param count  Number of keys to look up
+        ///
+        /// \return Returns the values of the elements in the order of the
+        ///         given keys. The value for keys which were not found is
+        ///         empty.
+        ///
+        template <typename InIter>
+        std::vector<hpx::optional<T>> find_n(
+            launch::sync_policy, InIter first, std::size_t count) const
+        {
+            return find_n(first, count).get();
+        }
+
+        /// Asynchronously look up the values of the \a count keys starting
+        /// at \a first in the unordered_map container.
+        ///
+        /// \param first  Iterator referring to the first key to look up
+        /// \param count  Number of keys to look up
+        ///
+        /// \return Returns the hpx::future to the values of the elements in
+        ///         the order of the given keys. The value for keys which were
+        ///         not found is empty.
+        ///
+        /// \note The keys are grouped by partition and all keys belonging
+        ///       to the same remote partition are sent using a single action.
+        ///       Keys found in the local cache are not sent at all.
+        ///
+        template <typename InIter>
+        future<std::vector<hpx::optional<T>>> find_n(
+            InIter first, std::size_t count) const
+        {
+            typedef typename partition_unordered_map_server::find_result_type
+                find_result_type;
+
+            auto values =
+                std::make_shared<std::vector<hpx::optional<T>>>(count);
+
+            std::vector<std::vector<Key>> keys(partitions_.size());
+            std::vector<std::vector<std::size_t>> indices(partitions_.size());
+            for (std::size_t i = 0; i != count; ++i, ++first)
+            {
+                Key const& key = *first;
+                std::size_t const part = get_partition(key);
+
+                if (!caches_.empty() && caches_[part])
+                {
+                    (*values)[i] = caches_[part]->find(key);
+                    if ((*values)[i])
+                        continue;
+                }
+
+                keys[part].push_back(key);
+                indices[part].push_back(i);
+            }
+
+            std::vector<future<void>> results;
+            for (std::size_t part = 0; part != partitions_.size(); ++part)
+            {
+                if (keys[part].empty())
+                    continue;
+
+                partition_data const& part_data = partitions_[part];
+                if (part_data.local_data_)
+                {
+                    find_result_type result =
+                        part_data.local_data_->find_values(keys[part]);
+                    for (std::size_t i = 0; i != indices[part].size(); ++i)
+                    {
+                        (*values)[indices[part][i]] =
+                            HPX_MOVE(result.values[i]);
+                    }
+                    continue;
+                }
+
+                results.push_back(
+                    partition_unordered_map_client(part_data.partition_)
+                        .find_values(keys[part])
+                        .then([values, cache = get_cache(part),
+                                  keys = HPX_MOVE(keys[part]),
+                                  indices = HPX_MOVE(indices[part])](
+                                  future<find_result_type>&& f) {
+                            find_result_type result = f.get();
+                            if (cache)
+                                cache->update(keys, result);
+                            for (std::size_t i = 0; i != indices.size(); ++i)
+                            {
+                                (*values)[indices[i]] =
+                                    HPX_MOVE(result.values[i]);
+                            }
+                        }));
+            }
+
+            if (results.empty())
+                return make_ready_future(HPX_MOVE(*values));
+
+            return hpx::when_all(results).then(
+                [values = HPX_MOVE(values)](
+                    future<std::vector<future<void>>>&& f) {
+                    for (future<void>& r : f.get())
+                        r.get();    // rethrow exceptions
+                    return HPX_MOVE(*values);
+                });
+        }
+
+        /// Enable or disable caching of the values read from remote
+        /// partitions.
+        ///
+        /// \param enable  Whether values read from remote partitions should
+        ///                be cached locally
+        ///
+        /// \note The cache is weakly consistent. Every partition maintains a
+        ///       version which is incremented on each modification. Cached
+        ///       values of a partition are dropped whenever a newer version
+        ///       of that partition is observed, i.e. while looking up keys
+        ///       which are not cached or while calling \a validate_cache.
+        ///       Modifications made by other clients may therefore not be
+        ///       visible until then. Modifications made through this client
+        ///       are always visible.
+        ///
+        void enable_caching(bool enable = true)
+        {
+            if (enable != is_caching_enabled())
+                reset_caches(enable);
+        }
+
+        /// Return whether values read from remote partitions are cached
+        bool is_caching_enabled() const
+        {
+            return !caches_.empty();
+        }
+
+        /// Drop all cached values
+        void clear_cache()
+        {
+            for (auto& cache : caches_)
+            {
+                if (cache)
+                    cache->clear();
+            }
+        }
+
+        /// Asynchronously query the version of all remote partitions and
+        /// drop all cached values which are outdated.
+        ///
+        /// \return This returns the hpx::future of type void which gets ready
+        ///         once all caches have been validated.
+        ///
+        future<void> validate_cache()
+        {
+            std::vector<future<void>> results;
+            for (std::size_t part = 0; part != caches_.size(); ++part)
+            {
+                if (!caches_[part])
+                    continue;
+
+                results.push_back(
+                    partition_unordered_map_client(partitions_[part].partition_)
+                        .get_version()
+                        .then([cache = caches_[part]](
+                                  future<std::uint64_t>&& f) {
+                            cache->validate(f.get());
+                        }));
+            }
+
+            if (results.empty())
+                return make_ready_future();
+
+            return hpx::when_all(results).then(
+                [](future<std::vector<future<void>>>&& f) {
+                    for (future<void>& r : f.get())
+                        r.get();    // rethrow exceptions
+                });
+        }
+
         /// Asynchronously compute the size of the unordered_map.
         ///
         /// \return Return the number of elements in the unordered_map
@@ -849,6 +1313,9 @@ namespace hpx {
             if (part_data.local_data_)
                 return part_data.local_data_->erase(key);
 
+            if (!caches_.empty())
+                caches_[part]->erase(key);
+
             return partition_unordered_map_client(part_data.partition_)
                 .erase(launch::sync, key);
         }
@@ -874,6 +1341,9 @@ namespace hpx {
             if (part_data.local_data_)
                 return make_ready_future(part_data.local_data_->erase(key));
 
+            if (!caches_.empty())
+                caches_[part]->erase(key);
+
             return partition_unordered_map_client(part_data.partition_)
                 .erase(key);
         }
@@ -0,0 +1,156 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures the throughput of the element access operations of
+// hpx::unordered_map. Every locality accesses the elements of a map spread
+// over all localities using single element operations, bulk operations, and
+// cached lookups and reports the achieved operations per second.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+
+#include <hpx/include/unordered_map.hpp>
+#include <hpx/modules/collectives.hpp>
+#include <hpx/modules/format.hpp>
+#include <hpx/modules/program_options.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// Define the map types to be used.
+HPX_REGISTER_UNORDERED_MAP(std::uint64_t, double)
+
+using map_type = hpx::unordered_map<std::uint64_t, double>;
+
+char const* const map_name = "/unordered_map_throughput/map";
+char const* const barrier_name = "/unordered_map_throughput/barrier";
+
+///////////////////////////////////////////////////////////////////////////////
+void report(char const* name, std::size_t ops, double elapsed)
+{
+    std::cout << hpx::util::format("locality {1}: {2}: {3} ops/s\n",
+                     hpx::get_locality_id(), name,
+                     elapsed != 0.0 ? static_cast<double>(ops) / elapsed : 0.0)
+              << std::flush;
+}
+
+template <typename F>
+void measure(hpx::distributed::barrier& b, char const* name, std::size_t ops,
+    F&& f)
+{
+    b.wait();
+
+    hpx::chrono::high_resolution_timer t;
+    f();
+    report(name, ops, t.elapsed());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t const num_keys = vm["num_keys"].as<std::size_t>();
+    std::size_t const batch_size =
+        (std::max)(vm["batch_size"].as<std::size_t>(), std::size_t(1));
+
+    std::uint32_t const locality_id = hpx::get_locality_id();
+    hpx::distributed::barrier b(barrier_name);
+
+    map_type m(hpx::container_layout(hpx::find_all_localities()));
+    if (locality_id == 0)
+    {
+        m.register_as(map_name).get();
+        b.wait();
+    }
+    else
+    {
+        b.wait();
+        m.connect_to(map_name).get();
+    }
+
+    // every locality works on its own range of keys, which are spread over
+    // all partitions
+    std::vector<std::uint64_t> keys(num_keys);
+    std::vector<std::pair<std::uint64_t, double>> values(num_keys);
+    for (std::size_t i = 0; i != num_keys; ++i)
+    {
+        keys[i] = locality_id * num_keys + i;
+        values[i] = std::make_pair(keys[i], static_cast<double>(i));
+    }
+
+    measure(b, "set_value", num_keys, [&] {
+        for (auto const& value : values)
+            m.set_value(hpx::launch::sync, value.first, value.second);
+    });
+
+    measure(b, "get_value", num_keys, [&] {
+        for (std::uint64_t key : keys)
+            m.get_value(hpx::launch::sync, key);
+    });
+
+    measure(b, "insert_n", num_keys, [&] {
+        for (std::size_t i = 0; i < num_keys; i += batch_size)
+        {
+            m.insert_n(hpx::launch::sync, values.begin() + i,
+                (std::min)(batch_size, num_keys - i));
+        }
+    });
+
+    measure(b, "find_n", num_keys, [&] {
+        for (std::size_t i = 0; i < num_keys; i += batch_size)
+        {
+            m.find_n(hpx::launch::sync, keys.begin() + i,
+                (std::min)(batch_size, num_keys - i));
+        }
+    });
+
+    // the first pass fills the cache, the second pass is measured
+    m.enable_caching();
+    for (std::uint64_t key : keys)
+        m.get_value(hpx::launch::sync, key);
+
+    measure(b, "get_value (cached)", num_keys, [&] {
+        for (std::uint64_t key : keys)
+            m.get_value(hpx::launch::sync, key);
+    });
+
+    b.wait();
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+
+    options_description cmdline("usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("num_keys", value<std::size_t>()->default_value(10000),
+            "number of keys accessed by each locality (default: 10000)")
+        ("batch_size", value<std::size_t>()->default_value(1000),
+            "number of keys per bulk operation (default: 1000)")
+        ;
+    // clang-format on
+
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=all", "hpx.run_hpx_main!=1"};
+
+    hpx::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+    init_args.cfg = cfg;
+
+    return hpx::init(argc, argv, init_args);
+}
+#endif
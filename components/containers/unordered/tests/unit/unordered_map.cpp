@@ -18,6 +18,7 @@
 #include <iostream>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -153,6 +154,75 @@ void trivial_tests()
     }
 }
 
+///////////////////////////////////////////////////////////////////////////////
+template <typename Key, typename Value>
+void test_find_n(hpx::unordered_map<Key, Value> const& m,
+    std::vector<Key> const& keys, std::size_t count)
+{
+    std::vector<hpx::optional<Value>> found =
+        m.find_n(hpx::launch::sync, keys.begin(), keys.size());
+    HPX_TEST_EQ(found.size(), keys.size());
+
+    for (std::size_t i = 0; i != keys.size(); ++i)
+    {
+        HPX_TEST_EQ(static_cast<bool>(found[i]), i < count);
+        if (found[i])
+        {
+            HPX_TEST_EQ(*found[i], Value(i));
+        }
+    }
+}
+
+template <typename Key, typename Value, typename DistPolicy>
+void bulk_tests(DistPolicy const& policy)
+{
+    hpx::unordered_map<Key, Value> m(17, policy);
+
+    std::vector<std::pair<Key, Value>> values;
+    std::vector<Key> keys;
+    for (std::size_t i = 0; i != 214; ++i)
+    {
+        if (i < 107)
+        {
+            values.emplace_back(std::to_string(i), Value(i));
+        }
+        keys.push_back(std::to_string(i));
+    }
+
+    m.insert_n(hpx::launch::sync, values.begin(), values.size());
+    HPX_TEST_EQ(m.size(), values.size());
+
+    test_find_n(m, keys, values.size());
+
+    // repeated lookups are served from the cache
+    m.enable_caching();
+    HPX_TEST(m.is_caching_enabled());
+
+    test_find_n(m, keys, values.size());
+    test_find_n(m, keys, values.size());
+
+    m.validate_cache().get();
+    test_find_n(m, keys, values.size());
+
+    // modifications made through the same client are visible immediately
+    m.set_value(hpx::launch::sync, keys[0], Value(-1));
+    HPX_TEST_EQ(m.get_value(hpx::launch::sync, keys[0]), Value(-1));
+
+    std::pair<Key, Value> value(keys[1], Value(-2));
+    m.insert_n(hpx::launch::sync, &value, 1);
+    HPX_TEST_EQ(m.get_value(hpx::launch::sync, keys[1]), Value(-2));
+
+    HPX_TEST_EQ(m.erase(hpx::launch::sync, keys[2]), std::size_t(1));
+    std::vector<hpx::optional<Value>> found =
+        m.find_n(hpx::launch::sync, keys.begin(), 3);
+    HPX_TEST(!found[2]);
+
+    m.clear_cache();
+    m.enable_caching(false);
+    HPX_TEST(!m.is_caching_enabled());
+    HPX_TEST_EQ(m.get_value(hpx::launch::sync, keys[0]), Value(-1));
+}
+
 int main()
 {
     trivial_tests<std::string, double>();
@@ -164,6 +234,9 @@ int main()
     trivial_tests<std::string, double>(hpx::container_layout(3, localities));
     trivial_tests<std::string, double>(hpx::container_layout(localities));
 
+    bulk_tests<std::string, double>(hpx::container_layout);
+    bulk_tests<std::string, double>(hpx::container_layout(3, localities));
+
     return 0;
 }
 #endif
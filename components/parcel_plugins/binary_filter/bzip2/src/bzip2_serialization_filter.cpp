@@ -174,11 +174,16 @@ namespace hpx::plugins::compression {
     bool bzip2_serialization_filter::flush(
         void* dst, std::size_t dst_count, std::size_t& written)
     {
-        // compress everything in one go
+        // Compress everything in one go. If the destination is too small,
+        // the data compressed so far has been written and we will be called
+        // again with more space, continue where the last call left off.
         char* dst_begin = static_cast<char*>(dst);
-        char const* src_begin = buffer_.data();
-        bool eof = compdecomp_.save(src_begin, src_begin + buffer_.size(),
-            dst_begin, dst_begin + dst_count, true);
+        char const* src_begin = buffer_.data() + current_;
+        bool eof = compdecomp_.save(src_begin,
+            buffer_.data() + buffer_.size(), dst_begin, dst_begin + dst_count,
+            true);
+        current_ = static_cast<std::size_t>(src_begin - buffer_.data());
+
         written = dst_begin - static_cast<char*>(dst);
         return !eof;
     }
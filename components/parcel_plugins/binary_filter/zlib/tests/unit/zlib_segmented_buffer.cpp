@@ -0,0 +1,98 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Compressing incompressible data makes the zlib filter run out of space in
+// the output container, it writes partial output and asks for more space.
+// The partial output has to be retained by the segmented buffer.
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE) && defined(HPX_HAVE_COMPRESSION_ZLIB)
+#include <hpx/include/compression_zlib.hpp>
+#include <hpx/modules/serialization.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/serialization/segmented_buffer.hpp>
+
+#include <cstddef>
+#include <random>
+#include <vector>
+
+std::vector<char> flatten(hpx::serialization::segmented_buffer const& buffer)
+{
+    std::vector<char> result;
+    result.reserve(buffer.size());
+    buffer.for_each_segment([&](char const* data, std::size_t size) {
+        result.insert(result.end(), data, data + size);
+    });
+    return result;
+}
+
+// returns the size of the uncompressed data
+template <typename Container>
+std::size_t compress(Container& buffer, std::vector<char> const& data)
+{
+    hpx::plugins::compression::zlib_serialization_filter filter(true);
+
+    hpx::serialization::output_archive oarchive(buffer,
+        hpx::serialization::archive_flags::enable_compression, nullptr,
+        &filter);
+    oarchive << data;
+    oarchive.flush();
+
+    return oarchive.bytes_written();
+}
+
+std::vector<char> decompress(
+    std::vector<char> const& buffer, std::size_t inbound_data_size)
+{
+    std::vector<char> data;
+    hpx::serialization::input_archive iarchive(buffer, inbound_data_size);
+    iarchive >> data;
+    return data;
+}
+
+void test_zlib_segmented_buffer(std::size_t size)
+{
+    std::mt19937 gen(static_cast<unsigned>(size));
+    std::uniform_int_distribution<int> dist(-128, 127);
+
+    std::vector<char> data(size);
+    for (char& c : data)
+    {
+        c = static_cast<char>(dist(gen));
+    }
+
+    std::vector<char> contiguous;
+    std::size_t const inbound_data_size = compress(contiguous, data);
+
+    hpx::serialization::segmented_buffer segmented;
+    HPX_TEST_EQ(compress(segmented, data), inbound_data_size);
+
+    // random data can't be compressed, the filter had to ask for more space
+    HPX_TEST_LT(data.size(), segmented.size());
+
+    std::vector<char> const flattened = flatten(segmented);
+    HPX_TEST(flattened == contiguous);
+
+    HPX_TEST(decompress(contiguous, inbound_data_size) == data);
+    HPX_TEST(decompress(flattened, inbound_data_size) == data);
+}
+
+int main()
+{
+    test_zlib_segmented_buffer(1000);
+    test_zlib_segmented_buffer(
+        3 * hpx::serialization::segmented_buffer::segment_size + 17);
+    test_zlib_segmented_buffer(1 << 20);
+
+    return hpx::util::report_errors();
+}
+#else
+int main()
+{
+    return 0;
+}
+#endif
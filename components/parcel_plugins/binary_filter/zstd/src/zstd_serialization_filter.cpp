@@ -0,0 +1,116 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_COMPRESSION_ZSTD)
+#include <hpx/modules/errors.hpp>
+
+#include <hpx/binary_filter/zstd_serialization_filter.hpp>
+#include <hpx/plugin_factories/binary_filter_factory.hpp>
+#include <hpx/plugin_factories/plugin_registry.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+
+#include <zstd.h>
+
+///////////////////////////////////////////////////////////////////////////////
+HPX_REGISTER_PLUGIN_MODULE();
+HPX_REGISTER_BINARY_FILTER_FACTORY(
+    hpx::plugins::compression::zstd_serialization_filter,
+    zstd_serialization_filter);
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::plugins::compression {
+
+    namespace {
+
+        // the compression level used, parcels favor speed over ratio
+        constexpr int compression_level = 1;
+    }    // namespace
+
+    void zstd_serialization_filter::set_max_length(std::size_t size)
+    {
+        buffer_.reserve(size);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::size_t zstd_serialization_filter::init_data(
+        void const* buffer, std::size_t size, std::size_t buffer_size)
+    {
+        buffer_.resize(buffer_size);
+        std::size_t const decompressed =
+            ZSTD_decompress(buffer_.data(), buffer_size, buffer, size);
+
+        if (ZSTD_isError(decompressed) || decompressed != buffer_size)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                "zstd_serialization_filter::init_data",
+                "decompression failure, archive data bstream is corrupted");
+        }
+
+        current_ = 0;
+        return buffer_.size();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void zstd_serialization_filter::load(void* dst, std::size_t dst_count)
+    {
+        if (current_ + dst_count > buffer_.size())
+        {
+            HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                "zstd_serialization_filter::load",
+                "archive data bstream is too short");
+            return;
+        }
+
+        std::memcpy(dst, &buffer_[current_], dst_count);
+        current_ += dst_count;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void zstd_serialization_filter::save(
+        void const* src, std::size_t src_count)
+    {
+        char const* src_begin = static_cast<char const*>(src);
+        std::copy(
+            src_begin, src_begin + src_count, std::back_inserter(buffer_));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    bool zstd_serialization_filter::flush(
+        void* dst, std::size_t dst_count, std::size_t& written)
+    {
+        // make sure we have enough memory
+        std::size_t const needed = ZSTD_compressBound(buffer_.size());
+        if (needed > dst_count)
+        {
+            written = 0;
+            return false;
+        }
+
+        // compress everything in one go
+        std::size_t const compressed_length = ZSTD_compress(dst, dst_count,
+            buffer_.data(), buffer_.size(), compression_level);
+
+        if (ZSTD_isError(compressed_length))
+        {
+            HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                "zstd_serialization_filter::flush",
+                "compression failure: {}",
+                ZSTD_getErrorName(compressed_length));
+            return false;
+        }
+
+        written = compressed_length;
+        return true;
+    }
+}    // namespace hpx::plugins::compression
+
+#endif
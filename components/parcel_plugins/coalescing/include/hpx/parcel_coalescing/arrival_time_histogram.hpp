@@ -0,0 +1,157 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCEL_COALESCING)
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace hpx::plugins::parcel::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Bounds used by the adaptive coalescing mode. The intervals are given in
+    // microseconds (as the 'interval' configuration setting), 'max_interval'
+    // is the upper bound for the latency added to a parcel by coalescing.
+    struct adaptive_bounds
+    {
+        std::size_t min_messages = 1;
+        std::size_t max_messages = 256;
+        std::size_t min_interval = 10;
+        std::size_t max_interval = 1000;
+
+        // number of parcels to observe before the parameters are adjusted
+        std::size_t window = 128;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Histogram of the times between parcels (in nanoseconds) using
+    // logarithmically spaced buckets. Bucket 'i' collects the times in
+    // [2^(i-1), 2^i). Other than the histogram exposed as a performance
+    // counter this does not need any configuration and is cheap enough to be
+    // updated for every parcel.
+    class arrival_time_histogram
+    {
+    public:
+        static constexpr std::size_t num_buckets = 48;
+
+        void add(std::int64_t time_between_parcels) noexcept
+        {
+            std::size_t bucket = 0;
+            for (auto t = static_cast<std::uint64_t>(
+                     (std::max) (time_between_parcels, std::int64_t(0)));
+                t != 0 && bucket != num_buckets - 1; t >>= 1)
+            {
+                ++bucket;
+            }
+            ++counts_[bucket];
+            ++samples_;
+        }
+
+        std::size_t samples() const noexcept
+        {
+            return samples_;
+        }
+
+        // Return the (approximate) time below which the given fraction of
+        // the collected samples fall.
+        std::int64_t percentile(double fraction) const noexcept
+        {
+            double const total = static_cast<double>(total_count());
+            if (total == 0)
+                return 0;
+
+            double cumulative = 0;
+            for (std::size_t i = 0; i != num_buckets; ++i)
+            {
+                cumulative += static_cast<double>(counts_[i]);
+                if (cumulative >= fraction * total)
+                {
+                    // use the middle of the bucket
+                    return i == 0 ? 0 : (std::int64_t(3) << i) >> 2;
+                }
+            }
+            return std::int64_t(1) << (num_buckets - 1);
+        }
+
+        // Age the collected data, this lets the histogram follow changes in
+        // the traffic pattern while still smoothing out short bursts.
+        void decay() noexcept
+        {
+            for (auto& count : counts_)
+            {
+                count /= 2;
+            }
+            samples_ = 0;
+        }
+
+        void reset() noexcept
+        {
+            counts_.fill(0);
+            samples_ = 0;
+        }
+
+    private:
+        std::uint64_t total_count() const noexcept
+        {
+            std::uint64_t total = 0;
+            for (auto count : counts_)
+            {
+                total += count;
+            }
+            return total;
+        }
+
+        std::array<std::uint64_t, num_buckets> counts_ = {};
+        std::size_t samples_ = 0;    // samples added since last decay
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Derive the number of parcels to coalesce and the flush interval
+    // (in microseconds) from the observed times between parcels.
+    //
+    // If parcels arrive less often than the latency bound allows to wait for
+    // the next one, coalescing only adds latency and the lower bounds are
+    // used. Otherwise we buffer as many parcels as are expected to arrive
+    // within the latency bound (based on the median time between parcels),
+    // and choose the flush interval such that a batch of that size is
+    // expected to be complete for 90% of the observed arrival times.
+    inline void adapt_parameters(arrival_time_histogram const& histogram,
+        adaptive_bounds const& bounds, std::size_t& num_messages,
+        std::size_t& interval) noexcept
+    {
+        std::int64_t const median =
+            (std::max) (histogram.percentile(0.5), std::int64_t(1));
+        std::int64_t const upper = (std::max) (histogram.percentile(0.9), median);
+
+        auto const max_interval_ns =
+            static_cast<std::int64_t>(bounds.max_interval) * 1000;
+        if (median >= max_interval_ns)
+        {
+            num_messages = bounds.min_messages;
+            interval = bounds.min_interval;
+            return;
+        }
+
+        num_messages = std::clamp(
+            static_cast<std::size_t>(max_interval_ns / median),
+            bounds.min_messages, bounds.max_messages);
+
+        std::int64_t const interval_ns =
+            upper > max_interval_ns / static_cast<std::int64_t>(num_messages) ?
+            max_interval_ns :
+            upper * static_cast<std::int64_t>(num_messages);
+
+        interval = std::clamp(static_cast<std::size_t>(interval_ns / 1000),
+            bounds.min_interval, bounds.max_interval);
+    }
+}    // namespace hpx::plugins::parcel::detail
+
+#endif
@@ -49,6 +49,8 @@ namespace hpx::plugins::parcel {
             get_counter_type average_time_between_parcels;
             get_counter_values_creator_type
                 time_between_parcels_histogram_creator;
+            get_counter_type num_messages_parameter;
+            get_counter_type interval_parameter;
             std::int64_t min_boundary = 0, max_boundary = 0, num_buckets = 0;
         };
 
@@ -65,7 +67,9 @@ namespace hpx::plugins::parcel {
             get_counter_type const& time_between_parcels,
             get_counter_type const& average_time_between_parcels,
             get_counter_values_creator_type const&
-                time_between_parcels_histogram_creator);
+                time_between_parcels_histogram_creator,
+            get_counter_type const& num_messages_parameter,
+            get_counter_type const& interval_parameter);
 
         get_counter_type get_parcels_counter(std::string const& name) const;
         get_counter_type get_messages_counter(std::string const& name) const;
@@ -76,6 +80,10 @@ namespace hpx::plugins::parcel {
         get_counter_values_type get_time_between_parcels_histogram_counter(
             std::string const& name, std::int64_t min_boundary,
             std::int64_t max_boundary, std::int64_t num_buckets);
+        get_counter_type get_num_messages_parameter_counter(
+            std::string const& name) const;
+        get_counter_type get_interval_parameter_counter(
+            std::string const& name) const;
 
         bool counter_discoverer(performance_counters::counter_info const& info,
             performance_counters::counter_path_elements& p,
@@ -15,6 +15,7 @@
 #include <hpx/modules/statistics.hpp>
 #include <hpx/modules/synchronization.hpp>
 
+#include <hpx/parcel_coalescing/arrival_time_histogram.hpp>
 #include <hpx/parcel_coalescing/message_buffer.hpp>
 #include <hpx/parcelset_base/policies/message_handler.hpp>
 
@@ -63,6 +64,10 @@ namespace hpx::plugins::parcel {
             std::int64_t num_buckets,
             hpx::function<std::vector<std::int64_t>(bool)>& result);
 
+        // access the currently used coalescing parameters
+        std::int64_t get_num_messages_parameter(bool reset);
+        std::int64_t get_interval_parameter(bool reset);
+
         // register the given action
         static void register_action(char const* action, error_code& ec);
 
@@ -75,6 +80,9 @@ namespace hpx::plugins::parcel {
         void update_num_messages();
         void update_interval();
 
+        // adjust the coalescing parameters based on the observed traffic
+        void adapt_parameters_locked();
+
     private:
         mutable mutex_type mtx_;
         parcelset::parcelport* pp_;
@@ -86,6 +94,11 @@ namespace hpx::plugins::parcel {
         bool allow_background_flush_;
         std::string action_name_;
 
+        // adaptive coalescing
+        bool adaptive_;
+        detail::adaptive_bounds adaptive_bounds_;
+        detail::arrival_time_histogram arrival_times_;
+
         // performance counter data
         std::int64_t num_parcels_;
         std::int64_t reset_num_parcels_;
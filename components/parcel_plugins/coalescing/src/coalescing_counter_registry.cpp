@@ -35,7 +35,9 @@ namespace hpx::plugins::parcel {
         get_counter_type const& num_parcels_per_message,
         get_counter_type const& average_time_between_parcels,
         get_counter_values_creator_type const&
-            time_between_parcels_histogram_creator)
+            time_between_parcels_histogram_creator,
+        get_counter_type const& num_messages_parameter,
+        get_counter_type const& interval_parameter)
     {
         if (name.empty())
         {
@@ -51,7 +53,8 @@ namespace hpx::plugins::parcel {
         {
             counter_functions data = {num_parcels, num_messages,
                 num_parcels_per_message, average_time_between_parcels,
-                time_between_parcels_histogram_creator, 0, 0, 1};
+                time_between_parcels_histogram_creator, num_messages_parameter,
+                interval_parameter, 0, 0, 1};
 
             map_.emplace(name, HPX_MOVE(data));
         }
@@ -65,6 +68,8 @@ namespace hpx::plugins::parcel {
                 average_time_between_parcels;
             it->second.time_between_parcels_histogram_creator =
                 time_between_parcels_histogram_creator;
+            it->second.num_messages_parameter = num_messages_parameter;
+            it->second.interval_parameter = interval_parameter;
 
             if (it->second.min_boundary != it->second.max_boundary)
             {
@@ -80,6 +85,8 @@ namespace hpx::plugins::parcel {
             (void) it->second.num_parcels_per_message;
             (void) it->second.average_time_between_parcels;
             (void) it->second.time_between_parcels_histogram_creator;
+            (void) it->second.num_messages_parameter;
+            (void) it->second.interval_parameter;
         }
     }
 
@@ -203,6 +210,41 @@ namespace hpx::plugins::parcel {
         return result;
     }
 
+    coalescing_counter_registry::get_counter_type
+    coalescing_counter_registry::get_num_messages_parameter_counter(
+        std::string const& name) const
+    {
+        std::unique_lock<mutex_type> l(mtx_);
+
+        map_type::const_iterator it = map_.find(name);
+        if (it == map_.end())
+        {
+            l.unlock();
+            HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                "coalescing_counter_registry::"
+                "get_num_messages_parameter_counter",
+                "unknown action type");
+        }
+        return it->second.num_messages_parameter;
+    }
+
+    coalescing_counter_registry::get_counter_type
+    coalescing_counter_registry::get_interval_parameter_counter(
+        std::string const& name) const
+    {
+        std::unique_lock<mutex_type> l(mtx_);
+
+        map_type::const_iterator it = map_.find(name);
+        if (it == map_.end())
+        {
+            l.unlock();
+            HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                "coalescing_counter_registry::get_interval_parameter_counter",
+                "unknown action type");
+        }
+        return it->second.interval_parameter;
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     bool coalescing_counter_registry::counter_discoverer(
         performance_counters::counter_info const& info,
@@ -23,6 +23,7 @@
 
 #include <boost/accumulators/accumulators.hpp>
 
+#include <algorithm>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
@@ -41,6 +42,8 @@ namespace hpx::traits {
     //      ...
     //      num_messages = 50
     //      interval = 100
+    //      adaptive = 0
+    //      ...
     //
     template <>
     struct plugin_config_data<hpx::plugins::parcel::coalescing_message_handler>
@@ -49,7 +52,13 @@ namespace hpx::traits {
         {
             return "num_messages = 50\n"
                    "interval = 100\n"
-                   "allow_background_flush = 1";
+                   "allow_background_flush = 1\n"
+                   "adaptive = 0\n"
+                   "adaptive_min_messages = 1\n"
+                   "adaptive_max_messages = 256\n"
+                   "adaptive_min_interval = 10\n"
+                   "adaptive_max_interval = 1000\n"
+                   "adaptive_window = 128";
         }
     };
 }    // namespace hpx::traits
@@ -84,6 +93,49 @@ namespace hpx::plugins::parcel {
                 "1");
             return !value.empty() && value[0] != '0';
         }
+
+        bool get_adaptive()
+        {
+            std::string value = hpx::get_config_entry(
+                "hpx.plugins.coalescing_message_handler.adaptive", "0");
+            return !value.empty() && value[0] != '0';
+        }
+
+        std::size_t get_adaptive_entry(char const* name, std::size_t dflt)
+        {
+            return hpx::util::from_string<std::size_t>(
+                hpx::get_config_entry(
+                    std::string("hpx.plugins.coalescing_message_handler."
+                                "adaptive_") +
+                        name,
+                    dflt),
+                dflt);
+        }
+
+        adaptive_bounds get_adaptive_bounds()
+        {
+            adaptive_bounds bounds;
+            bounds.min_messages =
+                get_adaptive_entry("min_messages", bounds.min_messages);
+            bounds.max_messages =
+                get_adaptive_entry("max_messages", bounds.max_messages);
+            bounds.min_interval =
+                get_adaptive_entry("min_interval", bounds.min_interval);
+            bounds.max_interval =
+                get_adaptive_entry("max_interval", bounds.max_interval);
+            bounds.window = get_adaptive_entry("window", bounds.window);
+
+            // make sure the bounds are consistent
+            bounds.min_messages = (std::max) (bounds.min_messages,
+                static_cast<std::size_t>(1));
+            bounds.max_messages =
+                (std::max) (bounds.max_messages, bounds.min_messages);
+            bounds.max_interval =
+                (std::max) (bounds.max_interval, bounds.min_interval);
+            bounds.window =
+                (std::max) (bounds.window, static_cast<std::size_t>(1));
+            return bounds;
+        }
     }    // namespace detail
 
     void coalescing_message_handler::update_num_messages()
@@ -112,6 +164,9 @@ namespace hpx::plugins::parcel {
       , stopped_(false)
       , allow_background_flush_(detail::get_background_flush())
       , action_name_(action_name)
+      , adaptive_(detail::get_adaptive())
+      , adaptive_bounds_(adaptive_ ? detail::get_adaptive_bounds() :
+                                     detail::adaptive_bounds())
       , num_parcels_(0)
       , reset_num_parcels_(0)
       , reset_num_parcels_per_message_parcels_(0)
@@ -139,7 +194,11 @@ namespace hpx::plugins::parcel {
                 this),
             hpx::bind_front(&coalescing_message_handler::
                                 get_time_between_parcels_histogram_creator,
-                this));
+                this),
+            hpx::bind_front(
+                &coalescing_message_handler::get_num_messages_parameter, this),
+            hpx::bind_front(
+                &coalescing_message_handler::get_interval_parameter, this));
 
         // register parameter update callbacks
         set_config_entry_callback(
@@ -165,6 +224,14 @@ namespace hpx::plugins::parcel {
         if (time_between_parcels_)
             (*time_between_parcels_)(time_since_last_parcel);
 
+        // collect data for adapting the coalescing parameters
+        if (adaptive_)
+        {
+            arrival_times_.add(time_since_last_parcel);
+            if (arrival_times_.samples() >= adaptive_bounds_.window)
+                adapt_parameters_locked();
+        }
+
         std::chrono::microseconds interval(interval_);
 
         // just send parcel if the coalescing was stopped or the buffer is
@@ -209,6 +276,16 @@ namespace hpx::plugins::parcel {
         }
     }
 
+    void coalescing_message_handler::adapt_parameters_locked()
+    {
+        // The new number of parcels to coalesce will be used once the
+        // current buffer has been flushed, the new interval is used when the
+        // flush timer is started the next time.
+        detail::adapt_parameters(arrival_times_, adaptive_bounds_,
+            num_coalesced_parcels_, interval_);
+        arrival_times_.decay();
+    }
+
     bool coalescing_message_handler::timer_flush()
     {
         // adjust timer if needed
@@ -376,6 +453,20 @@ namespace hpx::plugins::parcel {
         return num_messages;
     }
 
+    std::int64_t coalescing_message_handler::get_num_messages_parameter(
+        bool /* reset */)
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        return static_cast<std::int64_t>(num_coalesced_parcels_);
+    }
+
+    std::int64_t coalescing_message_handler::get_interval_parameter(
+        bool /* reset */)
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        return static_cast<std::int64_t>(interval_) * 1000;    // [ns]
+    }
+
     std::vector<std::int64_t>
     coalescing_message_handler::get_time_between_parcels_histogram(
         bool /* reset */)
@@ -526,6 +526,109 @@ namespace hpx::plugins::parcel {
             ec);
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    // The counters exposing the coalescing parameters currently used by the
+    // message handler of a given action share their implementation.
+    using get_parameter_counter_type =
+        coalescing_counter_registry::get_counter_type (
+            coalescing_counter_registry::*)(std::string const&) const;
+
+    struct parameter_counter_surrogate
+    {
+        parameter_counter_surrogate(
+            get_parameter_counter_type get_counter, std::string const& parameters)
+          : get_counter_(get_counter)
+          , parameters_(parameters)
+        {
+        }
+
+        std::int64_t operator()(bool reset)
+        {
+            if (counter_.empty())
+            {
+                counter_ = (coalescing_counter_registry::instance().*
+                    get_counter_)(parameters_);
+                if (counter_.empty())
+                    return 0;    // no counter available yet
+            }
+
+            // dispatch to actual counter
+            return counter_(reset);
+        }
+
+        get_parameter_counter_type get_counter_;
+        hpx::function<std::int64_t(bool)> counter_;
+        std::string parameters_;
+    };
+
+    hpx::naming::gid_type parameter_counter_creator(
+        hpx::performance_counters::counter_info const& info,
+        get_parameter_counter_type get_counter, char const* name,
+        hpx::error_code& ec)
+    {
+        if (info.type_ != performance_counters::counter_type::raw)
+        {
+            HPX_THROWS_IF(ec, hpx::error::bad_parameter, name,
+                "invalid counter type requested");
+            return naming::invalid_gid;
+        }
+
+        performance_counters::counter_path_elements paths;
+        performance_counters::get_counter_path_elements(
+            info.fullname_, paths, ec);
+        if (ec)
+            return naming::invalid_gid;
+
+        if (paths.parentinstance_is_basename_)
+        {
+            HPX_THROWS_IF(ec, hpx::error::bad_parameter, name,
+                "invalid counter name for coalescing parameter (instance "
+                "name must not be a valid base counter name)");
+            return naming::invalid_gid;
+        }
+
+        if (paths.parameters_.empty())
+        {
+            HPX_THROWS_IF(ec, hpx::error::bad_parameter, name,
+                "invalid counter parameter for coalescing parameter: must "
+                "specify an action type");
+            return naming::invalid_gid;
+        }
+
+        // ask registry
+        hpx::function<std::int64_t(bool)> f =
+            (coalescing_counter_registry::instance().*get_counter)(
+                paths.parameters_);
+
+        if (!f.empty())
+        {
+            return performance_counters::detail::create_raw_counter(
+                info, HPX_MOVE(f), ec);
+        }
+
+        // the counter is not available yet, create surrogate function
+        return performance_counters::detail::create_raw_counter(info,
+            parameter_counter_surrogate(get_counter, paths.parameters_), ec);
+    }
+
+    hpx::naming::gid_type num_messages_parameter_counter_creator(
+        hpx::performance_counters::counter_info const& info,
+        hpx::error_code& ec)
+    {
+        return parameter_counter_creator(info,
+            &coalescing_counter_registry::get_num_messages_parameter_counter,
+            "num_messages_parameter_counter_creator", ec);
+    }
+
+    hpx::naming::gid_type interval_parameter_counter_creator(
+        hpx::performance_counters::counter_info const& info,
+        hpx::error_code& ec)
+    {
+        return parameter_counter_creator(info,
+            &coalescing_counter_registry::get_interval_parameter_counter,
+            "interval_parameter_counter_creator", ec);
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     // This function will be registered as a startup function for HPX below.
     //
@@ -578,7 +681,23 @@ namespace hpx::plugins::parcel {
                 "the action which is given by the counter parameter",
                 HPX_PERFORMANCE_COUNTER_V1,
                 &time_between_parcels_histogram_counter_creator,
-                &counter_discoverer, "ns/0.1%"}};
+                &counter_discoverer, "ns/0.1%"},
+            // /coalescing(...)/count/max-parcels-per-message@action-name
+            {"/coalescing/count/max-parcels-per-message", counter_type::raw,
+                "returns the number of parcels the message handler associated "
+                "with the action which is given by the counter parameter "
+                "currently combines into one message at most",
+                HPX_PERFORMANCE_COUNTER_V1,
+                &num_messages_parameter_counter_creator, &counter_discoverer,
+                ""},
+            // /coalescing(...)/time/flush-interval@action-name
+            {"/coalescing/time/flush-interval", counter_type::raw,
+                "returns the time the message handler associated with the "
+                "action which is given by the counter parameter currently "
+                "waits for more parcels before sending a message",
+                HPX_PERFORMANCE_COUNTER_V1,
+                &interval_parameter_counter_creator, &counter_discoverer,
+                "ns"}};
 
         // Install the counter types, un-installation of the types is handled
         // automatically.
@@ -0,0 +1,198 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Feed synthetic times between parcels to the histogram used by the adaptive
+// coalescing mode and verify the derived number of parcels to coalesce and
+// the flush interval.
+
+#include <hpx/config.hpp>
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCEL_COALESCING)
+#include <hpx/modules/testing.hpp>
+#include <hpx/parcel_coalescing/arrival_time_histogram.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+using hpx::plugins::parcel::detail::adapt_parameters;
+using hpx::plugins::parcel::detail::adaptive_bounds;
+using hpx::plugins::parcel::detail::arrival_time_histogram;
+
+void add_samples(arrival_time_histogram& histogram, std::size_t count,
+    std::int64_t time_between_parcels)
+{
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        histogram.add(time_between_parcels);
+    }
+}
+
+void test_adapt(arrival_time_histogram const& histogram,
+    adaptive_bounds const& bounds, std::size_t expected_num_messages,
+    std::size_t expected_interval)
+{
+    std::size_t num_messages = 0;
+    std::size_t interval = 0;
+    adapt_parameters(histogram, bounds, num_messages, interval);
+
+    HPX_TEST_EQ(num_messages, expected_num_messages);
+    HPX_TEST_EQ(interval, expected_interval);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_histogram()
+{
+    arrival_time_histogram histogram;
+    HPX_TEST_EQ(histogram.samples(), std::size_t(0));
+    HPX_TEST_EQ(histogram.percentile(0.5), std::int64_t(0));
+
+    // 1000ns falls into [512, 1024), the middle of which is 768ns
+    add_samples(histogram, 9, 1000);
+    add_samples(histogram, 1, 100000);
+    HPX_TEST_EQ(histogram.samples(), std::size_t(10));
+    HPX_TEST_EQ(histogram.percentile(0.5), std::int64_t(768));
+    HPX_TEST_EQ(histogram.percentile(0.9), std::int64_t(768));
+    HPX_TEST_EQ(histogram.percentile(1.0), std::int64_t(98304));
+
+    // negative times (clock adjustments) end up in the first bucket
+    histogram.reset();
+    add_samples(histogram, 1, -1);
+    HPX_TEST_EQ(histogram.samples(), std::size_t(1));
+    HPX_TEST_EQ(histogram.percentile(1.0), std::int64_t(0));
+}
+
+// Parcels arriving every microsecond: coalesce as many parcels as the
+// latency bound (1ms) allows, the interval covers a complete batch.
+void test_dense_traffic()
+{
+    arrival_time_histogram histogram;
+    add_samples(histogram, 128, 1000);
+
+    // 1ms / 768ns = 1302 parcels, clamped to 256, 256 * 768ns = 196us
+    test_adapt(histogram, adaptive_bounds(), 256, 196);
+}
+
+// Parcels arriving every 50us: 1ms / 49152ns = 20 parcels, the interval
+// needed for those is 20 * 49152ns = 983us.
+void test_moderate_traffic()
+{
+    arrival_time_histogram histogram;
+    add_samples(histogram, 128, 50000);
+
+    test_adapt(histogram, adaptive_bounds(), 20, 983);
+}
+
+// Parcels arriving less often than the latency bound are sent right away.
+void test_sparse_traffic()
+{
+    arrival_time_histogram histogram;
+    add_samples(histogram, 128, 2000000);
+
+    test_adapt(histogram, adaptive_bounds(), 1, 10);
+}
+
+// Occasional gaps between otherwise dense traffic make a batch take longer
+// than the latency bound, the interval is capped at the bound.
+void test_bursty_traffic()
+{
+    arrival_time_histogram histogram;
+    add_samples(histogram, 100, 1000);
+    add_samples(histogram, 28, 100000);
+
+    test_adapt(histogram, adaptive_bounds(), 256, 1000);
+}
+
+// The derived parameters are kept within the configured bounds.
+void test_bounds()
+{
+    adaptive_bounds bounds;
+    bounds.min_messages = 4;
+    bounds.max_messages = 16;
+    bounds.min_interval = 50;
+    bounds.max_interval = 500;
+
+    arrival_time_histogram histogram;
+    add_samples(histogram, 128, 1000);
+
+    // 16 * 768ns = 12us is below the minimal interval
+    test_adapt(histogram, bounds, 16, 50);
+
+    // 200us between parcels: 500us / 196608ns = 2 parcels, which is below
+    // the minimal number of parcels, the interval is capped at the bound
+    histogram.reset();
+    add_samples(histogram, 128, 200000);
+    test_adapt(histogram, bounds, 4, 500);
+
+    // 600us between parcels exceeds the latency bound
+    histogram.reset();
+    add_samples(histogram, 128, 600000);
+    test_adapt(histogram, bounds, 4, 50);
+}
+
+// Run the adaptation the way the message handler does: after each window of
+// parcels the parameters are recomputed and the histogram is aged. The
+// parameters follow a change in the traffic pattern within a few windows.
+void test_windows()
+{
+    adaptive_bounds const bounds;
+    arrival_time_histogram histogram;
+
+    std::size_t num_messages = 0;
+    std::size_t interval = 0;
+    std::size_t adaptations = 0;
+
+    auto put_parcels = [&](std::size_t count, std::int64_t time) {
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            histogram.add(time);
+            if (histogram.samples() >= bounds.window)
+            {
+                adapt_parameters(histogram, bounds, num_messages, interval);
+                histogram.decay();
+                ++adaptations;
+            }
+        }
+    };
+
+    put_parcels(bounds.window - 1, 1000);
+    HPX_TEST_EQ(adaptations, std::size_t(0));
+
+    put_parcels(1, 1000);
+    HPX_TEST_EQ(adaptations, std::size_t(1));
+    HPX_TEST_EQ(histogram.samples(), std::size_t(0));
+    HPX_TEST_EQ(num_messages, std::size_t(256));
+    HPX_TEST_EQ(interval, std::size_t(196));
+
+    // after one window of slower traffic the aged samples of the dense
+    // traffic are outnumbered
+    put_parcels(bounds.window, 50000);
+    HPX_TEST_EQ(adaptations, std::size_t(2));
+    HPX_TEST_EQ(num_messages, std::size_t(20));
+    HPX_TEST_EQ(interval, std::size_t(983));
+
+    put_parcels(bounds.window, 2000000);
+    HPX_TEST_EQ(adaptations, std::size_t(3));
+    HPX_TEST_EQ(num_messages, std::size_t(1));
+    HPX_TEST_EQ(interval, std::size_t(10));
+}
+
+int main()
+{
+    test_histogram();
+    test_dense_traffic();
+    test_moderate_traffic();
+    test_sparse_traffic();
+    test_bursty_traffic();
+    test_bounds();
+    test_windows();
+
+    return hpx::util::report_errors();
+}
+#else
+int main()
+{
+    return 0;
+}
+#endif
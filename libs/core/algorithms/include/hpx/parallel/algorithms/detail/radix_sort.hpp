@@ -0,0 +1,440 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/execution/algorithms/detail/predicates.hpp>
+#include <hpx/execution/executors/execution.hpp>
+#include <hpx/execution/executors/execution_parameters.hpp>
+#include <hpx/iterator_support/counting_iterator.hpp>
+#include <hpx/iterator_support/iterator_range.hpp>
+#include <hpx/modules/async_combinators.hpp>
+#include <hpx/type_support/identity.hpp>
+#include <hpx/type_support/is_contiguous_iterator.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// A parallel least significant digit radix sort for arithmetic keys. It is
+// used by sort and sort_by_key instead of the comparison based sort if the
+// keys are integers or IEEE floating point values, the elements are compared
+// using std::less or std::greater (or their HPX equivalents), no projection
+// is involved, and the elements are stored contiguously.
+//
+// Each pass sorts by one byte of the key. All chunks compute the histogram of
+// the digit for their part of the input, the prefix sums over all histograms
+// give each chunk the positions it scatters its elements to. Passes for which
+// all keys share the same digit are skipped altogether. As the algorithm is
+// stable, sort_by_key keeps the relative order of values with equal keys.
+namespace hpx::parallel::detail {
+
+    /// \cond NOINTERNAL
+
+    // sequences shorter than this are sorted using the comparison based sort
+    inline constexpr std::size_t radix_sort_limit = 65536ul;
+
+    // smallest number of elements processed by a single task
+    inline constexpr std::size_t radix_sort_limit_per_task = 32768ul;
+
+    inline constexpr std::size_t radix_sort_digits = 256;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // the unsigned integer type holding the radix key for a given key type
+    template <typename T, typename Enable = void>
+    struct radix_key
+    {
+    };
+
+    template <typename T>
+    struct radix_key<T,
+        std::enable_if_t<std::is_integral_v<T> && !std::is_same_v<T, bool>>>
+    {
+        using type = std::make_unsigned_t<T>;
+    };
+
+    template <typename T>
+    struct radix_key<T,
+        std::enable_if_t<std::is_floating_point_v<T> &&
+            std::numeric_limits<T>::is_iec559 &&
+            (sizeof(T) == sizeof(std::uint32_t) ||
+                sizeof(T) == sizeof(std::uint64_t))>>
+    {
+        using type = std::conditional_t<sizeof(T) == sizeof(std::uint32_t),
+            std::uint32_t, std::uint64_t>;
+    };
+
+    template <typename T>
+    using radix_key_t = typename radix_key<T>::type;
+
+    template <typename T, typename Enable = void>
+    inline constexpr bool has_radix_key_v = false;
+
+    template <typename T>
+    inline constexpr bool has_radix_key_v<T,
+        std::void_t<typename radix_key<std::remove_cv_t<T>>::type>> = true;
+
+    // Map the given key onto an unsigned integer such that the integers
+    // compare the same way as the keys. The sign bit is flipped for signed
+    // integers. Negative floating point values have all of their bits flipped
+    // as their magnitude grows with the unsigned representation.
+    template <typename T>
+    HPX_FORCEINLINE radix_key_t<T> get_radix_key(
+        T key, radix_key_t<T> invert) noexcept
+    {
+        using key_type = radix_key_t<T>;
+        constexpr key_type sign_bit = key_type(1)
+            << (std::numeric_limits<key_type>::digits - 1);
+
+        key_type bits;
+        std::memcpy(&bits, &key, sizeof(key_type));
+
+        if constexpr (std::is_floating_point_v<T>)
+        {
+            bits = (bits & sign_bit) ? key_type(~bits) :
+                                       key_type(bits | sign_bit);
+        }
+        else if constexpr (std::is_signed_v<T>)
+        {
+            bits = key_type(bits ^ sign_bit);
+        }
+
+        // sorting in descending order inverts all bits of the radix key
+        return key_type(bits ^ invert);
+    }
+
+    template <typename T>
+    HPX_FORCEINLINE std::size_t get_radix_digit(
+        T key, radix_key_t<T> invert, std::size_t digit) noexcept
+    {
+        return static_cast<std::size_t>(
+            (get_radix_key(key, invert) >> (8 * digit)) & 0xff);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // the comparison function objects the radix sort can be used with
+    template <typename Comp, typename T>
+    inline constexpr bool is_radix_sort_less_v =
+        std::is_same_v<Comp, hpx::parallel::detail::less> ||
+        std::is_same_v<Comp, std::less<>> || std::is_same_v<Comp, std::less<T>>;
+
+    template <typename Comp, typename T>
+    inline constexpr bool is_radix_sort_greater_v =
+        std::is_same_v<Comp, hpx::parallel::detail::greater> ||
+        std::is_same_v<Comp, std::greater<>> ||
+        std::is_same_v<Comp, std::greater<T>>;
+
+    template <typename Iter, typename Comp, typename Proj>
+    inline constexpr bool is_radix_sortable_v =
+        hpx::traits::is_contiguous_iterator_v<Iter> &&
+        has_radix_key_v<typename std::iterator_traits<Iter>::value_type> &&
+        std::is_same_v<std::decay_t<Proj>, hpx::identity> &&
+        (is_radix_sort_less_v<std::decay_t<Comp>,
+             typename std::iterator_traits<Iter>::value_type> ||
+            is_radix_sort_greater_v<std::decay_t<Comp>,
+                typename std::iterator_traits<Iter>::value_type>);
+
+    // values moved along with the keys by sort_by_key
+    template <typename Iter>
+    inline constexpr bool is_radix_sortable_value_v =
+        hpx::traits::is_contiguous_iterator_v<Iter> &&
+        std::is_default_constructible_v<
+            typename std::iterator_traits<Iter>::value_type> &&
+        std::is_nothrow_move_assignable_v<
+            typename std::iterator_traits<Iter>::value_type>;
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Key, typename Value>
+    class radix_sort_helper
+    {
+        using key_type = radix_key_t<Key>;
+        using histogram = std::array<std::size_t, radix_sort_digits>;
+
+        static constexpr std::size_t num_digits = sizeof(key_type);
+        static constexpr bool has_values = !std::is_void_v<Value>;
+
+        using value_type = std::conditional_t<has_values, Value, char>;
+
+    public:
+        radix_sort_helper(Key* keys, value_type* values, std::size_t count,
+            std::size_t num_chunks, bool descending)
+          : keys(keys)
+          , values(values)
+          , count(count)
+          , num_chunks(num_chunks)
+          , chunk_size((count + num_chunks - 1) / num_chunks)
+          , invert(descending ? key_type(~key_type(0)) : key_type(0))
+          , histograms(num_chunks * num_digits)
+        {
+            HPX_ASSERT(num_chunks != 0);
+        }
+
+        template <typename Exec>
+        void call(Exec& exec)
+        {
+            // a single sweep over the input computes the histograms for all
+            // digits, these tell us which of the passes can be skipped
+            for_each_chunk(exec, [this](std::size_t chunk) {
+                count_all_digits(chunk);
+            });
+
+            std::array<bool, num_digits> needs_pass{};
+            std::size_t passes = 0;
+            for (std::size_t digit = 0; digit != num_digits; ++digit)
+            {
+                needs_pass[digit] = !is_uniform_digit(digit);
+                if (needs_pass[digit])
+                {
+                    ++passes;
+                }
+            }
+
+            if (passes == 0)
+            {
+                return;    // all keys are equal
+            }
+
+            std::unique_ptr<Key[]> key_buffer(new Key[count]);
+            std::unique_ptr<value_type[]> value_buffer;
+            if constexpr (has_values)
+            {
+                value_buffer.reset(new value_type[count]);
+            }
+
+            Key* key_dest = key_buffer.get();
+            value_type* value_dest = value_buffer.get();
+
+            bool first_pass = true;
+            for (std::size_t digit = 0; digit != num_digits; ++digit)
+            {
+                if (!needs_pass[digit])
+                {
+                    continue;
+                }
+
+                // the histograms computed above are valid for the first pass
+                // only, later passes work on the permuted sequence
+                if (!first_pass)
+                {
+                    for_each_chunk(exec, [this, digit](std::size_t chunk) {
+                        count_digit(chunk, digit);
+                    });
+                }
+                first_pass = false;
+
+                compute_offsets(digit);
+
+                for_each_chunk(
+                    exec, [this, digit, key_dest, value_dest](std::size_t c) {
+                        scatter(c, digit, key_dest, value_dest);
+                    });
+
+                std::swap(keys, key_dest);
+                if constexpr (has_values)
+                {
+                    std::swap(values, value_dest);
+                }
+            }
+
+            // an odd number of passes leaves the result in the buffers
+            if (passes % 2 != 0)
+            {
+                for_each_chunk(
+                    exec, [this, key_dest, value_dest](std::size_t chunk) {
+                        auto [begin, end] = get_chunk(chunk);
+                        std::copy(keys + begin, keys + end, key_dest + begin);
+                        if constexpr (has_values)
+                        {
+                            std::move(values + begin, values + end,
+                                value_dest + begin);
+                        }
+                    });
+            }
+        }
+
+    private:
+        template <typename Exec, typename F>
+        void for_each_chunk(Exec& exec, F&& f)
+        {
+            if (num_chunks == 1)
+            {
+                f(0);
+                return;
+            }
+
+            auto shape = hpx::util::iterator_range(
+                hpx::util::counting_iterator(std::size_t(0)),
+                hpx::util::counting_iterator(num_chunks));
+
+            hpx::wait_all(execution::bulk_async_execute(exec, f, shape));
+        }
+
+        std::pair<std::size_t, std::size_t> get_chunk(
+            std::size_t chunk) const noexcept
+        {
+            std::size_t const begin = (std::min)(chunk * chunk_size, count);
+            return {begin, (std::min)(begin + chunk_size, count)};
+        }
+
+        histogram& get_histogram(std::size_t chunk, std::size_t digit) noexcept
+        {
+            return histograms[chunk * num_digits + digit];
+        }
+
+        void count_all_digits(std::size_t chunk)
+        {
+            // the histograms of a chunk are stored next to each other
+            histogram* counts = &get_histogram(chunk, 0);
+            std::fill(counts, counts + num_digits, histogram{});
+
+            auto [begin, end] = get_chunk(chunk);
+            for (std::size_t i = begin; i != end; ++i)
+            {
+                key_type key = get_radix_key(keys[i], invert);
+                for (std::size_t digit = 0; digit != num_digits; ++digit)
+                {
+                    ++counts[digit][key & 0xff];
+                    key = key_type(key >> 8);
+                }
+            }
+        }
+
+        void count_digit(std::size_t chunk, std::size_t digit)
+        {
+            histogram& counts = get_histogram(chunk, digit);
+            counts.fill(0);
+
+            auto [begin, end] = get_chunk(chunk);
+            for (std::size_t i = begin; i != end; ++i)
+            {
+                ++counts[get_radix_digit(keys[i], invert, digit)];
+            }
+        }
+
+        bool is_uniform_digit(std::size_t digit)
+        {
+            for (std::size_t d = 0; d != radix_sort_digits; ++d)
+            {
+                std::size_t total = 0;
+                for (std::size_t chunk = 0; chunk != num_chunks; ++chunk)
+                {
+                    total += get_histogram(chunk, digit)[d];
+                }
+
+                if (total != 0)
+                {
+                    return total == count;
+                }
+            }
+            return true;
+        }
+
+        // turn the histograms into the positions the chunks start to write
+        // their elements with a given digit to
+        void compute_offsets(std::size_t digit)
+        {
+            std::size_t offset = 0;
+            for (std::size_t d = 0; d != radix_sort_digits; ++d)
+            {
+                for (std::size_t chunk = 0; chunk != num_chunks; ++chunk)
+                {
+                    std::size_t& h = get_histogram(chunk, digit)[d];
+                    std::size_t const n = h;
+                    h = offset;
+                    offset += n;
+                }
+            }
+            HPX_ASSERT(offset == count);
+        }
+
+        void scatter(std::size_t chunk, std::size_t digit, Key* key_dest,
+            [[maybe_unused]] value_type* value_dest)
+        {
+            histogram& offsets = get_histogram(chunk, digit);
+
+            auto [begin, end] = get_chunk(chunk);
+            for (std::size_t i = begin; i != end; ++i)
+            {
+                std::size_t const pos =
+                    offsets[get_radix_digit(keys[i], invert, digit)]++;
+
+                key_dest[pos] = keys[i];
+                if constexpr (has_values)
+                {
+                    value_dest[pos] = HPX_MOVE(values[i]);
+                }
+            }
+        }
+
+        Key* keys;
+        value_type* values;
+        std::size_t count;
+        std::size_t num_chunks;
+        std::size_t chunk_size;
+        key_type invert;
+        std::vector<histogram> histograms;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Sort the keys in [first, last) and, if given, the values starting at
+    // value_first along with them. Comp has to be one of the comparison
+    // function objects the radix sort supports (see is_radix_sortable_v).
+    template <typename Comp, typename ExPolicy, typename KeyIter,
+        typename ValueIter = std::nullptr_t>
+    void parallel_radix_sort(ExPolicy&& policy, KeyIter first, KeyIter last,
+        ValueIter value_first = nullptr)
+    {
+        using key_type = std::remove_cv_t<
+            typename std::iterator_traits<KeyIter>::value_type>;
+
+        std::size_t const count = last - first;
+        if (count < 2)
+        {
+            return;
+        }
+
+        std::size_t const cores =
+            hpx::execution::experimental::processing_units_count(
+                policy.parameters(), policy.executor(),
+                hpx::chrono::null_duration, count);
+
+        std::size_t const num_chunks = (std::max) (std::size_t(1),
+            (std::min) (cores, count / radix_sort_limit_per_task));
+
+        bool const descending =
+            is_radix_sort_greater_v<std::decay_t<Comp>, key_type>;
+
+        auto exec = policy.executor();
+        if constexpr (std::is_same_v<ValueIter, std::nullptr_t>)
+        {
+            radix_sort_helper<key_type, void>(std::addressof(*first), nullptr,
+                count, num_chunks, descending)
+                .call(exec);
+        }
+        else
+        {
+            using value_type = std::remove_cv_t<
+                typename std::iterator_traits<ValueIter>::value_type>;
+
+            radix_sort_helper<key_type, value_type>(std::addressof(*first),
+                std::addressof(*value_first), count, num_chunks, descending)
+                .call(exec);
+        }
+    }
+    /// \endcond
+}    // namespace hpx::parallel::detail
@@ -130,6 +130,12 @@ namespace hpx {
     /// permitted to execute in an unordered fashion in unspecified
     /// threads, and indeterminately sequenced within each thread.
     ///
+    /// If the elements are of integral or floating point type, are stored
+    /// contiguously, no projection is given, and \a comp is \a std::less or
+    /// \a std::greater (or the default), the parallel algorithm uses a radix
+    /// sort instead of comparing elements for sequences of 65536 elements or
+    /// more.
+    ///
     /// \returns  The \a sort algorithm returns a
     ///           \a hpx::future<void> if the execution policy is of
     ///           type
@@ -163,6 +169,7 @@ namespace hpx {
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/is_sorted.hpp>
 #include <hpx/parallel/algorithms/detail/pivot.hpp>
+#include <hpx/parallel/algorithms/detail/radix_sort.hpp>
 #include <hpx/parallel/util/compare_projected.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/detail/chunk_size.hpp>
@@ -329,6 +336,27 @@ namespace hpx::parallel {
                 HPX_FORWARD(Comp, comp), chunk_size);
         }
 
+        // sort arithmetic keys using the radix sort, Comp is the comparison
+        // function object as passed by the user
+        template <typename Comp, typename ExPolicy, typename RandomIt>
+        hpx::future<RandomIt> parallel_radix_sort_async(
+            ExPolicy&& policy, RandomIt first, RandomIt last)
+        {
+            // check if already sorted
+            if (detail::is_sorted_sequential(first, last, Comp()))
+            {
+                return hpx::make_ready_future(last);
+            }
+
+            auto exec = policy.executor();
+            return execution::async_execute(exec,
+                [policy = HPX_FORWARD(ExPolicy, policy), first,
+                    last]() mutable -> RandomIt {
+                    parallel_radix_sort<Comp>(policy, first, last);
+                    return last;
+                });
+        }
+
         ///////////////////////////////////////////////////////////////////////
         // sort
         template <typename RandomIt>
@@ -362,6 +390,20 @@ namespace hpx::parallel {
 
                 try
                 {
+                    // arithmetic keys compared with std::less or std::greater
+                    // are sorted using the (much faster) radix sort
+                    if constexpr (is_radix_sortable_v<RandomIt, Comp, Proj>)
+                    {
+                        if (static_cast<std::size_t>(last - first) >=
+                            radix_sort_limit)
+                        {
+                            return algorithm_result::get(
+                                parallel_radix_sort_async<std::decay_t<Comp>>(
+                                    HPX_FORWARD(ExPolicy, policy), first,
+                                    last));
+                        }
+                    }
+
                     // call the sort routine and return the right type,
                     // depending on execution policy
                     return algorithm_result::get(parallel_sort_async(
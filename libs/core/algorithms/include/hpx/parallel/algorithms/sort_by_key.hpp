@@ -27,6 +27,11 @@ namespace hpx { namespace experimental {
     /// \note   Complexity: O(N log(N)), where N = std::distance(first, last)
     ///                     comparisons.
     ///
+    /// If the keys are of integral or floating point type, keys and values
+    /// are stored contiguously, and \a comp is \a std::less or
+    /// \a std::greater (or the default), the parallel algorithm uses a
+    /// (stable) radix sort for sequences of 65536 elements or more.
+    ///
     /// A sequence is sorted with respect to a comparator \a comp
     /// if for every iterator i pointing to the sequence and
     /// every non-negative integer n such that i + n is a valid iterator
@@ -99,9 +104,12 @@ namespace hpx { namespace experimental {
 
 #include <hpx/config.hpp>
 #include <hpx/datastructures/tuple.hpp>
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/parallel/algorithms/detail/radix_sort.hpp>
 #include <hpx/parallel/algorithms/sort.hpp>
 #include <hpx/parallel/util/zip_iterator.hpp>
 
+#include <cstddef>
 #include <iterator>
 #include <type_traits>
 #include <utility>
@@ -154,6 +162,31 @@ namespace hpx::experimental {
         ValueIter value_last = value_first;
         std::advance(value_last, std::distance(key_first, key_last));
 
+        // arithmetic keys compared with std::less or std::greater are sorted
+        // using the radix sort, this moves the values only once per pass
+        if constexpr (!hpx::is_sequenced_execution_policy_v<ExPolicy> &&
+            hpx::parallel::detail::is_radix_sortable_v<KeyIter, Compare,
+                hpx::identity> &&
+            hpx::parallel::detail::is_radix_sortable_value_v<ValueIter>)
+        {
+            if (static_cast<std::size_t>(key_last - key_first) >=
+                hpx::parallel::detail::radix_sort_limit)
+            {
+                using result_type = sort_by_key_result<KeyIter, ValueIter>;
+
+                auto exec = policy.executor();
+                return hpx::parallel::util::detail::algorithm_result<ExPolicy,
+                    result_type>::get(hpx::parallel::execution::async_execute(
+                    exec,
+                    [policy = HPX_FORWARD(ExPolicy, policy), key_first,
+                        key_last, value_first, value_last]() mutable {
+                        hpx::parallel::detail::parallel_radix_sort<Compare>(
+                            policy, key_first, key_last, value_first);
+                        return result_type(key_last, value_last);
+                    }));
+            }
+        }
+
         using iterator_type = hpx::util::zip_iterator<KeyIter, ValueIter>;
 
         return hpx::parallel::detail::get_iter_pair<iterator_type>(
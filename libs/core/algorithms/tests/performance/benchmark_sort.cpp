@@ -0,0 +1,169 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark compares the radix sort used by hpx::sort and
+// hpx::experimental::sort_by_key for arithmetic keys with the comparison
+// based parallel sort. The latter is selected by passing a comparison
+// function object the radix sort does not know about. Every measurement
+// includes copying the unsorted input, which is the same for both variants.
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/algorithm.hpp>
+#include <hpx/execution.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/format.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/algorithms/sort_by_key.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+std::mt19937 gen(1000);
+
+// forces the comparison based sort
+struct less_comparison
+{
+    template <typename T>
+    bool operator()(T const& lhs, T const& rhs) const
+    {
+        return lhs < rhs;
+    }
+};
+
+template <typename T>
+std::vector<T> make_keys(std::size_t size)
+{
+    std::vector<T> keys(size);
+    if constexpr (std::is_floating_point_v<T>)
+    {
+        std::uniform_real_distribution<T> dis(T(-1e6), T(1e6));
+        std::generate(keys.begin(), keys.end(), [&]() { return dis(gen); });
+    }
+    else
+    {
+        std::uniform_int_distribution<T> dis(
+            (std::numeric_limits<T>::min)(), (std::numeric_limits<T>::max)());
+        std::generate(keys.begin(), keys.end(), [&]() { return dis(gen); });
+    }
+    return keys;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void bench_sort(char const* type_name, std::size_t size, int test_count)
+{
+    std::vector<T> const keys = make_keys<T>(size);
+    std::vector<T> c;
+
+    std::string const name = hpx::util::format("sort {} {}", type_name, size);
+    hpx::util::perftests_report(name, "radix", test_count, [&]() {
+        c = keys;
+        hpx::sort(hpx::execution::par, c.begin(), c.end(), std::less<>());
+    });
+    hpx::util::perftests_report(name, "comparison", test_count, [&]() {
+        c = keys;
+        hpx::sort(hpx::execution::par, c.begin(), c.end(), less_comparison());
+    });
+}
+
+template <typename T>
+void bench_sort_by_key(char const* type_name, std::size_t size, int test_count)
+{
+    std::vector<T> const keys = make_keys<T>(size);
+    std::vector<std::uint32_t> values(size);
+    std::iota(values.begin(), values.end(), std::uint32_t(0));
+
+    std::vector<T> k;
+    std::vector<std::uint32_t> v;
+
+    std::string const name =
+        hpx::util::format("sort_by_key {} {}", type_name, size);
+    hpx::util::perftests_report(name, "radix", test_count, [&]() {
+        k = keys;
+        v = values;
+        hpx::experimental::sort_by_key(hpx::execution::par, k.begin(),
+            k.end(), v.begin(), std::less<>());
+    });
+    hpx::util::perftests_report(name, "comparison", test_count, [&]() {
+        k = keys;
+        v = values;
+        hpx::experimental::sort_by_key(hpx::execution::par, k.begin(),
+            k.end(), v.begin(), less_comparison());
+    });
+}
+
+//////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    int const test_count = vm["test_count"].as<int>();
+    std::size_t const min_size = vm["min-size"].as<std::size_t>();
+    std::size_t const max_size = vm["max-size"].as<std::size_t>();
+
+    hpx::util::perftests_init(vm);
+
+    // verify that input is within domain of program
+    if (test_count <= 0 || min_size == 0)
+    {
+        std::cerr << "test_count and min-size have to be positive...\n"
+                  << std::flush;
+        hpx::local::finalize();
+        return -1;
+    }
+
+    for (std::size_t size = min_size; size <= max_size; size *= 10)
+    {
+        bench_sort<std::int32_t>("int32", size, test_count);
+        bench_sort<std::int64_t>("int64", size, test_count);
+        bench_sort<float>("float", size, test_count);
+        bench_sort<double>("double", size, test_count);
+
+        bench_sort_by_key<std::int32_t>("int32", size, test_count);
+        bench_sort_by_key<double>("double", size, test_count);
+    }
+
+    hpx::util::perftests_print_times();
+
+    return hpx::local::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+
+    options_description cmdline("usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("test_count", value<int>()->default_value(10),
+            "number of tests to be averaged")
+        ("min-size", value<std::size_t>()->default_value(1000000),
+            "smallest number of elements to sort, grows by a factor of 10")
+        ("max-size", value<std::size_t>()->default_value(100000000),
+            "largest number of elements to sort (1000000000 elements need "
+            "more than 32GB of memory)")
+        ;
+    // clang-format on
+
+    hpx::util::perftests_cfg(cmdline);
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+    init_args.cfg = {"hpx.os_threads=all"};
+
+    return hpx::local::init(hpx_main, argc, argv, init_args);
+}
+#endif
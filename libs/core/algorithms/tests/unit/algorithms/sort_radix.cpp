@@ -0,0 +1,194 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Arithmetic keys compared using std::less or std::greater are sorted by a
+// radix sort if a parallel execution policy is used. This verifies the result
+// against std::sort for all kinds of key types and value distributions.
+
+#include <hpx/algorithm.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/algorithms/sort_by_key.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#if defined(HPX_DEBUG)
+#define HPX_SORT_RADIX_TEST_SIZE (1 << 17)
+#else
+#define HPX_SORT_RADIX_TEST_SIZE (1 << 20)
+#endif
+
+std::mt19937 gen;
+
+///////////////////////////////////////////////////////////////////////////////
+// fill the vector with random values from the full range of the type, or
+// from a small range only to create many duplicates
+template <typename T>
+std::vector<T> make_keys(std::size_t size, bool duplicates)
+{
+    std::vector<T> keys(size);
+    if constexpr (std::is_floating_point_v<T>)
+    {
+        T const range = duplicates ? T(10) : (std::numeric_limits<T>::max)();
+        std::uniform_real_distribution<T> dis(-range / 2, range / 2);
+        std::generate(keys.begin(), keys.end(), [&]() { return dis(gen); });
+
+        // sprinkle in some special values
+        keys[0] = T(-0.0);
+        keys[1] = T(0.0);
+        keys[2] = std::numeric_limits<T>::infinity();
+        keys[3] = -std::numeric_limits<T>::infinity();
+        keys[4] = std::numeric_limits<T>::denorm_min();
+        keys[5] = (std::numeric_limits<T>::lowest)();
+    }
+    else
+    {
+        using dist_type = std::conditional_t<std::is_signed_v<T>,
+            std::int64_t, std::uint64_t>;
+        std::uniform_int_distribution<dist_type> dis(
+            duplicates ? dist_type(0) : (std::numeric_limits<T>::min)(),
+            duplicates ? dist_type(7) : (std::numeric_limits<T>::max)());
+        std::generate(keys.begin(), keys.end(),
+            [&]() { return static_cast<T>(dis(gen)); });
+    }
+    return keys;
+}
+
+template <typename T, typename Compare>
+void test_sort_radix(Compare comp, bool duplicates)
+{
+    using namespace hpx::execution;
+
+    std::vector<T> keys = make_keys<T>(HPX_SORT_RADIX_TEST_SIZE, duplicates);
+
+    std::vector<T> expected = keys;
+    std::sort(expected.begin(), expected.end(), comp);
+
+    {
+        std::vector<T> c = keys;
+        hpx::sort(par, c.begin(), c.end(), comp);
+        HPX_TEST(hpx::is_sorted(c.begin(), c.end(), comp));
+
+        // -0.0 and 0.0 compare equal but may end up in any order
+        HPX_TEST(std::equal(c.begin(), c.end(), expected.begin(),
+            [&](T lhs, T rhs) { return !comp(lhs, rhs) && !comp(rhs, lhs); }));
+    }
+
+    {
+        std::vector<T> c = keys;
+        hpx::sort(par_unseq(task), c.begin(), c.end(), comp).get();
+        HPX_TEST(hpx::is_sorted(c.begin(), c.end(), comp));
+    }
+
+    // sort_by_key is stable if the radix sort is used
+    {
+        std::vector<T> c = keys;
+        std::vector<std::size_t> values(c.size());
+        std::iota(values.begin(), values.end(), std::size_t(0));
+
+        hpx::experimental::sort_by_key(
+            par, c.begin(), c.end(), values.begin(), comp);
+
+        HPX_TEST(hpx::is_sorted(c.begin(), c.end(), comp));
+        for (std::size_t i = 0; i != c.size(); ++i)
+        {
+            T const key = keys[values[i]];
+            HPX_TEST(!comp(key, c[i]) && !comp(c[i], key));
+            if (i != 0 && !comp(c[i - 1], c[i]))
+            {
+                HPX_TEST_LT(values[i - 1], values[i]);
+            }
+        }
+    }
+}
+
+template <typename T>
+void test_sort_radix()
+{
+    for (bool duplicates : {false, true})
+    {
+        test_sort_radix<T>(hpx::parallel::detail::less(), duplicates);
+        test_sort_radix<T>(std::less<T>(), duplicates);
+        test_sort_radix<T>(std::greater<>(), duplicates);
+    }
+}
+
+void test_sort_radix_sorted()
+{
+    using namespace hpx::execution;
+
+    // already sorted sequences and sequences of equal keys
+    std::vector<std::int32_t> c(HPX_SORT_RADIX_TEST_SIZE);
+    std::iota(c.begin(), c.end(), -42);
+
+    hpx::sort(par, c.begin(), c.end());
+    HPX_TEST(std::is_sorted(c.begin(), c.end()));
+
+    hpx::sort(par, c.begin(), c.end(), std::greater<>());
+    HPX_TEST(std::is_sorted(c.begin(), c.end(), std::greater<>()));
+
+    std::fill(c.begin(), c.end(), 42);
+    hpx::sort(par, c.begin(), c.end());
+    HPX_TEST(std::count(c.begin(), c.end(), 42) ==
+        static_cast<std::ptrdiff_t>(c.size()));
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    test_sort_radix<std::int8_t>();
+    test_sort_radix<std::uint16_t>();
+    test_sort_radix<std::int32_t>();
+    test_sort_radix<std::uint32_t>();
+    test_sort_radix<std::int64_t>();
+    test_sort_radix<std::uint64_t>();
+    test_sort_radix<float>();
+    test_sort_radix<double>();
+
+    test_sort_radix_sorted();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -197,4 +197,12 @@ namespace hpx::execution::experimental {
     struct is_scheduling_property<get_first_core_t> : std::true_type
     {
     };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Attach executor parameters to a scheduler that determine how bulk
+    // operations are split into chunks of work.
+    inline constexpr struct with_bulk_chunking_t final
+      : detail::property_base<with_bulk_chunking_t>
+    {
+    } with_bulk_chunking{};
 }    // namespace hpx::execution::experimental
@@ -0,0 +1,808 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/thread_support/spinlock.hpp>
+
+#include <atomic>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::util::cache {
+
+    namespace detail {
+
+        // Trivially copyable values are stored as a sequence of relaxed
+        // atomic words. This allows readers to copy a value while it is being
+        // concurrently overwritten without introducing a data race, torn
+        // copies are detected by the sequence lock protecting the shard.
+        template <typename T>
+        class atomic_words
+        {
+            static constexpr std::size_t num_words =
+                (sizeof(T) + sizeof(std::uint64_t) - 1) / sizeof(std::uint64_t);
+
+        public:
+            void store(T const& value) noexcept
+            {
+                std::uint64_t buffer[num_words] = {};
+                std::memcpy(buffer, &value, sizeof(T));
+                for (std::size_t i = 0; i != num_words; ++i)
+                {
+                    words_[i].store(buffer[i], std::memory_order_relaxed);
+                }
+            }
+
+            void load(T& value) const noexcept
+            {
+                std::uint64_t buffer[num_words];
+                for (std::size_t i = 0; i != num_words; ++i)
+                {
+                    buffer[i] = words_[i].load(std::memory_order_relaxed);
+                }
+                std::memcpy(&value, buffer, sizeof(T));
+            }
+
+        private:
+            std::atomic<std::uint64_t> words_[num_words] = {};
+        };
+
+        // finalizer of MurmurHash3, std::hash is the identity for integral
+        // types on most platforms
+        constexpr std::uint64_t mix_hash(std::uint64_t h) noexcept
+        {
+            h ^= h >> 33;
+            h *= 0xff51afd7ed558ccdull;
+            h ^= h >> 33;
+            h *= 0xc4ceb9fe1a85ec53ull;
+            h ^= h >> 33;
+            return h;
+        }
+
+        constexpr std::size_t next_power_of_two(std::size_t n) noexcept
+        {
+            std::size_t result = 1;
+            while (result < n)
+            {
+                result <<= 1;
+            }
+            return result;
+        }
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \class concurrent_lru_cache concurrent_lru_cache.hpp hpx/cache/concurrent_lru_cache.hpp
+    ///
+    /// \brief The \a concurrent_lru_cache implements a local (non-distributed)
+    ///        cache which may be accessed concurrently from many threads.
+    ///
+    /// The cache is split into a number of independent shards. Each shard is
+    /// an open-addressing hash table (linear probing) and approximates LRU
+    /// eviction using the CLOCK algorithm. Modifications of a shard are
+    /// serialized by a spinlock, lookups do not acquire any lock but are
+    /// validated using a per-shard sequence lock instead.
+    ///
+    /// \tparam Key           The type of the keys to use to identify the
+    ///                       entries stored in the cache. The type must be
+    ///                       trivially copyable and default constructible.
+    /// \tparam Entry         The type of the items to be held in the cache.
+    ///                       The type must be trivially copyable and default
+    ///                       constructible.
+    /// \tparam Hash          The hash function to use for the keys.
+    /// \tparam KeyEqual      The function used to compare keys for equality.
+    template <typename Key, typename Entry, typename Hash = std::hash<Key>,
+        typename KeyEqual = std::equal_to<Key>>
+    class concurrent_lru_cache
+    {
+        static_assert(std::is_trivially_copyable_v<Key> &&
+                std::is_default_constructible_v<Key>,
+            "concurrent_lru_cache requires trivially copyable keys");
+        static_assert(std::is_trivially_copyable_v<Entry> &&
+                std::is_default_constructible_v<Entry>,
+            "concurrent_lru_cache requires trivially copyable entries");
+
+    public:
+        using key_type = Key;
+        using entry_type = Entry;
+        using entry_pair = std::pair<key_type, entry_type>;
+        using size_type = std::size_t;
+
+    private:
+        enum class slot_state : std::uint8_t
+        {
+            empty = 0,
+            occupied = 1,
+            deleted = 2
+        };
+
+        struct slot
+        {
+            std::atomic<slot_state> state{slot_state::empty};
+            std::atomic<bool> referenced{false};
+            detail::atomic_words<key_type> key;
+            detail::atomic_words<entry_type> entry;
+        };
+
+        struct table
+        {
+            explicit table(std::size_t capacity)
+              : mask(capacity - 1)
+              , slots(new slot[capacity])
+            {
+            }
+
+            std::size_t mask;
+            std::unique_ptr<slot[]> slots;
+        };
+
+        struct alignas(threads::get_cache_line_size()) shard
+        {
+            hpx::util::detail::spinlock mtx;
+            std::atomic<std::size_t> sequence{0};
+            std::atomic<table*> current{nullptr};
+
+            std::atomic<std::size_t> hits{0};
+            std::atomic<std::size_t> misses{0};
+            std::atomic<std::size_t> insertions{0};
+            std::atomic<std::size_t> evictions{0};
+
+            // the members below are protected by mtx
+            std::atomic<std::size_t> size{0};
+            std::size_t deleted = 0;
+            std::size_t max_size = 0;
+            std::size_t hand = 0;
+
+            // Tables are never freed before the cache is destroyed as
+            // concurrent readers might still access them. Tables are replaced
+            // only if the cache grows, which is rare.
+            std::vector<std::unique_ptr<table>> tables;
+        };
+
+        // RAII helper marking a shard as being modified
+        class write_guard
+        {
+        public:
+            explicit write_guard(shard& s) noexcept
+              : s_(s)
+              , lock_(s.mtx)
+            {
+                s_.sequence.store(
+                    s_.sequence.load(std::memory_order_relaxed) + 1,
+                    std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_release);
+            }
+
+            write_guard(write_guard const&) = delete;
+            write_guard(write_guard&&) = delete;
+            write_guard& operator=(write_guard const&) = delete;
+            write_guard& operator=(write_guard&&) = delete;
+
+            ~write_guard()
+            {
+                s_.sequence.store(
+                    s_.sequence.load(std::memory_order_relaxed) + 1,
+                    std::memory_order_release);
+            }
+
+        private:
+            shard& s_;
+            std::lock_guard<hpx::util::detail::spinlock> lock_;
+        };
+
+    public:
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Construct an instance of a concurrent_lru_cache.
+        ///
+        /// \param max_size   [in] The maximal number of entries this cache is
+        ///                   allowed to hold at any time.
+        /// \param num_shards [in] The number of independent shards the cache
+        ///                   is split into. This is rounded up to the next
+        ///                   power of two.
+        ///
+        explicit concurrent_lru_cache(
+            size_type max_size = 0, size_type num_shards = 16)
+          : num_shards_(detail::next_power_of_two(
+                num_shards == 0 ? std::size_t(1) : num_shards))
+          , shards_(new shard[num_shards_])
+        {
+            for (std::size_t i = 0; i != num_shards_; ++i)
+            {
+                shard& s = shards_[i];
+                s.tables.push_back(std::make_unique<table>(8));
+                s.current.store(s.tables.back().get());
+            }
+            reserve(max_size);
+        }
+
+        concurrent_lru_cache(concurrent_lru_cache const&) = delete;
+        concurrent_lru_cache(concurrent_lru_cache&&) = delete;
+        concurrent_lru_cache& operator=(concurrent_lru_cache const&) = delete;
+        concurrent_lru_cache& operator=(concurrent_lru_cache&&) = delete;
+
+        ~concurrent_lru_cache() = default;
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Return current size of the cache.
+        ///
+        /// \returns The current number of entries held by this cache
+        ///          instance. The value may be outdated as soon as it is
+        ///          returned if other threads concurrently modify the cache.
+        [[nodiscard]] size_type size() const noexcept
+        {
+            size_type result = 0;
+            for (std::size_t i = 0; i != num_shards_; ++i)
+            {
+                result += shards_[i].size.load(std::memory_order_relaxed);
+            }
+            return result;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Access the maximum number of entries the cache is allowed
+        ///        to hold.
+        [[nodiscard]] size_type capacity() const noexcept
+        {
+            return max_size_.load(std::memory_order_relaxed);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Change the maximum number of entries this cache can hold
+        ///
+        /// \param max_size    [in] The new maximum size this cache will be
+        ///             allowed to grow to. The entries are distributed evenly
+        ///             over all shards.
+        ///
+        void reserve(size_type max_size)
+        {
+            max_size_.store(max_size, std::memory_order_relaxed);
+
+            std::size_t const per_shard =
+                (max_size + num_shards_ - 1) / num_shards_;
+
+            // keep the load factor of the tables below one half
+            std::size_t const capacity =
+                detail::next_power_of_two(2 * per_shard);
+
+            for (std::size_t i = 0; i != num_shards_; ++i)
+            {
+                shard& s = shards_[i];
+                write_guard guard(s);
+
+                s.max_size = per_shard;
+                while (s.size.load(std::memory_order_relaxed) > s.max_size)
+                {
+                    evict(s);
+                }
+
+                table const* t = s.current.load(std::memory_order_relaxed);
+                if (capacity > t->mask + 1)
+                {
+                    rehash(s, capacity);
+                }
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Check whether the cache currently holds an entry identified
+        ///        by the given key
+        ///
+        /// \note         This function does not mark the entry as being
+        ///               recently used.
+        [[nodiscard]] bool holds_key(key_type const& key) const
+        {
+            entry_type entry;
+            return lookup(get_shard(hash(key)), key, entry, false);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Get a specific entry identified by the given key.
+        ///
+        /// \param key     [in] The key for the entry which should be retrieved
+        ///               from the cache.
+        /// \param realkey[out] Return the full real key found in the cache
+        /// \param entry  [out] If the entry indexed by the key is found in the
+        ///               cache this value on successful return will be a copy
+        ///               of the corresponding entry.
+        ///
+        /// \note         The function will mark the entry as recently used if
+        ///               the key was found in the cache. It does not acquire
+        ///               any lock.
+        ///
+        /// \returns      This function returns \a true if the cache holds the
+        ///               referenced entry, otherwise it returns \a false.
+        bool get_entry(
+            key_type const& key, key_type& realkey, entry_type& entry) const
+        {
+            if (get_entry(key, entry))
+            {
+                realkey = key;
+                return true;
+            }
+            return false;
+        }
+
+        bool get_entry(key_type const& key, entry_type& entry) const
+        {
+            shard& s = get_shard(hash(key));
+            if (lookup(s, key, entry, true))
+            {
+                s.hits.fetch_add(1, std::memory_order_relaxed);
+                return true;
+            }
+            s.misses.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        /// \brief Insert a new entry into this cache
+        ///
+        /// \param key    [in] The key for the entry which should be added to
+        ///               the cache.
+        /// \param entry  [in] The entry which should be added to the cache.
+        ///
+        /// \returns      This function returns \a false if the key is already
+        ///               held by the cache, the existing entry is not changed
+        ///               in this case.
+        bool insert(key_type const& key, entry_type const& entry)
+        {
+            std::size_t const h = hash(key);
+            shard& s = get_shard(h);
+
+            write_guard guard(s);
+            if (find_slot(s, h, key) != nullptr)
+            {
+                return false;
+            }
+
+            insert_nonexist(s, h, key, entry);
+            return true;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Update an existing element in this cache or insert it if
+        ///        it is not held by the cache yet.
+        void update(key_type const& key, entry_type const& entry)
+        {
+            update_if(key, entry,
+                [](key_type const&, key_type const&) { return false; });
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Update an existing element in this cache
+        ///
+        /// \param key    [in] The key for the value which should be updated in
+        ///               the cache.
+        /// \param entry  [in] The value which should be used as a replacement
+        ///               for the existing value in the cache.
+        /// \param f      [in] A callable taking two arguments, \a k and the
+        ///               key found in the cache (in that order). If \a f
+        ///               returns true, then the update will not succeed.
+        ///
+        /// \returns      This function returns \a true if the entry has been
+        ///               successfully updated or inserted, otherwise it
+        ///               returns \a false.
+        template <typename F>
+        bool update_if(key_type const& key, entry_type const& entry, F&& f)
+        {
+            std::size_t const h = hash(key);
+            shard& s = get_shard(h);
+
+            write_guard guard(s);
+            slot* sl = find_slot(s, h, key);
+            if (sl == nullptr)
+            {
+                s.misses.fetch_add(1, std::memory_order_relaxed);
+                insert_nonexist(s, h, key, entry);
+                return true;
+            }
+
+            key_type existing;
+            sl->key.load(existing);
+            if (f(key, existing))
+            {
+                return false;
+            }
+
+            sl->entry.store(entry);
+            sl->referenced.store(true, std::memory_order_relaxed);
+            s.hits.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Remove the entry identified by the given key
+        ///
+        /// \returns      This function returns \a true if the entry was held
+        ///               by the cache.
+        bool erase(key_type const& key)
+        {
+            std::size_t const h = hash(key);
+            shard& s = get_shard(h);
+
+            write_guard guard(s);
+            slot* sl = find_slot(s, h, key);
+            if (sl == nullptr)
+            {
+                return false;
+            }
+
+            remove(s, *sl);
+            return true;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Remove stored entries from the cache for which the supplied
+        ///        function object returns true.
+        ///
+        /// \param ep     [in] This parameter has to be a (unary) function
+        ///               object. It is invoked for each of the entries
+        ///               (as a std::pair<key_type, entry_type>) currently held
+        ///               in the cache.
+        ///
+        /// \returns      This function returns the number of removed entries.
+        template <typename Func>
+        size_type erase(Func const& ep)
+        {
+            size_type erased = 0;
+            for (std::size_t i = 0; i != num_shards_; ++i)
+            {
+                shard& s = shards_[i];
+                write_guard guard(s);
+
+                table* t = s.current.load(std::memory_order_relaxed);
+                for (std::size_t j = 0; j <= t->mask; ++j)
+                {
+                    slot& sl = t->slots[j];
+                    if (sl.state.load(std::memory_order_relaxed) !=
+                        slot_state::occupied)
+                    {
+                        continue;
+                    }
+
+                    entry_pair p;
+                    sl.key.load(p.first);
+                    sl.entry.load(p.second);
+                    if (ep(p))
+                    {
+                        remove(s, sl);
+                        s.evictions.fetch_add(1, std::memory_order_relaxed);
+                        ++erased;
+                    }
+                }
+            }
+            return erased;
+        }
+
+        /// \brief Remove all stored entries from the cache
+        ///
+        /// \returns      This function returns the number of removed entries.
+        size_type erase()
+        {
+            return clear();
+        }
+
+        /// \brief Clear the cache
+        ///
+        /// Unconditionally removes all stored entries from the cache.
+        size_type clear()
+        {
+            size_type erased = 0;
+            for (std::size_t i = 0; i != num_shards_; ++i)
+            {
+                shard& s = shards_[i];
+                write_guard guard(s);
+
+                table* t = s.current.load(std::memory_order_relaxed);
+                for (std::size_t j = 0; j <= t->mask; ++j)
+                {
+                    t->slots[j].state.store(
+                        slot_state::empty, std::memory_order_relaxed);
+                }
+
+                erased += s.size.load(std::memory_order_relaxed);
+                s.size.store(0, std::memory_order_relaxed);
+                s.deleted = 0;
+            }
+            return erased;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Access the statistics collected by the cache
+        ///
+        /// \param reset  [in] Reset the corresponding counters to zero.
+        [[nodiscard]] std::size_t hits(bool reset = false) noexcept
+        {
+            return accumulate(&shard::hits, reset);
+        }
+        [[nodiscard]] std::size_t misses(bool reset = false) noexcept
+        {
+            return accumulate(&shard::misses, reset);
+        }
+        [[nodiscard]] std::size_t insertions(bool reset = false) noexcept
+        {
+            return accumulate(&shard::insertions, reset);
+        }
+        [[nodiscard]] std::size_t evictions(bool reset = false) noexcept
+        {
+            return accumulate(&shard::evictions, reset);
+        }
+
+    private:
+        static std::size_t hash(key_type const& key)
+        {
+            return static_cast<std::size_t>(
+                detail::mix_hash(static_cast<std::uint64_t>(Hash()(key))));
+        }
+
+        // use the upper half of the bits for selecting the shard, the lower
+        // bits select the slot inside the shard's table
+        static constexpr std::size_t shard_shift =
+            sizeof(std::size_t) * CHAR_BIT / 2;
+
+        shard& get_shard(std::size_t h) const noexcept
+        {
+            return shards_[(h >> shard_shift) & (num_shards_ - 1)];
+        }
+
+        // Lock-free lookup, the result is valid only if the sequence number
+        // of the shard did not change while the slots were inspected.
+        bool lookup(shard& s, key_type const& key, entry_type& entry,
+            bool touch) const
+        {
+            std::size_t const h = hash(key);
+            for (;;)
+            {
+                std::size_t const seq =
+                    s.sequence.load(std::memory_order_acquire);
+                if (seq & 1)
+                {
+                    HPX_SMT_PAUSE;
+                    continue;
+                }
+
+                table* t = s.current.load(std::memory_order_acquire);
+
+                slot* found = nullptr;
+                std::size_t idx = h & t->mask;
+                for (std::size_t n = 0; n <= t->mask;
+                    ++n, idx = (idx + 1) & t->mask)
+                {
+                    slot& sl = t->slots[idx];
+                    slot_state const state =
+                        sl.state.load(std::memory_order_relaxed);
+                    if (state == slot_state::empty)
+                    {
+                        break;
+                    }
+                    if (state == slot_state::occupied)
+                    {
+                        key_type k;
+                        sl.key.load(k);
+                        if (KeyEqual()(k, key))
+                        {
+                            sl.entry.load(entry);
+                            found = &sl;
+                            break;
+                        }
+                    }
+                }
+
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (s.sequence.load(std::memory_order_relaxed) != seq)
+                {
+                    continue;    // a writer interfered, try again
+                }
+
+                if (found == nullptr)
+                {
+                    return false;
+                }
+
+                if (touch && !found->referenced.load(std::memory_order_relaxed))
+                {
+                    found->referenced.store(true, std::memory_order_relaxed);
+                }
+                return true;
+            }
+        }
+
+        // the functions below require the shard to be locked
+        slot* find_slot(shard& s, std::size_t h, key_type const& key) const
+        {
+            table* t = s.current.load(std::memory_order_relaxed);
+
+            std::size_t idx = h & t->mask;
+            for (std::size_t n = 0; n <= t->mask;
+                ++n, idx = (idx + 1) & t->mask)
+            {
+                slot& sl = t->slots[idx];
+                slot_state const state =
+                    sl.state.load(std::memory_order_relaxed);
+                if (state == slot_state::empty)
+                {
+                    break;
+                }
+                if (state == slot_state::occupied)
+                {
+                    key_type k;
+                    sl.key.load(k);
+                    if (KeyEqual()(k, key))
+                    {
+                        return &sl;
+                    }
+                }
+            }
+            return nullptr;
+        }
+
+        // store the given entry in the first free slot of its probe sequence,
+        // returns the previous state of the used slot
+        static slot_state place(table& t, std::size_t h, key_type const& key,
+            entry_type const& e, bool referenced) noexcept
+        {
+            std::size_t idx = h & t.mask;
+            for (;;)
+            {
+                slot& sl = t.slots[idx];
+                slot_state const state =
+                    sl.state.load(std::memory_order_relaxed);
+                if (state != slot_state::occupied)
+                {
+                    sl.key.store(key);
+                    sl.entry.store(e);
+                    sl.referenced.store(referenced, std::memory_order_relaxed);
+                    sl.state.store(
+                        slot_state::occupied, std::memory_order_relaxed);
+                    return state;
+                }
+                idx = (idx + 1) & t.mask;
+            }
+        }
+
+        void insert_nonexist(shard& s, std::size_t h, key_type const& key,
+            entry_type const& entry)
+        {
+            if (s.max_size == 0)
+            {
+                return;
+            }
+
+            while (s.size.load(std::memory_order_relaxed) >= s.max_size)
+            {
+                evict(s);
+            }
+
+            // rebuild the table in place if too many slots are marked as
+            // deleted, this keeps the probe sequences short
+            table* t = s.current.load(std::memory_order_relaxed);
+            if (4 * (s.size.load(std::memory_order_relaxed) + s.deleted + 1) >
+                3 * (t->mask + 1))
+            {
+                rehash(s, t->mask + 1);
+                t = s.current.load(std::memory_order_relaxed);
+            }
+
+            // reusing a deleted slot is fine as the key is known not to be
+            // in the table
+            if (place(*t, h, key, entry, false) == slot_state::deleted)
+            {
+                --s.deleted;
+            }
+
+            s.size.fetch_add(1, std::memory_order_relaxed);
+            s.insertions.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        static void remove(shard& s, slot& sl) noexcept
+        {
+            sl.state.store(slot_state::deleted, std::memory_order_relaxed);
+            s.size.fetch_sub(1, std::memory_order_relaxed);
+            ++s.deleted;
+        }
+
+        // CLOCK eviction: advance the hand, giving every recently referenced
+        // entry a second chance
+        static void evict(shard& s) noexcept
+        {
+            table* t = s.current.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                slot& sl = t->slots[s.hand];
+                s.hand = (s.hand + 1) & t->mask;
+
+                if (sl.state.load(std::memory_order_relaxed) !=
+                    slot_state::occupied)
+                {
+                    continue;
+                }
+                if (sl.referenced.load(std::memory_order_relaxed))
+                {
+                    sl.referenced.store(false, std::memory_order_relaxed);
+                    continue;
+                }
+
+                remove(s, sl);
+                s.evictions.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+        }
+
+        // Move all entries to a table of the given capacity. If the capacity
+        // does not change the current table is rebuilt in place.
+        void rehash(shard& s, std::size_t capacity)
+        {
+            table* t = s.current.load(std::memory_order_relaxed);
+
+            std::vector<std::pair<entry_pair, bool>> entries;
+            entries.reserve(s.size.load(std::memory_order_relaxed));
+            for (std::size_t j = 0; j <= t->mask; ++j)
+            {
+                slot& sl = t->slots[j];
+                if (sl.state.load(std::memory_order_relaxed) ==
+                    slot_state::occupied)
+                {
+                    entry_pair p;
+                    sl.key.load(p.first);
+                    sl.entry.load(p.second);
+                    entries.emplace_back(
+                        p, sl.referenced.load(std::memory_order_relaxed));
+                }
+            }
+
+            if (capacity != t->mask + 1)
+            {
+                s.tables.push_back(std::make_unique<table>(capacity));
+                t = s.tables.back().get();
+                s.current.store(t, std::memory_order_release);
+            }
+            else
+            {
+                for (std::size_t j = 0; j <= t->mask; ++j)
+                {
+                    t->slots[j].state.store(
+                        slot_state::empty, std::memory_order_relaxed);
+                }
+            }
+
+            for (auto const& e : entries)
+            {
+                place(*t, hash(e.first.first), e.first.first, e.first.second,
+                    e.second);
+            }
+
+            s.deleted = 0;
+            s.hand = 0;
+        }
+
+        std::size_t accumulate(
+            std::atomic<std::size_t> shard::*counter, bool reset) noexcept
+        {
+            std::size_t result = 0;
+            for (std::size_t i = 0; i != num_shards_; ++i)
+            {
+                std::atomic<std::size_t>& c = shards_[i].*counter;
+                result += reset ? c.exchange(0, std::memory_order_relaxed) :
+                                  c.load(std::memory_order_relaxed);
+            }
+            return result;
+        }
+
+    private:
+        std::size_t num_shards_;
+        std::unique_ptr<shard[]> shards_;
+        std::atomic<size_type> max_size_{0};
+    };
+}    // namespace hpx::util::cache
@@ -0,0 +1,187 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/cache/concurrent_lru_cache.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+struct value_type
+{
+    std::uint64_t first = 0;
+    std::uint64_t second = 0;
+};
+
+using cache_type =
+    hpx::util::cache::concurrent_lru_cache<std::uint64_t, value_type>;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_insert_get()
+{
+    cache_type c(64, 4);
+
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(64), c.capacity());
+
+    for (std::uint64_t i = 0; i != 32; ++i)
+    {
+        HPX_TEST(c.insert(i, value_type{i, 2 * i}));
+    }
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(32), c.size());
+
+    // inserting an existing key does not change the entry
+    HPX_TEST(!c.insert(1, value_type{42, 42}));
+
+    for (std::uint64_t i = 0; i != 32; ++i)
+    {
+        value_type v;
+        std::uint64_t realkey = 0;
+        HPX_TEST(c.get_entry(i, realkey, v));
+        HPX_TEST_EQ(realkey, i);
+        HPX_TEST_EQ(v.first, i);
+        HPX_TEST_EQ(v.second, 2 * i);
+    }
+
+    value_type v;
+    HPX_TEST(!c.get_entry(100, v));
+
+    HPX_TEST_EQ(c.hits(), static_cast<std::size_t>(32));
+    HPX_TEST_EQ(c.misses(), static_cast<std::size_t>(1));
+    HPX_TEST_EQ(c.insertions(), static_cast<std::size_t>(32));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_eviction()
+{
+    cache_type c(16, 1);
+
+    for (std::uint64_t i = 0; i != 16; ++i)
+    {
+        HPX_TEST(c.insert(i, value_type{i, i}));
+    }
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(16), c.size());
+
+    // touch the first entry, it should survive the next insertion
+    value_type v;
+    HPX_TEST(c.get_entry(0, v));
+
+    HPX_TEST(c.insert(16, value_type{16, 16}));
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(16), c.size());
+    HPX_TEST(c.holds_key(0));
+    HPX_TEST(c.holds_key(16));
+    HPX_TEST_EQ(c.evictions(), static_cast<std::size_t>(1));
+
+    // shrinking the cache evicts entries
+    c.reserve(8);
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(8), c.size());
+
+    // growing the cache keeps all entries
+    c.reserve(128);
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(8), c.size());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_update_erase()
+{
+    cache_type c(64, 4);
+
+    c.update(1, value_type{1, 1});    // isn't in the cache
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(1), c.size());
+
+    c.update(1, value_type{2, 2});
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(1), c.size());
+
+    value_type v;
+    HPX_TEST(c.get_entry(1, v));
+    HPX_TEST_EQ(v.first, static_cast<std::uint64_t>(2));
+
+    HPX_TEST(!c.update_if(1, value_type{3, 3},
+        [](std::uint64_t, std::uint64_t) { return true; }));
+    HPX_TEST(c.get_entry(1, v));
+    HPX_TEST_EQ(v.first, static_cast<std::uint64_t>(2));
+
+    for (std::uint64_t i = 2; i != 32; ++i)
+    {
+        HPX_TEST(c.insert(i, value_type{i, i}));
+    }
+
+    HPX_TEST(c.erase(static_cast<std::uint64_t>(1)));
+    HPX_TEST(!c.erase(static_cast<std::uint64_t>(1)));
+    HPX_TEST(!c.holds_key(1));
+
+    // erase all odd keys
+    std::size_t const erased =
+        c.erase([](cache_type::entry_pair const& p) { return p.first % 2; });
+    HPX_TEST_EQ(erased, static_cast<std::size_t>(15));
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(15), c.size());
+
+    // deleted slots are reused
+    for (std::uint64_t i = 100; i != 200; ++i)
+    {
+        HPX_TEST(c.insert(i, value_type{i, i}));
+        HPX_TEST(c.erase(i));
+    }
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(15), c.size());
+
+    HPX_TEST_EQ(c.clear(), static_cast<cache_type::size_type>(15));
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(0), c.size());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_concurrent_access()
+{
+    constexpr std::uint64_t num_keys = 1024;
+    constexpr std::size_t num_threads = 4;
+
+    cache_type c(num_keys / 2);
+
+    std::atomic<bool> consistent(true);
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t != num_threads; ++t)
+    {
+        threads.emplace_back([&, t]() {
+            for (std::uint64_t i = 0; i != 20 * num_keys; ++i)
+            {
+                std::uint64_t const key = (i * 7 + t) % num_keys;
+                if (t % 2)
+                {
+                    c.update(key, value_type{key, ~key});
+                }
+                else if (value_type v; c.get_entry(key, v))
+                {
+                    // readers must never observe torn entries
+                    if (v.first != key || v.second != ~key)
+                    {
+                        consistent = false;
+                    }
+                }
+            }
+        });
+    }
+
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+
+    HPX_TEST(consistent.load());
+    HPX_TEST_LTE(c.size(), num_keys / 2);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_insert_get();
+    test_eviction();
+    test_update_erase();
+    test_concurrent_access();
+
+    return hpx::util::report_errors();
+}
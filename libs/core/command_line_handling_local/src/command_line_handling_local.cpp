@@ -519,6 +519,13 @@ namespace hpx::local::detail {
         }
 #endif
 
+        // enable task tracing, if requested
+        if (vm.count("hpx:trace"))
+        {
+            ini_config.emplace_back(
+                "hpx.trace.destination!=" + vm["hpx:trace"].as<std::string>());
+        }
+
         use_process_mask_ =
             (cfgmap.get_value<int>("hpx.use_process_mask", 0) > 0) ||
             (vm.count("hpx:use-process-mask") > 0);
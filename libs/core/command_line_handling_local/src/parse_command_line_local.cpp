@@ -614,6 +614,10 @@ namespace hpx::local::detail {
             ("hpx:debug-app-log", value<std::string>()->implicit_value("cout"),
                 "enable all messages on the application log channel and send all "
                 "application logs to the target destination")
+            ("hpx:trace", value<std::string>()->implicit_value("hpx_trace.bin"),
+                "continuously trace the tasks executed by the worker threads "
+                "and write the trace to the given file when the runtime is "
+                "stopped (default: hpx_trace.bin)")
             // ("hpx:verbose_bench", "For logging benchmarks in detail")
         ;
 
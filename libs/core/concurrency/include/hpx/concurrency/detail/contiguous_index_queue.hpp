@@ -11,6 +11,7 @@
 #include <hpx/concurrency/cache_line_data.hpp>
 #include <hpx/datastructures/optional.hpp>
 
+#include <algorithm>
 #include <atomic>
 #include <cstdint>
 #include <type_traits>
@@ -231,6 +232,98 @@ namespace hpx::concurrency::detail {
             }
         }
 
+        /// \brief Attempt to pop a range of items from the left of the queue.
+        ///
+        /// Attempt to pop a range of items from the left (beginning) of the
+        /// queue. The number of items is determined by invoking get_count
+        /// with the number of items left in the queue, at least one and at
+        /// most all of the remaining items are popped. Returns the half-open
+        /// range of popped items. If no items are left hpx::nullopt is
+        /// returned.
+        template <typename F>
+        hpx::optional<std::pair<T, T>> pop_left_n(F&& get_count) noexcept
+        {
+            range desired_range{0, 0};
+
+            range expected_range =
+                current_range.data_.load(std::memory_order_relaxed);
+
+            do
+            {
+                if (expected_range.empty())
+                {
+                    return hpx::optional<std::pair<T, T>>(hpx::nullopt);
+                }
+
+                // reduce pipeline pressure
+                HPX_SMT_PAUSE;
+
+                T const count = get_count_limited(get_count, expected_range);
+                desired_range =
+                    range{expected_range.first + count, expected_range.last};
+
+            } while (!current_range.data_.compare_exchange_weak(
+                expected_range, desired_range));
+
+            return hpx::optional<std::pair<T, T>>(
+                std::pair<T, T>(expected_range.first, desired_range.first));
+        }
+
+        /// \brief Attempt to pop a range of items from the right of the
+        ///        queue.
+        ///
+        /// Attempt to pop a range of items from the right (end) of the queue.
+        /// The number of items is determined by invoking get_count with the
+        /// number of items left in the queue, at least one and at most all of
+        /// the remaining items are popped. Returns the half-open range of
+        /// popped items. If no items are left hpx::nullopt is returned.
+        template <typename F>
+        hpx::optional<std::pair<T, T>> pop_right_n(F&& get_count) noexcept
+        {
+            range desired_range{0, 0};
+
+            range expected_range =
+                current_range.data_.load(std::memory_order_relaxed);
+
+            do
+            {
+                if (expected_range.empty())
+                {
+                    return hpx::optional<std::pair<T, T>>(hpx::nullopt);
+                }
+
+                // reduce pipeline pressure
+                HPX_SMT_PAUSE;
+
+                T const count = get_count_limited(get_count, expected_range);
+                desired_range =
+                    range{expected_range.first, expected_range.last - count};
+
+            } while (!current_range.data_.compare_exchange_weak(
+                expected_range, desired_range));
+
+            return hpx::optional<std::pair<T, T>>(
+                std::pair<T, T>(desired_range.last, expected_range.last));
+        }
+
+        /// \brief Attempt to pop a range of items from the given end of the
+        ///        queue.
+        ///
+        /// Attempt to pop a range of items from the given end of the queue.
+        /// If no items are left hpx::nullopt is returned.
+        template <queue_end Which, typename F>
+        hpx::optional<std::pair<T, T>> pop_n(F&& get_count) noexcept
+        {
+            if constexpr (Which == queue_end::left)
+            {
+                return pop_left_n(HPX_FORWARD(F, get_count));
+            }
+            else
+            {
+                return pop_right_n(HPX_FORWARD(F, get_count));
+            }
+        }
+
         constexpr bool empty() const noexcept
         {
             return current_range.data_.load(std::memory_order_relaxed).empty();
@@ -243,6 +336,14 @@ namespace hpx::concurrency::detail {
         }
 
     private:
+        template <typename F>
+        static T get_count_limited(F& get_count, range const& r) noexcept
+        {
+            T const remaining = r.last - r.first;
+            return (std::clamp)(
+                static_cast<T>(get_count(remaining)), T(1), remaining);
+        }
+
         range initial_range;
         hpx::util::cache_line_data<std::atomic<range>> current_range;
     };
@@ -23,6 +23,7 @@
 #include <iterator>
 #include <memory>
 #include <random>
+#include <utility>
 #include <vector>
 
 unsigned int seed = std::random_device{}();
@@ -93,6 +94,65 @@ void test_basic()
     }
 }
 
+void test_basic_n()
+{
+    using range_type = std::pair<std::uint32_t, std::uint32_t>;
+
+    {
+        // A default constructed queue should give no ranges.
+        hpx::concurrency::detail::contiguous_index_queue<> q;
+
+        auto get_count = [](std::uint32_t) { return std::uint32_t(3); };
+        HPX_TEST(!q.pop_left_n(get_count));
+        HPX_TEST(!q.pop_right_n(get_count));
+    }
+
+    {
+        // Popping ranges from the left and right should give us adjacent
+        // ranges, the last one of them being shorter than requested.
+        hpx::concurrency::detail::contiguous_index_queue<> q{3, 13};
+
+        // the number of remaining indices is passed to the function
+        std::uint32_t remaining = 0;
+        auto get_count = [&](std::uint32_t r) {
+            remaining = r;
+            return std::uint32_t(4);
+        };
+
+        hpx::optional<range_type> curr = q.pop_left_n(get_count);
+        HPX_TEST(curr);
+        HPX_TEST_EQ(remaining, std::uint32_t(10));
+        HPX_TEST_EQ(curr->first, std::uint32_t(3));
+        HPX_TEST_EQ(curr->second, std::uint32_t(7));
+
+        curr = q.pop_right_n(get_count);
+        HPX_TEST(curr);
+        HPX_TEST_EQ(remaining, std::uint32_t(6));
+        HPX_TEST_EQ(curr->first, std::uint32_t(9));
+        HPX_TEST_EQ(curr->second, std::uint32_t(13));
+
+        curr = q.pop_left_n(get_count);
+        HPX_TEST(curr);
+        HPX_TEST_EQ(remaining, std::uint32_t(2));
+        HPX_TEST_EQ(curr->first, std::uint32_t(7));
+        HPX_TEST_EQ(curr->second, std::uint32_t(9));
+
+        HPX_TEST(q.empty());
+        HPX_TEST(!q.pop_left_n(get_count));
+    }
+
+    {
+        // A requested count of zero still gives us one index.
+        hpx::concurrency::detail::contiguous_index_queue<> q{0, 2};
+
+        auto get_count = [](std::uint32_t) { return std::uint32_t(0); };
+        hpx::optional<range_type> curr = q.pop_right_n(get_count);
+        HPX_TEST(curr);
+        HPX_TEST_EQ(curr->first, std::uint32_t(1));
+        HPX_TEST_EQ(curr->second, std::uint32_t(2));
+    }
+}
+
 enum class pop_mode
 {
     left,
@@ -206,6 +266,7 @@ int hpx_main(hpx::program_options::variables_map& vm)
     std::cout << "Using seed: " << seed << '\n';
 
     test_basic();
+    test_basic_n();
     test_concurrent(pop_mode::left);
     test_concurrent(pop_mode::right);
     test_concurrent(pop_mode::random);
@@ -32,6 +32,7 @@
 
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
+#include <hpx/coroutines/detail/stack_pool.hpp>
 
 // include unistd.h conditionally to check for POSIX version. Not all OSs have the
 // unistd header...
@@ -81,7 +82,9 @@ namespace hpx::threads::coroutines::detail::posix {
 #if defined(HPX_HAVE_THREAD_STACK_MMAP) && defined(_POSIX_MAPPED_FILES) &&     \
     _POSIX_MAPPED_FILES > 0
 
-    inline void* alloc_stack(std::size_t size)
+    // directly map a new stack (including its guard page) from the operating
+    // system
+    inline void* map_stack(std::size_t size)
     {
 #if defined(HPX_HAVE_THREAD_GUARD_PAGE)
         if (use_guard_pages)
@@ -130,6 +133,15 @@ namespace hpx::threads::coroutines::detail::posix {
 #endif
     }
 
+    inline void* alloc_stack(std::size_t size)
+    {
+        if (use_stack_pool)
+        {
+            return stack_pool_allocate(size);
+        }
+        return map_stack(size);
+    }
+
     inline void watermark_stack(void* stack, std::size_t size)
     {
         HPX_ASSERT(size > EXEC_PAGESIZE);
@@ -158,7 +170,9 @@ namespace hpx::threads::coroutines::detail::posix {
         return false;
     }
 
-    inline void free_stack(void* stack, std::size_t size)
+    // unmap a stack (including its guard page), this works for stacks that
+    // were mapped as part of a slab as well
+    inline void unmap_stack(void* stack, std::size_t size) noexcept
     {
 #if defined(HPX_HAVE_THREAD_GUARD_PAGE)
         if (use_guard_pages)
@@ -176,6 +190,16 @@ namespace hpx::threads::coroutines::detail::posix {
 #endif
     }
 
+    inline void free_stack(void* stack, std::size_t size)
+    {
+        if (use_stack_pool)
+        {
+            stack_pool_deallocate(stack, size);
+            return;
+        }
+        unmap_stack(stack, size);
+    }
+
 #else
     // non-mmap()
 
@@ -0,0 +1,67 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+///////////////////////////////////////////////////////////////////////////////
+// The stack pool keeps released coroutine stacks around instead of handing
+// them back to the operating system. Every OS thread (worker) owns one free
+// list per stack size, overflowing stacks are moved to a shared depot, and
+// anything beyond the configured watermarks is unmapped. New stacks are mapped
+// in slabs holding several stacks at once, the guard pages of all stacks in a
+// slab are set up right after the slab has been mapped.
+namespace hpx::threads::coroutines::detail::posix {
+
+    struct stack_pool_parameters
+    {
+        // maximal number of cached stacks per worker and stack size
+        std::size_t watermark = 64;
+
+        // maximal number of stacks per stack size kept in the shared depot
+        std::size_t depot_watermark = 1024;
+
+        // number of stacks to map at once whenever the pool runs dry
+        std::size_t slab_size = 16;
+
+        // number of (default sized) stacks to pre-fault during startup
+        std::size_t prefault_count = 0;
+
+        // advise the kernel to back the slabs using transparent huge pages
+        bool use_huge_pages = false;
+    };
+
+    // this global variable is used to control whether stacks are allocated
+    // from the stack pool or directly from the operating system
+    HPX_CORE_EXPORT extern bool use_stack_pool;
+
+    // Initialize the stack pool, pre-fault the requested number of stacks of
+    // the given size. This enables the pool, it has to be called before the
+    // first HPX thread is created.
+    HPX_CORE_EXPORT void init_stack_pool(
+        stack_pool_parameters const& params, std::size_t prefault_stack_size);
+
+    HPX_CORE_EXPORT void* stack_pool_allocate(std::size_t size);
+    HPX_CORE_EXPORT void stack_pool_deallocate(
+        void* stack, std::size_t size) noexcept;
+
+    // Number of stack allocations served from the free list of the
+    // calling worker (hits), number of allocations that had to refill the
+    // free list from the depot or by mapping a new slab (misses), and number
+    // of stacks that were handed back to the operating system because the
+    // watermarks were exceeded (reclaims).
+    HPX_CORE_EXPORT std::uint64_t get_stack_pool_hit_count(
+        bool reset) noexcept;
+    HPX_CORE_EXPORT std::uint64_t get_stack_pool_miss_count(
+        bool reset) noexcept;
+    HPX_CORE_EXPORT std::uint64_t get_stack_pool_reclaim_count(
+        bool reset) noexcept;
+}    // namespace hpx::threads::coroutines::detail::posix
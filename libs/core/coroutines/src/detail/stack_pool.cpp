@@ -0,0 +1,381 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(__linux) || defined(linux) || defined(__linux__) ||                \
+    defined(__FreeBSD__) || defined(__APPLE__)
+
+#include <hpx/coroutines/detail/posix_utility.hpp>
+#include <hpx/coroutines/detail/stack_pool.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace hpx::threads::coroutines::detail::posix {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // this global variable is used to control whether the stack pool will be
+    // used or not
+    bool use_stack_pool = false;
+
+#if defined(HPX_HAVE_THREAD_STACK_MMAP) && defined(_POSIX_MAPPED_FILES) &&     \
+    _POSIX_MAPPED_FILES > 0
+
+    namespace {
+
+        stack_pool_parameters pool_params;
+
+#if defined(HPX_HAVE_COROUTINE_COUNTERS)
+        std::atomic<std::uint64_t> pool_hits(0);
+        std::atomic<std::uint64_t> pool_misses(0);
+        std::atomic<std::uint64_t> pool_reclaims(0);
+
+        void increment(std::atomic<std::uint64_t>& counter,
+            std::uint64_t count = 1) noexcept
+        {
+            counter.fetch_add(count, std::memory_order_relaxed);
+        }
+
+        std::uint64_t get_and_reset(
+            std::atomic<std::uint64_t>& counter, bool reset) noexcept
+        {
+            return reset ? counter.exchange(0, std::memory_order_relaxed) :
+                           counter.load(std::memory_order_relaxed);
+        }
+#endif
+
+        ///////////////////////////////////////////////////////////////////////
+        // HPX uses only a handful of different stack sizes (small, medium,
+        // large, and huge), a linear search over the free lists is cheaper
+        // than any associative lookup.
+        struct free_list
+        {
+            std::size_t size = 0;
+            std::vector<void*> stacks;
+        };
+
+        free_list& get_free_list(
+            std::vector<free_list>& lists, std::size_t size)
+        {
+            for (free_list& l : lists)
+            {
+                if (l.size == size)
+                    return l;
+            }
+            lists.push_back(free_list{size, {}});
+            return lists.back();
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // the depot collects the stacks overflowing the per-worker free lists
+        struct stack_depot
+        {
+            std::mutex mtx;
+            std::vector<free_list> lists;
+        };
+
+        stack_depot& get_depot()
+        {
+            static stack_depot depot;
+            return depot;
+        }
+
+        // move up to 'count' stacks from the depot to the given free list
+        std::size_t take_from_depot(free_list& l, std::size_t count)
+        {
+            stack_depot& depot = get_depot();
+
+            std::lock_guard<std::mutex> lk(depot.mtx);
+            free_list& from = get_free_list(depot.lists, l.size);
+
+            std::size_t const n =
+                (std::min) (count, static_cast<std::size_t>(from.stacks.size()));
+            l.stacks.insert(l.stacks.end(), from.stacks.end() - n,
+                from.stacks.end());
+            from.stacks.resize(from.stacks.size() - n);
+            return n;
+        }
+
+        // move the last 'count' stacks of the given free list to the depot,
+        // unmap whatever exceeds the depot watermark
+        void give_to_depot(free_list& l, std::size_t count) noexcept
+        {
+            auto const first = l.stacks.end() - static_cast<std::ptrdiff_t>(
+                                                    (std::min) (count,
+                                                        l.stacks.size()));
+            auto it = first;
+            {
+                stack_depot& depot = get_depot();
+
+                std::lock_guard<std::mutex> lk(depot.mtx);
+                try
+                {
+                    free_list& to = get_free_list(depot.lists, l.size);
+                    while (it != l.stacks.end() &&
+                        to.stacks.size() < pool_params.depot_watermark)
+                    {
+                        to.stacks.push_back(*it++);
+                    }
+                }
+                // NOLINTNEXTLINE(bugprone-empty-catch)
+                catch (std::bad_alloc const&)
+                {
+                    // fall through, the remaining stacks will be unmapped
+                }
+            }
+
+#if defined(HPX_HAVE_COROUTINE_COUNTERS)
+            increment(pool_reclaims,
+                static_cast<std::uint64_t>(l.stacks.end() - it));
+#endif
+            for (/**/; it != l.stacks.end(); ++it)
+            {
+                unmap_stack(*it, l.size);
+            }
+            l.stacks.erase(first, l.stacks.end());
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Map 'count' stacks of the given size at once. The guard pages for
+        // all stacks are set up right away. Optionally touch all pages to
+        // avoid page faults once the stacks are in use.
+        bool map_slab(free_list& l, std::size_t count, bool prefault)
+        {
+            std::size_t guard_size = 0;
+#if defined(HPX_HAVE_THREAD_GUARD_PAGE)
+            if (use_guard_pages)
+            {
+                guard_size = EXEC_PAGESIZE;
+            }
+#endif
+            std::size_t const stride = l.size + guard_size;
+
+            l.stacks.reserve(l.stacks.size() + count);
+            void* slab = ::mmap(nullptr, stride * count, PROT_READ | PROT_WRITE,
+#if defined(__APPLE__)
+                MAP_PRIVATE | MAP_ANON | MAP_NORESERVE,
+#elif defined(__FreeBSD__)
+                MAP_PRIVATE | MAP_ANON,
+#else
+                MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE,
+#endif
+                -1, 0);
+
+            if (slab == MAP_FAILED)
+            {
+                return false;
+            }
+
+#if defined(MADV_HUGEPAGE)
+            if (pool_params.use_huge_pages)
+            {
+                ::madvise(slab, stride * count, MADV_HUGEPAGE);
+            }
+#endif
+
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                char* stack = static_cast<char*>(slab) + i * stride;
+                if (guard_size != 0)
+                {
+                    ::mprotect(stack, guard_size, PROT_NONE);
+                    stack += guard_size;
+                }
+
+                if (prefault)
+                {
+                    for (std::size_t offset = 0; offset < l.size;
+                        offset += EXEC_PAGESIZE)
+                    {
+                        static_cast<char volatile*>(stack)[offset] = 0;
+                    }
+                }
+
+                l.stacks.push_back(stack);
+            }
+            return true;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        struct worker_cache
+        {
+            worker_cache() = default;
+
+            worker_cache(worker_cache const&) = delete;
+            worker_cache(worker_cache&&) = delete;
+            worker_cache& operator=(worker_cache const&) = delete;
+            worker_cache& operator=(worker_cache&&) = delete;
+
+            // hand all cached stacks to the depot when the worker exits
+            ~worker_cache()
+            {
+                for (free_list& l : lists)
+                {
+                    give_to_depot(l, l.stacks.size());
+                }
+            }
+
+            std::vector<free_list> lists;
+        };
+
+        worker_cache& get_worker_cache()
+        {
+            static thread_local worker_cache cache;
+            return cache;
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    void init_stack_pool(
+        stack_pool_parameters const& params, std::size_t prefault_stack_size)
+    {
+        pool_params = params;
+        if (pool_params.slab_size == 0)
+        {
+            pool_params.slab_size = 1;
+        }
+        use_stack_pool = true;
+
+        if (pool_params.prefault_count != 0 && prefault_stack_size != 0)
+        {
+            stack_depot& depot = get_depot();
+
+            std::lock_guard<std::mutex> lk(depot.mtx);
+            free_list& l = get_free_list(depot.lists, prefault_stack_size);
+
+            std::size_t count = pool_params.prefault_count;
+            while (count != 0)
+            {
+                std::size_t const n = (std::min) (count, pool_params.slab_size);
+                if (!map_slab(l, n, true))
+                {
+                    break;
+                }
+                count -= n;
+            }
+        }
+    }
+
+    void* stack_pool_allocate(std::size_t size)
+    {
+        free_list& l = get_free_list(get_worker_cache().lists, size);
+        if (l.stacks.empty())
+        {
+#if defined(HPX_HAVE_COROUTINE_COUNTERS)
+            increment(pool_misses);
+#endif
+            // refill from the depot first, map a new slab only if the depot
+            // is empty as well
+            if (take_from_depot(l, pool_params.slab_size) == 0 &&
+                !map_slab(l, pool_params.slab_size, false))
+            {
+                // let the operating system report the error
+                return map_stack(size);
+            }
+        }
+#if defined(HPX_HAVE_COROUTINE_COUNTERS)
+        else
+        {
+            increment(pool_hits);
+        }
+#endif
+
+        void* stack = l.stacks.back();
+        l.stacks.pop_back();
+        return stack;
+    }
+
+    void stack_pool_deallocate(void* stack, std::size_t size) noexcept
+    {
+        try
+        {
+            free_list& l = get_free_list(get_worker_cache().lists, size);
+            l.stacks.push_back(stack);
+
+            // keep half of the watermark, this avoids bouncing stacks between
+            // the worker and the depot
+            if (l.stacks.size() > pool_params.watermark)
+            {
+                give_to_depot(l, l.stacks.size() - pool_params.watermark / 2);
+            }
+        }
+        catch (std::bad_alloc const&)
+        {
+            unmap_stack(stack, size);
+        }
+    }
+
+#if defined(HPX_HAVE_COROUTINE_COUNTERS)
+    std::uint64_t get_stack_pool_hit_count(bool reset) noexcept
+    {
+        return get_and_reset(pool_hits, reset);
+    }
+
+    std::uint64_t get_stack_pool_miss_count(bool reset) noexcept
+    {
+        return get_and_reset(pool_misses, reset);
+    }
+
+    std::uint64_t get_stack_pool_reclaim_count(bool reset) noexcept
+    {
+        return get_and_reset(pool_reclaims, reset);
+    }
+#else
+    std::uint64_t get_stack_pool_hit_count(bool) noexcept
+    {
+        return 0;
+    }
+
+    std::uint64_t get_stack_pool_miss_count(bool) noexcept
+    {
+        return 0;
+    }
+
+    std::uint64_t get_stack_pool_reclaim_count(bool) noexcept
+    {
+        return 0;
+    }
+#endif
+
+#else
+    // non-mmap(), stacks are allocated using operator new, no pooling
+
+    void init_stack_pool(stack_pool_parameters const&, std::size_t) {}
+
+    void* stack_pool_allocate(std::size_t size)
+    {
+        return alloc_stack(size);
+    }
+
+    void stack_pool_deallocate(void* stack, std::size_t size) noexcept
+    {
+        free_stack(stack, size);
+    }
+
+    std::uint64_t get_stack_pool_hit_count(bool) noexcept
+    {
+        return 0;
+    }
+
+    std::uint64_t get_stack_pool_miss_count(bool) noexcept
+    {
+        return 0;
+    }
+
+    std::uint64_t get_stack_pool_reclaim_count(bool) noexcept
+    {
+        return 0;
+    }
+#endif
+}    // namespace hpx::threads::coroutines::detail::posix
+
+#endif
@@ -0,0 +1,205 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that the stack pool reuses released stacks, that every OS thread
+// owns its own free lists which are handed to the shared depot once the
+// thread exits, and that stacks exceeding the watermarks are reclaimed.
+
+#include <hpx/config.hpp>
+
+#if defined(__linux) || defined(linux) || defined(__linux__) ||                \
+    defined(__FreeBSD__) || defined(__APPLE__)
+#include <hpx/coroutines/detail/posix_utility.hpp>
+#endif
+
+#if defined(HPX_HAVE_THREAD_STACK_MMAP) && defined(_POSIX_MAPPED_FILES) &&     \
+    _POSIX_MAPPED_FILES > 0
+#include <hpx/coroutines/detail/stack_pool.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace posix = hpx::threads::coroutines::detail::posix;
+
+// the free lists are kept per stack size, every test uses its own size
+constexpr std::size_t stack_size = 0x4000;
+
+void reset_counters()
+{
+    posix::get_stack_pool_hit_count(true);
+    posix::get_stack_pool_miss_count(true);
+    posix::get_stack_pool_reclaim_count(true);
+}
+
+void test_counters([[maybe_unused]] std::uint64_t hits,
+    [[maybe_unused]] std::uint64_t misses,
+    [[maybe_unused]] std::uint64_t reclaims)
+{
+#if defined(HPX_HAVE_COROUTINE_COUNTERS)
+    HPX_TEST_EQ(posix::get_stack_pool_hit_count(false), hits);
+    HPX_TEST_EQ(posix::get_stack_pool_miss_count(false), misses);
+    HPX_TEST_EQ(posix::get_stack_pool_reclaim_count(false), reclaims);
+#endif
+}
+
+bool contains(std::vector<void*> const& stacks, void* stack)
+{
+    return std::find(stacks.begin(), stacks.end(), stack) != stacks.end();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Released stacks are handed out again, most recently released first.
+void test_reuse()
+{
+    std::size_t const size = stack_size;
+    reset_counters();
+
+    // the first allocation maps a slab of two stacks
+    void* a = posix::stack_pool_allocate(size);
+    void* b = posix::stack_pool_allocate(size);
+    HPX_TEST(a != nullptr && b != nullptr && a != b);
+    test_counters(1, 1, 0);
+
+    posix::stack_pool_deallocate(b, size);
+    posix::stack_pool_deallocate(a, size);
+
+    HPX_TEST_EQ(posix::stack_pool_allocate(size), a);
+    HPX_TEST_EQ(posix::stack_pool_allocate(size), b);
+    test_counters(3, 1, 0);
+
+    posix::stack_pool_deallocate(a, size);
+    posix::stack_pool_deallocate(b, size);
+}
+
+// Every thread allocates from its own free list, the stacks cached by a
+// thread are moved to the depot once it exits and are picked up from there
+// by other threads.
+void test_per_worker()
+{
+    std::size_t const size = 2 * stack_size;
+    reset_counters();
+
+    std::vector<void*> main_stacks;
+    main_stacks.push_back(posix::stack_pool_allocate(size));
+    main_stacks.push_back(posix::stack_pool_allocate(size));
+    for (void* stack : main_stacks)
+    {
+        posix::stack_pool_deallocate(stack, size);
+    }
+    test_counters(1, 1, 0);
+
+    // the stacks released by the main thread are not visible to other threads
+    std::vector<void*> thread_stacks;
+    std::thread t([&]() {
+        thread_stacks.push_back(posix::stack_pool_allocate(size));
+        thread_stacks.push_back(posix::stack_pool_allocate(size));
+        for (void* stack : thread_stacks)
+        {
+            posix::stack_pool_deallocate(stack, size);
+        }
+    });
+    t.join();
+
+    HPX_TEST_EQ(thread_stacks.size(), std::size_t(2));
+    for (void* stack : thread_stacks)
+    {
+        HPX_TEST(!contains(main_stacks, stack));
+    }
+    test_counters(2, 2, 0);
+
+    // the main thread empties its own free list first, then refills it from
+    // the depot holding the stacks of the exited thread
+    std::vector<void*> stacks;
+    for (int i = 0; i != 4; ++i)
+    {
+        stacks.push_back(posix::stack_pool_allocate(size));
+    }
+    HPX_TEST(contains(main_stacks, stacks[0]));
+    HPX_TEST(contains(main_stacks, stacks[1]));
+    HPX_TEST(contains(thread_stacks, stacks[2]));
+    HPX_TEST(contains(thread_stacks, stacks[3]));
+    test_counters(5, 3, 0);
+
+    for (void* stack : stacks)
+    {
+        posix::stack_pool_deallocate(stack, size);
+    }
+    test_counters(5, 3, 0);
+}
+
+// Stacks exceeding the watermark of a free list are moved to the depot,
+// stacks exceeding the watermark of the depot are unmapped.
+void test_reclaim()
+{
+    std::size_t const size = 4 * stack_size;
+    reset_counters();
+
+    // every other allocation maps a new slab of two stacks
+    std::vector<void*> stacks;
+    for (int i = 0; i != 10; ++i)
+    {
+        stacks.push_back(posix::stack_pool_allocate(size));
+    }
+    test_counters(5, 5, 0);
+
+    // the free list overflows on the fifth and eighth stack, half of the
+    // watermark is kept, the depot accepts four stacks
+    for (std::size_t i = 0; i != 8; ++i)
+    {
+        posix::stack_pool_deallocate(stacks[i], size);
+    }
+    test_counters(5, 5, 2);
+
+    posix::stack_pool_deallocate(stacks[8], size);
+    posix::stack_pool_deallocate(stacks[9], size);
+    test_counters(5, 5, 2);
+
+#if defined(HPX_HAVE_COROUTINE_COUNTERS)
+    HPX_TEST_EQ(posix::get_stack_pool_reclaim_count(true), std::uint64_t(2));
+    HPX_TEST_EQ(posix::get_stack_pool_reclaim_count(false), std::uint64_t(0));
+#endif
+
+    // the cached stacks are handed out without mapping new slabs
+    std::vector<void*> reused;
+    for (int i = 0; i != 8; ++i)
+    {
+        reused.push_back(posix::stack_pool_allocate(size));
+        HPX_TEST(contains(stacks, reused.back()));
+    }
+    test_counters(11, 7, 0);
+
+    for (void* stack : reused)
+    {
+        posix::stack_pool_deallocate(stack, size);
+    }
+}
+
+int main()
+{
+    posix::stack_pool_parameters params;
+    params.watermark = 4;
+    params.depot_watermark = 4;
+    params.slab_size = 2;
+    posix::init_stack_pool(params, 0);
+
+    HPX_TEST(posix::use_stack_pool);
+
+    test_reuse();
+    test_per_worker();
+    test_reclaim();
+
+    return hpx::util::report_errors();
+}
+#else
+int main()
+{
+    return 0;
+}
+#endif
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <hpx/config.hpp>
+#include <hpx/allocator_support/allocator_deleter.hpp>
 #include <hpx/allocator_support/internal_allocator.hpp>
 #include <hpx/allocator_support/thread_local_caching_allocator.hpp>
 #include <hpx/assert.hpp>
@@ -188,24 +189,19 @@ namespace hpx::lcos::detail {
     };
 
     ///////////////////////////////////////////////////////////////////////////
+    // the shared states of the continuations are recycled through a
+    // thread-local cache
     template <typename ContResult, typename Future, typename Policy, typename F>
     inline traits::detail::shared_state_ptr_t<continuation_result_t<ContResult>>
     make_continuation(Future&& future, Policy&& policy, F&& f)
     {
-        using result_type = continuation_result_t<ContResult>;
-        using shared_state = detail::continuation<Future, F, result_type>;
-        using init_no_addref = typename shared_state::init_no_addref;
-        using spawner_type = post_policy_spawner;
-
-        // create a continuation
-        traits::detail::shared_state_ptr_t<result_type> p(
-            new shared_state(init_no_addref{}, HPX_FORWARD(F, f)), false);
-
-        static_cast<shared_state*>(p.get())->template attach<true>(
-            HPX_FORWARD(Future, future), spawner_type{},
-            HPX_FORWARD(Policy, policy));
+        using allocator_type = hpx::util::thread_local_caching_allocator<
+            hpx::lockfree::variable_size_stack, char,
+            hpx::util::internal_allocator<>>;
 
-        return p;
+        return make_continuation_alloc<ContResult>(allocator_type{},
+            HPX_FORWARD(Future, future), HPX_FORWARD(Policy, policy),
+            HPX_FORWARD(F, f));
     }
 
     // same as above, except with allocator
@@ -297,20 +293,40 @@ namespace hpx::lcos::detail {
     make_continuation_exec_policy(
         Future&& future, Executor&& exec, Policy&& policy, F&& f)
     {
-        using shared_state = detail::continuation<Future, F, ContResult>;
+        using base_allocator = hpx::util::thread_local_caching_allocator<
+            hpx::lockfree::variable_size_stack, char,
+            hpx::util::internal_allocator<>>;
+        using shared_state = traits::shared_state_allocator_t<
+            detail::continuation<Future, F, ContResult>, base_allocator>;
+
+        using other_allocator = typename std::allocator_traits<
+            base_allocator>::template rebind_alloc<shared_state>;
+        using traits = std::allocator_traits<other_allocator>;
+
         using init_no_addref = typename shared_state::init_no_addref;
+
+        using unique_ptr = std::unique_ptr<shared_state,
+            util::allocator_deleter<other_allocator>>;
+
         using spawner_type = executor_spawner<std::decay_t<Executor>>;
 
-        // create a continuation
-        traits::detail::shared_state_ptr_t<ContResult> p(
-            new shared_state(init_no_addref{}, HPX_FORWARD(F, f)), false);
+        // create a continuation, its shared state is recycled through a
+        // thread-local cache
+        other_allocator alloc;
+        unique_ptr p(traits::allocate(alloc, 1),
+            util::allocator_deleter<other_allocator>{alloc});
+        traits::construct(
+            alloc, p.get(), init_no_addref{}, alloc, HPX_FORWARD(F, f));
+
+        hpx::traits::detail::shared_state_ptr_t<ContResult> r(
+            p.release(), false);
 
-        static_cast<shared_state*>(p.get())->template attach<false>(
+        static_cast<shared_state*>(r.get())->template attach<false>(
             HPX_FORWARD(Future, future),
             spawner_type{HPX_FORWARD(Executor, exec)},
             HPX_FORWARD(Policy, policy));
 
-        return p;
+        return r;
     }
 
     template <typename ContResult, typename Future, typename Executor,
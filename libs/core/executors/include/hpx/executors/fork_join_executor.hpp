@@ -30,11 +30,14 @@
 #include <hpx/modules/itt_notify.hpp>
 #include <hpx/modules/topology.hpp>
 #include <hpx/resource_partitioner/detail/partitioner.hpp>
+#include <hpx/synchronization/detail/condition_variable.hpp>
 #include <hpx/synchronization/spinlock.hpp>
 #include <hpx/threading/thread.hpp>
 #include <hpx/threading_base/annotated_function.hpp>
 #include <hpx/threading_base/set_thread_state.hpp>
+#include <hpx/threading_base/thread_data.hpp>
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <cstddef>
@@ -42,6 +45,7 @@
 #include <exception>
 #include <iosfwd>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <type_traits>
 #include <utility>
@@ -55,16 +59,24 @@ namespace hpx::execution::experimental {
     /// that are kept alive for the duration of the executor. Copying the
     /// executor has reference semantics, i.e. copies of a fork_join_executor
     /// hold a reference to the worker threads of the original instance.
-    /// Scheduling work through the executor concurrently from different threads
-    /// is undefined behaviour.
+    /// Scheduling work through the executor concurrently from different
+    /// threads is supported: the parallel regions are executed one after the
+    /// other in the order they were submitted. Scheduling work from inside a
+    /// parallel region of the same executor executes the nested region
+    /// sequentially on the calling thread.
     ///
     /// The executor keeps a set of worker threads alive for the lifetime of the
     /// executor, meaning other work will not be executed while the executor is
     /// busy or waiting for work. The executor has a customizable delay after
-    /// which it will yield to other work.  Since starting and resuming the
-    /// worker threads is a slow operation the executor should be reused
-    /// whenever possible for multiple adjacent parallel algorithms or
+    /// which it will yield to other work, and a customizable delay after which
+    /// idle worker threads suspend until new work arrives. Since starting and
+    /// resuming the worker threads is a slow operation the executor should be
+    /// reused whenever possible for multiple adjacent parallel algorithms or
     /// invocations of bulk_(a)sync_execute.
+    ///
+    /// For more than 64 worker threads the parallel regions are distributed to
+    /// and joined from the worker threads along a tree rooted at the thread
+    /// that submitted the region.
     class fork_join_executor
     {
     public:
@@ -125,6 +137,11 @@ namespace hpx::execution::experimental {
                 void const* shape_;
                 void* argument_pack_;
                 void* results_;
+
+                // the HPX thread executing the parallel regions for this
+                // thread index (not set for the main thread), read by
+                // is_nested_region from arbitrary threads
+                std::atomic<void*> thread_id_{nullptr};
             };
 
             // Can't apply 'using' here as the type needs to be forward
@@ -146,6 +163,7 @@ namespace hpx::execution::experimental {
                 threads::thread_stacksize::small_;
             loop_schedule schedule_ = loop_schedule::static_;
             std::uint64_t yield_delay_;
+            std::uint64_t suspend_delay_;
 
             std::size_t main_thread_;
             std::size_t num_threads_;
@@ -165,6 +183,27 @@ namespace hpx::execution::experimental {
             // executor properties
             char const* annotation_ = nullptr;
 
+            // Parallel regions submitted concurrently are executed in the
+            // order of the tickets drawn by the submitting threads.
+            hpx::util::cache_aligned_data<std::atomic<std::uint64_t>>
+                next_ticket_;
+            hpx::util::cache_aligned_data<std::atomic<std::uint64_t>>
+                now_serving_;
+
+            // the HPX thread that submitted the current parallel region
+            std::atomic<void*> submitter_{nullptr};
+
+            // Idle worker threads suspend after suspend_delay_ and wait to be
+            // notified of new work.
+            hpx::spinlock sleep_mutex_;
+            hpx::lcos::local::detail::condition_variable sleep_cond_;
+            std::atomic<std::size_t> num_sleeping_{0};
+
+            // Parallel regions are distributed and joined along a tree with
+            // the given arity if there are more threads than tree_threshold_.
+            std::size_t tree_threshold_;
+            static constexpr std::size_t tree_arity = 4;
+
             template <typename Op>
             static thread_state wait_state_this_thread_while(
                 std::atomic<thread_state> const& tstate, thread_state state,
@@ -208,6 +247,108 @@ namespace hpx::execution::experimental {
                 return current;
             }
 
+            // Wait for the state of the given (worker) thread to change from
+            // 'idle'. Spin and yield for up to suspend_delay_, then suspend
+            // until notified by notify_sleeping.
+            thread_state wait_while_idle(std::atomic<thread_state>& tstate)
+            {
+                std::uint64_t const base_time = util::hardware::timestamp();
+                auto state = wait_state_this_thread_while(tstate,
+                    thread_state::idle, yield_delay_,
+                    [&](thread_state current, thread_state expected) {
+                        return current == expected &&
+                            (util::hardware::timestamp() - base_time) <=
+                            suspend_delay_;
+                    });
+
+                if (HPX_UNLIKELY(state == thread_state::idle))
+                {
+                    std::unique_lock<hpx::spinlock> l(sleep_mutex_);
+
+                    num_sleeping_.fetch_add(1, std::memory_order_relaxed);
+
+                    // pairs with the fence in notify_sleeping()
+                    std::atomic_thread_fence(std::memory_order_seq_cst);
+                    while ((state = tstate.load(std::memory_order_acquire)) ==
+                        thread_state::idle)
+                    {
+                        sleep_cond_.wait(l, "fork_join_executor::idle");
+                    }
+
+                    num_sleeping_.fetch_sub(1, std::memory_order_relaxed);
+                }
+                return state;
+            }
+
+            // Wake up all suspended worker threads, they will go back to sleep
+            // if their state has not changed.
+            void notify_sleeping()
+            {
+                // pairs with the fence in wait_while_idle()
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                if (num_sleeping_.load(std::memory_order_relaxed) != 0)
+                {
+                    std::unique_lock<hpx::spinlock> l(sleep_mutex_);
+                    sleep_cond_.notify_all(HPX_MOVE(l));
+                }
+            }
+
+            [[nodiscard]] bool use_tree() const noexcept
+            {
+                return num_threads_ > tree_threshold_;
+            }
+
+            // Invoke f for the region data of all children of the given thread
+            // in the tree rooted at the main thread.
+            template <typename F>
+            void for_each_child(std::size_t const thread_index, F&& f)
+            {
+                std::size_t const rank =
+                    (thread_index + num_threads_ - main_thread_) % num_threads_;
+                std::size_t const first = rank * tree_arity + 1;
+                std::size_t const last =
+                    (std::min)(first + tree_arity, num_threads_);
+                for (std::size_t r = first; r < last; ++r)
+                {
+                    f(region_data_[(r + main_thread_) % num_threads_].data_);
+                }
+            }
+
+            // Pass the current parallel region on to the children of the
+            // given thread.
+            void fan_out(std::size_t const thread_index)
+            {
+                region_data const& data = region_data_[thread_index].data_;
+                for_each_child(thread_index, [&](region_data& child) {
+                    child.element_function_ = data.element_function_;
+                    child.shape_ = data.shape_;
+                    child.argument_pack_ = data.argument_pack_;
+                    child.results_ = data.results_;
+                    child.thread_function_helper_ =
+                        data.thread_function_helper_;
+
+                    child.state_.store(thread_state::partitioning_work,
+                        std::memory_order_release);
+                });
+                notify_sleeping();
+            }
+
+            // Mark the given thread as done with the current parallel region.
+            // With a tree, this waits for all children to be done first.
+            void finish_region(std::size_t const thread_index) noexcept
+            {
+                if (use_tree())
+                {
+                    for_each_child(thread_index, [&](region_data& child) {
+                        wait_state_this_thread_while(child.state_,
+                            thread_state::idle, yield_delay_,
+                            std::not_equal_to<>());
+                    });
+                }
+                region_data_[thread_index].data_.state_.store(
+                    thread_state::idle, std::memory_order_release);
+            }
+
             std::string generate_annotation(
                 std::size_t index, char const* default_name) const
             {
@@ -234,6 +375,8 @@ namespace hpx::execution::experimental {
                 // The threads are bound to the current core.
                 bool const priority_bound_;
 
+                shared_data& shared_;
+
                 static void set_state_this_thread(
                     region_data& data, thread_state const state) noexcept
                 {
@@ -252,25 +395,30 @@ namespace hpx::execution::experimental {
 
                     HPX_ASSERT(
                         get_state_this_thread(data) == thread_state::starting);
+                    data.thread_id_.store(threads::get_self_id().get(),
+                        std::memory_order_relaxed);
                     set_state_this_thread(data, thread_state::idle);
 
                     // wait as long the state is 'idle'
-                    auto state = shared_data::wait_state_this_thread_while(
-                        data.state_, thread_state::idle, yield_delay_,
-                        std::equal_to<>());
+                    auto state = shared_.wait_while_idle(data.state_);
 
                     HPX_ASSERT(!priority_bound_ ||
                         thread_index_ == hpx::get_worker_thread_num());
                     while (HPX_LIKELY(state != thread_state::stopping))
                     {
+                        if (shared_.use_tree())
+                        {
+                            shared_.fan_out(thread_index_);
+                        }
+
                         data.thread_function_helper_(region_data_,
                             thread_index_, num_threads_, queues_,
                             exception_mutex_, exception_);
 
+                        shared_.finish_region(thread_index_);
+
                         // wait as long the state is 'idle'
-                        state = shared_data::wait_state_this_thread_while(
-                            data.state_, thread_state::idle, yield_delay_,
-                            std::equal_to<>());
+                        state = shared_.wait_while_idle(data.state_);
 
                         HPX_ASSERT(!priority_bound_ ||
                             thread_index_ == hpx::get_worker_thread_num());
@@ -445,7 +593,7 @@ namespace hpx::execution::experimental {
                             launch::async_policy>::call(policy, desc, pool_,
                             thread_function{num_threads_, t, schedule_,
                                 exception_mutex_, exception_, yield_delay_,
-                                region_data_, queues_, priority_bound});
+                                region_data_, queues_, priority_bound, *this});
 
                         ++t;
                     }
@@ -491,16 +639,21 @@ namespace hpx::execution::experimental {
             explicit shared_data(threads::thread_priority const priority,
                 threads::thread_stacksize const stacksize,
                 loop_schedule const schedule,
-                std::chrono::nanoseconds const yield_delay)
+                std::chrono::nanoseconds const yield_delay,
+                std::chrono::nanoseconds const suspend_delay,
+                std::size_t const tree_threshold)
               : pool_(this_thread::get_pool())
               , priority_(priority)
               , stacksize_(stacksize)
               , schedule_(schedule)
               , yield_delay_(static_cast<std::uint64_t>(
                     yield_delay.count() / pool_->timestamp_scale()))
+              , suspend_delay_(static_cast<std::uint64_t>(
+                    suspend_delay.count() / pool_->timestamp_scale()))
               , num_threads_(pool_->get_os_thread_count())
               , pu_mask_(full_mask(num_threads_))
               , region_data_(num_threads_)
+              , tree_threshold_(tree_threshold)
             {
                 HPX_ASSERT(pool_);
 
@@ -511,6 +664,8 @@ namespace hpx::execution::experimental {
                 threads::thread_stacksize const stacksize,
                 loop_schedule const schedule,
                 std::chrono::nanoseconds const yield_delay,
+                std::chrono::nanoseconds const suspend_delay,
+                std::size_t const tree_threshold,
                 hpx::threads::mask_cref_type pu_mask)
               : pool_(this_thread::get_pool())
               , priority_(priority)
@@ -518,9 +673,12 @@ namespace hpx::execution::experimental {
               , schedule_(schedule)
               , yield_delay_(static_cast<std::uint64_t>(
                     yield_delay.count() / pool_->timestamp_scale()))
+              , suspend_delay_(static_cast<std::uint64_t>(
+                    suspend_delay.count() / pool_->timestamp_scale()))
               , num_threads_(hpx::threads::count(pu_mask))
               , pu_mask_(pu_mask)
               , region_data_(num_threads_)
+              , tree_threshold_(tree_threshold)
             {
                 HPX_ASSERT(pool_);
                 if (pool_ == nullptr ||
@@ -544,6 +702,7 @@ namespace hpx::execution::experimental {
             ~shared_data()
             {
                 set_state_all(thread_state::stopping);
+                notify_sleeping();
                 set_state_main_thread(thread_state::stopped);
                 wait_state_all(thread_state::stopped);
 
@@ -563,6 +722,8 @@ namespace hpx::execution::experimental {
                     stacksize_ == rhs.stacksize_ &&
                     schedule_ == rhs.schedule_ &&
                     yield_delay_ == rhs.yield_delay_ &&
+                    suspend_delay_ == rhs.suspend_delay_ &&
+                    tree_threshold_ == rhs.tree_threshold_ &&
                     pu_mask_ == rhs.pu_mask_;
             }
 
@@ -656,8 +817,6 @@ namespace hpx::execution::experimental {
                                 exception = HPX_MOVE(ep);
                             }
                         });
-
-                    set_state(data.state_, thread_state::idle);
                 }
 
                 // Main entry point for a single parallel region (dynamic
@@ -760,8 +919,6 @@ namespace hpx::execution::experimental {
                                 exception = HPX_MOVE(ep);
                             }
                         });
-
-                    set_state(data.state_, thread_state::idle);
                 }
             };
 
@@ -821,8 +978,6 @@ namespace hpx::execution::experimental {
                                 exception = HPX_MOVE(ep);
                             }
                         });
-
-                    set_state(data.state_, thread_state::idle);
                 }
             };
 
@@ -843,8 +998,16 @@ namespace hpx::execution::experimental {
                         Args>::call_dynamic;
                 }
 
+                // With a tree only the main thread's data is set here, the
+                // worker threads pass it on to their children.
+                bool const tree = use_tree();
                 for (std::size_t t = 0; t != num_threads_; ++t)
                 {
+                    if (tree && t != main_thread_)
+                    {
+                        continue;
+                    }
+
                     region_data& data = region_data_[t].data_;
 
                     data.element_function_ = &f;
@@ -855,6 +1018,15 @@ namespace hpx::execution::experimental {
 
                     data.state_.store(state, std::memory_order_release);
                 }
+
+                if (tree)
+                {
+                    fan_out(main_thread_);
+                }
+                else
+                {
+                    notify_sleeping();
+                }
                 return func;
             }
 
@@ -866,8 +1038,14 @@ namespace hpx::execution::experimental {
                 constexpr thread_function_helper_type* func =
                     &thread_function_helper_invoke<Fs, Args>::call;
 
+                bool const tree = use_tree();
                 for (std::size_t t = 0; t != num_threads_; ++t)
                 {
+                    if (tree && t != main_thread_)
+                    {
+                        continue;
+                    }
+
                     region_data& data = region_data_[t].data_;
 
                     data.element_function_ = &function_pack;
@@ -878,6 +1056,14 @@ namespace hpx::execution::experimental {
                     data.state_.store(state, std::memory_order_release);
                 }
 
+                if (tree)
+                {
+                    fan_out(main_thread_);
+                }
+                else
+                {
+                    notify_sleeping();
+                }
                 return func;
             }
 
@@ -889,8 +1075,13 @@ namespace hpx::execution::experimental {
                     exception_mutex_, exception_);
 
                 // Wait for all threads to finish their work assigned to
-                // them in this parallel region.
-                wait_state_all(thread_state::idle);
+                // them in this parallel region. With a tree, this is done once
+                // the children of the main thread are done.
+                finish_region(main_thread_);
+                if (!use_tree())
+                {
+                    wait_state_all(thread_state::idle);
+                }
 
                 // rethrow exception, if any
                 if (exception_)
@@ -899,19 +1090,110 @@ namespace hpx::execution::experimental {
                 }
             }
 
+            // Draw a ticket and wait for all parallel regions submitted
+            // earlier to finish. The next parallel region is started once
+            // this object goes out of scope.
+            class scoped_region
+            {
+            public:
+                explicit scoped_region(shared_data& data)
+                  : data_(data)
+                {
+                    std::uint64_t const ticket =
+                        data_.next_ticket_.data_.fetch_add(
+                            1, std::memory_order_relaxed);
+                    hpx::util::yield_while(
+                        [&] {
+                            return data_.now_serving_.data_.load(
+                                       std::memory_order_acquire) != ticket;
+                        },
+                        "fork_join_executor::scoped_region");
+
+                    data_.submitter_.store(threads::get_self_id().get(),
+                        std::memory_order_relaxed);
+                }
+
+                scoped_region(scoped_region const&) = delete;
+                scoped_region(scoped_region&&) = delete;
+                scoped_region& operator=(scoped_region const&) = delete;
+                scoped_region& operator=(scoped_region&&) = delete;
+
+                ~scoped_region()
+                {
+                    data_.submitter_.store(nullptr, std::memory_order_relaxed);
+                    data_.now_serving_.data_.fetch_add(
+                        1, std::memory_order_release);
+                }
+
+            private:
+                shared_data& data_;
+            };
+
+            // Return whether the calling thread takes part in the parallel
+            // region that is currently being executed.
+            [[nodiscard]] bool is_nested_region() const noexcept
+            {
+                if (next_ticket_.data_.load(std::memory_order_acquire) ==
+                    now_serving_.data_.load(std::memory_order_acquire))
+                {
+                    return false;
+                }
+
+                auto const self = threads::get_self_id();
+                if (submitter_.load(std::memory_order_relaxed) == self.get())
+                {
+                    return true;
+                }
+
+                return std::any_of(region_data_.begin(), region_data_.end(),
+                    [&](auto const& data) {
+                        return data.data_.thread_id_.load(
+                                   std::memory_order_relaxed) == self.get();
+                    });
+            }
+
+            // Nested parallel regions are executed sequentially on the calling
+            // thread.
+            template <typename F, typename S, typename... Ts>
+            static decltype(auto) bulk_sync_execute_inline(
+                F&& f, S const& shape, Ts&&... ts)
+            {
+                using result_type =
+                    hpx::parallel::execution::detail::bulk_execute_result_t<F,
+                        S, Ts...>;
+
+                std::size_t const size = hpx::util::size(shape);
+                auto it = hpx::util::begin(shape);
+                if constexpr (std::is_void_v<result_type>)
+                {
+                    for (std::size_t i = 0; i != size; (void) ++it, ++i)
+                    {
+                        HPX_INVOKE(f, *it, ts...);
+                    }
+                }
+                else
+                {
+                    result_type results(size);
+                    for (std::size_t i = 0; i != size; (void) ++it, ++i)
+                    {
+                        results[i] = HPX_INVOKE(f, *it, ts...);
+                    }
+                    return results;
+                }
+            }
+
         public:
             template <typename F, typename S, typename... Ts>
             decltype(auto) bulk_sync_execute(F&& f, S const& shape, Ts&&... ts)
             {
-                // protect against nested use of this executor instance
-                if (region_data_[main_thread_].data_.state_.load(
-                        std::memory_order_relaxed) != thread_state::idle)
+                if (is_nested_region())
                 {
-                    HPX_THROW_EXCEPTION(error::bad_request, "bulk_sync_execute",
-                        "unexpected state, is this instance of "
-                        "fork_join_executor being used in nested ways?");
+                    return bulk_sync_execute_inline(
+                        HPX_FORWARD(F, f), shape, HPX_FORWARD(Ts, ts)...);
                 }
 
+                scoped_region region(*this);
+
 #if defined(HPX_HAVE_THREAD_DESCRIPTION)
                 hpx::scoped_annotation annotate(
                     generate_annotation(hpx::get_worker_thread_num(),
@@ -990,16 +1272,18 @@ namespace hpx::execution::experimental {
             void sync_invoke_helper(FunctionPack& function_pack,
                 std::size_t first, std::size_t size)
             {
-                // protect against nested use of this executor instance
-                if (region_data_[main_thread_].data_.state_.load(
-                        std::memory_order_relaxed) != thread_state::idle)
+                if (is_nested_region())
                 {
-                    HPX_THROW_EXCEPTION(error::bad_request,
-                        "sync_invoke_helper",
-                        "unexpected state, is this instance of "
-                        "fork_join_executor being used in nested ways?");
+                    for (std::size_t i = first; i != first + size; ++i)
+                    {
+                        hpx::visit([](auto&& f) { f(); },
+                            hpx::detail::runtime_get(function_pack, i));
+                    }
+                    return;
                 }
 
+                scoped_region region(*this);
+
                 // Set the data for this parallel region
 #if defined(HPX_HAVE_THREAD_DESCRIPTION)
                 hpx::scoped_annotation annotate(
@@ -1016,19 +1300,7 @@ namespace hpx::execution::experimental {
                     set_all_states_and_region_data_invoke(
                         thread_state::partitioning_work, function_pack, args);
 
-                // Start work on the main thread.
-                func(region_data_, main_thread_, num_threads_, queues_,
-                    exception_mutex_, exception_);
-
-                // Wait for all threads to finish their work assigned to
-                // them in this parallel region.
-                wait_state_all(thread_state::idle);
-
-                // rethrow exception, if any
-                if (exception_)
-                {
-                    std::rethrow_exception(HPX_MOVE(exception_));
-                }
+                invoke_work(func);
             }
 
             template <typename... Fs>
@@ -1149,12 +1421,20 @@ namespace hpx::execution::experimental {
         /// \param schedule The loop schedule of the parallel regions.
         /// \param yield_delay The time after which the executor yields to other
         ///        work if it has not received any new work for execution.
+        /// \param suspend_delay The time after which idle worker threads
+        ///        suspend until they receive new work for execution.
+        /// \param tree_threshold Parallel regions are distributed to and
+        ///        joined from the worker threads along a tree if the number
+        ///        of worker threads exceeds this threshold.
         explicit fork_join_executor(
             threads::thread_priority priority = threads::thread_priority::bound,
             threads::thread_stacksize stacksize =
                 threads::thread_stacksize::small_,
             loop_schedule schedule = loop_schedule::static_,
-            std::chrono::nanoseconds yield_delay = std::chrono::milliseconds(1))
+            std::chrono::nanoseconds yield_delay = std::chrono::milliseconds(1),
+            std::chrono::nanoseconds suspend_delay =
+                std::chrono::milliseconds(100),
+            std::size_t tree_threshold = 64)
         {
             if (stacksize == threads::thread_stacksize::nostack)
             {
@@ -1165,8 +1445,8 @@ namespace hpx::execution::experimental {
                     "threads are required to yield correctly when idle)");
             }
 
-            shared_data_ = std::make_shared<shared_data>(
-                priority, stacksize, schedule, yield_delay);
+            shared_data_ = std::make_shared<shared_data>(priority, stacksize,
+                schedule, yield_delay, suspend_delay, tree_threshold);
         }
 
         /// \brief Construct a fork_join_executor.
@@ -1178,12 +1458,20 @@ namespace hpx::execution::experimental {
         /// \param schedule The loop schedule of the parallel regions.
         /// \param yield_delay The time after which the executor yields to other
         ///        work if it has not received any new work for execution.
+        /// \param suspend_delay The time after which idle worker threads
+        ///        suspend until they receive new work for execution.
+        /// \param tree_threshold Parallel regions are distributed to and
+        ///        joined from the worker threads along a tree if the number
+        ///        of worker threads exceeds this threshold.
         explicit fork_join_executor(hpx::threads::mask_cref_type pu_mask,
             threads::thread_priority priority = threads::thread_priority::bound,
             threads::thread_stacksize stacksize =
                 threads::thread_stacksize::small_,
             loop_schedule schedule = loop_schedule::static_,
-            std::chrono::nanoseconds yield_delay = std::chrono::milliseconds(1))
+            std::chrono::nanoseconds yield_delay = std::chrono::milliseconds(1),
+            std::chrono::nanoseconds suspend_delay =
+                std::chrono::milliseconds(100),
+            std::size_t tree_threshold = 64)
         {
             if (stacksize == threads::thread_stacksize::nostack)
             {
@@ -1194,8 +1482,8 @@ namespace hpx::execution::experimental {
                     "threads are required to yield correctly when idle)");
             }
 
-            shared_data_ = std::make_shared<shared_data>(
-                priority, stacksize, schedule, yield_delay, pu_mask);
+            shared_data_ = std::make_shared<shared_data>(priority, stacksize,
+                schedule, yield_delay, suspend_delay, tree_threshold, pu_mask);
         }
 
         friend fork_join_executor tag_invoke(
@@ -12,7 +12,9 @@
 #include <hpx/concepts/concepts.hpp>
 #include <hpx/errors/try_catch_exception_ptr.hpp>
 #include <hpx/execution/detail/post_policy_dispatch.hpp>
+#include <hpx/execution/executors/dynamic_chunk_size.hpp>
 #include <hpx/execution/executors/execution_parameters.hpp>
+#include <hpx/execution/executors/guided_chunk_size.hpp>
 #include <hpx/execution/queries/get_scheduler.hpp>
 #include <hpx/execution_base/completion_scheduler.hpp>
 #include <hpx/execution_base/completion_signatures.hpp>
@@ -25,6 +27,7 @@
 #include <hpx/timing/steady_clock.hpp>
 
 #include <cstddef>
+#include <cstdint>
 #include <exception>
 #include <string>
 #include <type_traits>
@@ -32,8 +35,62 @@
 
 namespace hpx::execution::experimental {
 
+    ///////////////////////////////////////////////////////////////////////////
+    // Bulk operations on a thread_pool_scheduler split their iteration space
+    // into chunks. By default (static_) the chunks are distributed to the
+    // worker threads when the operation is started. In the dynamic modes each
+    // worker thread starts with a contiguous partition of the iterations and
+    // repeatedly takes chunks from it while running. Once its partition is
+    // exhausted it takes chunks from the other partitions. The dynamic mode
+    // uses chunks of a fixed size, the guided mode uses chunks proportional to
+    // the number of iterations remaining in the partition.
+    enum class bulk_chunking_mode : std::uint8_t
+    {
+        static_,
+        dynamic,
+        guided
+    };
+
+    struct bulk_chunking
+    {
+        bulk_chunking_mode mode = bulk_chunking_mode::static_;
+
+        // fixed chunk size (dynamic) or minimal chunk size (guided)
+        std::size_t chunk_size = 0;
+    };
+
     namespace detail {
 
+        // Derive the chunking of bulk operations from the given executor
+        // parameters: dynamic_chunk_size selects the dynamic mode,
+        // guided_chunk_size the guided mode.
+        template <typename Scheduler, typename Parameters>
+        bulk_chunking get_bulk_chunking(
+            [[maybe_unused]] Scheduler const& scheduler,
+            [[maybe_unused]] Parameters& params)
+        {
+            using parameters_type = std::decay_t<Parameters>;
+            if constexpr (std::is_same_v<parameters_type, dynamic_chunk_size>)
+            {
+                return {bulk_chunking_mode::dynamic,
+                    get_chunk_size(params, scheduler,
+                        hpx::chrono::null_duration, 1, 0)};
+            }
+            else if constexpr (std::is_same_v<parameters_type,
+                                   guided_chunk_size>)
+            {
+                // the guided chunk size for zero remaining iterations is the
+                // minimal chunk size
+                return {bulk_chunking_mode::guided,
+                    get_chunk_size(params, scheduler,
+                        hpx::chrono::null_duration, 1, 0)};
+            }
+            else
+            {
+                return {};
+            }
+        }
+
         template <typename Policy>
         struct get_default_scheduler_policy
         {
@@ -152,6 +209,24 @@ namespace hpx::execution::experimental {
             return exec.get_first_core();
         }
 
+        // support with_bulk_chunking property
+        // clang-format off
+        template <typename Executor_, typename Parameters,
+            HPX_CONCEPT_REQUIRES_(
+                std::is_convertible_v<Executor_, thread_pool_policy_scheduler> &&
+                hpx::traits::is_executor_parameters_v<std::decay_t<Parameters>>
+            )>
+        // clang-format on
+        friend auto tag_invoke(
+            hpx::execution::experimental::with_bulk_chunking_t,
+            Executor_ const& scheduler, Parameters&& params)
+        {
+            auto scheduler_with_chunking = scheduler;
+            scheduler_with_chunking.bulk_chunking_ =
+                detail::get_bulk_chunking(scheduler, params);
+            return scheduler_with_chunking;
+        }
+
 #if defined(HPX_HAVE_THREAD_DESCRIPTION)
         // support with_annotation property
         // clang-format off
@@ -387,6 +462,11 @@ namespace hpx::execution::experimental {
         {
             return policy_;
         }
+
+        constexpr bulk_chunking const& get_bulk_chunking() const noexcept
+        {
+            return bulk_chunking_;
+        }
         /// \endcond
 
     private:
@@ -428,6 +508,7 @@ namespace hpx::execution::experimental {
         Policy policy_;
         std::size_t first_core_ = 0;
         std::size_t num_cores_ = 0;
+        bulk_chunking bulk_chunking_;
 #if defined(HPX_HAVE_THREAD_DESCRIPTION)
         char const* annotation_ = nullptr;
 #endif
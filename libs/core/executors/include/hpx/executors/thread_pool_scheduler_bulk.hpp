@@ -15,6 +15,7 @@
 #include <hpx/assert.hpp>
 #include <hpx/concepts/concepts.hpp>
 #include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/concurrency/detail/contiguous_index_queue.hpp>
 #include <hpx/concurrency/detail/non_contiguous_index_queue.hpp>
 #include <hpx/coroutines/thread_enums.hpp>
 #include <hpx/datastructures/tuple.hpp>
@@ -68,6 +69,22 @@ namespace hpx::execution::experimental::detail {
         return static_cast<std::uint32_t>(chunk_size);
     }
 
+    // Compute the number of iterations a worker thread takes at once from a
+    // partition with the given number of remaining iterations when using the
+    // dynamic or guided chunking. The guided chunking takes a quarter of the
+    // remaining iterations, but not less than the minimal chunk size.
+    constexpr std::uint32_t get_bulk_dynamic_chunk_size(
+        bulk_chunking const& chunking, std::uint32_t const remaining) noexcept
+    {
+        auto const chunk_size = static_cast<std::uint32_t>(
+            (std::max)(chunking.chunk_size, std::size_t(1)));
+        if (chunking.mode == bulk_chunking_mode::guided)
+        {
+            return (std::max)(chunk_size, (remaining + 3) / 4);
+        }
+        return chunk_size;
+    }
+
     template <std::size_t... Is, typename F, typename T, typename Ts>
     constexpr void bulk_scheduler_invoke_helper(
         hpx::util::index_pack<Is...>, F&& f, T&& t, Ts& ts)
@@ -131,6 +148,22 @@ namespace hpx::execution::experimental::detail {
         }
 
     private:
+        // Perform the work for the elements [i_begin, i_end) of the given
+        // shape.
+        template <typename Ts>
+        void do_work_range(
+            Ts& ts, std::size_t const i_begin, std::size_t const i_end) const
+        {
+            using index_pack_type = hpx::detail::fused_index_pack_t<Ts>;
+
+            auto it = std::next(hpx::util::begin(op_state->shape), i_begin);
+            for (std::size_t i = i_begin; i != i_end; (void) ++it, ++i)
+            {
+                bulk_scheduler_invoke_helper(
+                    index_pack_type{}, op_state->f, *it, ts);
+            }
+        }
+
         // Perform the work in one element indexed by index. The index
         // represents a range of indices (iterators) in the given shape.
         template <typename Ts>
@@ -142,18 +175,53 @@ namespace hpx::execution::experimental::detail {
 
             hpx::util::itt::mark_event e(notify_event);
 #endif
-            using index_pack_type = hpx::detail::fused_index_pack_t<Ts>;
-
             auto const i_begin =
                 static_cast<std::size_t>(index) * task_f->chunk_size;
             auto const i_end =
                 (std::min)(i_begin + task_f->chunk_size, task_f->size);
 
-            auto it = std::next(hpx::util::begin(op_state->shape), i_begin);
-            for (std::uint32_t i = i_begin; i != i_end; (void) ++it, ++i)
+            do_work_range(ts, i_begin, i_end);
+        }
+
+        // Perform the work for the iterations of the partition owned by the
+        // worker thread, taking as many of them at once as the dynamic or
+        // guided chunking allows. Then take iterations from the opposite end
+        // of the partitions of the neighboring worker threads.
+        template <hpx::concurrency::detail::queue_end Which, typename Ts>
+        void do_work_dynamic(Ts& ts) const
+        {
+            auto const get_count = [this](std::uint32_t remaining) {
+                return get_bulk_dynamic_chunk_size(
+                    op_state->chunking, remaining);
+            };
+
+            auto worker_thread = task_f->worker_thread;
+            auto& local_range = op_state->ranges[worker_thread];
+
+            hpx::optional<std::pair<std::uint32_t, std::uint32_t>> indices;
+            while ((indices = local_range.template pop_n<Which>(get_count)))
             {
-                bulk_scheduler_invoke_helper(
-                    index_pack_type{}, op_state->f, *it, ts);
+                do_work_range(ts, indices->first, indices->second);
+            }
+
+            if (task_f->allow_stealing)
+            {
+                static constexpr auto opposite_end =
+                    hpx::concurrency::detail::opposite_end_v<Which>;
+
+                for (std::uint32_t offset = 1;
+                     offset != op_state->num_worker_threads; ++offset)
+                {
+                    std::size_t neighbor_thread =
+                        (worker_thread + offset) % op_state->num_worker_threads;
+                    auto& neighbor_range = op_state->ranges[neighbor_thread];
+
+                    while ((indices = neighbor_range.template pop_n<
+                                opposite_end>(get_count)))
+                    {
+                        do_work_range(ts, indices->first, indices->second);
+                    }
+                }
             }
         }
 
@@ -206,6 +274,21 @@ namespace hpx::execution::experimental::detail {
         // clang-format on
         void operator()(Ts& ts) const
         {
+            if (op_state->chunking.mode != bulk_chunking_mode::static_)
+            {
+                if (task_f->reverse_placement)
+                {
+                    do_work_dynamic<hpx::concurrency::detail::queue_end::right>(
+                        ts);
+                }
+                else
+                {
+                    do_work_dynamic<hpx::concurrency::detail::queue_end::left>(
+                        ts);
+                }
+                return;
+            }
+
             // schedule chunks from the end, if needed
             if (task_f->reverse_placement)
             {
@@ -387,14 +470,35 @@ namespace hpx::execution::experimental::detail {
             queue.reset(part_begin, part_end, num_threads);
         }
 
+        // Initialize the partition of iterations for a worker thread when
+        // using the dynamic or guided chunking.
+        void init_range(std::uint32_t const worker_thread,
+            std::uint32_t const size, std::uint32_t num_threads) noexcept
+        {
+            auto& range = op_state->ranges[worker_thread];
+            auto const part_begin = static_cast<std::uint32_t>(
+                (std::uint64_t(worker_thread) * size) / num_threads);
+            auto const part_end = static_cast<std::uint32_t>(
+                (std::uint64_t(worker_thread + 1) * size) / num_threads);
+            range.reset(part_begin, part_end);
+        }
+
+        bool has_work(std::uint32_t const worker_thread) const noexcept
+        {
+            if (op_state->chunking.mode != bulk_chunking_mode::static_)
+            {
+                return !op_state->ranges[worker_thread].empty();
+            }
+            return !op_state->queues[worker_thread].data_.empty();
+        }
+
         // Spawn a task which will process a number of chunks. If the queue
         // contains no chunks no task will be spawned.
         template <typename Task>
         void do_work_task(Task&& task_f) const
         {
             std::uint32_t const worker_thread = task_f.worker_thread;
-            auto& queue = op_state->queues[worker_thread].data_;
-            if (queue.empty())
+            if (!has_work(worker_thread))
             {
                 // If the queue is empty we don't spawn a task. We only signal
                 // that this "task" is ready.
@@ -460,9 +564,15 @@ namespace hpx::execution::experimental::detail {
                 return;
             }
 
-            // Calculate chunk size and number of chunks
-            std::uint32_t chunk_size = get_bulk_scheduler_chunk_size(
-                op_state->num_worker_threads, size);
+            // Calculate chunk size and number of chunks. The dynamic and
+            // guided chunking use the given (minimal) chunk size to limit the
+            // number of worker threads only.
+            bool const dynamic_chunking =
+                op_state->chunking.mode != bulk_chunking_mode::static_;
+            std::uint32_t chunk_size = dynamic_chunking ?
+                get_bulk_dynamic_chunk_size(op_state->chunking, 0) :
+                get_bulk_scheduler_chunk_size(
+                    op_state->num_worker_threads, size);
             std::uint32_t num_chunks = (size + chunk_size - 1) / chunk_size;
 
             // launch only as many tasks as we have chunks
@@ -494,7 +604,15 @@ namespace hpx::execution::experimental::detail {
             for (std::uint32_t worker_thread = 0;
                  worker_thread != op_state->num_worker_threads; ++worker_thread)
             {
-                if (hint.placement_mode() == placement::breadth_first ||
+                if (dynamic_chunking)
+                {
+                    // the partitions are consumed in chunks of varying size,
+                    // thus they always cover contiguous iterations
+                    init_range(worker_thread, size,
+                        static_cast<std::uint32_t>(
+                            op_state->num_worker_threads));
+                }
+                else if (hint.placement_mode() == placement::breadth_first ||
                     hint.placement_mode() == placement::breadth_first_reverse)
                 {
                     init_queue_breadth_first(worker_thread, num_chunks,
@@ -614,6 +732,13 @@ namespace hpx::execution::experimental::detail {
     // thread will be spawned. Once the HPX thread has finished working on its
     // own queue, it will attempt to steal work from other queues.
     //
+    // If the scheduler was given dynamic or guided chunking (see
+    // with_bulk_chunking) every worker thread instead owns a contiguous
+    // partition of the iterations from which it takes chunks while running.
+    // The chunk size is fixed (dynamic) or shrinks with the number of
+    // remaining iterations (guided), which balances iterations of varying
+    // cost. Idle worker threads take chunks from the other partitions.
+    //
     // Since predecessor sender must complete on an HPX thread (the completion
     // scheduler is a thread_pool_scheduler; otherwise the customization defined
     // in this file is not chosen) it will be reused as one of the worker
@@ -778,9 +903,12 @@ namespace hpx::execution::experimental::detail {
             std::size_t first_thread;
             std::size_t num_worker_threads;
             hpx::threads::mask_type pu_mask;
+            bulk_chunking chunking;
             std::vector<hpx::util::cache_aligned_data<
                 hpx::concurrency::detail::non_contiguous_index_queue<>>>
                 queues;
+            std::vector<hpx::concurrency::detail::contiguous_index_queue<>>
+                ranges;
             HPX_NO_UNIQUE_ADDRESS std::decay_t<Shape> shape;
             HPX_NO_UNIQUE_ADDRESS std::decay_t<F> f;
             HPX_NO_UNIQUE_ADDRESS std::decay_t<Receiver> receiver;
@@ -809,7 +937,13 @@ namespace hpx::execution::experimental::detail {
                         hpx::execution::experimental::null_parameters,
                         scheduler, hpx::chrono::null_duration, 0))
               , pu_mask(HPX_MOVE(pumask))
-              , queues(num_worker_threads)
+              , chunking(this->scheduler.get_bulk_chunking())
+              , queues(chunking.mode == bulk_chunking_mode::static_ ?
+                        num_worker_threads :
+                        0)
+              , ranges(chunking.mode == bulk_chunking_mode::static_ ?
+                        0 :
+                        num_worker_threads)
               , shape(HPX_FORWARD(Shape_, shape))
               , f(HPX_FORWARD(F_, f))
               , receiver(HPX_FORWARD(Receiver_, receiver))
@@ -0,0 +1,193 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures bulk operations on the thread_pool_scheduler whose
+// iterations have very different costs. The default static chunking is
+// compared with the dynamic and guided chunking selected through
+// with_bulk_chunking. The costs of the iterations are either uniform, grow
+// linearly with the iteration index, or are concentrated in a few expensive
+// iterations.
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/execution.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/format.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace ex = hpx::execution::experimental;
+namespace tt = hpx::this_thread::experimental;
+
+///////////////////////////////////////////////////////////////////////////////
+// Simulate work proportional to the given cost.
+std::uint64_t do_work(std::uint64_t cost)
+{
+    std::uint64_t result = cost;
+    for (std::uint64_t i = 0; i != cost; ++i)
+    {
+        result = result * 6364136223846793005ULL + 1442695040888963407ULL;
+    }
+    return result;
+}
+
+enum class cost_distribution
+{
+    uniform,
+    linear,
+    spikes
+};
+
+char const* get_name(cost_distribution dist)
+{
+    switch (dist)
+    {
+    case cost_distribution::uniform:
+        return "uniform";
+    case cost_distribution::linear:
+        return "linear";
+    case cost_distribution::spikes:
+        [[fallthrough]];
+    default:
+        return "spikes";
+    }
+}
+
+// The average cost of an iteration is about the same for all distributions.
+std::vector<std::uint64_t> make_costs(
+    cost_distribution dist, std::size_t size, std::uint64_t cost)
+{
+    std::vector<std::uint64_t> costs(size, cost);
+    switch (dist)
+    {
+    case cost_distribution::linear:
+        for (std::size_t i = 0; i != size; ++i)
+        {
+            costs[i] = 2 * cost * i / size;
+        }
+        break;
+
+    case cost_distribution::spikes:
+        // every 64th iteration is expensive, most of them are located in the
+        // first eighth of the iteration space
+        for (std::size_t i = 0; i != size; ++i)
+        {
+            costs[i] = (i % 64 == 0 && (i < size / 8 || i % 512 == 0)) ?
+                4 * 64 * cost :
+                1;
+        }
+        break;
+
+    case cost_distribution::uniform:
+        [[fallthrough]];
+    default:
+        break;
+    }
+    return costs;
+}
+
+template <typename Scheduler>
+void run_bulk(Scheduler const& sched, std::vector<std::uint64_t> const& costs,
+    std::vector<std::uint64_t>& results)
+{
+    auto f = [&](std::size_t i) { results[i] = do_work(costs[i]); };
+
+#if defined(HPX_HAVE_STDEXEC)
+    tt::sync_wait(ex::schedule(sched) | ex::bulk(costs.size(), f));
+#else
+    ex::schedule(sched) | ex::bulk(costs.size(), f) | tt::sync_wait();
+#endif
+}
+
+void bench_bulk(cost_distribution dist, std::size_t size, std::uint64_t cost,
+    std::size_t chunk_size, int test_count)
+{
+    std::vector<std::uint64_t> const costs = make_costs(dist, size, cost);
+    std::vector<std::uint64_t> results(size);
+
+    ex::thread_pool_scheduler const sched;
+
+    std::string const name =
+        hpx::util::format("bulk {} {}", get_name(dist), size);
+
+    hpx::util::perftests_report(name, "static", test_count,
+        [&]() { run_bulk(sched, costs, results); });
+
+    auto const dynamic_sched = ex::with_bulk_chunking(
+        sched, hpx::execution::dynamic_chunk_size(chunk_size));
+    hpx::util::perftests_report(name, "dynamic", test_count,
+        [&]() { run_bulk(dynamic_sched, costs, results); });
+
+    auto const guided_sched = ex::with_bulk_chunking(
+        sched, hpx::execution::guided_chunk_size(chunk_size));
+    hpx::util::perftests_report(name, "guided", test_count,
+        [&]() { run_bulk(guided_sched, costs, results); });
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    int const test_count = vm["test_count"].as<int>();
+    std::size_t const size = vm["size"].as<std::size_t>();
+    std::uint64_t const cost = vm["cost"].as<std::uint64_t>();
+    std::size_t const chunk_size = vm["chunk-size"].as<std::size_t>();
+
+    hpx::util::perftests_init(vm);
+
+    // verify that input is within domain of program
+    if (test_count <= 0 || size == 0)
+    {
+        std::cerr << "test_count and size have to be positive...\n"
+                  << std::flush;
+        hpx::local::finalize();
+        return -1;
+    }
+
+    for (auto dist : {cost_distribution::uniform, cost_distribution::linear,
+             cost_distribution::spikes})
+    {
+        bench_bulk(dist, size, cost, chunk_size, test_count);
+    }
+
+    hpx::util::perftests_print_times();
+
+    return hpx::local::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+
+    options_description cmdline("usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("test_count", value<int>()->default_value(10),
+            "number of tests to be averaged")
+        ("size", value<std::size_t>()->default_value(100000),
+            "number of iterations of the bulk operation")
+        ("cost", value<std::uint64_t>()->default_value(1000),
+            "average cost of an iteration")
+        ("chunk-size", value<std::size_t>()->default_value(16),
+            "(minimal) chunk size for the dynamic and guided chunking")
+        ;
+    // clang-format on
+
+    hpx::util::perftests_cfg(cmdline);
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+    init_args.cfg = {"hpx.os_threads=all"};
+
+    return hpx::local::init(hpx_main, argc, argv, init_args);
+}
+#endif
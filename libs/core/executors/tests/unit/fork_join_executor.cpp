@@ -14,6 +14,7 @@
 
 #include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <cstddef>
 #include <cstdlib>
 #include <iostream>
@@ -435,6 +436,90 @@ void test_invoke_sync_exception(ExecutorArgs&&... args)
     HPX_TEST(caught_exception);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+template <typename... ExecutorArgs>
+void test_bulk_sync_concurrent(ExecutorArgs&&... args)
+{
+    std::cerr << "test_bulk_sync_concurrent\n";
+
+    count1 = 0;
+    constexpr std::size_t n = 107;
+    constexpr std::size_t num_submitters = 4;
+    constexpr std::size_t num_regions = 10;
+    std::vector<int> v(n);
+    std::iota(std::begin(v), std::end(v), std::rand());
+
+    // several threads share the same executor
+    fork_join_executor exec{std::forward<ExecutorArgs>(args)...};
+
+    std::vector<hpx::future<void>> submitters;
+    for (std::size_t i = 0; i != num_submitters; ++i)
+    {
+        submitters.push_back(hpx::async([&]() {
+            for (std::size_t j = 0; j != num_regions; ++j)
+            {
+                hpx::parallel::execution::bulk_sync_execute(
+                    exec, &bulk_test, v, 42);
+            }
+        }));
+    }
+    hpx::wait_all(submitters);
+
+    HPX_TEST_EQ(count1.load(), num_submitters * num_regions * n);
+}
+
+template <typename... ExecutorArgs>
+void test_bulk_sync_nested(ExecutorArgs&&... args)
+{
+    std::cerr << "test_bulk_sync_nested\n";
+
+    count1 = 0;
+    constexpr std::size_t n = 17;
+    std::vector<int> v(n);
+    std::iota(std::begin(v), std::end(v), std::rand());
+
+    fork_join_executor exec{std::forward<ExecutorArgs>(args)...};
+
+    // nested parallel regions are executed sequentially
+    auto results = hpx::parallel::execution::bulk_sync_execute(
+        exec,
+        [&](int, int passed_through) {
+            hpx::parallel::execution::bulk_sync_execute(
+                exec, &bulk_test, v, passed_through);
+            return passed_through;
+        },
+        v, 42);
+
+    HPX_TEST_EQ(count1.load(), n * n);
+    HPX_TEST_EQ(results.size(), n);
+    for (int r : results)
+    {
+        HPX_TEST_EQ(r, 42);
+    }
+}
+
+template <typename... ExecutorArgs>
+void test_bulk_sync_suspended(ExecutorArgs&&... args)
+{
+    std::cerr << "test_bulk_sync_suspended\n";
+
+    count1 = 0;
+    constexpr std::size_t n = 107;
+    std::vector<int> v(n);
+    std::iota(std::begin(v), std::end(v), std::rand());
+
+    // the worker threads suspend shortly after finishing a parallel region
+    fork_join_executor exec{std::forward<ExecutorArgs>(args)...,
+        std::chrono::microseconds(10), std::chrono::microseconds(100)};
+
+    for (std::size_t i = 0; i != 3; ++i)
+    {
+        hpx::this_thread::sleep_for(std::chrono::milliseconds(10));
+        hpx::parallel::execution::bulk_sync_execute(exec, &bulk_test, v, 42);
+    }
+    HPX_TEST_EQ(count1.load(), 3 * n);
+}
+
 void static_check_executor()
 {
     using namespace hpx::traits;
@@ -468,7 +553,36 @@ void test_executor(hpx::threads::thread_priority priority,
     test_invoke_sync_homogeneous_exception(priority, stacksize, schedule);
     test_invoke_sync_exception(priority, stacksize, schedule);
 
+    test_bulk_sync_concurrent(priority, stacksize, schedule);
+    test_bulk_sync_nested(priority, stacksize, schedule);
+    test_bulk_sync_suspended(priority, stacksize, schedule);
+
     test_processing_mask(priority, stacksize, schedule);
+
+    // distribute and join the parallel regions along a tree, even for the
+    // small number of worker threads used by the tests
+    std::cerr << "testing fork_join_executor using a tree\n";
+
+    auto const yield_delay = std::chrono::milliseconds(1);
+    auto const suspend_delay = std::chrono::milliseconds(100);
+    constexpr std::size_t tree_threshold = 1;
+
+    test_bulk_sync(priority, stacksize, schedule, yield_delay, suspend_delay,
+        tree_threshold);
+    test_bulk_async(priority, stacksize, schedule, yield_delay, suspend_delay,
+        tree_threshold);
+    test_bulk_sync_exception(priority, stacksize, schedule, yield_delay,
+        suspend_delay, tree_threshold);
+    test_bulk_sync_with_result(priority, stacksize, schedule, yield_delay,
+        suspend_delay, tree_threshold);
+    test_invoke_sync(priority, stacksize, schedule, yield_delay,
+        suspend_delay, tree_threshold);
+    test_bulk_sync_concurrent(priority, stacksize, schedule, yield_delay,
+        suspend_delay, tree_threshold);
+    test_bulk_sync_nested(priority, stacksize, schedule, yield_delay,
+        suspend_delay, tree_threshold);
+    test_processing_mask(priority, stacksize, schedule, yield_delay,
+        suspend_delay, tree_threshold);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
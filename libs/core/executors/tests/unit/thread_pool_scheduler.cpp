@@ -2086,6 +2086,103 @@ void test_bulk()
     }
 }
 
+template <typename Parameters>
+void test_bulk_chunking(Parameters&& params)
+{
+    auto sched = ex::with_bulk_chunking(
+        ex::thread_pool_scheduler{}, std::forward<Parameters>(params));
+
+    // iterations of very different cost are all executed exactly once
+    std::vector<int> const ns = {0, 1, 10, 43, 10007};
+    for (int n : ns)
+    {
+        std::vector<std::atomic<int>> v(n);
+        for (auto& e : v)
+        {
+            e.store(0, std::memory_order_relaxed);
+        }
+
+        auto f = [&](int i) {
+            if (i % 97 == 0)
+            {
+                hpx::this_thread::yield();
+            }
+            ++v[i];
+        };
+
+#if defined(HPX_HAVE_STDEXEC)
+        tt::sync_wait(ex::schedule(sched) | ex::bulk(n, f));
+#else
+        ex::schedule(sched) | ex::bulk(n, f) | tt::sync_wait();
+#endif
+
+        for (int i = 0; i < n; ++i)
+        {
+            HPX_TEST_EQ(v[i].load(), 1);
+        }
+    }
+
+    {
+        bool exception_thrown = false;
+        try
+        {
+#if defined(HPX_HAVE_STDEXEC)
+            tt::sync_wait(ex::schedule(sched) | ex::bulk(100, [](int i) {
+                if (i == 42)
+                {
+                    throw std::runtime_error("error");
+                }
+            }));
+#else
+            ex::schedule(sched) | ex::bulk(100, [](int i) {
+                if (i == 42)
+                {
+                    throw std::runtime_error("error");
+                }
+            }) | tt::sync_wait();
+#endif
+            HPX_TEST(false);
+        }
+        catch (std::runtime_error const& e)
+        {
+            HPX_TEST_EQ(std::string(e.what()), std::string("error"));
+            exception_thrown = true;
+        }
+        HPX_TEST(exception_thrown);
+    }
+}
+
+void test_bulk_chunking()
+{
+    {
+        auto sched = ex::with_bulk_chunking(
+            ex::thread_pool_scheduler{}, hpx::execution::dynamic_chunk_size(7));
+        HPX_TEST(
+            sched.get_bulk_chunking().mode == ex::bulk_chunking_mode::dynamic);
+        HPX_TEST_EQ(sched.get_bulk_chunking().chunk_size, std::size_t(7));
+    }
+
+    {
+        auto sched = ex::with_bulk_chunking(
+            ex::thread_pool_scheduler{}, hpx::execution::guided_chunk_size(3));
+        HPX_TEST(
+            sched.get_bulk_chunking().mode == ex::bulk_chunking_mode::guided);
+        HPX_TEST_EQ(sched.get_bulk_chunking().chunk_size, std::size_t(3));
+    }
+
+    {
+        auto sched = ex::with_bulk_chunking(
+            ex::thread_pool_scheduler{}, hpx::execution::static_chunk_size(3));
+        HPX_TEST(
+            sched.get_bulk_chunking().mode == ex::bulk_chunking_mode::static_);
+    }
+
+    test_bulk_chunking(hpx::execution::dynamic_chunk_size());
+    test_bulk_chunking(hpx::execution::dynamic_chunk_size(16));
+    test_bulk_chunking(hpx::execution::guided_chunk_size());
+    test_bulk_chunking(hpx::execution::guided_chunk_size(8));
+}
+
 void test_completion_scheduler()
 {
     namespace ex = hpx::execution::experimental;
@@ -2226,6 +2323,7 @@ int hpx_main()
     test_let_error();
     test_detach();
     test_bulk();
+    test_bulk_chunking();
     test_completion_scheduler();
 
     return hpx::local::finalize();
@@ -0,0 +1,292 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/allocator_support/internal_allocator.hpp>
+#include <hpx/allocator_support/thread_local_caching_allocator.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/concurrency/stack.hpp>
+#include <hpx/functional/detail/basic_function.hpp>
+#include <hpx/functional/detail/vtable/callable_vtable.hpp>
+#include <hpx/functional/detail/vtable/vtable.hpp>
+#include <hpx/functional/traits/get_function_address.hpp>
+#include <hpx/functional/traits/get_function_annotation.hpp>
+#include <hpx/functional/traits/is_invocable.hpp>
+#include <hpx/modules/itt_notify.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace hpx::lcos::detail {
+
+    // The callbacks attached to a shared state by continuations, dataflow,
+    // when_all, etc. capture the continuation's shared state, the shared state
+    // of the future they wait for, the launch policy and possibly an executor.
+    // This is too large for the small object buffer of hpx::move_only_function,
+    // which would allocate every single one of them from the heap.
+    inline constexpr std::size_t completed_callback_storage_size =
+        8 * sizeof(void*);
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct completed_callback_vtable
+      : util::detail::callable_vtable<void()>
+      , util::detail::callable_info_vtable
+    {
+        template <typename T>
+        static constexpr bool is_stored_inline =
+            sizeof(T) <= completed_callback_storage_size &&
+            alignof(T) <= alignof(std::max_align_t) &&
+            std::is_nothrow_move_constructible_v<T>;
+
+        // callbacks too large to be stored inline are allocated from a
+        // thread-local cache of blocks of the required size
+        template <typename T>
+        using storage_type = std::aligned_storage_t<sizeof(T), alignof(T)>;
+
+        template <typename T>
+        using allocator_type = hpx::util::thread_local_caching_allocator<
+            hpx::lockfree::variable_size_stack, storage_type<T>,
+            hpx::util::internal_allocator<storage_type<T>>>;
+
+        template <typename T>
+        static void* allocate(void* storage)
+        {
+            if constexpr (is_stored_inline<T>)
+            {
+                return storage;
+            }
+            else
+            {
+                allocator_type<T> alloc;
+                return std::allocator_traits<allocator_type<T>>::allocate(
+                    alloc, 1);
+            }
+        }
+
+        // release the memory returned by allocate<T>, the object must have
+        // been destroyed already (or never been constructed)
+        template <typename T>
+        static void release(void* obj) noexcept
+        {
+            if constexpr (!is_stored_inline<T>)
+            {
+                allocator_type<T> alloc;
+                std::allocator_traits<allocator_type<T>>::deallocate(
+                    alloc, static_cast<storage_type<T>*>(obj), 1);
+            }
+        }
+
+        template <typename T>
+        static void _deallocate(void* obj) noexcept
+        {
+            std::destroy_at(std::addressof(util::detail::vtable::get<T>(obj)));
+            release<T>(obj);
+        }
+        void (*deallocate)(void*) noexcept;
+
+        // move the callback stored inline into the given storage, callbacks
+        // allocated separately simply change their owner
+        template <typename T>
+        static void* _relocate(
+            [[maybe_unused]] void* storage, void* obj) noexcept
+        {
+            if constexpr (is_stored_inline<T>)
+            {
+                T& f = util::detail::vtable::get<T>(obj);
+                void* result = ::new (storage) T(HPX_MOVE(f));
+                std::destroy_at(std::addressof(f));
+                return result;
+            }
+            else
+            {
+                return obj;
+            }
+        }
+        void* (*relocate)(void*, void*) noexcept;
+
+        template <typename T>
+        explicit constexpr completed_callback_vtable(
+            util::detail::construct_vtable<T>) noexcept
+          : util::detail::callable_vtable<void()>(
+                util::detail::construct_vtable<T>())
+          , util::detail::callable_info_vtable(
+                util::detail::construct_vtable<T>())
+          , deallocate(&completed_callback_vtable::_deallocate<T>)
+          , relocate(&completed_callback_vtable::_relocate<T>)
+        {
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A move-only nullary function object used for the callbacks invoked once
+    // a shared state becomes ready. Unlike hpx::move_only_function it stores
+    // callbacks of up to completed_callback_storage_size bytes inline.
+    class completed_callback
+    {
+        using vtable = completed_callback_vtable;
+
+    public:
+        completed_callback() noexcept = default;
+
+        completed_callback(std::nullptr_t) noexcept {}
+
+        template <typename F, typename FD = std::decay_t<F>,
+            typename Enable =
+                std::enable_if_t<!std::is_same_v<FD, completed_callback> &&
+                    hpx::is_invocable_r_v<void, FD&>>>
+        completed_callback(F&& f)    //-V1071
+        {
+            if (!util::detail::is_empty_function(f))
+            {
+                constexpr vtable const* f_vptr =
+                    util::detail::get_vtable<vtable, FD>();
+
+                void* buffer = vtable::template allocate<FD>(&storage);
+                try
+                {
+                    object = ::new (buffer) FD(HPX_FORWARD(F, f));
+                }
+                catch (...)
+                {
+                    vtable::template release<FD>(buffer);
+                    throw;
+                }
+                vptr = f_vptr;
+            }
+        }
+
+        completed_callback(completed_callback const&) = delete;
+        completed_callback& operator=(completed_callback const&) = delete;
+
+        completed_callback(completed_callback&& other) noexcept
+        {
+            move_from(other);
+        }
+
+        completed_callback& operator=(completed_callback&& other) noexcept
+        {
+            if (this != &other)
+            {
+                reset();
+                move_from(other);
+            }
+            return *this;
+        }
+
+        ~completed_callback()
+        {
+            reset();
+        }
+
+        void reset() noexcept
+        {
+            if (object != nullptr)
+            {
+                vptr->deallocate(object);
+                vptr = nullptr;
+                object = nullptr;
+            }
+        }
+
+        [[nodiscard]] constexpr bool empty() const noexcept
+        {
+            return object == nullptr;
+        }
+
+        explicit constexpr operator bool() const noexcept
+        {
+            return !empty();
+        }
+
+        HPX_FORCEINLINE void operator()() const
+        {
+            HPX_ASSERT(!empty());
+            vptr->invoke(object);
+        }
+
+#if defined(HPX_HAVE_THREAD_DESCRIPTION)
+        [[nodiscard]] std::size_t get_function_address() const
+        {
+            return empty() ? 0 : vptr->get_function_address(object);
+        }
+
+        [[nodiscard]] char const* get_function_annotation() const
+        {
+            return empty() ? nullptr : vptr->get_function_annotation(object);
+        }
+
+#if HPX_HAVE_ITTNOTIFY != 0 && !defined(HPX_HAVE_APEX)
+        [[nodiscard]] util::itt::string_handle get_function_annotation_itt()
+            const
+        {
+            return empty() ? util::itt::string_handle() :
+                             vptr->get_function_annotation_itt(object);
+        }
+#endif
+#endif
+
+    private:
+        void move_from(completed_callback& other) noexcept
+        {
+            if (other.object != nullptr)
+            {
+                vptr = other.vptr;
+                object = vptr->relocate(&storage, other.object);
+
+                other.vptr = nullptr;
+                other.object = nullptr;
+            }
+        }
+
+        vtable const* vptr = nullptr;
+        void* object = nullptr;
+        alignas(std::max_align_t) mutable unsigned char
+            storage[completed_callback_storage_size];
+    };
+}    // namespace hpx::lcos::detail
+
+#if defined(HPX_HAVE_THREAD_DESCRIPTION)
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::traits {
+
+    template <>
+    struct get_function_address<hpx::lcos::detail::completed_callback>
+    {
+        [[nodiscard]] static std::size_t call(
+            hpx::lcos::detail::completed_callback const& f) noexcept
+        {
+            return f.get_function_address();
+        }
+    };
+
+    template <>
+    struct get_function_annotation<hpx::lcos::detail::completed_callback>
+    {
+        [[nodiscard]] static char const* call(
+            hpx::lcos::detail::completed_callback const& f) noexcept
+        {
+            return f.get_function_annotation();
+        }
+    };
+
+#if HPX_HAVE_ITTNOTIFY != 0 && !defined(HPX_HAVE_APEX)
+    template <>
+    struct get_function_annotation_itt<hpx::lcos::detail::completed_callback>
+    {
+        [[nodiscard]] static util::itt::string_handle call(
+            hpx::lcos::detail::completed_callback const& f) noexcept
+        {
+            return f.get_function_annotation_itt();
+        }
+    };
+#endif
+}    // namespace hpx::traits
+#endif
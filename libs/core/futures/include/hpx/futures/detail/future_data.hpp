@@ -13,6 +13,7 @@
 #include <hpx/datastructures/detail/small_vector.hpp>
 #include <hpx/errors/try_catch_exception_ptr.hpp>
 #include <hpx/functional/function.hpp>
+#include <hpx/futures/detail/completed_callback.hpp>
 #include <hpx/futures/future_fwd.hpp>
 #include <hpx/futures/traits/future_access.hpp>
 #include <hpx/futures/traits/get_remote_result.hpp>
@@ -92,7 +93,7 @@ namespace hpx::lcos::detail {
         future_data_refcnt_base& operator=(future_data_refcnt_base&&) = delete;
 
     public:
-        using completed_callback_type = hpx::move_only_function<void()>;
+        using completed_callback_type = completed_callback;
         using completed_callback_vector_type =
             hpx::detail::small_vector<completed_callback_type, 1,
                 hpx::util::internal_allocator<completed_callback_type>>;
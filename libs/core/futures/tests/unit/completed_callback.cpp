@@ -0,0 +1,205 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/functional/move_only_function.hpp>
+#include <hpx/futures/detail/completed_callback.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+
+using hpx::lcos::detail::completed_callback;
+using hpx::lcos::detail::completed_callback_storage_size;
+using hpx::lcos::detail::completed_callback_vtable;
+
+///////////////////////////////////////////////////////////////////////////////
+int instances = 0;
+int invocations = 0;
+void const* invoked_object = nullptr;
+
+template <std::size_t Size>
+struct callback
+{
+    callback() noexcept
+    {
+        ++instances;
+    }
+
+    callback(callback const&)
+    {
+        ++instances;
+    }
+
+    callback(callback&&) noexcept
+    {
+        ++instances;
+    }
+
+    ~callback()
+    {
+        --instances;
+    }
+
+    void operator()() const
+    {
+        ++invocations;
+        invoked_object = this;
+    }
+
+    char data[Size] = {};
+};
+
+using small_callback = callback<sizeof(void*)>;
+using large_callback = callback<2 * completed_callback_storage_size>;
+
+// callbacks which may throw while being moved are never stored inline
+struct throwing_move_callback : small_callback
+{
+    throwing_move_callback() = default;
+
+    throwing_move_callback(throwing_move_callback&& rhs)
+      : small_callback(std::move(rhs))
+    {
+    }
+};
+
+// callbacks which throw while being constructed
+template <typename Base>
+struct throwing_copy_callback : Base
+{
+    throwing_copy_callback() = default;
+
+    throwing_copy_callback(throwing_copy_callback const& rhs)
+      : Base(rhs)
+    {
+        throw std::runtime_error("throwing_copy_callback");
+    }
+
+    throwing_copy_callback(throwing_copy_callback&&) noexcept = default;
+};
+
+static_assert(completed_callback_vtable::is_stored_inline<small_callback>);
+static_assert(!completed_callback_vtable::is_stored_inline<large_callback>);
+static_assert(
+    !completed_callback_vtable::is_stored_inline<throwing_move_callback>);
+static_assert(completed_callback_vtable::is_stored_inline<
+    throwing_copy_callback<small_callback>>);
+
+///////////////////////////////////////////////////////////////////////////////
+void test_empty()
+{
+    {
+        completed_callback f;
+        HPX_TEST(f.empty());
+        HPX_TEST(!f);
+    }
+    {
+        completed_callback f = nullptr;
+        HPX_TEST(f.empty());
+
+        completed_callback g(std::move(f));
+        HPX_TEST(g.empty());
+        HPX_TEST(f.empty());
+    }
+    {
+        // empty function objects result in an empty callback
+        hpx::move_only_function<void()> func;
+        completed_callback f = std::move(func);
+        HPX_TEST(f.empty());
+
+        void (*fp)() = nullptr;
+        completed_callback g = fp;
+        HPX_TEST(g.empty());
+    }
+    {
+        completed_callback f = small_callback();
+        HPX_TEST(!f.empty());
+        HPX_TEST_EQ(instances, 1);
+
+        f.reset();
+        HPX_TEST(f.empty());
+        HPX_TEST_EQ(instances, 0);
+
+        f.reset();
+        HPX_TEST(f.empty());
+    }
+    HPX_TEST_EQ(instances, 0);
+}
+
+// Callbacks stored inline are moved into the storage of the target, while
+// callbacks stored out of line just change their owner.
+template <typename Callback>
+void test_relocate(bool stored_inline)
+{
+    invocations = 0;
+    {
+        completed_callback f = Callback();
+        HPX_TEST_EQ(instances, 1);
+
+        f();
+        HPX_TEST_EQ(invocations, 1);
+        void const* object = invoked_object;
+
+        completed_callback g(std::move(f));
+        HPX_TEST(f.empty());
+        HPX_TEST(!g.empty());
+        HPX_TEST_EQ(instances, 1);
+
+        g();
+        HPX_TEST_EQ(invocations, 2);
+        HPX_TEST_EQ(invoked_object != object, stored_inline);
+        object = invoked_object;
+
+        completed_callback h = small_callback();
+        HPX_TEST_EQ(instances, 2);
+
+        h = std::move(g);
+        HPX_TEST(g.empty());
+        HPX_TEST_EQ(instances, 1);
+
+        h();
+        HPX_TEST_EQ(invocations, 3);
+        HPX_TEST_EQ(invoked_object != object, stored_inline);
+    }
+    HPX_TEST_EQ(instances, 0);
+}
+
+// A callback whose construction throws leaves nothing behind.
+template <typename Callback>
+void test_throwing_construction()
+{
+    Callback const c;
+    HPX_TEST_EQ(instances, 1);
+
+    bool caught = false;
+    try
+    {
+        completed_callback f = c;
+        HPX_TEST(false);
+    }
+    catch (std::runtime_error const&)
+    {
+        caught = true;
+    }
+    HPX_TEST(caught);
+    HPX_TEST_EQ(instances, 1);
+}
+
+int main()
+{
+    test_empty();
+
+    test_relocate<small_callback>(true);
+    test_relocate<large_callback>(false);
+    test_relocate<throwing_move_callback>(false);
+
+    test_throwing_construction<throwing_copy_callback<small_callback>>();
+    test_throwing_construction<throwing_copy_callback<large_callback>>();
+    HPX_TEST_EQ(instances, 0);
+
+    return hpx::util::report_errors();
+}
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <hpx/config.hpp>
+#include <hpx/coroutines/detail/stack_pool.hpp>
 #include <hpx/coroutines/thread_enums.hpp>
 #include <hpx/ini/ini.hpp>
 #include <hpx/modules/filesystem.hpp>
@@ -91,6 +92,8 @@ namespace hpx::util {
 
         std::size_t get_agas_max_pending_refcnt_requests() const;
 
+        std::size_t get_agas_max_resolve_batch_size() const;
+
         // Load application specific configuration and merge it with the
         // default configuration loaded from hpx.ini
         bool load_application_configuration(
@@ -110,6 +113,12 @@ namespace hpx::util {
 #if defined(__linux) || defined(linux) || defined(__linux__) ||                \
     defined(__FreeBSD__)
         bool use_stack_guard_pages() const;
+
+        // Return whether coroutine stacks should be allocated from the stack
+        // pool and how the pool should be configured.
+        bool use_stack_pool() const;
+        threads::coroutines::detail::posix::stack_pool_parameters
+        get_stack_pool_parameters() const;
 #endif
 
         // return trace_depth for stack-backtraces
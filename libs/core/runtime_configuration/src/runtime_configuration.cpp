@@ -191,6 +191,9 @@ namespace hpx::util {
             "[hpx.lcos.collectives]",
             "arity = ${HPX_LCOS_COLLECTIVES_ARITY:32}",
             "cut_off = ${HPX_LCOS_COLLECTIVES_CUT_OFF:-1}",
+            "direct_sites = ${HPX_LCOS_COLLECTIVES_DIRECT_SITES:4}",
+            "small_message_size = "
+            "${HPX_LCOS_COLLECTIVES_SMALL_MESSAGE_SIZE:16384}",
 
             // connect back to the given latch if specified
             "[hpx.on_startup]",
@@ -214,6 +217,12 @@ namespace hpx::util {
 #if defined(__linux) || defined(linux) || defined(__linux__) ||                \
     defined(__FreeBSD__)
             "use_guard_pages = ${HPX_USE_GUARD_PAGES:1}",
+            "use_pool = ${HPX_STACKS_USE_POOL:0}",
+            "pool_watermark = ${HPX_STACKS_POOL_WATERMARK:64}",
+            "pool_depot_watermark = ${HPX_STACKS_POOL_DEPOT_WATERMARK:1024}",
+            "pool_slab_size = ${HPX_STACKS_POOL_SLAB_SIZE:16}",
+            "pool_prefault = ${HPX_STACKS_POOL_PREFAULT:0}",
+            "pool_use_huge_pages = ${HPX_STACKS_POOL_USE_HUGE_PAGES:0}",
 #endif
 
             "[hpx.threadpools]",
@@ -257,6 +266,12 @@ namespace hpx::util {
             "init_threads_count = "
             "${HPX_THREAD_QUEUE_INIT_THREADS_COUNT:" HPX_PP_STRINGIZE(
                 HPX_PP_EXPAND(HPX_THREAD_QUEUE_INIT_THREADS_COUNT)) "}",
+            "hierarchical_stealing = "
+            "${HPX_THREAD_QUEUE_HIERARCHICAL_STEALING:0}",
+
+            "[hpx.trace]",
+            "destination = ${HPX_TRACE_DESTINATION:}",
+            "buffer_size = ${HPX_TRACE_BUFFER_SIZE:65536}",
 
             "[hpx.commandline]",
             // enable aliasing
@@ -304,6 +319,7 @@ namespace hpx::util {
             "${HPX_AGAS_MAX_PENDING_REFCNT_REQUESTS:" HPX_PP_STRINGIZE(
                 HPX_PP_EXPAND(
                     HPX_INITIAL_AGAS_MAX_PENDING_REFCNT_REQUESTS)) "}",
+            "max_resolve_batch_size = ${HPX_AGAS_MAX_RESOLVE_BATCH_SIZE:256}",
             "service_mode = hosted",
             "local_cache_size = ${HPX_AGAS_LOCAL_CACHE_SIZE:" HPX_PP_STRINGIZE(
                 HPX_PP_EXPAND(HPX_AGAS_LOCAL_CACHE_SIZE)) "}",
@@ -919,6 +935,16 @@ namespace hpx::util {
         return HPX_INITIAL_AGAS_MAX_PENDING_REFCNT_REQUESTS;
     }
 
+    std::size_t runtime_configuration::get_agas_max_resolve_batch_size() const
+    {
+        if (util::section const* sec = get_section("hpx.agas"); nullptr != sec)
+        {
+            return hpx::util::get_entry_as<std::size_t>(
+                *sec, "max_resolve_batch_size", 256);
+        }
+        return 256;
+    }
+
     bool runtime_configuration::get_itt_notify_mode() const
     {
 #if HPX_HAVE_ITTNOTIFY != 0
@@ -1101,6 +1127,38 @@ namespace hpx::util {
         }
         return true;    // default is true
     }
+
+    bool runtime_configuration::use_stack_pool() const
+    {
+        if (util::section const* sec = get_section("hpx.stacks");
+            nullptr != sec)
+        {
+            return hpx::util::get_entry_as<int>(*sec, "use_pool", 0) != 0;
+        }
+        return false;    // default is false
+    }
+
+    threads::coroutines::detail::posix::stack_pool_parameters
+    runtime_configuration::get_stack_pool_parameters() const
+    {
+        threads::coroutines::detail::posix::stack_pool_parameters params;
+        if (util::section const* sec = get_section("hpx.stacks");
+            nullptr != sec)
+        {
+            params.watermark = hpx::util::get_entry_as<std::size_t>(
+                *sec, "pool_watermark", params.watermark);
+            params.depot_watermark = hpx::util::get_entry_as<std::size_t>(
+                *sec, "pool_depot_watermark", params.depot_watermark);
+            params.slab_size = hpx::util::get_entry_as<std::size_t>(
+                *sec, "pool_slab_size", params.slab_size);
+            params.prefault_count = hpx::util::get_entry_as<std::size_t>(
+                *sec, "pool_prefault", params.prefault_count);
+            params.use_huge_pages =
+                hpx::util::get_entry_as<int>(*sec, "pool_use_huge_pages", 0) !=
+                0;
+        }
+        return params;
+    }
 #endif
 
     std::ptrdiff_t runtime_configuration::init_small_stack_size() const
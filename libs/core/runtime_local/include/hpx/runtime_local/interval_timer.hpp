@@ -11,6 +11,7 @@
 #include <hpx/functional/function.hpp>
 #include <hpx/modules/threading_base.hpp>
 #include <hpx/synchronization/spinlock.hpp>
+#include <hpx/threading_base/detail/timer_wheel.hpp>
 #include <hpx/timing/steady_clock.hpp>
 
 #include <cstdint>
@@ -84,8 +85,8 @@ namespace hpx::util::detail {
         std::int64_t microsecs_ = 0;
         /// id of currently scheduled thread
         threads::thread_id_ref_type id_;
-        /// id of the timer thread for the currently scheduled thread
-        threads::thread_id_ref_type timerid_;
+        /// timer waking up the currently scheduled thread
+        threads::detail::timer_entry_ptr timerid_;
         /// description of this interval timer
         std::string description_;
 
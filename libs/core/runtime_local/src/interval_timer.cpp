@@ -12,6 +12,7 @@
 #include <hpx/runtime_local/interval_timer.hpp>
 #include <hpx/runtime_local/shutdown_function.hpp>
 #include <hpx/thread_support/unlock_guard.hpp>
+#include <hpx/threading_base/set_thread_state_timed.hpp>
 #include <hpx/threading_base/thread_helpers.hpp>
 #include <hpx/type_support/assert_owns_lock.hpp>
 
@@ -137,12 +138,9 @@ namespace hpx::util::detail {
 
             if (timerid_)
             {
-                error_code ec(
-                    throwmode::lightweight);    // avoid throwing on error
-                threads::set_thread_state(timerid_.noref(),
-                    threads::thread_schedule_state::pending,
-                    threads::thread_restart_state::abort,
-                    threads::thread_priority::boost, true, ec);
+                // release the reference to the scheduled thread held by the
+                // timer
+                timerid_->cancel();
                 timerid_.reset();
             }
             if (id_)
@@ -295,11 +293,14 @@ namespace hpx::util::detail {
         }
 
         // schedule this thread to be run after the given amount of seconds
-        threads::thread_id_ref_type const timerid = threads::set_thread_state(
-            id.noref(), std::chrono::microseconds(microsecs_),
-            threads::thread_schedule_state::pending,
-            threads::thread_restart_state::signaled,
-            threads::thread_priority::boost, true, ec);
+        threads::detail::timer_entry_ptr timerid =
+            threads::detail::create_thread_timer(
+                std::chrono::steady_clock::now() +
+                    std::chrono::microseconds(microsecs_),
+                id.noref(), threads::thread_schedule_state::pending,
+                threads::thread_restart_state::signaled,
+                threads::thread_priority::boost,
+                threads::thread_schedule_hint(), true, ec);
 
         if (ec)
         {
@@ -316,7 +317,7 @@ namespace hpx::util::detail {
         }
 
         id_ = id;
-        timerid_ = timerid;
+        timerid_ = HPX_MOVE(timerid);
         is_started_ = true;
     }
 }    // namespace hpx::util::detail
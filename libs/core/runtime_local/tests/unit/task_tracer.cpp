@@ -0,0 +1,111 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/threading_base.hpp>
+#include <hpx/thread.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+char const* const trace_file = "task_tracer_test.bin";
+
+int hpx_main()
+{
+    HPX_TEST(hpx::threads::is_task_tracing_enabled());
+
+    std::vector<hpx::future<void>> tasks;
+    for (int i = 0; i != 100; ++i)
+    {
+        tasks.push_back(hpx::async([] { hpx::this_thread::yield(); }));
+    }
+    hpx::wait_all(tasks);
+
+    return hpx::local::finalize();
+}
+
+template <typename T>
+T read_value(std::ifstream& in)
+{
+    T value{};
+    in.read(reinterpret_cast<char*>(&value), sizeof(T));
+    return value;
+}
+
+void verify_trace()
+{
+    using hpx::threads::task_trace_event_type;
+    using hpx::threads::detail::task_trace_event;
+
+    std::ifstream in(trace_file, std::ios::binary);
+    HPX_TEST(in.good());
+
+    char magic[8];
+    in.read(magic, sizeof(magic));
+    HPX_TEST(std::memcmp(magic, "HPXTRACE", sizeof(magic)) == 0);
+    HPX_TEST_EQ(read_value<std::uint32_t>(in), std::uint32_t(1));
+
+    auto const num_workers = read_value<std::uint32_t>(in);
+    HPX_TEST_NEQ(num_workers, std::uint32_t(0));
+
+    auto const start_timestamp = read_value<std::uint64_t>(in);
+    read_value<std::uint64_t>(in);
+    auto const stop_timestamp = read_value<std::uint64_t>(in);
+    read_value<std::uint64_t>(in);
+    HPX_TEST_LTE(start_timestamp, stop_timestamp);
+
+    std::size_t num_started = 0;
+    std::size_t num_finished = 0;
+    for (std::uint32_t i = 0; i != num_workers; ++i)
+    {
+        HPX_TEST_EQ(read_value<std::uint32_t>(in), i);
+        read_value<std::uint32_t>(in);
+
+        auto const count = read_value<std::uint64_t>(in);
+        for (std::uint64_t j = 0; j != count; ++j)
+        {
+            auto const e = read_value<task_trace_event>(in);
+            HPX_TEST_LTE(start_timestamp, e.timestamp);
+
+            auto const type = static_cast<task_trace_event_type>(e.type);
+            if (type == task_trace_event_type::start)
+            {
+                ++num_started;
+            }
+            else if (type == task_trace_event_type::stop ||
+                type == task_trace_event_type::suspend)
+            {
+                ++num_finished;
+            }
+        }
+    }
+
+    // all tasks, including the ones spawned above, have been executed
+    HPX_TEST_LTE(std::size_t(100), num_started);
+    HPX_TEST_EQ(num_started, num_finished);
+    HPX_TEST(in.good());
+}
+
+int main(int argc, char* argv[])
+{
+    hpx::local::init_params init_args;
+    init_args.cfg = {"hpx.trace.destination=" + std::string(trace_file)};
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+    HPX_TEST(!hpx::threads::is_task_tracing_enabled());
+
+    verify_trace();
+    std::remove(trace_file);
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,38 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/affinity/affinity_data.hpp>
+#include <hpx/threading_base/steal_distance.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace hpx::threads::policies::detail {
+
+    /// Determine the topological distance of all worker threads of a
+    /// scheduler to the worker thread \a num_thread and the order in which
+    /// this worker thread should try to steal work from the others.
+    ///
+    /// \param num_thread   [in] the worker thread looking for work
+    /// \param num_threads  [in] the number of worker threads of the scheduler
+    /// \param affinity_data [in] maps the worker threads to processing units
+    /// \param enable_stealing_numa [in] whether worker threads of other NUMA
+    ///                     domains are added to the list of victims
+    /// \param victims      [out] the worker threads to steal from, ordered by
+    ///                     increasing distance (same core, same last level
+    ///                     cache, same NUMA domain, other NUMA domains). Ties
+    ///                     are broken by the distance of the NUMA domains and
+    ///                     the distance of the worker threads.
+    /// \param distances    [out] the distance of each worker thread to
+    ///                     \a num_thread, indexed by worker thread
+    HPX_CORE_EXPORT void get_hierarchical_victims(std::size_t num_thread,
+        std::size_t num_threads, affinity_data const& affinity_data,
+        bool enable_stealing_numa, std::vector<std::size_t>& victims,
+        std::vector<steal_distance>& distances);
+}    // namespace hpx::threads::policies::detail
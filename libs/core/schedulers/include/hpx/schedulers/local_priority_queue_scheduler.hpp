@@ -15,14 +15,19 @@
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/logging.hpp>
 #include <hpx/schedulers/deadlock_detection.hpp>
+#include <hpx/schedulers/hierarchical_victims.hpp>
 #include <hpx/schedulers/lockfree_queue_backends.hpp>
 #include <hpx/schedulers/thread_queue.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
+#include <hpx/threading_base/steal_distance.hpp>
+#include <hpx/threading_base/task_tracer.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_num_tss.hpp>
 #include <hpx/threading_base/thread_queue_init_parameters.hpp>
 #include <hpx/topology/topology.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
 
+#include <array>
 #include <atomic>
 #include <cmath>
 #include <cstddef>
@@ -124,6 +129,10 @@ namespace hpx::threads::policies {
           , queues_(num_queues_)
           , high_priority_queues_(num_queues_)
           , victim_threads_(num_queues_)
+          , steal_distances_(num_queues_)
+#ifdef HPX_HAVE_THREAD_STEALING_COUNTS
+          , num_stolen_by_distance_(num_queues_)
+#endif
         {
             if (!deferred_initialization)
             {
@@ -469,6 +478,28 @@ namespace hpx::threads::policies {
             }
             return num_stolen_threads;
         }
+
+        std::int64_t get_num_stolen_by_distance(std::size_t num_thread,
+            steal_distance distance, bool reset) override
+        {
+            auto const index = static_cast<std::size_t>(distance);
+            HPX_ASSERT(index < num_steal_distances);
+
+            std::int64_t num_stolen_threads = 0;
+            if (num_thread == static_cast<std::size_t>(-1))
+            {
+                for (std::size_t i = 0; i != num_queues_; ++i)
+                {
+                    num_stolen_threads += util::get_and_reset_value(
+                        num_stolen_by_distance_[i].data_[index], reset);
+                }
+                return num_stolen_threads;
+            }
+
+            HPX_ASSERT(num_thread < num_queues_);
+            return util::get_and_reset_value(
+                num_stolen_by_distance_[num_thread].data_[index], reset);
+        }
 #endif
 
         ///////////////////////////////////////////////////////////////////////
@@ -653,39 +684,76 @@ namespace hpx::threads::policies {
             }
         }
 
+        // Steal a pending thread from the queue of the worker thread
+        // 'victim'. In hierarchical mode up to half of the pending threads
+        // of the victim are taken at once, the additional threads are moved
+        // to the queue of the stealing worker thread.
+        bool steal_pending_threads([[maybe_unused]] std::size_t num_thread,
+            std::size_t victim, thread_queue_type* q,
+            thread_queue_type* this_queue, threads::thread_id_ref_type& thrd)
+        {
+            if (!q->get_next_thread(thrd, true, true))
+                return false;
+
+            threads::detail::trace_task_steal(thrd, victim);
+
+            std::int64_t num_stolen = 1;
+            if (has_scheduler_mode(
+                    policies::scheduler_mode::steal_hierarchical))
+            {
+                std::int64_t const num_to_steal =
+                    q->get_pending_queue_length(std::memory_order_relaxed) / 2;
+
+                threads::thread_id_ref_type next_thrd;
+                while (num_stolen <= num_to_steal &&
+                    q->get_next_thread(next_thrd, true, true))
+                {
+                    this_queue->schedule_thread(HPX_MOVE(next_thrd));
+                    ++num_stolen;
+                }
+            }
+
+#ifdef HPX_HAVE_THREAD_STEALING_COUNTS
+            q->increment_num_stolen_from_pending(num_stolen);
+            this_queue->increment_num_stolen_to_pending(num_stolen);
+            count_stolen_by_distance(num_thread, victim, num_stolen);
+#endif
+            return true;
+        }
+
+#ifdef HPX_HAVE_THREAD_STEALING_COUNTS
+        void count_stolen_by_distance(std::size_t num_thread,
+            std::size_t victim, std::int64_t num_stolen) noexcept
+        {
+            auto const index = static_cast<std::size_t>(
+                steal_distances_[num_thread].data_[victim]);
+            num_stolen_by_distance_[num_thread].data_[index].fetch_add(
+                num_stolen, std::memory_order_relaxed);
+        }
+#endif
+
         bool attempt_stealing_pending(std::size_t num_thread,
             threads::thread_id_ref_type& thrd,
-            [[maybe_unused]] thread_queue_type* this_high_priority_queue,
-            [[maybe_unused]] thread_queue_type* this_queue)
+            thread_queue_type* this_high_priority_queue,
+            thread_queue_type* this_queue)
         {
-            thread_queue_type* q = nullptr;
             if (num_thread < num_high_priority_queues_)
             {
                 for (std::size_t idx : victim_threads_[num_thread].data_)
                 {
                     HPX_ASSERT(idx != num_thread);
 
-                    if (idx < num_high_priority_queues_)
+                    if (idx < num_high_priority_queues_ &&
+                        steal_pending_threads(num_thread, idx,
+                            high_priority_queues_[idx].data_,
+                            this_high_priority_queue, thrd))
                     {
-                        q = high_priority_queues_[idx].data_;
-                        if (q->get_next_thread(thrd, true, true))
-                        {
-#ifdef HPX_HAVE_THREAD_STEALING_COUNTS
-                            q->increment_num_stolen_from_pending();
-                            this_high_priority_queue
-                                ->increment_num_stolen_to_pending();
-#endif
-                            return true;
-                        }
+                        return true;
                     }
 
-                    q = queues_[idx].data_;
-                    if (q->get_next_thread(thrd, true, true))
+                    if (steal_pending_threads(num_thread, idx,
+                            queues_[idx].data_, this_queue, thrd))
                     {
-#ifdef HPX_HAVE_THREAD_STEALING_COUNTS
-                        q->increment_num_stolen_from_pending();
-                        this_queue->increment_num_stolen_to_pending();
-#endif
                         return true;
                     }
                 }
@@ -696,13 +764,9 @@ namespace hpx::threads::policies {
                 {
                     HPX_ASSERT(idx != num_thread);
 
-                    q = queues_[idx].data_;
-                    if (q->get_next_thread(thrd, true, true))
+                    if (steal_pending_threads(num_thread, idx,
+                            queues_[idx].data_, this_queue, thrd))
                     {
-#ifdef HPX_HAVE_THREAD_STEALING_COUNTS
-                        q->increment_num_stolen_from_pending();
-                        this_queue->increment_num_stolen_to_pending();
-#endif
                         return true;
                     }
                 }
@@ -1315,6 +1379,8 @@ namespace hpx::threads::policies {
                             q->increment_num_stolen_from_staged(added);
                             this_high_priority_queue
                                 ->increment_num_stolen_to_staged(added);
+                            count_stolen_by_distance(num_thread, idx,
+                                static_cast<std::int64_t>(added));
 #endif
                             return result;
                         }
@@ -1329,6 +1395,8 @@ namespace hpx::threads::policies {
 #ifdef HPX_HAVE_THREAD_STEALING_COUNTS
                         q->increment_num_stolen_from_staged(added);
                         this_queue->increment_num_stolen_to_staged(added);
+                        count_stolen_by_distance(num_thread, idx,
+                            static_cast<std::int64_t>(added));
 #endif
                         return result;
                     }
@@ -1349,6 +1417,8 @@ namespace hpx::threads::policies {
 #ifdef HPX_HAVE_THREAD_STEALING_COUNTS
                         q->increment_num_stolen_from_staged(added);
                         this_queue->increment_num_stolen_to_staged(added);
+                        count_stolen_by_distance(num_thread, idx,
+                            static_cast<std::int64_t>(added));
 #endif
                         return result;
                     }
@@ -1501,6 +1571,22 @@ namespace hpx::threads::policies {
             queues_[num_thread].data_->on_start_thread(num_thread);
 
             std::size_t const num_threads = num_queues_;
+
+            // order the victims by their topological distance
+            std::vector<std::size_t> victims;
+            detail::get_hierarchical_victims(num_thread, num_threads,
+                affinity_data_,
+                has_scheduler_mode(
+                    policies::scheduler_mode::enable_stealing_numa),
+                victims, steal_distances_[num_thread].data_);
+
+            if (has_scheduler_mode(
+                    policies::scheduler_mode::steal_hierarchical))
+            {
+                victim_threads_[num_thread].data_ = HPX_MOVE(victims);
+                return;
+            }
+
             auto const& topo = create_topology();
 
             // get NUMA domain masks of all queues...
@@ -1659,6 +1745,14 @@ namespace hpx::threads::policies {
             high_priority_queues_;
         std::vector<util::cache_line_data<std::vector<std::size_t>>>
             victim_threads_;
+        std::vector<util::cache_line_data<std::vector<steal_distance>>>
+            steal_distances_;
+
+#ifdef HPX_HAVE_THREAD_STEALING_COUNTS
+        std::vector<util::cache_line_data<
+            std::array<std::atomic<std::int64_t>, num_steal_distances>>>
+            num_stolen_by_distance_;
+#endif
     };    // namespace hpx::threads::policies
 }    // namespace hpx::threads::policies
 
@@ -14,20 +14,25 @@
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/logging.hpp>
 #include <hpx/modules/synchronization.hpp>
+#include <hpx/schedulers/hierarchical_victims.hpp>
 #include <hpx/schedulers/lockfree_queue_backends.hpp>
 #include <hpx/schedulers/thread_queue.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
+#include <hpx/threading_base/steal_distance.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_num_tss.hpp>
 #include <hpx/threading_base/thread_queue_init_parameters.hpp>
 #include <hpx/type_support/unused.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
 
 #include <algorithm>
+#include <array>
 #include <atomic>
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
 #include <exception>
+#include <iterator>
 #include <memory>
 #include <mutex>
 #include <random>
@@ -277,6 +282,13 @@ namespace hpx::threads::policies {
             // initial affinity mask for this core
             mask_type victims_ = mask_type();
 
+            // the cores to send steal requests to, ordered by their
+            // topological distance (used in hierarchical mode only)
+            std::vector<std::size_t> ordered_victims_;
+
+            // the topological distance of all cores to this core
+            std::vector<steal_distance> steal_distances_;
+
             // queues for threads scheduled on this core
             thread_queue_type* queue_ = nullptr;
             thread_queue_type* high_priority_queue_ = nullptr;
@@ -300,6 +312,12 @@ namespace hpx::threads::policies {
             std::uint16_t num_recent_tasks_executed_ = 0;
             bool stealhalf_ = true;
 
+#ifdef HPX_HAVE_THREAD_STEALING_COUNTS
+            // number of tasks received from other cores, by distance
+            std::array<std::atomic<std::int64_t>, num_steal_distances>
+                num_stolen_by_distance_ = {};
+#endif
+
 #if defined(HPX_HAVE_WORKREQUESTING_LAST_VICTIM)
             // core number the last stolen tasks originated from
             std::uint16_t last_victim_ = static_cast<std::uint16_t>(-1);
@@ -615,6 +633,28 @@ namespace hpx::threads::policies {
             count += d.queue_->get_num_stolen_to_staged(reset);
             return count + d.bound_queue_->get_num_stolen_to_staged(reset);
         }
+
+        std::int64_t get_num_stolen_by_distance(std::size_t num_thread,
+            steal_distance distance, bool reset) override
+        {
+            auto const index = static_cast<std::size_t>(distance);
+            HPX_ASSERT(index < num_steal_distances);
+
+            std::int64_t count = 0;
+            if (num_thread == static_cast<std::size_t>(-1))
+            {
+                for (std::size_t i = 0; i != num_queues_; ++i)
+                {
+                    count += util::get_and_reset_value(
+                        data_[i].data_.num_stolen_by_distance_[index], reset);
+                }
+                return count;
+            }
+
+            HPX_ASSERT(num_thread < num_queues_);
+            return util::get_and_reset_value(
+                data_[num_thread].data_.num_stolen_by_distance_[index], reset);
+        }
 #endif
 
         ///////////////////////////////////////////////////////////////////////
@@ -905,8 +945,8 @@ namespace hpx::threads::policies {
                     thrd = thread_id_ref_type{};
                 }
 #else
-                d.queue_->get_next_threads(
-                    thrds.tasks_.begin(), thrds.tasks_.size(), false, true);
+                d.queue_->get_next_threads(std::back_inserter(thrds.tasks_),
+                    static_cast<std::int64_t>(max_num_to_steal), false, true);
 #endif
 
                 // we are ready to send at least one task
@@ -1523,6 +1563,22 @@ namespace hpx::threads::policies {
             return result;
         }
 
+        // return the closest core to the thief that has not been asked yet
+        std::size_t hierarchical_victim(steal_request const& req) noexcept
+        {
+            for (std::size_t victim :
+                data_[req.num_thread_].data_.ordered_victims_)
+            {
+                if (victim != req.num_thread_ && !test(req.victims_, victim))
+                {
+                    return victim;
+                }
+            }
+
+            // all of the preferred cores have been asked already
+            return random_victim(req);
+        }
+
         // return the number of the next victim core
         std::size_t next_victim([[maybe_unused]] scheduler_data& d,
             steal_request const& req) noexcept
@@ -1549,7 +1605,10 @@ namespace hpx::threads::policies {
                 else
 #endif
                 {
-                    victim = random_victim(req);
+                    victim = has_scheduler_mode(
+                                 policies::scheduler_mode::steal_hierarchical) ?
+                        hierarchical_victim(req) :
+                        random_victim(req);
                 }
             }
 
@@ -1604,8 +1663,14 @@ namespace hpx::threads::policies {
                     }
                 }
 
+                // always steal half of the available work in hierarchical
+                // mode, the victims are close to us
+                bool const stealhalf = d.stealhalf_ ||
+                    has_scheduler_mode(
+                        policies::scheduler_mode::steal_hierarchical);
+
                 steal_request req(
-                    d.num_thread_, d.tasks_, d.victims_, idle, d.stealhalf_);
+                    d.num_thread_, d.tasks_, d.victims_, idle, stealhalf);
                 std::size_t victim = next_victim(d, req);
 
                 ++d.requested_;
@@ -1633,6 +1698,13 @@ namespace hpx::threads::policies {
                 // if at least one thrd was received
                 if (!thrds.tasks_.empty())
                 {
+#ifdef HPX_HAVE_THREAD_STEALING_COUNTS
+                    auto const index = static_cast<std::size_t>(
+                        d.steal_distances_[thrds.num_thread_]);
+                    d.num_stolen_by_distance_[index].fetch_add(
+                        static_cast<std::int64_t>(thrds.tasks_.size()),
+                        std::memory_order_relaxed);
+#endif
                     // Schedule all but the first received task in reverse order
                     // to maintain the sequence of tasks as pulled from the
                     // victims queue.
@@ -1807,6 +1879,10 @@ namespace hpx::threads::policies {
             resize(d.victims_, num_queues_);
             reset(d.victims_);
             set(d.victims_, num_thread);
+
+            // order the potential victims by their topological distance
+            detail::get_hierarchical_victims(num_thread, num_queues_,
+                affinity_data_, true, d.ordered_victims_, d.steal_distances_);
         }
 
         void on_stop_thread(std::size_t num_thread) override
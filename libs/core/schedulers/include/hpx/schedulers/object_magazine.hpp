@@ -0,0 +1,148 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace hpx::threads::policies::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A magazine holds a fixed number of objects which are ready for reuse
+    // (thread objects of terminated threads of one stack size class). Every
+    // slot is accessed using atomic operations only, objects can be returned
+    // to and taken from the magazine concurrently without locking. As slots
+    // hold plain values there is no ABA problem. The magazine tries to hand
+    // out the object that was returned last, as that one is most likely to
+    // still be cached.
+    template <typename T>
+    class object_magazine
+    {
+    public:
+        static constexpr std::size_t default_capacity = 256;
+
+        explicit object_magazine(std::size_t capacity = default_capacity)
+          : slots_(new std::atomic<T*>[capacity])
+          , capacity_(capacity)
+        {
+            HPX_ASSERT(capacity_ != 0);
+            for (std::size_t i = 0; i != capacity_; ++i)
+            {
+                slots_[i].store(nullptr, std::memory_order_relaxed);
+            }
+            count_.data_.store(0, std::memory_order_relaxed);
+            top_.data_.store(0, std::memory_order_relaxed);
+        }
+
+        object_magazine(object_magazine const&) = delete;
+        object_magazine(object_magazine&&) = delete;
+        object_magazine& operator=(object_magazine const&) = delete;
+        object_magazine& operator=(object_magazine&&) = delete;
+
+        ~object_magazine() = default;
+
+        // Store the given object, returns false if the magazine is full.
+        bool push(T* p) noexcept
+        {
+            HPX_ASSERT(p != nullptr);
+            if (count_.data_.load(std::memory_order_relaxed) >=
+                static_cast<std::int64_t>(capacity_))
+            {
+                return false;
+            }
+
+            std::size_t const top = top_.data_.load(std::memory_order_relaxed);
+            for (std::size_t i = 0; i != capacity_; ++i)
+            {
+                std::size_t const idx = (top + i) % capacity_;
+
+                T* expected = nullptr;
+                if (slots_[idx].compare_exchange_strong(expected, p,
+                        std::memory_order_release, std::memory_order_relaxed))
+                {
+                    top_.data_.store(idx + 1, std::memory_order_relaxed);
+                    count_.data_.fetch_add(1, std::memory_order_relaxed);
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        // Take an object out of the magazine, returns nullptr if the magazine
+        // is empty.
+        T* pop() noexcept
+        {
+            if (count_.data_.load(std::memory_order_relaxed) <= 0)
+            {
+                return nullptr;
+            }
+
+            std::size_t const top =
+                top_.data_.load(std::memory_order_relaxed) + capacity_;
+            for (std::size_t i = 1; i <= capacity_; ++i)
+            {
+                std::size_t const idx = (top - i) % capacity_;
+
+                T* p = slots_[idx].load(std::memory_order_relaxed);
+                if (p != nullptr &&
+                    slots_[idx].compare_exchange_strong(p, nullptr,
+                        std::memory_order_acquire, std::memory_order_relaxed))
+                {
+                    top_.data_.store(idx, std::memory_order_relaxed);
+                    count_.data_.fetch_sub(1, std::memory_order_relaxed);
+                    return p;
+                }
+            }
+            return nullptr;
+        }
+
+        // Remove all objects from the magazine, calling f for each of them.
+        // This must not be called concurrently with push or pop.
+        template <typename F>
+        void drain(F&& f)
+        {
+            for (std::size_t i = 0; i != capacity_; ++i)
+            {
+                if (T* p = slots_[i].exchange(nullptr); p != nullptr)
+                {
+                    f(p);
+                }
+            }
+            count_.data_.store(0, std::memory_order_relaxed);
+        }
+
+        // The (approximate) number of objects in the magazine
+        std::size_t size() const noexcept
+        {
+            std::int64_t const count =
+                count_.data_.load(std::memory_order_relaxed);
+            return count > 0 ? static_cast<std::size_t>(count) : 0;
+        }
+
+        std::size_t capacity() const noexcept
+        {
+            return capacity_;
+        }
+
+    private:
+        std::unique_ptr<std::atomic<T*>[]> slots_;
+        std::size_t const capacity_;
+
+        // The number of objects is updated after the slot has been modified,
+        // it may transiently be off by the number of concurrent operations.
+        util::cache_line_data<std::atomic<std::int64_t>> count_;
+
+        // the slot to look at first
+        util::cache_line_data<std::atomic<std::size_t>> top_;
+    };
+}    // namespace hpx::threads::policies::detail
@@ -14,6 +14,7 @@
 #include <hpx/functional/function.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/format.hpp>
+#include <hpx/schedulers/object_magazine.hpp>
 #include <hpx/schedulers/queue_helpers.hpp>
 #include <hpx/thread_support/unlock_guard.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
@@ -39,11 +40,13 @@
 #endif
 
 #include <algorithm>
+#include <array>
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <exception>
 #include <functional>
+#include <limits>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -100,8 +103,15 @@ namespace hpx::threads::policies {
             std::unordered_set<thread_id_type, std::hash<thread_id_type>,
                 std::equal_to<>, util::internal_allocator<thread_id_type>>;
 
-        using thread_heap_type = std::vector<thread_id_type,
-            util::internal_allocator<thread_id_type>>;
+        // every queue maintains one magazine of unused thread objects per
+        // stack size
+        using thread_magazine_type = detail::object_magazine<thread_data>;
+
+        static constexpr std::size_t num_thread_magazines = 5;
+
+        // the maximal number of terminated threads removed from the thread
+        // map while holding the lock
+        static constexpr std::size_t cleanup_batch_size = 64;
 
         struct task_description
         {
@@ -132,76 +142,112 @@ namespace hpx::threads::policies {
             typename TerminatedQueuing::template apply<thread_data*>::type;
 
     protected:
-        template <typename Lock>
-        void create_thread_object(threads::thread_id_ref_type& thrd,
-            threads::thread_init_data& data, Lock& lk)
+        // the magazines hold at least the pre-allocated thread objects
+        std::size_t magazine_capacity() const noexcept
         {
-            HPX_ASSERT_OWNS_LOCK(lk);
-
-            std::ptrdiff_t const stacksize =
-                data.scheduler_base->get_stack_size(data.stacksize);
-
-#if !defined(HPX_HAVE_ADDRESS_SANITIZER)
-            thread_heap_type* heap = nullptr;
+            return (std::max)(thread_magazine_type::default_capacity,
+                static_cast<std::size_t>(parameters_.init_threads_count_));
+        }
 
+        thread_magazine_type* get_thread_magazine(
+            std::ptrdiff_t stacksize) noexcept
+        {
             if (stacksize == parameters_.small_stacksize_)
             {
-                heap = &thread_heap_small_;
+                return &thread_magazines_[0];
             }
-            else if (stacksize == parameters_.medium_stacksize_)
+            if (stacksize == parameters_.medium_stacksize_)
             {
-                heap = &thread_heap_medium_;
+                return &thread_magazines_[1];
             }
-            else if (stacksize == parameters_.large_stacksize_)
+            if (stacksize == parameters_.large_stacksize_)
             {
-                heap = &thread_heap_large_;
+                return &thread_magazines_[2];
             }
-            else if (stacksize == parameters_.huge_stacksize_)
+            if (stacksize == parameters_.huge_stacksize_)
             {
-                heap = &thread_heap_huge_;
+                return &thread_magazines_[3];
             }
-            else if (stacksize == parameters_.nostack_stacksize_)
+            if (stacksize == parameters_.nostack_stacksize_)
             {
-                heap = &thread_heap_nostack_;
+                return &thread_magazines_[4];
             }
-            HPX_ASSERT(heap);
-#endif
+            return nullptr;
+        }
 
+        std::ptrdiff_t prepare_thread_object(
+            threads::thread_init_data& data) const
+        {
             if (data.initial_state ==
                     thread_schedule_state::pending_do_not_schedule ||
                 data.initial_state == thread_schedule_state::pending_boost)
             {
                 data.initial_state = thread_schedule_state::pending;
             }
+            return data.scheduler_base->get_stack_size(data.stacksize);
+        }
 
+        // Check for an unused thread object, take ownership of it and rebind
+        // it. This does not require to hold the lock.
+        bool reuse_thread_object(
+            [[maybe_unused]] threads::thread_id_ref_type& thrd,
+            [[maybe_unused]] threads::thread_init_data& data,
+            [[maybe_unused]] std::ptrdiff_t stacksize)
+        {
             // ASAN gets confused by reusing threads/stacks
 #if !defined(HPX_HAVE_ADDRESS_SANITIZER)
-            // Check for an unused thread object.
-            if (heap && !heap->empty())    //-V522
+            thread_magazine_type* magazine = get_thread_magazine(stacksize);
+            HPX_ASSERT(magazine);
+
+            if (threads::thread_data* p = magazine->pop(); p != nullptr)
             {
-                // Take ownership of the thread object and rebind it.
-                thrd = heap->back();
-                heap->pop_back();
-                get_thread_id_data(thrd)->rebind(data);
+                thrd = thread_id_type(p);
+                p->rebind(data);
+                return true;
             }
-            else
 #endif
+            return false;
+        }
+
+        void allocate_thread_object(threads::thread_id_ref_type& thrd,
+            threads::thread_init_data& data, std::ptrdiff_t stacksize)
+        {
+            // Allocate a new thread object.
+            threads::thread_data* p;
+            if (stacksize == parameters_.nostack_stacksize_)
+            {
+                p = threads::thread_data_stackless::create(
+                    data, this, stacksize);
+            }
+            else
+            {
+                p = threads::thread_data_stackful::create(
+                    data, this, stacksize);
+            }
+            thrd = thread_id_ref_type(p, thread_id_addref::no);
+        }
+
+        template <typename Lock>
+        void create_thread_object(threads::thread_id_ref_type& thrd,
+            threads::thread_init_data& data, Lock& lk)
+        {
+            HPX_ASSERT_OWNS_LOCK(lk);
+
+            std::ptrdiff_t const stacksize = prepare_thread_object(data);
+            if (!reuse_thread_object(thrd, data, stacksize))
             {
                 hpx::unlock_guard<Lock> ull(lk);
+                allocate_thread_object(thrd, data, stacksize);
+            }
+        }
 
-                // Allocate a new thread object.
-                threads::thread_data* p;
-                if (stacksize == parameters_.nostack_stacksize_)
-                {
-                    p = threads::thread_data_stackless::create(
-                        data, this, stacksize);
-                }
-                else
-                {
-                    p = threads::thread_data_stackful::create(
-                        data, this, stacksize);
-                }
-                thrd = thread_id_ref_type(p, thread_id_addref::no);
+        void create_thread_object(
+            threads::thread_id_ref_type& thrd, threads::thread_init_data& data)
+        {
+            std::ptrdiff_t const stacksize = prepare_thread_object(data);
+            if (!reuse_thread_object(thrd, data, stacksize))
+            {
+                allocate_thread_object(thrd, data, stacksize);
             }
         }
 
@@ -348,34 +394,108 @@ namespace hpx::threads::policies {
 
         void recycle_thread(thread_id_type const& thrd)
         {
-            std::ptrdiff_t const stacksize =
-                get_thread_id_data(thrd)->get_stack_size();
+            threads::thread_data* p = get_thread_id_data(thrd);
+            std::ptrdiff_t const stacksize = p->get_stack_size();
 
-            if (stacksize == parameters_.small_stacksize_)
-            {
-                thread_heap_small_.push_back(thrd);
-            }
-            else if (stacksize == parameters_.medium_stacksize_)
+            thread_magazine_type* magazine = get_thread_magazine(stacksize);
+            if (magazine == nullptr)
             {
-                thread_heap_medium_.push_back(thrd);
-            }
-            else if (stacksize == parameters_.large_stacksize_)
-            {
-                thread_heap_large_.push_back(thrd);
+                HPX_ASSERT_MSG(
+                    false, util::format("Invalid stack size {1}", stacksize));
+                return;
             }
-            else if (stacksize == parameters_.huge_stacksize_)
+
+            // release the thread object if the magazine is full already
+            if (!magazine->push(p))
             {
-                thread_heap_huge_.push_back(thrd);
+                deallocate(p);
             }
-            else if (stacksize == parameters_.nostack_stacksize_)
+        }
+
+        // Remove at most max_count terminated threads from the map of all
+        // threads, the threads to recycle are stored in 'recycled'. Returns
+        // the number of items taken from the list of terminated threads.
+        std::int64_t erase_terminated_locked(std::int64_t max_count,
+            thread_id_type* recycled, std::size_t& num_recycled)
+        {
+            std::int64_t count = 0;
+
+            thread_data* todelete;
+            while (count != max_count && terminated_items_.pop(todelete))
             {
-                thread_heap_nostack_.push_back(thrd);
+                thread_id_type tid(todelete);
+                --terminated_items_count_;
+                ++count;
+
+                // this thread has to be managed by this queue, it may have
+                // ended up on the terminate threads list more than once,
+                // however
+                HPX_ASSERT(
+                    &get_thread_id_data(tid)->get_queue<thread_queue>() ==
+                    this);
+
+                if (thread_map_.erase(tid) != 0)
+                {
+                    recycled[num_recycled++] = tid;
+                    --thread_map_count_;
+                    HPX_ASSERT(thread_map_count_ >= 0);
+                }
             }
-            else
+            return count;
+        }
+
+        std::int64_t get_delete_count() const noexcept
+        {
+            // delete only this many threads
+            std::int64_t const delete_count = (std::min)(
+                static_cast<std::int64_t>(terminated_items_count_ / 10),
+                static_cast<std::int64_t>(parameters_.max_delete_count_));
+
+            // delete at least this many threads
+            return (std::max)(delete_count,
+                static_cast<std::int64_t>(parameters_.min_delete_count_));
+        }
+
+        // Delete a batch of terminated threads. The lock is held only while
+        // the threads are removed from the map of all threads, the thread
+        // objects are recycled after the lock has been released. Returns
+        // false if the lock could not be acquired.
+        bool cleanup_terminated_batch()
+        {
+#ifdef HPX_HAVE_THREAD_CREATION_AND_CLEANUP_RATES
+            util::tick_counter tc(cleanup_terminated_time_);
+#endif
+            std::array<thread_id_type, cleanup_batch_size> recycled;
+
+            std::int64_t delete_count = get_delete_count();
+            while (delete_count > 0)
             {
-                HPX_ASSERT_MSG(
-                    false, util::format("Invalid stack size {1}", stacksize));
+                std::int64_t const max_count = (std::min)(delete_count,
+                    static_cast<std::int64_t>(cleanup_batch_size));
+
+                std::size_t num_recycled = 0;
+                std::int64_t count = 0;
+                {
+                    std::unique_lock<mutex_type> lk(mtx_, std::try_to_lock);
+                    if (!lk.owns_lock())
+                        return false;    // avoid long wait on lock
+
+                    count = erase_terminated_locked(
+                        max_count, recycled.data(), num_recycled);
+                }
+
+                for (std::size_t i = 0; i != num_recycled; ++i)
+                {
+                    recycle_thread(recycled[i]);
+                }
+
+                // no more terminated threads
+                if (count != max_count)
+                    break;
+
+                delete_count -= count;
             }
+            return true;
         }
 
     public:
@@ -393,62 +513,30 @@ namespace hpx::threads::policies {
             if (terminated_items_count_.load(std::memory_order_acquire) == 0)
                 return true;
 
-            if (delete_all)
-            {
-                // delete all threads
-                thread_data* todelete;
-                while (terminated_items_.pop(todelete))
-                {
-                    thread_id_type tid(todelete);
-                    --terminated_items_count_;
-
-                    // this thread has to be managed by this queue, it may have
-                    // ended up on the terminate threads list more than once,
-                    // however
-                    HPX_ASSERT(
-                        &get_thread_id_data(tid)->get_queue<thread_queue>() ==
-                        this);
+            // delete all threads or only as many as configured
+            std::int64_t delete_count =
+                delete_all ? (std::numeric_limits<std::int64_t>::max)() :
+                             get_delete_count();
 
-                    if (thread_map_.erase(tid) != 0)
-                    {
-                        recycle_thread(tid);
-                        --thread_map_count_;
-                        HPX_ASSERT(thread_map_count_ >= 0);
-                    }
-                }
-            }
-            else
+            std::array<thread_id_type, cleanup_batch_size> recycled;
+            while (delete_count > 0)
             {
-                // delete only this many threads
-                std::int64_t delete_count = (std::min)(
-                    static_cast<std::int64_t>(terminated_items_count_ / 10),
-                    static_cast<std::int64_t>(parameters_.max_delete_count_));
+                std::int64_t const max_count = (std::min)(delete_count,
+                    static_cast<std::int64_t>(cleanup_batch_size));
 
-                // delete at least this many threads
-                delete_count = (std::max)(delete_count,
-                    static_cast<std::int64_t>(parameters_.min_delete_count_));
+                std::size_t num_recycled = 0;
+                std::int64_t const count = erase_terminated_locked(
+                    max_count, recycled.data(), num_recycled);
 
-                thread_data* todelete;
-                while (delete_count && terminated_items_.pop(todelete))
+                for (std::size_t i = 0; i != num_recycled; ++i)
                 {
-                    thread_id_type tid(todelete);
-                    --terminated_items_count_;
+                    recycle_thread(recycled[i]);
+                }
 
-                    // this thread has to be managed by this queue, it may have
-                    // ended up on the terminate threads list more than once,
-                    // however
-                    HPX_ASSERT(
-                        &get_thread_id_data(tid)->get_queue<thread_queue>() ==
-                        this);
+                if (count != max_count)
+                    break;
 
-                    if (thread_map_.erase(tid) != 0)
-                    {
-                        recycle_thread(tid);
-                        --thread_map_count_;
-                        HPX_ASSERT(thread_map_count_ >= 0);
-                    }
-                    --delete_count;
-                }
+                delete_count -= count;
             }
             return terminated_items_count_.load(std::memory_order_acquire) == 0;
         }
@@ -462,13 +550,10 @@ namespace hpx::threads::policies {
             if (delete_all)
             {
                 // do not lock mutex while deleting all threads, do it piece-wise
-                while (true)
+                while (cleanup_terminated_batch())
                 {
-                    std::unique_lock<mutex_type> lk(mtx_, std::try_to_lock);
-                    if (!lk.owns_lock())
-                        break;    // avoid long wait on lock
-
-                    if (cleanup_terminated_locked(false))
+                    if (terminated_items_count_.load(
+                            std::memory_order_acquire) == 0)
                     {
                         return true;
                     }
@@ -476,11 +561,10 @@ namespace hpx::threads::policies {
                 return false;
             }
 
-            std::unique_lock<mutex_type> lk(mtx_, std::try_to_lock);
-            if (!lk.owns_lock())
-                return false;    // avoid long wait on lock
+            if (!cleanup_terminated_batch())
+                return false;
 
-            return cleanup_terminated_locked(false);
+            return terminated_items_count_.load(std::memory_order_acquire) == 0;
         }
 
         explicit thread_queue(thread_queue_init_parameters const& parameters =
@@ -499,6 +583,11 @@ namespace hpx::threads::policies {
           , new_tasks_wait_(0)
           , new_tasks_wait_count_(0)
 #endif
+          , thread_magazines_{{thread_magazine_type(magazine_capacity()),
+                thread_magazine_type(magazine_capacity()),
+                thread_magazine_type(magazine_capacity()),
+                thread_magazine_type(magazine_capacity()),
+                thread_magazine_type(magazine_capacity())}}
 #ifdef HPX_HAVE_THREAD_CREATION_AND_CLEANUP_RATES
           , add_new_time_(0)
           , cleanup_terminated_time_(0)
@@ -523,20 +612,10 @@ namespace hpx::threads::policies {
 
         ~thread_queue()
         {
-            for (auto const& t : thread_heap_small_)
-                deallocate(get_thread_id_data(t));
-
-            for (auto const& t : thread_heap_medium_)
-                deallocate(get_thread_id_data(t));
-
-            for (auto const& t : thread_heap_large_)
-                deallocate(get_thread_id_data(t));
-
-            for (auto const& t : thread_heap_huge_)
-                deallocate(get_thread_id_data(t));
-
-            for (auto const& t : thread_heap_nostack_)
-                deallocate(get_thread_id_data(t));
+            for (auto& magazine : thread_magazines_)
+            {
+                magazine.drain(&thread_queue::deallocate);
+            }
         }
 
         thread_queue(thread_queue const&) = delete;
@@ -708,12 +787,14 @@ namespace hpx::threads::policies {
                 // suspended.
                 threads::thread_id_ref_type thrd;
 
-                std::unique_lock<mutex_type> lk(mtx_);
-
                 bool const schedule_now =
                     data.initial_state == thread_schedule_state::pending;
 
-                create_thread_object(thrd, data, lk);
+                // the thread object is taken from the magazines (or
+                // allocated) without holding the lock
+                create_thread_object(thrd, data);
+
+                std::unique_lock<mutex_type> lk(mtx_);
 
                 // add a new entry in the map for this thread
                 std::pair<thread_map_type::iterator, bool> const p =
@@ -1227,11 +1308,6 @@ namespace hpx::threads::policies {
         ///////////////////////////////////////////////////////////////////////
         void on_start_thread(std::size_t /* num_thread */)
         {
-            thread_heap_small_.reserve(parameters_.init_threads_count_);
-            thread_heap_medium_.reserve(parameters_.init_threads_count_);
-            thread_heap_large_.reserve(parameters_.init_threads_count_);
-            thread_heap_huge_.reserve(parameters_.init_threads_count_);
-
             // Pre-allocate init_threads_count threads, with accompanying stack,
             // with the default stack size
             static_assert(
@@ -1241,7 +1317,6 @@ namespace hpx::threads::policies {
                 "fails you've most likely changed the default without changing "
                 "the code here.");
 
-            std::lock_guard<mutex_type> lk(mtx_);
             for (std::int64_t i = 0; i < parameters_.init_threads_count_; ++i)
             {
                 // We don't care about the init parameters since this thread
@@ -1256,7 +1331,11 @@ namespace hpx::threads::policies {
                 HPX_ASSERT(p);
 
                 // Finally, store the thread for later use
-                thread_heap_small_.emplace_back(p);
+                if (!thread_magazines_[0].push(p))
+                {
+                    deallocate(p);
+                    break;
+                }
             }
         }
         static constexpr void on_stop_thread(std::size_t) noexcept {}
@@ -1297,11 +1376,8 @@ namespace hpx::threads::policies {
         std::atomic<std::int64_t> new_tasks_wait_count_;
 #endif
 
-        thread_heap_type thread_heap_small_;
-        thread_heap_type thread_heap_medium_;
-        thread_heap_type thread_heap_large_;
-        thread_heap_type thread_heap_huge_;
-        thread_heap_type thread_heap_nostack_;
+        std::array<thread_magazine_type, num_thread_magazines>
+            thread_magazines_;
 
 #ifdef HPX_HAVE_THREAD_CREATION_AND_CLEANUP_RATES
         std::uint64_t add_new_time_;
@@ -0,0 +1,96 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/affinity/affinity_data.hpp>
+#include <hpx/schedulers/hierarchical_victims.hpp>
+#include <hpx/threading_base/steal_distance.hpp>
+#include <hpx/topology/topology.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <tuple>
+#include <vector>
+
+namespace hpx::threads::policies::detail {
+
+    // the last level cache shared by the cores of a socket
+    inline constexpr int shared_cache_level = 3;
+
+    void get_hierarchical_victims(std::size_t num_thread,
+        std::size_t num_threads, affinity_data const& affinity_data,
+        bool enable_stealing_numa, std::vector<std::size_t>& victims,
+        std::vector<steal_distance>& distances)
+    {
+        auto const& topo = create_topology();
+
+        std::size_t const num_pu = affinity_data.get_pu_num(num_thread);
+        mask_type const core_mask = topo.get_core_affinity_mask(num_pu);
+        mask_type const cache_mask =
+            topo.get_cache_affinity_mask(num_pu, shared_cache_level);
+        mask_type const numa_mask = topo.get_numa_node_affinity_mask(num_pu);
+        auto const numa_node =
+            static_cast<std::ptrdiff_t>(topo.get_numa_node_number(num_pu));
+
+        distances.assign(num_threads, steal_distance::remote_numa);
+        distances[num_thread] = steal_distance::core;
+
+        std::vector<std::ptrdiff_t> numa_distances(num_threads, 0);
+
+        victims.clear();
+        victims.reserve(num_threads);
+
+        for (std::size_t i = 0; i != num_threads; ++i)
+        {
+            if (i == num_thread)
+                continue;
+
+            std::size_t const other_pu = affinity_data.get_pu_num(i);
+            mask_cref_type other_mask =
+                topo.get_thread_affinity_mask(other_pu);
+
+            if (any(core_mask & other_mask))
+            {
+                distances[i] = steal_distance::core;
+            }
+            else if (any(cache_mask & other_mask))
+            {
+                distances[i] = steal_distance::cache;
+            }
+            else if (any(numa_mask & other_mask))
+            {
+                distances[i] = steal_distance::numa;
+            }
+            else
+            {
+                // steal from other NUMA domains only if we are NUMA aware
+                if (!enable_stealing_numa)
+                    continue;
+
+                numa_distances[i] = std::abs(numa_node -
+                    static_cast<std::ptrdiff_t>(
+                        topo.get_numa_node_number(other_pu)));
+            }
+
+            victims.push_back(i);
+        }
+
+        // distance of the worker threads if arranged in a ring
+        auto const ring_distance = [&](std::size_t i) {
+            std::size_t const d = (i + num_threads - num_thread) % num_threads;
+            return (std::min) (d, num_threads - d);
+        };
+
+        std::sort(victims.begin(), victims.end(),
+            [&](std::size_t lhs, std::size_t rhs) {
+                return std::make_tuple(distances[lhs], numa_distances[lhs],
+                           ring_distance(lhs), lhs) <
+                    std::make_tuple(distances[rhs], numa_distances[rhs],
+                        ring_distance(rhs), rhs);
+            });
+    }
+}    // namespace hpx::threads::policies::detail
@@ -0,0 +1,120 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/modules/testing.hpp>
+#include <hpx/schedulers/object_magazine.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+using magazine_type = hpx::threads::policies::detail::object_magazine<int>;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_sequential()
+{
+    std::vector<int> objects(8);
+
+    magazine_type m(4);
+    HPX_TEST_EQ(m.capacity(), static_cast<std::size_t>(4));
+    HPX_TEST(m.pop() == nullptr);
+
+    // the magazine holds at most 'capacity' objects
+    for (std::size_t i = 0; i != 4; ++i)
+    {
+        HPX_TEST(m.push(&objects[i]));
+    }
+    HPX_TEST(!m.push(&objects[4]));
+    HPX_TEST_EQ(m.size(), static_cast<std::size_t>(4));
+
+    // the object returned last is handed out first
+    HPX_TEST(m.pop() == &objects[3]);
+    HPX_TEST(m.push(&objects[5]));
+    HPX_TEST(m.pop() == &objects[5]);
+
+    std::size_t count = 0;
+    m.drain([&](int*) { ++count; });
+    HPX_TEST_EQ(count, static_cast<std::size_t>(3));
+    HPX_TEST_EQ(m.size(), static_cast<std::size_t>(0));
+    HPX_TEST(m.pop() == nullptr);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_concurrent()
+{
+    constexpr std::size_t num_threads = 4;
+    constexpr std::size_t num_objects = 64;
+    constexpr std::size_t num_iterations = 100000;
+
+    // every object is owned either by one of the threads (1) or by the
+    // magazine (0)
+    std::vector<int> objects(num_threads * num_objects);
+    std::vector<std::atomic<int>> owned(objects.size());
+    for (auto& o : owned)
+    {
+        o.store(1);
+    }
+
+    magazine_type m(num_objects);
+    std::atomic<std::size_t> errors(0);
+    std::atomic<std::size_t> remaining(0);
+
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t != num_threads; ++t)
+    {
+        threads.emplace_back([&, t]() {
+            std::vector<int*> local;
+            for (std::size_t i = 0; i != num_objects; ++i)
+            {
+                local.push_back(&objects[t * num_objects + i]);
+            }
+
+            for (std::size_t i = 0; i != num_iterations; ++i)
+            {
+                if ((i % 3) != 0 && !local.empty())
+                {
+                    int* p = local.back();
+                    local.pop_back();
+
+                    owned[p - objects.data()].store(0);
+                    if (!m.push(p))
+                    {
+                        owned[p - objects.data()].store(1);
+                        local.push_back(p);
+                    }
+                }
+                else if (int* p = m.pop(); p != nullptr)
+                {
+                    // no object may be handed out twice
+                    if (owned[p - objects.data()].exchange(1) != 0)
+                        ++errors;
+                    local.push_back(p);
+                }
+            }
+
+            remaining += local.size();
+        });
+    }
+
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+    HPX_TEST_EQ(errors.load(), static_cast<std::size_t>(0));
+
+    // no object got lost
+    m.drain([&](int*) { ++remaining; });
+    HPX_TEST_EQ(remaining.load(), objects.size());
+}
+
+int main()
+{
+    test_sequential();
+    test_concurrent();
+
+    return hpx::util::report_errors();
+}
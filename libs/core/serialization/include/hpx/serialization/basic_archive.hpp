@@ -39,7 +39,8 @@ namespace hpx::serialization {
         disable_receive_data_chunking = 0x00040000,
         archive_is_saving = 0x00080000,
         archive_is_preprocessing = 0x00100000,
-        all_archive_flags = 0x001fe000    // all of the above
+        enable_type_ids = 0x00200000,
+        all_archive_flags = 0x003fe000    // all of the above
     };
 
     constexpr archive_flags operator|(
@@ -145,6 +146,14 @@ namespace hpx::serialization {
                     flags_ & archive_flags::disable_receive_data_chunking);
         }
 
+        // Polymorphic types which have a (dense) id assigned are identified
+        // by their id instead of their name. The ids are assigned while
+        // bootstrapping the localities, they are not stable across runs.
+        [[nodiscard]] constexpr bool enable_type_ids() const noexcept
+        {
+            return static_cast<bool>(flags_ & archive_flags::enable_type_ids);
+        }
+
         [[nodiscard]] constexpr std::uint32_t flags() const noexcept
         {
             return flags_;
@@ -9,17 +9,124 @@
 
 #include <hpx/config.hpp>
 
+#include <hpx/serialization/access.hpp>
 #include <hpx/serialization/brace_initializable_fwd.hpp>
 #include <hpx/serialization/serialization_fwd.hpp>
 #include <hpx/serialization/std_tuple.hpp>
 #include <hpx/serialization/traits/brace_initializable_traits.hpp>
+#include <hpx/serialization/traits/is_bitwise_serializable.hpp>
+#include <hpx/serialization/traits/is_not_bitwise_serializable.hpp>
+#include <hpx/serialization/traits/is_serializable.hpp>
+#include <hpx/serialization/traits/polymorphic_traits.hpp>
 
+#include <cstddef>
+#include <memory>
 // We use std::tuple instead of hpx::tuple to avoid circular dependencies
 // between the serialization and datastructure modules.
 #include <tuple>
+#include <type_traits>
 
 namespace hpx::serialization {
 
+    namespace detail {
+
+        // Members of this type are serialized by copying their bytes, exactly
+        // like the archives handle bitwise serializable types. Integral types
+        // are copied as well, without being widened to 64 bits first.
+        template <typename T>
+        inline constexpr bool is_bitwise_member_v =
+            std::is_trivially_copyable_v<T> && !std::is_pointer_v<T> &&
+            !std::is_empty_v<T> && !access::has_serialize_v<T> &&
+            !hpx::traits::has_serialize_adl_v<T> &&
+            !hpx::traits::is_nonintrusive_polymorphic_v<T> &&
+            (hpx::traits::is_bitwise_serializable_v<T> ||
+                !hpx::traits::is_not_bitwise_serializable_v<T>);
+
+        // Collects adjacent bitwise serializable members of a struct, each
+        // run of members not separated by padding or by other members is
+        // handed to the archive using a single call.
+        template <typename Archive>
+        class member_run
+        {
+        public:
+            explicit constexpr member_run(Archive& ar) noexcept
+              : ar_(ar)
+            {
+            }
+
+            template <typename T>
+            HPX_FORCEINLINE void add(T& t)
+            {
+                if constexpr (is_bitwise_member_v<std::remove_const_t<T>>)
+                {
+                    char* p = const_cast<char*>(
+                        reinterpret_cast<char const*>(std::addressof(t)));
+                    if (p != end_)
+                    {
+                        flush();
+                        begin_ = p;
+                    }
+                    end_ = p + sizeof(T);
+                }
+                else
+                {
+                    flush();
+#if !defined(HPX_SERIALIZATION_HAVE_ALLOW_CONST_TUPLE_MEMBERS)
+                    serialize_one(ar_, t);
+#else
+                    serialize_one(ar_, const_cast<std::remove_const_t<T>&>(t));
+#endif
+                }
+            }
+
+            HPX_FORCEINLINE void flush()
+            {
+                if (begin_ != end_)
+                {
+                    auto const count = static_cast<std::size_t>(end_ - begin_);
+                    if constexpr (std::is_same_v<Archive, input_archive>)
+                    {
+                        ar_.load_binary(begin_, count);
+                    }
+                    else
+                    {
+                        ar_.save_binary(begin_, count);
+                    }
+                }
+                begin_ = nullptr;
+                end_ = nullptr;
+            }
+
+        private:
+            Archive& ar_;
+            char* begin_ = nullptr;
+            char* end_ = nullptr;
+        };
+
+        template <typename Archive, typename... Ts>
+        void serialize_struct_members(
+            Archive& archive, unsigned int const version, Ts&... ts)
+        {
+            if constexpr ((is_bitwise_member_v<std::remove_const_t<Ts>> ||
+                              ...))
+            {
+                // copying the bytes is valid only if the archive does not
+                // have to convert the members
+                if (!archive.disable_array_optimization() &&
+                    !archive.endianess_differs())
+                {
+                    member_run<Archive> run(archive);
+                    (run.add(ts), ...);
+                    run.flush();
+                    return;
+                }
+            }
+
+            auto&& data = std::forward_as_tuple(ts...);
+            serialize(archive, data, version);
+        }
+    }    // namespace detail
+
     template <typename Archive, typename T>
     void serialize_struct(Archive& archive, T& t, const unsigned int version,
         hpx::traits::detail::size<0>)
@@ -32,8 +139,7 @@ namespace hpx::serialization {
         hpx::traits::detail::size<1>)
     {
         auto& [p1] = t;
-        auto&& data = std::forward_as_tuple(p1);
-        serialize(archive, data, version);
+        detail::serialize_struct_members(archive, version, p1);
     }
 
     template <typename Archive, typename T>
@@ -41,8 +147,7 @@ namespace hpx::serialization {
         hpx::traits::detail::size<2>)
     {
         auto& [p1, p2] = t;
-        auto&& data = std::forward_as_tuple(p1, p2);
-        serialize(archive, data, version);
+        detail::serialize_struct_members(archive, version, p1, p2);
     }
 
     template <typename Archive, typename T>
@@ -50,8 +155,7 @@ namespace hpx::serialization {
         hpx::traits::detail::size<3>)
     {
         auto& [p1, p2, p3] = t;
-        auto&& data = std::forward_as_tuple(p1, p2, p3);
-        serialize(archive, data, version);
+        detail::serialize_struct_members(archive, version, p1, p2, p3);
     }
 
     template <typename Archive, typename T>
@@ -59,8 +163,7 @@ namespace hpx::serialization {
         hpx::traits::detail::size<4>)
     {
         auto& [p1, p2, p3, p4] = t;
-        auto&& data = std::forward_as_tuple(p1, p2, p3, p4);
-        serialize(archive, data, version);
+        detail::serialize_struct_members(archive, version, p1, p2, p3, p4);
     }
 
     template <typename Archive, typename T>
@@ -68,8 +171,7 @@ namespace hpx::serialization {
         hpx::traits::detail::size<5>)
     {
         auto& [p1, p2, p3, p4, p5] = t;
-        auto&& data = std::forward_as_tuple(p1, p2, p3, p4, p5);
-        serialize(archive, data, version);
+        detail::serialize_struct_members(archive, version, p1, p2, p3, p4, p5);
     }
 
     template <typename Archive, typename T>
@@ -77,8 +179,8 @@ namespace hpx::serialization {
         hpx::traits::detail::size<6>)
     {
         auto& [p1, p2, p3, p4, p5, p6] = t;
-        auto&& data = std::forward_as_tuple(p1, p2, p3, p4, p5, p6);
-        serialize(archive, data, version);
+        detail::serialize_struct_members(archive, version, p1, p2, p3, p4, p5,
+            p6);
     }
 
     template <typename Archive, typename T>
@@ -86,8 +188,8 @@ namespace hpx::serialization {
         hpx::traits::detail::size<7>)
     {
         auto& [p1, p2, p3, p4, p5, p6, p7] = t;
-        auto&& data = std::forward_as_tuple(p1, p2, p3, p4, p5, p6, p7);
-        serialize(archive, data, version);
+        detail::serialize_struct_members(archive, version, p1, p2, p3, p4, p5,
+            p6, p7);
     }
 
     template <typename Archive, typename T>
@@ -95,8 +197,8 @@ namespace hpx::serialization {
         hpx::traits::detail::size<8>)
     {
         auto& [p1, p2, p3, p4, p5, p6, p7, p8] = t;
-        auto&& data = std::forward_as_tuple(p1, p2, p3, p4, p5, p6, p7, p8);
-        serialize(archive, data, version);
+        detail::serialize_struct_members(archive, version, p1, p2, p3, p4, p5,
+            p6, p7, p8);
     }
 
     template <typename Archive, typename T>
@@ -104,8 +206,8 @@ namespace hpx::serialization {
         hpx::traits::detail::size<9>)
     {
         auto& [p1, p2, p3, p4, p5, p6, p7, p8, p9] = t;
-        auto&& data = std::forward_as_tuple(p1, p2, p3, p4, p5, p6, p7, p8, p9);
-        serialize(archive, data, version);
+        detail::serialize_struct_members(archive, version, p1, p2, p3, p4, p5,
+            p6, p7, p8, p9);
     }
 
     template <typename Archive, typename T>
@@ -113,9 +215,8 @@ namespace hpx::serialization {
         hpx::traits::detail::size<10>)
     {
         auto& [p1, p2, p3, p4, p5, p6, p7, p8, p9, p10] = t;
-        auto&& data =
-            std::forward_as_tuple(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10);
-        serialize(archive, data, version);
+        detail::serialize_struct_members(archive, version, p1, p2, p3, p4, p5,
+            p6, p7, p8, p9, p10);
     }
 
     template <typename Archive, typename T>
@@ -123,9 +224,8 @@ namespace hpx::serialization {
         hpx::traits::detail::size<11>)
     {
         auto& [p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11] = t;
-        auto&& data =
-            std::forward_as_tuple(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11);
-        serialize(archive, data, version);
+        detail::serialize_struct_members(archive, version, p1, p2, p3, p4, p5,
+            p6, p7, p8, p9, p10, p11);
     }
 
     template <typename Archive, typename T>
@@ -133,9 +233,8 @@ namespace hpx::serialization {
         hpx::traits::detail::size<12>)
     {
         auto& [p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12] = t;
-        auto&& data = std::forward_as_tuple(
-            p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12);
-        serialize(archive, data, version);
+        detail::serialize_struct_members(archive, version, p1, p2, p3, p4, p5,
+            p6, p7, p8, p9, p10, p11, p12);
     }
 
     template <typename Archive, typename T>
@@ -143,9 +242,8 @@ namespace hpx::serialization {
         hpx::traits::detail::size<13>)
     {
         auto& [p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13] = t;
-        auto&& data = std::forward_as_tuple(
-            p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13);
-        serialize(archive, data, version);
+        detail::serialize_struct_members(archive, version, p1, p2, p3, p4, p5,
+            p6, p7, p8, p9, p10, p11, p12, p13);
     }
 
     template <typename Archive, typename T>
@@ -153,9 +251,8 @@ namespace hpx::serialization {
         hpx::traits::detail::size<14>)
     {
         auto& [p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14] = t;
-        auto&& data = std::forward_as_tuple(
-            p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14);
-        serialize(archive, data, version);
+        detail::serialize_struct_members(archive, version, p1, p2, p3, p4, p5,
+            p6, p7, p8, p9, p10, p11, p12, p13, p14);
     }
 
     template <typename Archive, typename T>
@@ -164,9 +261,8 @@ namespace hpx::serialization {
     {
         auto& [p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14,
             p15] = t;
-        auto&& data = std::forward_as_tuple(
-            p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15);
-        serialize(archive, data, version);
+        detail::serialize_struct_members(archive, version, p1, p2, p3, p4, p5,
+            p6, p7, p8, p9, p10, p11, p12, p13, p14, p15);
     }
 
     template <typename Archive, typename T>
@@ -46,5 +46,11 @@ namespace hpx::serialization {
         virtual void load_binary(void* address, std::size_t count) = 0;
         virtual void load_binary_chunk(
             void* address, std::size_t count, bool allow_zero_copy_receive) = 0;
+
+        // Return the address of the already received zero-copy chunk of the
+        // given size (and consume it) if the next chunk can be referenced in
+        // place, otherwise return nullptr without consuming anything.
+        virtual void* load_binary_chunk_view(
+            std::size_t count, std::size_t alignment) = 0;
     };
 }    // namespace hpx::serialization
@@ -0,0 +1,91 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace hpx::serialization::detail {
+
+    // An allocator which default-initializes (instead of value-initializes)
+    // the elements constructed without arguments. Resizing a std::vector<char>
+    // using this allocator leaves the new bytes uninitialized, which avoids
+    // clearing memory that is about to be overwritten by the serialization
+    // archives anyway.
+    template <typename T, typename Allocator = std::allocator<T>>
+    struct default_init_allocator : Allocator
+    {
+        using traits = std::allocator_traits<Allocator>;
+
+        using value_type = T;
+        using size_type = typename traits::size_type;
+        using difference_type = typename traits::difference_type;
+        using propagate_on_container_move_assignment =
+            typename traits::propagate_on_container_move_assignment;
+        using is_always_equal = typename traits::is_always_equal;
+
+        template <typename U>
+        struct rebind
+        {
+            using other = default_init_allocator<U,
+                typename traits::template rebind_alloc<U>>;
+        };
+
+        default_init_allocator() = default;
+
+        template <typename U, typename OtherAllocator>
+        constexpr default_init_allocator(
+            default_init_allocator<U, OtherAllocator> const& other) noexcept
+          : Allocator(static_cast<OtherAllocator const&>(other))
+        {
+        }
+
+        [[nodiscard]] T* allocate(std::size_t n)
+        {
+            return traits::allocate(static_cast<Allocator&>(*this), n);
+        }
+
+        void deallocate(T* p, std::size_t n) noexcept
+        {
+            traits::deallocate(static_cast<Allocator&>(*this), p, n);
+        }
+
+        template <typename U>
+        void construct(U* p) noexcept(
+            std::is_nothrow_default_constructible_v<U>)
+        {
+            ::new (static_cast<void*>(p)) U;
+        }
+
+        template <typename U, typename... Ts>
+        void construct(U* p, Ts&&... ts)
+        {
+            traits::construct(static_cast<Allocator&>(*this), p,
+                HPX_FORWARD(Ts, ts)...);
+        }
+
+        template <typename U, typename OtherAllocator>
+        friend constexpr bool operator==(default_init_allocator const& lhs,
+            default_init_allocator<U, OtherAllocator> const& rhs) noexcept
+        {
+            return static_cast<Allocator const&>(lhs) ==
+                static_cast<OtherAllocator const&>(rhs);
+        }
+
+        template <typename U, typename OtherAllocator>
+        friend constexpr bool operator!=(default_init_allocator const& lhs,
+            default_init_allocator<U, OtherAllocator> const& rhs) noexcept
+        {
+            return !(lhs == rhs);
+        }
+    };
+}    // namespace hpx::serialization::detail
@@ -102,11 +102,8 @@ namespace hpx::serialization {
             {
                 static Pointer call(input_archive& ar)
                 {
-                    std::string name;
-                    ar >> name;
-
                     Pointer t(polymorphic_intrusive_factory::instance()
-                                  .create<referred_type>(name));
+                                  .create<referred_type>(ar));
                     ar >> *t;
                     return t;
                 }
@@ -179,8 +176,8 @@ namespace hpx::serialization {
             {
                 static void call(output_archive& ar, Pointer const& ptr)
                 {
-                    std::string const name = access::get_name(ptr.get());
-                    ar << name;
+                    polymorphic_intrusive_factory::instance().save_type(
+                        ar, access::get_name(ptr.get()));
                     ar << *ptr;
                 }
             };
@@ -48,6 +48,14 @@ namespace hpx::serialization::detail {
         HPX_CORE_EXPORT void register_typename(
             std::string const& type_name, std::uint32_t id);
 
+        // Register the name of a polymorphic type which is created by the
+        // intrusive or the non-intrusive factory. Such types are assigned an
+        // id as well, which allows to send the id instead of the name.
+        HPX_CORE_EXPORT void register_polymorphic_typename(
+            std::string const& type_name);
+
+        // Assign ids to all types which don't have one yet and make the ids
+        // known to the factories.
         HPX_CORE_EXPORT void fill_missing_typenames();
 
         [[nodiscard]] HPX_CORE_EXPORT std::uint32_t try_get_id(
@@ -16,9 +16,11 @@
 #include <hpx/preprocessor/stringize.hpp>
 #include <hpx/serialization/serialization_fwd.hpp>
 
+#include <cstdint>
 #include <functional>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 namespace hpx::serialization::detail {
 
@@ -29,8 +31,16 @@ namespace hpx::serialization::detail {
 
     private:
         using ctor_type = void* (*) ();
+
+        struct entry_type
+        {
+            ctor_type ctor;
+            std::uint32_t id;
+        };
+
         using ctor_map_type =
-            std::unordered_map<std::string, ctor_type, std::hash<std::string>>;
+            std::unordered_map<std::string, entry_type, std::hash<std::string>>;
+        using cache_type = std::vector<ctor_type>;
 
     public:
         polymorphic_intrusive_factory() = default;
@@ -43,14 +53,46 @@ namespace hpx::serialization::detail {
         [[nodiscard]] HPX_CORE_EXPORT void* create(
             std::string const& name) const;
 
+        [[nodiscard]] HPX_CORE_EXPORT void* create(std::uint32_t id) const;
+
         template <typename T>
         [[nodiscard]] T* create(std::string const& name) const
         {
             return static_cast<T*>(create(name));
         }
 
+        template <typename T>
+        [[nodiscard]] T* create(std::uint32_t id) const
+        {
+            return static_cast<T*>(create(id));
+        }
+
+        // Write the id or the name identifying the type with the given name.
+        HPX_CORE_EXPORT void save_type(
+            output_archive& ar, std::string const& name) const;
+
+        // Read the id or the name identifying a type and create an instance.
+        [[nodiscard]] HPX_CORE_EXPORT void* create(input_archive& ar) const;
+
+        template <typename T>
+        [[nodiscard]] T* create(input_archive& ar) const
+        {
+            return static_cast<T*>(create(ar));
+        }
+
+        // Return the id assigned to the type with the given name, or
+        // id_registry::invalid_id if no id was assigned (yet).
+        [[nodiscard]] HPX_CORE_EXPORT std::uint32_t get_id(
+            std::string const& name) const;
+
+        // Pick up the ids assigned by the id_registry.
+        HPX_CORE_EXPORT void cache_ids();
+
     private:
+        void cache_id(std::string const& name, entry_type& entry);
+
         ctor_map_type map_;
+        cache_type cache_;
     };
 
     template <typename T, typename Enable = void>
@@ -17,17 +17,20 @@
 #include <hpx/preprocessor/stringize.hpp>
 #include <hpx/preprocessor/strip_parens.hpp>
 #include <hpx/serialization/detail/non_default_constructible.hpp>
+#include <hpx/serialization/detail/polymorphic_id_factory.hpp>
 #include <hpx/serialization/serialization_fwd.hpp>
 #include <hpx/serialization/traits/needs_automatic_registration.hpp>
 #include <hpx/serialization/traits/polymorphic_traits.hpp>
 #include <hpx/type_support/static.hpp>
 
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <string>
 #include <type_traits>
 #include <typeinfo>
 #include <unordered_map>
+#include <vector>
 
 #include <hpx/config/warnings_prefix.hpp>
 
@@ -106,10 +109,18 @@ namespace hpx::serialization::detail {
         HPX_NON_COPYABLE(polymorphic_nonintrusive_factory);
 
     public:
+        struct type_entry
+        {
+            std::string class_name;
+            std::uint32_t id;
+            function_bunch_type const* bunch;
+        };
+
         using serializer_map_type = std::unordered_map<std::string,
             function_bunch_type, std::hash<std::string>>;
         using serializer_typeinfo_map_type = std::unordered_map<std::string,
-            std::string, std::hash<std::string>>;
+            type_entry, std::hash<std::string>>;
+        using cache_type = std::vector<function_bunch_type const*>;
 
         HPX_CORE_EXPORT static polymorphic_nonintrusive_factory& instance();
 
@@ -128,15 +139,27 @@ namespace hpx::serialization::detail {
                     "polymorphic_nonintrusive_factory::register_class",
                     "Cannot register a factory with an empty name");
             }
-            auto const it = map_.find(class_name);
+            auto const it = map_.emplace(class_name, bunch).first;
             auto const jt = typeinfo_map_.find(typeinfo.name());
 
-            if (it == map_.end())
-                map_[class_name] = bunch;
             if (jt == typeinfo_map_.end())
-                typeinfo_map_[typeinfo.name()] = class_name;
+            {
+                auto const p = typeinfo_map_.emplace(typeinfo.name(),
+                    type_entry{class_name, id_registry::invalid_id,
+                        &it->second});
+
+                // make sure the type is assigned an id, types registered
+                // after the ids were assigned pick up the id if the name is
+                // known
+                id_registry::instance().register_polymorphic_typename(
+                    class_name);
+                cache_id(p.first->second);
+            }
         }
 
+        // Pick up the ids assigned by the id_registry.
+        HPX_CORE_EXPORT void cache_ids();
+
         // the following templates are defined in *.ipp file
         template <typename T>
         void save(output_archive& ar, T const& t);
@@ -154,8 +177,20 @@ namespace hpx::serialization::detail {
 
         friend struct hpx::util::static_<polymorphic_nonintrusive_factory>;
 
+        HPX_CORE_EXPORT void cache_id(type_entry& entry);
+
+        // write the id or the name identifying the type
+        HPX_CORE_EXPORT static void save_type(
+            output_archive& ar, type_entry const& entry);
+
+        // read the id or the name identifying the type and return the
+        // corresponding functions
+        [[nodiscard]] HPX_CORE_EXPORT function_bunch_type const& load_type(
+            input_archive& ar) const;
+
         serializer_map_type map_;
         serializer_typeinfo_map_type typeinfo_map_;
+        cache_type cache_;
     };
 
     template <typename Derived>
@@ -22,30 +22,24 @@ namespace hpx::serialization::detail {
     void polymorphic_nonintrusive_factory::save(output_archive& ar, T const& t)
     {
         // It's safe to call typeid here. The typeid(t) return value is
-        // only used for local lookup to the portable string that goes over the
-        // wire
-        std::string const class_name = typeinfo_map_.at(typeid(t).name());
-        ar << class_name;
+        // only used for local lookup to the portable string (or id) that goes
+        // over the wire
+        type_entry const& entry = typeinfo_map_.at(typeid(t).name());
+        save_type(ar, entry);
 
-        map_.at(class_name).save_function(ar, &t);
+        entry.bunch->save_function(ar, &t);
     }
 
     template <typename T>
     void polymorphic_nonintrusive_factory::load(input_archive& ar, T& t)
     {
-        std::string class_name;
-        ar >> class_name;
-
-        map_.at(class_name).load_function(ar, &t);
+        load_type(ar).load_function(ar, &t);
     }
 
     template <typename T>
     T* polymorphic_nonintrusive_factory::load(input_archive& ar)
     {
-        std::string class_name;
-        ar >> class_name;
-
-        function_bunch_type const& bunch = map_.at(class_name);
+        function_bunch_type const& bunch = load_type(ar);
         T* t = static_cast<T*>(bunch.create_function(ar));
 
         return t;
@@ -0,0 +1,70 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/type_support/extra_data.hpp>
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace hpx::serialization::detail {
+
+    // Polymorphic types which are identified by their id are sent together
+    // with their name when they appear in an archive for the first time. This
+    // allows the receiver to fall back to the name if it does not know the id
+    // (e.g. if it registered the type only after the ids were exchanged while
+    // bootstrapping the localities).
+    class polymorphic_type_names
+    {
+    public:
+        // Return the name sent for the type with the given id, or nullptr if
+        // the type did not appear in the archive yet. The returned name is
+        // empty on the sending side.
+        [[nodiscard]] std::string const* find(std::uint32_t id) const noexcept
+        {
+            // archives usually hold only a few distinct polymorphic types
+            for (auto const& [type_id, name] : types_)
+            {
+                if (type_id == id)
+                {
+                    return &name;
+                }
+            }
+            return nullptr;
+        }
+
+        std::string const& add(std::uint32_t id, std::string name = {})
+        {
+            return types_.emplace_back(id, HPX_MOVE(name)).second;
+        }
+
+        void reset() noexcept
+        {
+            types_.clear();
+        }
+
+    private:
+        std::vector<std::pair<std::uint32_t, std::string>> types_;
+    };
+}    // namespace hpx::serialization::detail
+
+// This is explicitly instantiated to ensure that the id is stable across shared
+// libraries.
+template <>
+struct hpx::util::extra_data_helper<
+    hpx::serialization::detail::polymorphic_type_names>
+{
+    HPX_CORE_EXPORT static extra_data_id_type id() noexcept;
+    static void reset(
+        serialization::detail::polymorphic_type_names* data) noexcept
+    {
+        data->reset();
+    }
+};
@@ -76,6 +76,12 @@ namespace hpx::traits {
             return cont.resize(cont.size() + count);
         }
 
+        static void truncate(serialization::detail::preprocess_container& cont,
+            std::size_t size) noexcept
+        {
+            cont.resize(size);
+        }
+
         static void reset(
             serialization::detail::preprocess_container& cont) noexcept
         {
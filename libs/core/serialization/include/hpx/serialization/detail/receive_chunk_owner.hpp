@@ -0,0 +1,43 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/type_support/extra_data.hpp>
+
+#include <cstddef>
+#include <memory>
+
+namespace hpx::serialization::detail {
+
+    // Attached to an input archive by the receiving end of a parcelport if
+    // the memory holding the zero-copy chunks was received before the
+    // de-serialization starts. Types supporting this (serialize_buffer) may
+    // then refer to the chunk memory instead of copying it, sharing the
+    // ownership of the memory.
+    struct receive_chunk_owner
+    {
+        std::shared_ptr<void> owner;
+
+        // number of chunks that were handed out without being copied
+        std::size_t views = 0;
+    };
+}    // namespace hpx::serialization::detail
+
+// This is explicitly instantiated to ensure that the id is stable across shared
+// libraries.
+template <>
+struct hpx::util::extra_data_helper<
+    hpx::serialization::detail::receive_chunk_owner>
+{
+    HPX_CORE_EXPORT static extra_data_id_type id() noexcept;
+    static void reset(serialization::detail::receive_chunk_owner* data) noexcept
+    {
+        data->owner.reset();
+        data->views = 0;
+    }
+};
@@ -308,6 +308,29 @@ namespace hpx::serialization {
             size_ += count;
         }
 
+        // Return the address of the next zero-copy chunk if it can be
+        // referenced in place (it was received before de-serialization
+        // started), nullptr otherwise. The chunk is consumed only if its
+        // address is returned. No chunk is available if the other end has
+        // serialized the data inline (array optimization or data chunking
+        // disabled).
+        [[nodiscard]] void* load_binary_chunk_view(
+            std::size_t count, std::size_t alignment)
+        {
+            if (HPX_UNLIKELY(0 == count) || disable_array_optimization() ||
+                disable_data_chunking() || endianess_differs())
+            {
+                return nullptr;
+            }
+
+            void* data = buffer_->load_binary_chunk_view(count, alignment);
+            if (data != nullptr)
+            {
+                size_ += count;
+            }
+            return data;
+        }
+
     private:
         std::unique_ptr<erased_input_container> buffer_;
     };
@@ -212,6 +212,36 @@ namespace hpx::serialization {
             }
         }
 
+        void* load_binary_chunk_view(
+            std::size_t count, std::size_t alignment) override
+        {
+            HPX_ASSERT(static_cast<std::int64_t>(count) >= 0);
+
+            // the data must have been stored in a separate chunk which was
+            // received before de-serialization started
+            if (chunks_ == nullptr ||
+                count < zero_copy_serialization_threshold_ ||
+                filter_ != nullptr ||
+                current_chunk_ == static_cast<std::size_t>(-1) ||
+                current_chunk_ >= get_num_chunks() ||
+                get_chunk_type(current_chunk_) !=
+                    chunk_type::chunk_type_pointer ||
+                get_chunk_size(current_chunk_) != count)
+            {
+                return nullptr;
+            }
+
+            void* buffer = get_chunk_data(current_chunk_).pos_;
+            if (buffer == nullptr ||
+                reinterpret_cast<std::uintptr_t>(buffer) % alignment != 0)
+            {
+                return nullptr;
+            }
+
+            ++current_chunk_;
+            return buffer;
+        }
+
         Container const& cont_;
         std::size_t current_;
         std::unique_ptr<binary_filter> filter_;
@@ -311,8 +311,13 @@ namespace hpx::serialization {
         {
             std::size_t written = 0;
 
-            if (access_traits::size(this->cont_) < this->current_)
-                access_traits::resize(this->cont_, this->current_);
+            // the compressed data is expected to be smaller than the data
+            // passed to the filter
+            std::size_t size = access_traits::size(this->cont_);
+            if (size < this->current_)
+            {
+                access_traits::resize(this->cont_, this->current_ - size);
+            }
 
             this->current_ = start_compressing_at_;
 
@@ -326,14 +331,14 @@ namespace hpx::serialization {
                 if (flushed)
                     break;
 
-                // resize container
-                std::size_t const size = access_traits::size(this->cont_);
-                access_traits::resize(this->cont_, 2 * size);
+                // double the size of the container
+                size = access_traits::size(this->cont_);
+                access_traits::resize(this->cont_, size);
 
             } while (true);
 
             // truncate container
-            access_traits::resize(this->cont_, this->current_);
+            access_traits::truncate(this->cont_, this->current_);
         }
 
         void set_filter(binary_filter* filter) override
@@ -349,9 +354,22 @@ namespace hpx::serialization {
         {
             HPX_ASSERT(count != 0);
 
-            // during construction the filter may not have been set yet
             if (filter_ != nullptr)
+            {
                 filter_->save(address, count);
+            }
+            else
+            {
+                // during construction the filter has not been set yet, the
+                // archive header is stored uncompressed
+                std::size_t const size = access_traits::size(this->cont_);
+                std::size_t const new_current = this->current_ + count;
+                if (size < new_current)
+                    access_traits::resize(this->cont_, new_current - size);
+
+                access_traits::write(
+                    this->cont_, count, this->current_, address);
+            }
             this->current_ += count;
         }
 
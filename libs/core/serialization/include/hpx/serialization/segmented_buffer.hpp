@@ -0,0 +1,248 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/serialization/binary_filter.hpp>
+#include <hpx/serialization/detail/default_init_allocator.hpp>
+#include <hpx/serialization/traits/serialization_access_data.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::serialization {
+
+    namespace detail {
+
+        // Segments are recycled through a process-wide pool, which retains a
+        // limited number of unused segments.
+        [[nodiscard]] HPX_CORE_EXPORT char* allocate_segment();
+        HPX_CORE_EXPORT void deallocate_segment(char* segment) noexcept;
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    // An output container for the serialization archives which stores the
+    // serialized data in a chain of fixed-size segments instead of a single
+    // contiguous block of memory. Growing the buffer never moves the data
+    // serialized so far, nor does it initialize the added memory. The
+    // segments can be handed to the network layer as a list of buffers
+    // (scatter-gather I/O) without having to flatten them first.
+    //
+    // The segmented_buffer can be used for output archives only.
+    class segmented_buffer
+    {
+    public:
+        using value_type = char;
+        using size_type = std::size_t;
+
+        // The segments are not allocated using the allocator, the type is
+        // defined for compatibility with the parcelport buffers only.
+        using allocator_type = std::allocator<char>;
+
+        static constexpr std::size_t segment_bits = 14;
+        static constexpr std::size_t segment_size = std::size_t(1)
+            << segment_bits;
+
+        explicit segmented_buffer(
+            allocator_type const& = allocator_type()) noexcept
+          : size_(0)
+        {
+        }
+
+        segmented_buffer(segmented_buffer const&) = delete;
+        segmented_buffer& operator=(segmented_buffer const&) = delete;
+
+        segmented_buffer(segmented_buffer&& rhs) noexcept
+          : segments_(HPX_MOVE(rhs.segments_))
+          , size_(std::exchange(rhs.size_, 0))
+        {
+            rhs.segments_.clear();
+        }
+
+        segmented_buffer& operator=(segmented_buffer&& rhs) noexcept
+        {
+            if (this != &rhs)
+            {
+                clear();
+                segments_ = HPX_MOVE(rhs.segments_);
+                size_ = std::exchange(rhs.size_, 0);
+                rhs.segments_.clear();
+            }
+            return *this;
+        }
+
+        ~segmented_buffer()
+        {
+            clear();
+        }
+
+        [[nodiscard]] std::size_t size() const noexcept
+        {
+            return size_;
+        }
+
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return size_ == 0;
+        }
+
+        [[nodiscard]] std::size_t capacity() const noexcept
+        {
+            return segments_.size() * segment_size;
+        }
+
+        // Return the number of segments holding data.
+        [[nodiscard]] std::size_t num_segments() const noexcept
+        {
+            return (size_ + segment_size - 1) >> segment_bits;
+        }
+
+        void reserve(std::size_t size)
+        {
+            if (size > capacity())
+            {
+                segments_.reserve((size + segment_size - 1) >> segment_bits);
+                while (size > capacity())
+                {
+                    segments_.push_back(detail::allocate_segment());
+                }
+            }
+        }
+
+        // Change the size of the buffer, any bytes added are uninitialized.
+        // Segments which are not needed anymore are kept until clear() is
+        // called.
+        void resize(std::size_t size)
+        {
+            reserve(size);
+            size_ = size;
+        }
+
+        // Remove all data, returning the segments to the pool.
+        void clear() noexcept
+        {
+            for (char* segment : segments_)
+            {
+                detail::deallocate_segment(segment);
+            }
+            segments_.clear();
+            size_ = 0;
+        }
+
+        [[nodiscard]] char& operator[](std::size_t pos) noexcept
+        {
+            HPX_ASSERT(pos < size_);
+            return segments_[pos >> segment_bits][pos & (segment_size - 1)];
+        }
+
+        [[nodiscard]] char const& operator[](std::size_t pos) const noexcept
+        {
+            HPX_ASSERT(pos < size_);
+            return segments_[pos >> segment_bits][pos & (segment_size - 1)];
+        }
+
+        // Copy the given data into the buffer at the given position, the
+        // buffer has to be large enough already.
+        void write(
+            std::size_t pos, void const* address, std::size_t count) noexcept
+        {
+            HPX_ASSERT(pos + count <= size_);
+
+            char const* src = static_cast<char const*>(address);
+            std::size_t segment = pos >> segment_bits;
+            std::size_t offset = pos & (segment_size - 1);
+            while (count != 0)
+            {
+                std::size_t const n = (std::min)(count, segment_size - offset);
+                std::memcpy(segments_[segment] + offset, src, n);
+
+                src += n;
+                count -= n;
+                ++segment;
+                offset = 0;
+            }
+        }
+
+        // Invoke f(char const* data, std::size_t size) for each of the
+        // segments holding data, in order.
+        template <typename F>
+        void for_each_segment(F&& f) const
+        {
+            std::size_t remaining = size_;
+            for (std::size_t i = 0; remaining != 0; ++i)
+            {
+                std::size_t const n = (std::min)(remaining, segment_size);
+                f(static_cast<char const*>(segments_[i]), n);
+                remaining -= n;
+            }
+        }
+
+    private:
+        std::vector<char*> segments_;
+        std::size_t size_;
+    };
+}    // namespace hpx::serialization
+
+namespace hpx::traits {
+
+    template <>
+    struct serialization_access_data<serialization::segmented_buffer>
+      : default_serialization_access_data<serialization::segmented_buffer>
+    {
+        [[nodiscard]] static std::size_t size(
+            serialization::segmented_buffer const& cont) noexcept
+        {
+            return cont.size();
+        }
+
+        static void resize(
+            serialization::segmented_buffer& cont, std::size_t count)
+        {
+            cont.resize(cont.size() + count);
+        }
+
+        static void truncate(
+            serialization::segmented_buffer& cont, std::size_t size)
+        {
+            cont.resize(size);
+        }
+
+        static void write(serialization::segmented_buffer& cont,
+            std::size_t count, std::size_t current,
+            void const* address) noexcept
+        {
+            cont.write(current, address, count);
+        }
+
+        // The binary filters operate on contiguous memory only. Streaming
+        // filters may produce partial output before asking for more space,
+        // that output has to be kept as well.
+        static bool flush(serialization::binary_filter* filter,
+            serialization::segmented_buffer& cont, std::size_t current,
+            std::size_t size, std::size_t& written)
+        {
+            using buffer_type = std::vector<char,
+                serialization::detail::default_init_allocator<char>>;
+
+            buffer_type data(size);
+            bool const flushed = filter->flush(data.data(), size, written);
+
+            HPX_ASSERT(written <= size);
+            cont.write(current, data.data(), written);
+            return flushed;
+        }
+    };
+}    // namespace hpx::traits
+
+#include <hpx/config/warnings_suffix.hpp>
@@ -12,9 +12,12 @@
 #include <hpx/modules/errors.hpp>
 
 #include <hpx/serialization/array.hpp>
+#include <hpx/serialization/detail/receive_chunk_owner.hpp>
 #include <hpx/serialization/serialization_fwd.hpp>
 #include <hpx/serialization/serialize.hpp>
 #include <hpx/serialization/serialize_buffer_fwd.hpp>
+#include <hpx/serialization/traits/is_bitwise_serializable.hpp>
+#include <hpx/serialization/traits/is_not_bitwise_serializable.hpp>
 
 #if !defined(HPX_HAVE_CXX17_SHARED_PTR_ARRAY)
 #include <boost/shared_array.hpp>
@@ -22,6 +25,7 @@
 
 #include <cstddef>
 #include <memory>
+#include <type_traits>
 
 namespace hpx::serialization {
 
@@ -385,11 +389,47 @@ namespace hpx::serialization {
         }
 
         ///////////////////////////////////////////////////////////////////////
+        template <typename Archive>
+        bool load_view(Archive& ar)
+        {
+            auto* chunks = ar.template try_get_extra_data<
+                detail::receive_chunk_owner>();
+            if (chunks == nullptr || !chunks->owner || size_ == 0)
+            {
+                return false;
+            }
+
+            void* p = ar.load_binary_chunk_view(size_ * sizeof(T), alignof(T));
+            if (p == nullptr)
+            {
+                return false;
+            }
+
+            // share the ownership of the received memory
+            data_ = buffer_type(static_cast<T*>(p),
+                [owner = chunks->owner](T*) noexcept {});
+            ++chunks->views;
+            return true;
+        }
+
         template <typename Archive>
         void load(Archive& ar, unsigned int const)
         {
             ar >> size_ >> alloc_;    // -V128
 
+            // Refer to the memory of an already received zero-copy chunk
+            // instead of copying the data. This is done only if the memory
+            // would have been allocated using the default allocator anyways.
+            if constexpr (std::is_same_v<allocator_type, std::allocator<T>> &&
+                (hpx::traits::is_bitwise_serializable_v<T> ||
+                    !hpx::traits::is_not_bitwise_serializable_v<T>))
+            {
+                if (load_view(ar))
+                {
+                    return;
+                }
+            }
+
             data_ = buffer_type(
                 detail::array_allocator<allocator_type>()(alloc_, size_),
                 [alloc = this->alloc_, size = this->size_](T* p) noexcept {
@@ -35,6 +35,11 @@ namespace hpx::traits {
         {
         }
 
+        static constexpr void truncate(
+            Container& /* cont */, std::size_t /* size */) noexcept
+        {
+        }
+
         static bool flush(serialization::binary_filter* /* filter */,
             Container& /* cont */, std::size_t /* current */, std::size_t size,
             std::size_t& written) noexcept
@@ -75,6 +80,11 @@ namespace hpx::traits {
             return cont.resize(cont.size() + count);
         }
 
+        static void truncate(Container& cont, std::size_t size)
+        {
+            cont.resize(size);
+        }
+
         static void write(Container& cont, std::size_t count,
             std::size_t current, void const* address) noexcept
         {
@@ -9,6 +9,8 @@
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/serialization/detail/polymorphic_id_factory.hpp>
+#include <hpx/serialization/detail/polymorphic_intrusive_factory.hpp>
+#include <hpx/serialization/detail/polymorphic_nonintrusive_factory.hpp>
 
 #include <cstddef>
 #include <cstdint>
@@ -78,6 +80,14 @@ namespace hpx::serialization::detail {
             max_id = id;
     }
 
+    void id_registry::register_polymorphic_typename(
+        std::string const& type_name)
+    {
+        // the types created by the other factories have no constructor
+        // registered here
+        typename_to_ctor.emplace(type_name, nullptr);
+    }
+
     // This makes sure that the registries are consistent.
     void id_registry::fill_missing_typenames()
     {
@@ -102,6 +112,11 @@ namespace hpx::serialization::detail {
             HPX_ASSERT(it != typename_to_id.end());
             cache_id(it->second, snd);    //-V783
         }
+
+        // The factories for the intrusive and non-intrusive polymorphic
+        // types keep their own mappings from ids to constructors.
+        polymorphic_intrusive_factory::instance().cache_ids();
+        polymorphic_nonintrusive_factory::instance().cache_ids();
     }
 
     std::uint32_t id_registry::try_get_id(std::string const& type_name) const
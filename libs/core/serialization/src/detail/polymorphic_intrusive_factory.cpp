@@ -10,9 +10,18 @@
 
 #include <hpx/config.hpp>
 #include <hpx/modules/errors.hpp>
+#include <hpx/serialization/detail/polymorphic_id_factory.hpp>
+#include <hpx/serialization/detail/polymorphic_type_names.hpp>
+#include <hpx/serialization/input_archive.hpp>
+#include <hpx/serialization/output_archive.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/string.hpp>
 #include <hpx/type_support/static.hpp>
 
+#include <cstddef>
+#include <cstdint>
 #include <string>
+#include <utility>
 
 namespace hpx::serialization::detail {
 
@@ -35,12 +44,126 @@ namespace hpx::serialization::detail {
         auto const it = map_.find(name);
         if (it == map_.end())
         {
-            map_.emplace(name, fun);
+            auto const p =
+                map_.emplace(name, entry_type{fun, id_registry::invalid_id});
+
+            // make sure the type is assigned an id, types registered after
+            // the ids were assigned pick up the id if the name is known
+            id_registry::instance().register_polymorphic_typename(name);
+            cache_id(name, p.first->second);
         }
     }
 
     void* polymorphic_intrusive_factory::create(std::string const& name) const
     {
-        return map_.at(name)();
+        return map_.at(name).ctor();
+    }
+
+    void* polymorphic_intrusive_factory::create(std::uint32_t id) const
+    {
+        if (id >= cache_.size() || cache_[id] == nullptr)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                "polymorphic_intrusive_factory::create",
+                "Unknown type descriptor {}", id);
+        }
+        return cache_[id]();
+    }
+
+    std::uint32_t polymorphic_intrusive_factory::get_id(
+        std::string const& name) const
+    {
+        auto const it = map_.find(name);
+        if (it == map_.end())
+        {
+            return id_registry::invalid_id;
+        }
+        return it->second.id;
+    }
+
+    void polymorphic_intrusive_factory::save_type(
+        output_archive& ar, std::string const& name) const
+    {
+        // types which were not assigned an id are sent by name, the name is
+        // sent along with the id when a type appears for the first time
+        if (ar.enable_type_ids())
+        {
+            std::uint32_t const id = get_id(name);
+            ar << id;
+            if (id != id_registry::invalid_id)
+            {
+                auto& names = ar.get_extra_data<polymorphic_type_names>();
+                if (names.find(id) != nullptr)
+                {
+                    return;
+                }
+                names.add(id);
+            }
+        }
+        ar << name;
+    }
+
+    void* polymorphic_intrusive_factory::create(input_archive& ar) const
+    {
+        if (ar.enable_type_ids())
+        {
+            std::uint32_t id = id_registry::invalid_id;
+            ar >> id;
+            if (id != id_registry::invalid_id)
+            {
+                auto& names = ar.get_extra_data<polymorphic_type_names>();
+                std::string const* name = names.find(id);
+                if (name == nullptr)
+                {
+                    std::string type_name;
+                    ar >> type_name;
+                    name = &names.add(id, HPX_MOVE(type_name));
+                }
+
+                if (id < cache_.size() && cache_[id] != nullptr)
+                {
+                    return cache_[id]();
+                }
+
+                // the type is not known by its id, fall back to its name
+                auto const it = map_.find(*name);
+                if (it == map_.end())
+                {
+                    HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                        "polymorphic_intrusive_factory::create",
+                        "Unknown type descriptor {} ({})", id, *name);
+                }
+                return it->second.ctor();
+            }
+        }
+
+        std::string name;
+        ar >> name;
+
+        return create(name);
+    }
+
+    void polymorphic_intrusive_factory::cache_id(
+        std::string const& name, entry_type& entry)
+    {
+        entry.id = id_registry::instance().try_get_id(name);
+        if (entry.id == id_registry::invalid_id)
+        {
+            return;
+        }
+
+        if (entry.id >= cache_.size())
+        {
+            cache_.resize(static_cast<std::size_t>(entry.id) + 1, nullptr);
+        }
+        cache_[entry.id] = entry.ctor;
+    }
+
+    void polymorphic_intrusive_factory::cache_ids()
+    {
+        for (auto& [name, entry] : map_)
+        {
+            cache_id(name, entry);
+        }
     }
 }    // namespace hpx::serialization::detail
@@ -7,7 +7,20 @@
 //  See accompanying file LICENSE_1_0.txt or copy at
 //  http://www.boost.org/LICENSE_1_0.txt)
 
+#include <hpx/config.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/serialization/detail/polymorphic_id_factory.hpp>
 #include <hpx/serialization/detail/polymorphic_nonintrusive_factory.hpp>
+#include <hpx/serialization/detail/polymorphic_type_names.hpp>
+#include <hpx/serialization/input_archive.hpp>
+#include <hpx/serialization/output_archive.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/string.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
 
 namespace hpx::serialization::detail {
 
@@ -17,4 +30,89 @@ namespace hpx::serialization::detail {
         hpx::util::static_<polymorphic_nonintrusive_factory> factory;
         return factory.get();
     }
+
+    void polymorphic_nonintrusive_factory::cache_id(type_entry& entry)
+    {
+        entry.id = id_registry::instance().try_get_id(entry.class_name);
+        if (entry.id == id_registry::invalid_id)
+        {
+            return;
+        }
+
+        if (entry.id >= cache_.size())
+        {
+            cache_.resize(static_cast<std::size_t>(entry.id) + 1, nullptr);
+        }
+        cache_[entry.id] = entry.bunch;
+    }
+
+    void polymorphic_nonintrusive_factory::cache_ids()
+    {
+        for (auto& [_, entry] : typeinfo_map_)
+        {
+            cache_id(entry);
+        }
+    }
+
+    void polymorphic_nonintrusive_factory::save_type(
+        output_archive& ar, type_entry const& entry)
+    {
+        // types which were not assigned an id are sent by name, the name is
+        // sent along with the id when a type appears for the first time
+        if (ar.enable_type_ids())
+        {
+            ar << entry.id;
+            if (entry.id != id_registry::invalid_id)
+            {
+                auto& names = ar.get_extra_data<polymorphic_type_names>();
+                if (names.find(entry.id) != nullptr)
+                {
+                    return;
+                }
+                names.add(entry.id);
+            }
+        }
+        ar << entry.class_name;
+    }
+
+    function_bunch_type const& polymorphic_nonintrusive_factory::load_type(
+        input_archive& ar) const
+    {
+        if (ar.enable_type_ids())
+        {
+            std::uint32_t id = id_registry::invalid_id;
+            ar >> id;
+            if (id != id_registry::invalid_id)
+            {
+                auto& names = ar.get_extra_data<polymorphic_type_names>();
+                std::string const* class_name = names.find(id);
+                if (class_name == nullptr)
+                {
+                    std::string name;
+                    ar >> name;
+                    class_name = &names.add(id, HPX_MOVE(name));
+                }
+
+                if (id < cache_.size() && cache_[id] != nullptr)
+                {
+                    return *cache_[id];
+                }
+
+                // the type is not known by its id, fall back to its name
+                auto const it = map_.find(*class_name);
+                if (it == map_.end())
+                {
+                    HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                        "polymorphic_nonintrusive_factory::load_type",
+                        "Unknown type descriptor {} ({})", id, *class_name);
+                }
+                return it->second;
+            }
+        }
+
+        std::string class_name;
+        ar >> class_name;
+
+        return map_.at(class_name);
+    }
 }    // namespace hpx::serialization::detail
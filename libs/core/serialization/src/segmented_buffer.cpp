@@ -0,0 +1,89 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/serialization/segmented_buffer.hpp>
+
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+namespace hpx::serialization::detail {
+
+    namespace {
+
+        // The number of unused segments retained by the pool, any segments
+        // released beyond that are freed.
+        constexpr std::size_t max_pooled_segments = 1024;
+
+        struct segment_pool
+        {
+            segment_pool()
+            {
+                segments_.reserve(max_pooled_segments);
+            }
+
+            segment_pool(segment_pool const&) = delete;
+            segment_pool(segment_pool&&) = delete;
+            segment_pool& operator=(segment_pool const&) = delete;
+            segment_pool& operator=(segment_pool&&) = delete;
+
+            ~segment_pool()
+            {
+                for (char* segment : segments_)
+                {
+                    delete[] segment;
+                }
+            }
+
+            char* allocate()
+            {
+                {
+                    std::lock_guard l(mtx_);
+                    if (!segments_.empty())
+                    {
+                        char* segment = segments_.back();
+                        segments_.pop_back();
+                        return segment;
+                    }
+                }
+                return new char[segmented_buffer::segment_size];
+            }
+
+            void deallocate(char* segment) noexcept
+            {
+                {
+                    std::lock_guard l(mtx_);
+                    if (segments_.size() < max_pooled_segments)
+                    {
+                        segments_.push_back(segment);
+                        return;
+                    }
+                }
+                delete[] segment;
+            }
+
+            std::mutex mtx_;
+            std::vector<char*> segments_;
+        };
+
+        segment_pool& get_segment_pool()
+        {
+            static segment_pool pool;
+            return pool;
+        }
+    }    // namespace
+
+    char* allocate_segment()
+    {
+        return get_segment_pool().allocate();
+    }
+
+    void deallocate_segment(char* segment) noexcept
+    {
+        get_segment_pool().deallocate(segment);
+    }
+}    // namespace hpx::serialization::detail
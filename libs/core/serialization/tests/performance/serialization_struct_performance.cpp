@@ -0,0 +1,195 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark compares the throughput of serializing aggregates using the
+// generated (brace_initializable) serialization, which writes runs of bitwise
+// serializable members using a single call to the archive, to the throughput
+// of serializing the same data using a hand-written member-wise serialize()
+// function.
+
+#include <hpx/serialization/brace_initializable.hpp>
+#include <hpx/serialization/input_archive.hpp>
+#include <hpx/serialization/output_archive.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/string.hpp>
+#include <hpx/serialization/vector.hpp>
+#include <hpx/util/from_string.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace hpx_test {
+
+    // serialized using the generated serialization
+    struct particle
+    {
+        std::string name;
+        std::int64_t id;
+        double x, y, z;
+        double vx, vy, vz;
+        float mass;
+        std::int32_t type;
+    };
+
+    // serialized member by member
+    struct particle_memberwise
+    {
+        std::string name;
+        std::int64_t id;
+        double x, y, z;
+        double vx, vy, vz;
+        float mass;
+        std::int32_t type;
+
+        template <typename Archive>
+        void serialize(Archive& ar, unsigned int)
+        {
+            // clang-format off
+            ar & name & id & x & y & z & vx & vy & vz & mass & type;
+            // clang-format on
+        }
+    };
+
+    template <typename Particle>
+    bool equal(std::vector<Particle> const& lhs_particles,
+        std::vector<Particle> const& rhs_particles)
+    {
+        if (lhs_particles.size() != rhs_particles.size())
+        {
+            return false;
+        }
+
+        for (std::size_t i = 0; i != lhs_particles.size(); ++i)
+        {
+            Particle const& lhs = lhs_particles[i];
+            Particle const& rhs = rhs_particles[i];
+            if (std::tie(lhs.name, lhs.id, lhs.x, lhs.y, lhs.z, lhs.vx,
+                    lhs.vy, lhs.vz, lhs.mass, lhs.type) !=
+                std::tie(rhs.name, rhs.id, rhs.x, rhs.y, rhs.z, rhs.vx,
+                    rhs.vy, rhs.vz, rhs.mass, rhs.type))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template <typename Particle>
+    std::vector<Particle> make_particles(std::size_t count)
+    {
+        std::vector<Particle> particles;
+        particles.reserve(count);
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            double const d = static_cast<double>(i);
+            particles.push_back(Particle{"particle", std::int64_t(i), d,
+                d + 1, d + 2, -d, -d - 1, -d - 2, float(d) * 0.5f,
+                std::int32_t(i % 4)});
+        }
+        return particles;
+    }
+
+    template <typename Particle>
+    void measure(char const* name, std::size_t iterations, std::size_t count)
+    {
+        std::vector<Particle> const out = make_particles<Particle>(count);
+        std::vector<Particle> in;
+
+        std::vector<char> buffer;
+        {
+            hpx::serialization::output_archive oarchive(buffer);
+            oarchive << out;
+        }
+        {
+            hpx::serialization::input_archive iarchive(buffer);
+            iarchive >> in;
+        }
+
+        if (!equal(out, in))
+        {
+            throw std::logic_error(
+                std::string(name) + ": deserialization failed");
+        }
+
+        std::size_t const size = buffer.size();
+
+        auto start = std::chrono::high_resolution_clock::now();
+        for (std::size_t i = 0; i != iterations; ++i)
+        {
+            buffer.clear();
+            hpx::serialization::output_archive oarchive(buffer);
+            oarchive << out;
+        }
+        auto finish = std::chrono::high_resolution_clock::now();
+        double const save_time =
+            std::chrono::duration<double>(finish - start).count();
+
+        start = std::chrono::high_resolution_clock::now();
+        for (std::size_t i = 0; i != iterations; ++i)
+        {
+            in.clear();
+            hpx::serialization::input_archive iarchive(buffer);
+            iarchive >> in;
+        }
+        finish = std::chrono::high_resolution_clock::now();
+        double const load_time =
+            std::chrono::duration<double>(finish - start).count();
+
+        double const megabytes =
+            static_cast<double>(size * iterations) / (1024. * 1024.);
+
+        std::cout << name << ": size = " << size << " bytes" << std::endl;
+        std::cout << name << ": save = " << megabytes / save_time << " MB/s"
+                  << std::endl;
+        std::cout << name << ": load = " << megabytes / load_time << " MB/s"
+                  << std::endl
+                  << std::endl;
+    }
+}    // namespace hpx_test
+
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        std::cout << "usage: " << argv[0] << " N [count]";
+        std::cout << std::endl << std::endl;
+        std::cout << "arguments: " << std::endl;
+        std::cout << " N      -- number of iterations" << std::endl;
+        std::cout << " count  -- number of particles (default: 10000)"
+                  << std::endl
+                  << std::endl;
+        return 0;
+    }
+
+    std::size_t iterations;
+    std::size_t count = 10000;
+    try
+    {
+        iterations = hpx::util::from_string<std::size_t>(argv[1]);
+        if (argc > 2)
+        {
+            count = hpx::util::from_string<std::size_t>(argv[2]);
+        }
+    }
+    catch (std::exception& exc)
+    {
+        std::cerr << "Error: " << exc.what() << std::endl;
+        std::cerr << "Positional arguments must be integers." << std::endl;
+        return -1;
+    }
+
+    hpx_test::measure<hpx_test::particle>("aggregate", iterations, count);
+    hpx_test::measure<hpx_test::particle_memberwise>(
+        "member-wise", iterations, count);
+
+    return 0;
+}
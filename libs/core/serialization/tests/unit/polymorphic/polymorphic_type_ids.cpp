@@ -0,0 +1,387 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Polymorphic types are identified by a (dense) id instead of their name if
+// the archive is created with archive_flags::enable_type_ids and an id was
+// assigned to the type. The name is sent along with the id when a type
+// appears in an archive for the first time, types with an id unknown to the
+// receiver are resolved by that name.
+
+#include <hpx/serialization/base_object.hpp>
+#include <hpx/serialization/detail/polymorphic_id_factory.hpp>
+#include <hpx/serialization/detail/polymorphic_intrusive_factory.hpp>
+#include <hpx/serialization/detail/polymorphic_nonintrusive_factory.hpp>
+#include <hpx/serialization/input_archive.hpp>
+#include <hpx/serialization/output_archive.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/shared_ptr.hpp>
+#include <hpx/serialization/vector.hpp>
+
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <typeinfo>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// intrusive polymorphic types
+struct A
+{
+    int a;
+
+    explicit A(int a = 1)
+      : a(a)
+    {
+    }
+    virtual ~A() = default;
+
+    virtual std::string foo() const = 0;
+
+    template <class Archive>
+    void serialize(Archive& ar, unsigned)
+    {
+        ar & a;
+    }
+    HPX_SERIALIZATION_POLYMORPHIC_ABSTRACT(A);
+};
+
+struct B : A
+{
+    int b;
+
+    explicit B(int b = 2)
+      : b(b)
+    {
+    }
+
+    std::string foo() const override
+    {
+        return "B::foo";
+    }
+
+    template <class Archive>
+    void serialize(Archive& ar, unsigned)
+    {
+        ar & hpx::serialization::base_object<A>(*this);
+        ar & b;
+    }
+    HPX_SERIALIZATION_POLYMORPHIC(B, override)
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// non-intrusive polymorphic types
+struct C
+{
+    int c;
+
+    explicit C(int c = 3)
+      : c(c)
+    {
+    }
+    virtual ~C() = default;
+
+    virtual std::string bar() const = 0;
+};
+
+HPX_TRAITS_NONINTRUSIVE_POLYMORPHIC(C)
+
+template <class Archive>
+void serialize(Archive& ar, C& c, unsigned)
+{
+    ar & c.c;
+}
+
+struct D : C
+{
+    int d;
+
+    explicit D(int d = 4)
+      : d(d)
+    {
+    }
+
+    std::string bar() const override
+    {
+        return "D::bar";
+    }
+};
+
+template <class Archive>
+void serialize(Archive& ar, D& d, unsigned)
+{
+    ar & hpx::serialization::base_object<C>(d);
+    ar & d.d;
+}
+HPX_SERIALIZATION_REGISTER_CLASS(D)
+
+// registered explicitly by the test, after the ids were assigned
+struct E : C
+{
+    int e;
+
+    explicit E(int e = 5)
+      : e(e)
+    {
+    }
+
+    std::string bar() const override
+    {
+        return "E::bar";
+    }
+};
+
+template <class Archive>
+void serialize(Archive& ar, E& e, unsigned)
+{
+    ar & hpx::serialization::base_object<C>(e);
+    ar & e.e;
+}
+
+void* create_b()
+{
+    return new B(42);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t test_round_trip(std::uint32_t flags)
+{
+    std::vector<std::shared_ptr<A>> as;
+    std::vector<std::shared_ptr<C>> cs;
+    for (int i = 0; i != 10; ++i)
+    {
+        as.push_back(std::make_shared<B>(i));
+        cs.push_back(std::make_shared<D>(i));
+    }
+
+    std::vector<char> buffer;
+    {
+        hpx::serialization::output_archive oarchive(buffer, flags);
+        oarchive << as << cs;
+    }
+
+    std::vector<std::shared_ptr<A>> as_in;
+    std::vector<std::shared_ptr<C>> cs_in;
+    {
+        hpx::serialization::input_archive iarchive(buffer);
+        iarchive >> as_in >> cs_in;
+    }
+
+    HPX_TEST_EQ(as_in.size(), as.size());
+    for (std::size_t i = 0; i != as_in.size() && i != as.size(); ++i)
+    {
+        HPX_TEST_EQ(as_in[i]->foo(), std::string("B::foo"));
+        HPX_TEST_EQ(as_in[i]->a, 1);
+        HPX_TEST_EQ(static_cast<B&>(*as_in[i]).b, static_cast<int>(i));
+    }
+
+    HPX_TEST_EQ(cs_in.size(), cs.size());
+    for (std::size_t i = 0; i != cs_in.size() && i != cs.size(); ++i)
+    {
+        HPX_TEST_EQ(cs_in[i]->bar(), std::string("D::bar"));
+        HPX_TEST_EQ(cs_in[i]->c, 3);
+        HPX_TEST_EQ(static_cast<D&>(*cs_in[i]).d, static_cast<int>(i));
+    }
+
+    return buffer.size();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// the bytes written to an archive for the given values
+template <typename... Ts>
+std::vector<char> serialized(Ts const&... ts)
+{
+    std::vector<char> header;
+    {
+        hpx::serialization::output_archive oarchive(header);
+    }
+
+    std::vector<char> buffer;
+    {
+        hpx::serialization::output_archive oarchive(buffer);
+        (oarchive << ... << ts);
+    }
+
+    buffer.erase(buffer.begin(),
+        buffer.begin() + static_cast<std::ptrdiff_t>(header.size()));
+    return buffer;
+}
+
+std::vector<char>::iterator find(std::vector<char>::iterator begin,
+    std::vector<char>::iterator end, std::vector<char> const& bytes)
+{
+    return std::search(begin, end, bytes.begin(), bytes.end());
+}
+
+// types registered after the ids were assigned pick up the id assigned to
+// their name
+void test_late_registration()
+{
+    using hpx::serialization::detail::id_registry;
+    using hpx::serialization::detail::polymorphic_intrusive_factory;
+    using hpx::serialization::detail::polymorphic_nonintrusive_factory;
+
+    id_registry& registry = id_registry::instance();
+
+    // intrusive
+    {
+        std::uint32_t const id = registry.get_max_registered_id() + 1;
+        registry.register_typename("late B", id);
+
+        auto& factory = polymorphic_intrusive_factory::instance();
+        factory.register_class("late B", &create_b);
+        HPX_TEST_EQ(factory.get_id("late B"), id);
+
+        std::unique_ptr<A> const a(factory.create<A>(id));
+        HPX_TEST_EQ(a->foo(), std::string("B::foo"));
+        HPX_TEST_EQ(static_cast<B&>(*a).b, 42);
+    }
+
+    // non-intrusive
+    {
+        std::uint32_t const id = registry.get_max_registered_id() + 1;
+        registry.register_typename("E", id);
+
+        using register_class = hpx::serialization::detail::register_class<E>;
+        static constexpr hpx::serialization::detail::function_bunch_type
+            bunch = {&register_class::save, &register_class::load,
+                &register_class::create};
+        polymorphic_nonintrusive_factory::instance().register_class(
+            typeid(E), "E", bunch);
+
+        std::shared_ptr<C> const c = std::make_shared<E>(7);
+
+        std::vector<char> buffer;
+        {
+            hpx::serialization::output_archive oarchive(buffer,
+                hpx::serialization::archive_flags::enable_type_ids);
+            oarchive << c;
+        }
+        std::vector<char> const descriptor = serialized(id, std::string("E"));
+        HPX_TEST(
+            find(buffer.begin(), buffer.end(), descriptor) != buffer.end());
+
+        std::shared_ptr<C> c_in;
+        {
+            hpx::serialization::input_archive iarchive(buffer);
+            iarchive >> c_in;
+        }
+
+        HPX_TEST_EQ(c_in->bar(), std::string("E::bar"));
+        HPX_TEST_EQ(static_cast<E&>(*c_in).e, 7);
+    }
+}
+
+// types with an id unknown to the receiver are resolved by their name
+void test_unknown_id(std::uint32_t id)
+{
+    using hpx::serialization::detail::id_registry;
+
+    std::uint32_t const unknown_id = id + 1000;
+    HPX_TEST_LT(id_registry::instance().get_max_registered_id(), unknown_id);
+
+    std::vector<std::shared_ptr<A>> const as = {
+        std::make_shared<B>(1), std::make_shared<B>(2)};
+
+    std::vector<char> buffer;
+    {
+        hpx::serialization::output_archive oarchive(
+            buffer, hpx::serialization::archive_flags::enable_type_ids);
+        oarchive << as;
+    }
+
+    // replace the id as if it was assigned by another locality only, the
+    // first element is identified by the id and the name, the second by the
+    // id only
+    std::vector<char> const descriptor = serialized(id, std::string("B"));
+    std::vector<char> const id_bytes = serialized(id);
+    std::vector<char> const unknown_id_bytes = serialized(unknown_id);
+
+    auto const it = find(buffer.begin(), buffer.end(), descriptor);
+    HPX_TEST(it != buffer.end());
+    if (it == buffer.end())
+    {
+        return;
+    }
+    std::copy(unknown_id_bytes.begin(), unknown_id_bytes.end(), it);
+
+    auto const name_end = it + static_cast<std::ptrdiff_t>(descriptor.size());
+    auto const jt = find(name_end, buffer.end(), id_bytes);
+    HPX_TEST(jt != buffer.end());
+    if (jt == buffer.end())
+    {
+        return;
+    }
+    std::copy(unknown_id_bytes.begin(), unknown_id_bytes.end(), jt);
+
+    {
+        std::vector<std::shared_ptr<A>> as_in;
+        hpx::serialization::input_archive iarchive(buffer);
+        iarchive >> as_in;
+
+        HPX_TEST_EQ(as_in.size(), as.size());
+        for (std::size_t i = 0; i != as_in.size() && i != as.size(); ++i)
+        {
+            HPX_TEST_EQ(as_in[i]->foo(), std::string("B::foo"));
+            HPX_TEST_EQ(
+                static_cast<B&>(*as_in[i]).b, static_cast<int>(i + 1));
+        }
+    }
+
+    // types known neither by their id nor by their name are rejected
+    *(name_end - 1) = 'X';
+    {
+        bool caught_exception = false;
+        try
+        {
+            std::vector<std::shared_ptr<A>> as_in;
+            hpx::serialization::input_archive iarchive(buffer);
+            iarchive >> as_in;
+        }
+        catch (hpx::exception const& e)
+        {
+            caught_exception = true;
+            HPX_TEST_EQ(e.get_error(), hpx::error::serialization_error);
+        }
+        HPX_TEST(caught_exception);
+    }
+}
+
+int main()
+{
+    using hpx::serialization::archive_flags;
+    using hpx::serialization::detail::id_registry;
+
+    std::uint32_t const type_ids =
+        static_cast<std::uint32_t>(archive_flags::enable_type_ids);
+
+    // types without an id are identified by name
+    std::size_t const with_names = test_round_trip(0);
+    HPX_TEST_EQ(id_registry::instance().try_get_id("B"),
+        id_registry::invalid_id);
+    HPX_TEST_LT(with_names, test_round_trip(type_ids));
+
+    // assign ids to all types, this is normally done while bootstrapping,
+    // the id of B is chosen not to appear anywhere else in the archives
+    std::uint32_t const id_b = 1000;
+    id_registry::instance().register_typename("B", id_b);
+    id_registry::instance().fill_missing_typenames();
+    HPX_TEST_EQ(id_registry::instance().try_get_id("B"), id_b);
+    HPX_TEST_NEQ(id_registry::instance().try_get_id("D"),
+        id_registry::invalid_id);
+
+    HPX_TEST_EQ(test_round_trip(0), with_names);
+    HPX_TEST_LT(test_round_trip(type_ids), with_names);
+
+    test_late_registration();
+    test_unknown_id(id_b);
+
+    return hpx::util::report_errors();
+}
@@ -9,6 +9,7 @@
 #include <hpx/modules/serialization.hpp>
 #include <hpx/modules/testing.hpp>
 
+#include <cstdint>
 #include <string>
 #include <tuple>
 #include <vector>
@@ -77,6 +78,47 @@ bool operator==(const B& b1, const B& b2)
     return std::tie(b1.a, b1.sign) == std::tie(b2.a, b2.sign);
 }
 
+// runs of bitwise serializable members are serialized using a single call to
+// the archive, including members separated by padding
+enum class color : std::uint8_t
+{
+    red,
+    green,
+    blue
+};
+
+struct C
+{
+    std::string name;
+    std::int8_t small;
+    std::int64_t large;
+    std::int32_t medium;
+    color c;
+    bool flag;
+    double value;
+    std::vector<double> data;
+    float last;
+};
+
+static_assert(hpx::traits::detail::arity<C>().value == 9,
+    "hpx::traits::detail::arity<C>() == size<9>{}");
+static_assert(hpx::traits::has_struct_serialization<C>::value,
+    "has_struct_serialization<C>::value");
+static_assert(hpx::serialization::detail::is_bitwise_member_v<std::int64_t>,
+    "is_bitwise_member_v<std::int64_t>");
+static_assert(!hpx::serialization::detail::is_bitwise_member_v<std::string>,
+    "!is_bitwise_member_v<std::string>");
+static_assert(!hpx::serialization::detail::is_bitwise_member_v<A>,
+    "!is_bitwise_member_v<A>");
+
+bool operator==(const C& c1, const C& c2)
+{
+    return std::tie(c1.name, c1.small, c1.large, c1.medium, c1.c, c1.flag,
+               c1.value, c1.data, c1.last) ==
+        std::tie(c2.name, c2.small, c2.large, c2.medium, c2.c, c2.flag,
+            c2.value, c2.data, c2.last);
+}
+
 int main()
 {
     std::vector<char> buf;
@@ -102,5 +144,31 @@ int main()
         HPX_TEST(b == deserialized_b);
     }
 
+    {
+        C c{"test_string", -12, 1234567890123, -42, color::blue, true, 3.0,
+            {4.0, 5.0, 6.0, 7.0}, 8.0f};
+        oar << c;
+        C deserialized_c{};
+        iar >> deserialized_c;
+
+        HPX_TEST(c == deserialized_c);
+    }
+
+    {
+        std::vector<C> cs;
+        for (int i = 0; i != 100; ++i)
+        {
+            cs.push_back(C{std::to_string(i), static_cast<std::int8_t>(i),
+                -i * 1000000000LL, i * 1000, static_cast<color>(i % 3),
+                i % 2 == 0, i * 3.0, std::vector<double>(i % 7, i * 0.5),
+                i * 0.25f});
+        }
+        oar << cs;
+        std::vector<C> deserialized_cs;
+        iar >> deserialized_cs;
+
+        HPX_TEST(cs == deserialized_cs);
+    }
+
     return hpx::util::report_errors();
 }
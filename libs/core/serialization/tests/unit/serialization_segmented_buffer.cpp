@@ -0,0 +1,190 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/serialization/detail/default_init_allocator.hpp>
+#include <hpx/serialization/input_archive.hpp>
+#include <hpx/serialization/output_archive.hpp>
+#include <hpx/serialization/segmented_buffer.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/string.hpp>
+#include <hpx/serialization/vector.hpp>
+
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+struct data
+{
+    std::string name;
+    std::vector<double> values;
+    std::int64_t id = 0;
+
+    template <typename Archive>
+    void serialize(Archive& ar, unsigned)
+    {
+        // clang-format off
+        ar & name & values & id;
+        // clang-format on
+    }
+};
+
+std::vector<data> make_data(std::size_t count, std::size_t num_values)
+{
+    std::vector<data> result(count);
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        result[i].name = "item " + std::to_string(i);
+        result[i].values.resize(num_values);
+        for (std::size_t j = 0; j != num_values; ++j)
+        {
+            result[i].values[j] = static_cast<double>(i * num_values + j);
+        }
+        result[i].id = static_cast<std::int64_t>(i);
+    }
+    return result;
+}
+
+std::vector<char> flatten(hpx::serialization::segmented_buffer const& buffer)
+{
+    std::vector<char> result;
+    result.reserve(buffer.size());
+
+    std::size_t segments = 0;
+    buffer.for_each_segment([&](char const* data, std::size_t size) {
+        HPX_TEST_LTE(size, hpx::serialization::segmented_buffer::segment_size);
+        result.insert(result.end(), data, data + size);
+        ++segments;
+    });
+    HPX_TEST_EQ(segments, buffer.num_segments());
+
+    return result;
+}
+
+void test_equal(std::vector<data> const& lhs, std::vector<data> const& rhs)
+{
+    HPX_TEST_EQ(lhs.size(), rhs.size());
+    for (std::size_t i = 0; i != lhs.size() && i != rhs.size(); ++i)
+    {
+        HPX_TEST_EQ(lhs[i].name, rhs[i].name);
+        HPX_TEST(lhs[i].values == rhs[i].values);
+        HPX_TEST_EQ(lhs[i].id, rhs[i].id);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// the segmented buffer has to produce the same bytes as a contiguous one
+void test_segmented(std::size_t count, std::size_t num_values)
+{
+    std::vector<data> const out = make_data(count, num_values);
+
+    std::vector<char> contiguous;
+    {
+        hpx::serialization::output_archive oarchive(contiguous);
+        oarchive << out;
+        oarchive.flush();
+    }
+
+    hpx::serialization::segmented_buffer segmented;
+    {
+        hpx::serialization::output_archive oarchive(segmented);
+        oarchive << out;
+        oarchive.flush();
+    }
+
+    HPX_TEST_EQ(segmented.size(), contiguous.size());
+    HPX_TEST_LTE(segmented.size(), segmented.capacity());
+
+    std::vector<char> const flattened = flatten(segmented);
+    HPX_TEST(flattened == contiguous);
+
+    std::vector<data> in;
+    {
+        hpx::serialization::input_archive iarchive(flattened);
+        iarchive >> in;
+    }
+    test_equal(out, in);
+
+    // moving the buffer hands over the segments
+    hpx::serialization::segmented_buffer moved(std::move(segmented));
+    HPX_TEST(segmented.empty());    // NOLINT(bugprone-use-after-move)
+    HPX_TEST(flatten(moved) == contiguous);
+
+    moved.clear();
+    HPX_TEST(moved.empty());
+    HPX_TEST_EQ(moved.num_segments(), static_cast<std::size_t>(0));
+}
+
+// zero-copy chunks refer to the data independently of the container
+void test_segmented_chunks()
+{
+    std::vector<data> const out = make_data(4, 16384);
+
+    std::vector<char> contiguous;
+    std::vector<hpx::serialization::serialization_chunk> contiguous_chunks;
+    {
+        hpx::serialization::output_archive oarchive(
+            contiguous, 0U, &contiguous_chunks);
+        oarchive << out;
+        oarchive.flush();
+    }
+
+    hpx::serialization::segmented_buffer segmented;
+    std::vector<hpx::serialization::serialization_chunk> segmented_chunks;
+    {
+        hpx::serialization::output_archive oarchive(
+            segmented, 0U, &segmented_chunks);
+        oarchive << out;
+        oarchive.flush();
+    }
+
+    HPX_TEST(flatten(segmented) == contiguous);
+    HPX_TEST_EQ(segmented_chunks.size(), contiguous_chunks.size());
+    for (std::size_t i = 0;
+        i != segmented_chunks.size() && i != contiguous_chunks.size(); ++i)
+    {
+        HPX_TEST(segmented_chunks[i].type_ == contiguous_chunks[i].type_);
+        HPX_TEST_EQ(segmented_chunks[i].size_, contiguous_chunks[i].size_);
+    }
+}
+
+// a contiguous buffer which is not initialized while growing
+void test_default_init()
+{
+    using buffer_type = std::vector<char,
+        hpx::serialization::detail::default_init_allocator<char>>;
+
+    std::vector<data> const out = make_data(16, 1000);
+
+    buffer_type buffer;
+    {
+        hpx::serialization::output_archive oarchive(buffer);
+        oarchive << out;
+        oarchive.flush();
+    }
+
+    std::vector<data> in;
+    {
+        hpx::serialization::input_archive iarchive(buffer);
+        iarchive >> in;
+    }
+    test_equal(out, in);
+}
+
+int main()
+{
+    test_segmented(0, 0);
+    test_segmented(1, 10);
+    test_segmented(100, 100);
+    test_segmented(10, 10000);
+
+    test_segmented_chunks();
+    test_default_init();
+
+    return hpx::util::report_errors();
+}
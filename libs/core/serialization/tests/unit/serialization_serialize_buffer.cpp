@@ -0,0 +1,185 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/serialization/detail/receive_chunk_owner.hpp>
+#include <hpx/serialization/input_archive.hpp>
+#include <hpx/serialization/output_archive.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/serialize_buffer.hpp>
+
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <numeric>
+#include <vector>
+
+using buffer_type = hpx::serialization::serialize_buffer<double>;
+
+constexpr std::size_t large_size = 10000;
+constexpr std::size_t small_size = 10;
+
+///////////////////////////////////////////////////////////////////////////////
+// Serialize two buffers, one of them is large enough to be stored in a
+// separate zero-copy chunk. The chunk data is then copied into memory owned
+// by 'received', simulating the receiving end of a parcelport.
+std::size_t serialize(std::vector<char>& data,
+    std::vector<hpx::serialization::serialization_chunk>& chunks,
+    std::shared_ptr<std::vector<double>>& received)
+{
+    buffer_type large(large_size);
+    std::iota(large.begin(), large.end(), 0.0);
+
+    buffer_type small(small_size);
+    std::iota(small.begin(), small.end(), 1.0);
+
+    hpx::serialization::output_archive oarchive(data, 0, &chunks);
+    oarchive << large << small;
+
+    received = std::make_shared<std::vector<double>>(large_size);
+
+    std::size_t zero_copy_chunks = 0;
+    for (auto& c : chunks)
+    {
+        if (c.type_ == hpx::serialization::chunk_type::chunk_type_pointer)
+        {
+            HPX_TEST_EQ(c.size_, large_size * sizeof(double));
+            std::memcpy(received->data(), c.data(), c.size_);
+            c.data_.pos_ = received->data();
+            ++zero_copy_chunks;
+        }
+    }
+    HPX_TEST_EQ(zero_copy_chunks, static_cast<std::size_t>(1));
+
+    return oarchive.bytes_written();
+}
+
+void check(buffer_type const& large, buffer_type const& small)
+{
+    HPX_TEST_EQ(large.size(), large_size);
+    for (std::size_t i = 0; i != large.size(); ++i)
+    {
+        HPX_TEST_EQ(large[i], static_cast<double>(i));
+    }
+
+    HPX_TEST_EQ(small.size(), small_size);
+    for (std::size_t i = 0; i != small.size(); ++i)
+    {
+        HPX_TEST_EQ(small[i], static_cast<double>(i + 1));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_view()
+{
+    std::vector<char> data;
+    std::vector<hpx::serialization::serialization_chunk> chunks;
+    std::shared_ptr<std::vector<double>> received;
+    std::size_t const size = serialize(data, chunks, received);
+
+    buffer_type large, small;
+    {
+        hpx::serialization::input_archive iarchive(data, size, &chunks);
+
+        auto& owner = iarchive.get_extra_data<
+            hpx::serialization::detail::receive_chunk_owner>();
+        owner.owner = received;
+
+        iarchive >> large >> small;
+
+        HPX_TEST_EQ(owner.views, static_cast<std::size_t>(1));
+    }
+
+    // the large buffer refers to the received memory and keeps it alive
+    HPX_TEST_EQ(large.data(), received->data());
+    HPX_TEST_EQ(received.use_count(), 2L);
+
+    check(large, small);
+
+    // the received memory stays valid as long as the buffer refers to it
+    received.reset();
+    check(large, small);
+}
+
+void test_copy()
+{
+    std::vector<char> data;
+    std::vector<hpx::serialization::serialization_chunk> chunks;
+    std::shared_ptr<std::vector<double>> received;
+    std::size_t const size = serialize(data, chunks, received);
+
+    // without an owner for the received memory the data is copied
+    buffer_type large, small;
+    {
+        hpx::serialization::input_archive iarchive(data, size, &chunks);
+        iarchive >> large >> small;
+    }
+
+    HPX_TEST_NEQ(large.data(), received->data());
+    HPX_TEST_EQ(received.use_count(), 1L);
+
+    check(large, small);
+}
+
+void test_disable_array_optimization()
+{
+    buffer_type large(large_size);
+    std::iota(large.begin(), large.end(), 0.0);
+
+    buffer_type small(small_size);
+    std::iota(small.begin(), small.end(), 1.0);
+
+    // the data is serialized inline if array optimization is disabled
+    std::vector<char> data;
+    std::vector<hpx::serialization::serialization_chunk> chunks;
+    std::size_t size = 0;
+    {
+        hpx::serialization::output_archive oarchive(data,
+            hpx::serialization::archive_flags::disable_array_optimization,
+            &chunks);
+        oarchive << large << small;
+        size = oarchive.bytes_written();
+    }
+
+    for (auto const& c : chunks)
+    {
+        HPX_TEST(
+            c.type_ != hpx::serialization::chunk_type::chunk_type_pointer);
+    }
+
+    // an unrelated zero-copy chunk must not be picked up
+    auto received = std::make_shared<std::vector<double>>(large_size, -1.0);
+    chunks.push_back(hpx::serialization::create_pointer_chunk(
+        received->data(), large_size * sizeof(double)));
+
+    buffer_type large_received, small_received;
+    {
+        hpx::serialization::input_archive iarchive(data, size, &chunks);
+
+        auto& owner = iarchive.get_extra_data<
+            hpx::serialization::detail::receive_chunk_owner>();
+        owner.owner = received;
+
+        iarchive >> large_received >> small_received;
+
+        HPX_TEST_EQ(owner.views, static_cast<std::size_t>(0));
+    }
+
+    HPX_TEST_NEQ(large_received.data(), received->data());
+    HPX_TEST_EQ(received.use_count(), 1L);
+
+    check(large_received, small_received);
+}
+
+int main()
+{
+    test_view();
+    test_copy();
+    test_disable_array_optimization();
+
+    return hpx::util::report_errors();
+}
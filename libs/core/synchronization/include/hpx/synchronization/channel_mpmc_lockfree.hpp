@@ -0,0 +1,431 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+//  The ring buffer is based on the bounded MPMC queue described by Dmitry
+//  Vyukov, https://www.1024cores.net/home/lock-free-algorithms/queues
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/execution_base/this_thread.hpp>
+#include <hpx/modules/concurrency.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/synchronization/detail/condition_variable.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace hpx::lcos::local {
+
+    ////////////////////////////////////////////////////////////////////////////
+    // A lock-free implementation of the channel concept supporting multiple
+    // producers and multiple consumers. The channel is bounded to a size given
+    // at construction time (rounded up to the next power of two). The data is
+    // stored in a ring-buffer where every slot carries a sequence number
+    // telling producers and consumers whether the slot can be written or read
+    // in the current round. Producers and consumers claim one or more slots
+    // with a single compare-and-swap on the tail or head counter, no lock is
+    // held while the data is moved in or out of the channel.
+    //
+    // The operations get() and set() (and their batched versions get_n() and
+    // set_n()) never block. The operations get_sync() and set_sync() suspend
+    // the calling thread while the channel is empty or full. Suspended
+    // threads are woken up by the operations on the other end of the channel,
+    // which touch the wait queues only if there actually is a thread waiting.
+    template <typename T>
+    class lockfree_bounded_channel
+    {
+    private:
+        using mutex_type = hpx::spinlock;
+
+        // number of times a blocking operation retries before suspending
+        static constexpr std::size_t spin_count = 16;
+
+        struct slot
+        {
+            std::atomic<std::size_t> sequence_;
+            T data_;
+        };
+
+        // everything needed to suspend threads waiting for the channel to
+        // become non-empty or non-full
+        struct wait_data
+        {
+            mutex_type mtx_;
+            detail::condition_variable not_empty_;
+            detail::condition_variable not_full_;
+            std::atomic<std::size_t> consumers_waiting_{0};
+            std::atomic<std::size_t> producers_waiting_{0};
+        };
+
+        [[nodiscard]] static constexpr std::size_t round_up_to_power_of_two(
+            std::size_t size) noexcept
+        {
+            std::size_t result = 1;
+            while (result < size)
+            {
+                result <<= 1;
+            }
+            return result;
+        }
+
+        [[nodiscard]] static constexpr std::ptrdiff_t distance(
+            std::size_t sequence, std::size_t pos) noexcept
+        {
+            return static_cast<std::ptrdiff_t>(sequence - pos);
+        }
+
+        [[nodiscard]] bool has_data() const noexcept
+        {
+            std::size_t const pos = head_.data_.load(std::memory_order_relaxed);
+            std::size_t const sequence =
+                buffer_[pos & mask_].sequence_.load(std::memory_order_acquire);
+            return distance(sequence, pos + 1) >= 0;
+        }
+
+        [[nodiscard]] bool has_space() const noexcept
+        {
+            std::size_t const pos = tail_.data_.load(std::memory_order_relaxed);
+            std::size_t const sequence =
+                buffer_[pos & mask_].sequence_.load(std::memory_order_acquire);
+            return distance(sequence, pos) >= 0;
+        }
+
+        // Claim up to count consecutive slots. Slots are ready if their
+        // sequence number is equal to their position plus the given offset
+        // (0 for producers, 1 for consumers). Returns the number of claimed
+        // slots and the position of the first one.
+        [[nodiscard]] std::size_t claim(
+            std::atomic<std::size_t>& counter, std::size_t offset,
+            std::size_t count, std::size_t& pos) const noexcept
+        {
+            pos = counter.load(std::memory_order_relaxed);
+            while (true)
+            {
+                std::size_t claimed = 0;
+                std::size_t sequence = 0;
+                for (/**/; claimed != count; ++claimed)
+                {
+                    sequence = buffer_[(pos + claimed) & mask_]
+                                   .sequence_.load(std::memory_order_acquire);
+                    if (sequence != pos + claimed + offset)
+                    {
+                        break;
+                    }
+                }
+
+                if (claimed == 0)
+                {
+                    if (distance(sequence, pos + offset) < 0)
+                    {
+                        return 0;    // channel is empty or full
+                    }
+
+                    // somebody else was faster, try again
+                    pos = counter.load(std::memory_order_relaxed);
+                }
+                else if (counter.compare_exchange_weak(pos, pos + claimed,
+                             std::memory_order_relaxed))
+                {
+                    return claimed;
+                }
+            }
+        }
+
+        // wake up threads waiting on the given condition, if any
+        void notify(std::atomic<std::size_t> const& waiting,
+            detail::condition_variable& cond, std::size_t count) const
+        {
+            // pairs with the fence in wait()
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (waiting.load(std::memory_order_relaxed) != 0)
+            {
+                std::unique_lock<mutex_type> l(wait_->mtx_);
+                if (count == 1)
+                {
+                    cond.notify_one(HPX_MOVE(l));
+                }
+                else
+                {
+                    cond.notify_all(HPX_MOVE(l));
+                }
+            }
+        }
+
+        template <typename Predicate>
+        void wait(std::atomic<std::size_t>& waiting,
+            detail::condition_variable& cond, Predicate&& ready,
+            char const* description) const
+        {
+            std::unique_lock<mutex_type> l(wait_->mtx_);
+
+            waiting.fetch_add(1, std::memory_order_relaxed);
+
+            // pairs with the fence in notify()
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            while (!closed_.load(std::memory_order_relaxed) && !ready())
+            {
+                cond.wait(l, description);
+            }
+
+            waiting.fetch_sub(1, std::memory_order_relaxed);
+        }
+
+    public:
+        explicit lockfree_bounded_channel(std::size_t size)
+          : mask_(round_up_to_power_of_two(size) - 1)
+          , buffer_(new slot[mask_ + 1])
+          , wait_(new wait_data)
+          , closed_(false)
+        {
+            HPX_ASSERT(size != 0);
+
+            for (std::size_t i = 0; i != mask_ + 1; ++i)
+            {
+                buffer_[i].sequence_.store(i, std::memory_order_relaxed);
+            }
+
+            head_.data_.store(0, std::memory_order_relaxed);
+            tail_.data_.store(0, std::memory_order_release);
+        }
+
+        lockfree_bounded_channel(lockfree_bounded_channel const& rhs) = delete;
+        lockfree_bounded_channel& operator=(
+            lockfree_bounded_channel const& rhs) = delete;
+
+        lockfree_bounded_channel(lockfree_bounded_channel&& rhs) noexcept
+          : mask_(rhs.mask_)
+          , buffer_(HPX_MOVE(rhs.buffer_))
+          , wait_(HPX_MOVE(rhs.wait_))
+        {
+            head_.data_.store(rhs.head_.data_.load(std::memory_order_acquire),
+                std::memory_order_relaxed);
+            tail_.data_.store(rhs.tail_.data_.load(std::memory_order_acquire),
+                std::memory_order_relaxed);
+
+            closed_.store(rhs.closed_.load(std::memory_order_acquire),
+                std::memory_order_relaxed);
+            rhs.closed_.store(true, std::memory_order_release);
+        }
+
+        lockfree_bounded_channel& operator=(
+            lockfree_bounded_channel&& rhs) noexcept
+        {
+            head_.data_.store(rhs.head_.data_.load(std::memory_order_acquire),
+                std::memory_order_relaxed);
+            tail_.data_.store(rhs.tail_.data_.load(std::memory_order_acquire),
+                std::memory_order_relaxed);
+
+            mask_ = rhs.mask_;
+            buffer_ = HPX_MOVE(rhs.buffer_);
+            wait_ = HPX_MOVE(rhs.wait_);
+
+            closed_.store(rhs.closed_.load(std::memory_order_acquire),
+                std::memory_order_relaxed);
+            rhs.closed_.store(true, std::memory_order_release);
+
+            return *this;
+        }
+
+        ~lockfree_bounded_channel()
+        {
+            if (!closed_.load(std::memory_order_relaxed))
+            {
+                close();
+            }
+        }
+
+        [[nodiscard]] bool is_empty() const noexcept
+        {
+            if (closed_.load(std::memory_order_relaxed))
+            {
+                return true;
+            }
+            return !has_data();
+        }
+
+        // Retrieve up to count values from the channel and store them into
+        // the sequence starting at dest. Returns the number of retrieved
+        // values, which is zero if the channel is empty or closed.
+        template <typename OutIter>
+        std::size_t get_n(OutIter dest, std::size_t count) const
+        {
+            if (count == 0 || closed_.load(std::memory_order_relaxed))
+            {
+                return 0;
+            }
+
+            std::size_t pos = 0;
+            std::size_t const claimed = claim(head_.data_, 1, count, pos);
+            for (std::size_t i = 0; i != claimed; ++i, ++dest)
+            {
+                slot& s = buffer_[(pos + i) & mask_];
+                *dest = HPX_MOVE(s.data_);
+                s.sequence_.store(
+                    pos + i + mask_ + 1, std::memory_order_release);
+            }
+
+            if (claimed != 0)
+            {
+                notify(wait_->producers_waiting_, wait_->not_full_, claimed);
+            }
+            return claimed;
+        }
+
+        // Retrieve a value from the channel. If val is nullptr, only check
+        // whether a value is available.
+        bool get(T* val = nullptr) const
+        {
+            if (val == nullptr)
+            {
+                return !is_empty();
+            }
+            return get_n(val, 1) != 0;
+        }
+
+        // Retrieve a value from the channel, suspend the calling thread while
+        // the channel is empty. Returns false if the channel was closed.
+        bool get_sync(T* val) const
+        {
+            HPX_ASSERT(val != nullptr);
+            for (std::size_t k = 0; /**/; ++k)
+            {
+                if (get_n(val, 1) != 0)
+                {
+                    return true;
+                }
+
+                if (closed_.load(std::memory_order_relaxed))
+                {
+                    return false;
+                }
+
+                if (k < spin_count)
+                {
+                    hpx::execution_base::this_thread::yield_k(
+                        k, "lockfree_bounded_channel::get_sync");
+                }
+                else
+                {
+                    wait(wait_->consumers_waiting_, wait_->not_empty_,
+                        [this]() { return has_data(); },
+                        "lockfree_bounded_channel::get_sync");
+                }
+            }
+        }
+
+        // Store up to count values from the sequence starting at first into
+        // the channel. Returns the number of stored values, which is zero if
+        // the channel is full or closed. The values are copied unless first
+        // is a move iterator.
+        template <typename InIter>
+        std::size_t set_n(InIter first, std::size_t count)
+        {
+            if (count == 0 || closed_.load(std::memory_order_relaxed))
+            {
+                return 0;
+            }
+
+            std::size_t pos = 0;
+            std::size_t const claimed = claim(tail_.data_, 0, count, pos);
+            for (std::size_t i = 0; i != claimed; ++i, ++first)
+            {
+                slot& s = buffer_[(pos + i) & mask_];
+                s.data_ = *first;
+                s.sequence_.store(pos + i + 1, std::memory_order_release);
+            }
+
+            if (claimed != 0)
+            {
+                notify(wait_->consumers_waiting_, wait_->not_empty_, claimed);
+            }
+            return claimed;
+        }
+
+        bool set(T&& t)
+        {
+            return set_n(std::make_move_iterator(&t), 1) != 0;
+        }
+
+        // Store a value into the channel, suspend the calling thread while the
+        // channel is full. Returns false if the channel was closed.
+        bool set_sync(T&& t)
+        {
+            for (std::size_t k = 0; /**/; ++k)
+            {
+                if (set_n(std::make_move_iterator(&t), 1) != 0)
+                {
+                    return true;
+                }
+
+                if (closed_.load(std::memory_order_relaxed))
+                {
+                    return false;
+                }
+
+                if (k < spin_count)
+                {
+                    hpx::execution_base::this_thread::yield_k(
+                        k, "lockfree_bounded_channel::set_sync");
+                }
+                else
+                {
+                    wait(wait_->producers_waiting_, wait_->not_full_,
+                        [this]() { return has_space(); },
+                        "lockfree_bounded_channel::set_sync");
+                }
+            }
+        }
+
+        // Close the channel, all suspended threads are woken up
+        std::size_t close()
+        {
+            bool expected = false;
+            if (!closed_.compare_exchange_strong(expected, true))
+            {
+                HPX_THROW_EXCEPTION(hpx::error::invalid_status,
+                    "hpx::lcos::local::lockfree_bounded_channel::close",
+                    "attempting to close an already closed channel");
+            }
+
+            std::unique_lock<mutex_type> l(wait_->mtx_);
+            wait_->not_full_.notify_all_no_unlock(l);
+            wait_->not_empty_.notify_all(HPX_MOVE(l));
+            return 0;
+        }
+
+        [[nodiscard]] constexpr std::size_t capacity() const noexcept
+        {
+            return mask_ + 1;
+        }
+
+    private:
+        // keep the head and the tail counters in separate cache lines
+        mutable hpx::util::cache_aligned_data<std::atomic<std::size_t>> head_;
+        hpx::util::cache_aligned_data<std::atomic<std::size_t>> tail_;
+
+        std::size_t mask_;
+
+        // channel buffer
+        std::unique_ptr<slot[]> buffer_;
+
+        // wait queues for suspended producers and consumers
+        std::unique_ptr<wait_data> wait_;
+
+        // this channel was closed, i.e. no further operations are possible
+        std::atomic<bool> closed_;
+    };
+
+    ////////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    using channel_mpmc_lockfree = lockfree_bounded_channel<T>;
+}    // namespace hpx::lcos::local
@@ -0,0 +1,231 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures the throughput of the local channels for a growing
+// number of producers and consumers sharing a single channel. The spinlock
+// protected channel_mpmc is compared with the lock-free channel_mpmc_lockfree
+// (using the non-blocking, the blocking, and the batched operations). The
+// channel_mpsc is measured with a single consumer and the channel_spsc with a
+// single producer and a single consumer only.
+
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/format.hpp>
+#include <hpx/modules/synchronization.hpp>
+#include <hpx/modules/timing.hpp>
+#include <hpx/thread.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+using hpx::lcos::local::channel_mpmc;
+using hpx::lcos::local::channel_mpmc_lockfree;
+using hpx::lcos::local::channel_mpsc;
+using hpx::lcos::local::channel_spsc;
+
+constexpr std::size_t batch_size = 16;
+
+///////////////////////////////////////////////////////////////////////////////
+// non-blocking operations, yield while the channel is full or empty
+template <typename Channel>
+void set_yield(Channel& c, std::size_t count)
+{
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        while (!c.set(static_cast<std::uint64_t>(i)))
+        {
+            hpx::this_thread::yield();
+        }
+    }
+}
+
+template <typename Channel>
+void get_yield(Channel const& c, std::size_t count)
+{
+    std::uint64_t value = 0;
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        while (!c.get(&value))
+        {
+            hpx::this_thread::yield();
+        }
+    }
+}
+
+// blocking operations, suspend while the channel is full or empty
+void set_blocking(channel_mpmc_lockfree<std::uint64_t>& c, std::size_t count)
+{
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        c.set_sync(static_cast<std::uint64_t>(i));
+    }
+}
+
+void get_blocking(
+    channel_mpmc_lockfree<std::uint64_t> const& c, std::size_t count)
+{
+    std::uint64_t value = 0;
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        c.get_sync(&value);
+    }
+}
+
+// batched operations
+void set_batched(channel_mpmc_lockfree<std::uint64_t>& c, std::size_t count)
+{
+    std::vector<std::uint64_t> values(batch_size);
+    std::iota(values.begin(), values.end(), std::uint64_t(0));
+
+    while (count != 0)
+    {
+        std::size_t const stored =
+            c.set_n(values.begin(), (std::min) (count, batch_size));
+        if (stored == 0)
+        {
+            hpx::this_thread::yield();
+        }
+        count -= stored;
+    }
+}
+
+void get_batched(
+    channel_mpmc_lockfree<std::uint64_t> const& c, std::size_t count)
+{
+    std::vector<std::uint64_t> values(batch_size);
+    while (count != 0)
+    {
+        std::size_t const retrieved =
+            c.get_n(values.begin(), (std::min) (count, batch_size));
+        if (retrieved == 0)
+        {
+            hpx::this_thread::yield();
+        }
+        count -= retrieved;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Run the given number of producers and consumers, each of them transferring
+// the same number of items. Returns the number of transferred items per
+// second.
+template <typename Channel, typename Set, typename Get>
+double measure(Channel& c, std::size_t num_producers,
+    std::size_t num_consumers, std::size_t num_items, Set&& set, Get&& get)
+{
+    std::size_t const items_per_producer = num_items / num_producers;
+    std::size_t const items_per_consumer = num_items / num_consumers;
+
+    std::vector<hpx::future<void>> tasks;
+    tasks.reserve(num_producers + num_consumers);
+
+    hpx::chrono::high_resolution_timer const t;
+
+    for (std::size_t i = 0; i != num_producers; ++i)
+    {
+        tasks.push_back(hpx::async(set, std::ref(c), items_per_producer));
+    }
+    for (std::size_t i = 0; i != num_consumers; ++i)
+    {
+        tasks.push_back(hpx::async(get, std::cref(c), items_per_consumer));
+    }
+    hpx::wait_all(tasks);
+
+    return static_cast<double>(items_per_producer * num_producers) /
+        t.elapsed();
+}
+
+void print_result(char const* channel, char const* operation,
+    std::size_t num_producers, std::size_t num_consumers, double throughput)
+{
+    std::cout << hpx::util::format("{},{},{},{},{:.0f}\n", channel, operation,
+        num_producers, num_consumers, throughput);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t const num_items = vm["items"].as<std::size_t>();
+    std::size_t const capacity = vm["capacity"].as<std::size_t>();
+    std::size_t const max_tasks = vm["max-tasks"].as<std::size_t>();
+
+    std::cout << "channel,operation,producers,consumers,throughput[items/s]\n";
+
+    {
+        channel_spsc<std::uint64_t> c(capacity);
+        print_result("channel_spsc", "yield", 1, 1,
+            measure(c, 1, 1, num_items, &set_yield<decltype(c)>,
+                &get_yield<decltype(c)>));
+    }
+
+    for (std::size_t n = 1; n <= max_tasks; n *= 2)
+    {
+        // the number of items has to be divisible by the number of tasks
+        std::size_t const items = num_items / n * n;
+
+        {
+            channel_mpsc<std::uint64_t> c(capacity);
+            print_result("channel_mpsc", "yield", n, 1,
+                measure(c, n, 1, items, &set_yield<decltype(c)>,
+                    &get_yield<decltype(c)>));
+        }
+        {
+            channel_mpmc<std::uint64_t> c(capacity);
+            print_result("channel_mpmc", "yield", n, n,
+                measure(c, n, n, items, &set_yield<decltype(c)>,
+                    &get_yield<decltype(c)>));
+        }
+        {
+            channel_mpmc_lockfree<std::uint64_t> c(capacity);
+            print_result("channel_mpmc_lockfree", "yield", n, n,
+                measure(c, n, n, items, &set_yield<decltype(c)>,
+                    &get_yield<decltype(c)>));
+        }
+        {
+            channel_mpmc_lockfree<std::uint64_t> c(capacity);
+            print_result("channel_mpmc_lockfree", "blocking", n, n,
+                measure(c, n, n, items, &set_blocking, &get_blocking));
+        }
+        {
+            channel_mpmc_lockfree<std::uint64_t> c(capacity);
+            print_result("channel_mpmc_lockfree", "batched", n, n,
+                measure(c, n, n, items, &set_batched, &get_batched));
+        }
+    }
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using hpx::program_options::options_description;
+    using hpx::program_options::value;
+
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("items", value<std::size_t>()->default_value(1000000),
+         "number of items transferred through the channel (default: 1000000)")
+        ("capacity", value<std::size_t>()->default_value(1024),
+         "capacity of the channel (default: 1024)")
+        ("max-tasks", value<std::size_t>()->default_value(128),
+         "largest number of producers and consumers (default: 128)")
+        ;
+    // clang-format on
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+
+    return hpx::local::init(hpx_main, argc, argv, init_args);
+}
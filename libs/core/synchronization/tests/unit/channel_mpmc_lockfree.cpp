@@ -0,0 +1,238 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/synchronization.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/thread.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+using hpx::lcos::local::channel_mpmc_lockfree;
+
+constexpr int NUM_WORKERS = 1000;
+constexpr int NUM_ITEMS = 10000;
+
+///////////////////////////////////////////////////////////////////////////////
+// every worker passes its number on to the next one
+int shift_func(int i, channel_mpmc_lockfree<int>& channel,
+    channel_mpmc_lockfree<int>& next)
+{
+    HPX_TEST(channel.set_sync(std::move(i)));    // NOLINT
+
+    int result = 0;
+    HPX_TEST(next.get_sync(&result));
+    return result;
+}
+
+void test_shift()
+{
+    std::vector<channel_mpmc_lockfree<int>> channels;
+    channels.reserve(NUM_WORKERS);
+
+    std::vector<hpx::future<int>> workers;
+    workers.reserve(NUM_WORKERS);
+
+    for (int i = 0; i != NUM_WORKERS; ++i)
+    {
+        channels.emplace_back(std::size_t(1));
+    }
+
+    for (int i = 0; i != NUM_WORKERS; ++i)
+    {
+        workers.push_back(hpx::async(&shift_func, i, std::ref(channels[i]),
+            std::ref(channels[(i + 1) % NUM_WORKERS])));
+    }
+
+    hpx::wait_all(workers);
+
+    for (int i = 0; i != NUM_WORKERS; ++i)
+    {
+        HPX_TEST_EQ((i + 1) % NUM_WORKERS, workers[i].get());
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// producers and consumers using single and batched operations
+void produce(channel_mpmc_lockfree<int>& c, int batch)
+{
+    std::vector<int> values(NUM_ITEMS);
+    std::iota(values.begin(), values.end(), 0);
+
+    if (batch == 1)
+    {
+        for (int value : values)
+        {
+            HPX_TEST(c.set_sync(std::move(value)));    // NOLINT
+        }
+        return;
+    }
+
+    for (std::size_t i = 0; i != values.size(); /**/)
+    {
+        std::size_t const count =
+            (std::min) (values.size() - i, static_cast<std::size_t>(batch));
+        std::size_t const stored = c.set_n(values.begin() + i, count);
+        if (stored == 0)
+        {
+            hpx::this_thread::yield();
+        }
+        i += stored;
+    }
+}
+
+std::int64_t consume(channel_mpmc_lockfree<int>& c, int batch)
+{
+    std::int64_t sum = 0;
+    if (batch == 1)
+    {
+        int value = 0;
+        while (c.get_sync(&value))
+        {
+            sum += value;
+        }
+        return sum;
+    }
+
+    std::vector<int> values(batch);
+    while (true)
+    {
+        std::size_t const count = c.get_n(values.begin(), values.size());
+        if (count == 0)
+        {
+            // wait for more data, returns false once the channel was closed
+            int value = 0;
+            if (!c.get_sync(&value))
+            {
+                break;
+            }
+            sum += value;
+            continue;
+        }
+
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            sum += values[i];
+        }
+    }
+    return sum;
+}
+
+void test_producers_consumers(int num_producers, int num_consumers)
+{
+    channel_mpmc_lockfree<int> c(64);
+
+    std::vector<hpx::future<void>> producers;
+    for (int i = 0; i != num_producers; ++i)
+    {
+        producers.push_back(hpx::async(&produce, std::ref(c), 1 + i % 7));
+    }
+
+    std::vector<hpx::future<std::int64_t>> consumers;
+    for (int i = 0; i != num_consumers; ++i)
+    {
+        consumers.push_back(hpx::async(&consume, std::ref(c), 1 + i % 5));
+    }
+
+    hpx::wait_all(producers);
+
+    // wait for the consumers to drain the channel before closing it
+    while (!c.is_empty())
+    {
+        hpx::this_thread::yield();
+    }
+    c.close();
+
+    std::int64_t sum = 0;
+    for (auto& f : consumers)
+    {
+        sum += f.get();
+    }
+
+    std::int64_t const expected = static_cast<std::int64_t>(num_producers) *
+        NUM_ITEMS * (NUM_ITEMS - 1) / 2;
+    HPX_TEST_EQ(sum, expected);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_close()
+{
+    channel_mpmc_lockfree<int> c(1);
+
+    // a consumer suspended on an empty channel is woken up by close
+    hpx::future<bool> consumer = hpx::async([&c]() {
+        int value = 0;
+        return c.get_sync(&value);
+    });
+
+    // a producer suspended on a full channel is woken up by close
+    HPX_TEST(c.set(42));
+    hpx::future<bool> producer =
+        hpx::async([&c]() { return c.set_sync(43) && c.set_sync(44); });
+
+    hpx::this_thread::yield();
+    c.close();
+
+    consumer.get();
+    HPX_TEST(!producer.get());
+
+    int value = 0;
+    HPX_TEST(!c.get(&value));
+    HPX_TEST(!c.set(42));
+    HPX_TEST_EQ(c.set_n(&value, 1), std::size_t(0));
+    HPX_TEST_EQ(c.get_n(&value, 1), std::size_t(0));
+}
+
+void test_capacity()
+{
+    channel_mpmc_lockfree<int> c(5);
+    HPX_TEST_EQ(c.capacity(), std::size_t(8));
+
+    std::vector<int> values(10);
+    std::iota(values.begin(), values.end(), 0);
+
+    HPX_TEST(c.is_empty());
+    HPX_TEST_EQ(c.set_n(values.begin(), values.size()), std::size_t(8));
+    HPX_TEST(!c.set(42));
+    HPX_TEST(!c.is_empty());
+
+    std::vector<int> result(10);
+    HPX_TEST_EQ(c.get_n(result.begin(), 3), std::size_t(3));
+    HPX_TEST_EQ(c.get_n(result.begin() + 3, 7), std::size_t(5));
+    HPX_TEST(c.is_empty());
+
+    for (int i = 0; i != 8; ++i)
+    {
+        HPX_TEST_EQ(result[i], i);
+    }
+}
+
+int hpx_main()
+{
+    test_capacity();
+    test_close();
+    test_shift();
+
+    test_producers_consumers(1, 1);
+    test_producers_consumers(1, 8);
+    test_producers_consumers(8, 1);
+    test_producers_consumers(8, 8);
+
+    hpx::local::finalize();
+    return hpx::util::report_errors();
+}
+
+int main(int argc, char* argv[])
+{
+    return hpx::local::init(hpx_main, argc, argv);
+}
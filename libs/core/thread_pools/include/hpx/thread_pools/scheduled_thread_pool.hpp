@@ -225,6 +225,13 @@ namespace hpx::threads::detail {
         {
             return sched_->Scheduler::get_num_stolen_to_staged(num, reset);
         }
+
+        std::int64_t get_num_stolen_by_distance(std::size_t num,
+            policies::steal_distance distance, bool reset) override
+        {
+            return sched_->Scheduler::get_num_stolen_by_distance(
+                num, distance, reset);
+        }
 #endif
         std::int64_t get_queue_length(
             std::size_t num_thread, bool /* reset */) override
@@ -16,9 +16,12 @@
 #include <hpx/thread_pools/detail/scheduling_counters.hpp>
 #include <hpx/thread_pools/detail/scheduling_log.hpp>
 #include <hpx/threading_base/detail/switch_status.hpp>
+#include <hpx/threading_base/detail/timer_wheel.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
 #include <hpx/threading_base/scheduler_state.hpp>
+#include <hpx/threading_base/task_tracer.hpp>
 #include <hpx/threading_base/thread_data.hpp>
+#include <hpx/threading_base/thread_num_tss.hpp>
 
 #if defined(HPX_HAVE_ITTNOTIFY) && HPX_HAVE_ITTNOTIFY != 0 &&                  \
     !defined(HPX_HAVE_APEX)
@@ -136,10 +139,25 @@ namespace hpx::threads::detail {
             context_storage =
                 hpx::execution_base::this_thread::detail::get_agent_storage();
 
+        // the task tracer is enabled before the worker threads are started
+        detail::task_trace_buffer* trace_buffer =
+            detail::get_task_trace_buffer(hpx::get_worker_thread_num());
+
+        // timers created by the HPX threads running on this worker thread,
+        // any remaining timers are handed over to the timer service on exit
+        timer_wheel timers;
+        timer_wheel::scoped_current const current_timers(timers);
+
         auto added = static_cast<std::size_t>(-1);
         thread_id_ref_type next_thrd;
         while (true)
         {
+            // wake up threads whose timers have expired
+            if (!timers.empty())
+            {
+                timers.poll();
+            }
+
             thread_id_ref_type thrd = HPX_MOVE(next_thrd);
             next_thrd = thread_id_ref_type();
 
@@ -239,6 +257,12 @@ namespace hpx::threads::detail {
                                             idle_rate.collect_exec_time(ts);
                                         });
 #endif
+                                if (trace_buffer)
+                                {
+                                    detail::trace_task_start(
+                                        *trace_buffer, thrdptr);
+                                }
+
 #if defined(HPX_HAVE_APEX)
                                 // get the APEX data pointer, in case we are
                                 // resuming the thread and have to restore any
@@ -267,6 +291,18 @@ namespace hpx::threads::detail {
 #else
                                 thrd_stat = (*thrdptr)(context_storage);
 #endif
+                                if (trace_buffer)
+                                {
+                                    thread_schedule_state const next =
+                                        thrd_stat.get_previous();
+                                    bool const finished = next ==
+                                            thread_schedule_state::terminated ||
+                                        next == thread_schedule_state::deleted;
+                                    trace_buffer->record(finished ?
+                                            task_trace_event_type::stop :
+                                            task_trace_event_type::suspend,
+                                        thrdptr, 0, 0);
+                                }
                             }
 
                             detail::write_state_log(scheduler, num_thread, thrd,
@@ -540,6 +576,10 @@ namespace hpx::threads::detail {
             {
                 busy_loop_count = 0;
 
+                // fire expired timers of worker threads which are busy
+                // running a task
+                timer_wheel::poll_expired();
+
                 if (do_background_work)
                 {
                     // do background work in parcel layer and in agas
@@ -554,7 +594,12 @@ namespace hpx::threads::detail {
                 if (idle_loop_count > params.max_idle_loop_count_)
                     idle_loop_count = 0;
 
-                // call back into invoking context
+                // fire expired timers of worker threads which are busy
+                // running a task
+                timer_wheel::poll_expired();
+
+                // call back into invoking context, this may put the worker
+                // thread to sleep until the next timer expires
                 if (!params.outer_.empty())
                 {
                     params.outer_();
@@ -0,0 +1,146 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Exercise the timers used for suspending threads for a given amount of time
+// (sleep_for, timed waits, and timed futures).
+
+#include <hpx/execution.hpp>
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/thread.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_sleep_for()
+{
+    std::vector<hpx::future<void>> sleepers;
+    for (std::size_t i = 0; i != 1000; ++i)
+    {
+        auto const duration = std::chrono::microseconds(i % 100 * 50);
+        sleepers.push_back(hpx::async([duration] {
+            auto const start = std::chrono::steady_clock::now();
+            hpx::this_thread::sleep_for(duration);
+            HPX_TEST_LTE(
+                start + duration, std::chrono::steady_clock::now());
+        }));
+    }
+    hpx::wait_all(sleepers);
+}
+
+void test_sleep_for_long()
+{
+    // exceeds the range covered by the lower levels of the timer wheels
+    auto const start = std::chrono::steady_clock::now();
+    hpx::this_thread::sleep_for(1100ms);
+    HPX_TEST_LTE(start + 1100ms, std::chrono::steady_clock::now());
+}
+
+void test_wait_for()
+{
+    // timed waits which are satisfied early cancel their timers
+    std::vector<hpx::future<void>> waiters;
+    for (std::size_t i = 0; i != 100; ++i)
+    {
+        waiters.push_back(hpx::async([] {
+            hpx::promise<void> p;
+            hpx::future<void> f = p.get_future();
+
+            hpx::future<void> setter =
+                hpx::async([p = std::move(p)]() mutable { p.set_value(); });
+
+            HPX_TEST(f.wait_for(10s) == hpx::future_status::ready);
+            setter.get();
+        }));
+    }
+    hpx::wait_all(waiters);
+
+    // timed waits which are not satisfied time out
+    hpx::promise<void> p;
+    hpx::future<void> f = p.get_future();
+
+    auto const start = std::chrono::steady_clock::now();
+    HPX_TEST(f.wait_for(10ms) == hpx::future_status::timeout);
+    HPX_TEST_LTE(start + 10ms, std::chrono::steady_clock::now());
+
+    p.set_value();
+    HPX_TEST(f.wait_for(10ms) == hpx::future_status::ready);
+}
+
+void test_timed_future()
+{
+    auto const start = std::chrono::steady_clock::now();
+
+    std::vector<hpx::future<int>> futures;
+    for (int i = 0; i != 100; ++i)
+    {
+        futures.push_back(
+            hpx::make_ready_future_after(std::chrono::microseconds(i * 10), i));
+    }
+
+    for (int i = 0; i != 100; ++i)
+    {
+        HPX_TEST_EQ(futures[i].get(), i);
+    }
+    HPX_TEST_LTE(start + std::chrono::microseconds(990),
+        std::chrono::steady_clock::now());
+}
+
+void test_busy_worker()
+{
+    // timers fire even if the worker thread they were created on is busy
+    // running a task which never yields
+    std::atomic<bool> started(false);
+    std::atomic<bool> woken(false);
+
+    hpx::execution::parallel_executor exec(hpx::threads::thread_schedule_hint(
+        static_cast<std::int16_t>(hpx::get_worker_thread_num())));
+    hpx::future<void> sleeper = hpx::async(exec, [&] {
+        started = true;
+        hpx::this_thread::sleep_for(10ms);
+        woken = true;
+    });
+
+    while (!started)
+    {
+        hpx::this_thread::yield();
+    }
+
+    // keep this worker thread busy without yielding
+    auto const deadline = std::chrono::steady_clock::now() + 10s;
+    while (!woken && std::chrono::steady_clock::now() < deadline)
+    {
+    }
+
+    HPX_TEST(woken);
+    sleeper.get();
+}
+
+int hpx_main()
+{
+    test_sleep_for();
+    test_sleep_for_long();
+    test_wait_for();
+    test_timed_future();
+    test_busy_worker();
+
+    return hpx::local::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv), 0);
+    return hpx::util::report_errors();
+}
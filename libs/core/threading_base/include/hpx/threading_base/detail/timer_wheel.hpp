@@ -0,0 +1,234 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/memory/intrusive_ptr.hpp>
+#include <hpx/thread_support/atomic_count.hpp>
+#include <hpx/thread_support/spinlock.hpp>
+#include <hpx/threading_base/threading_base_fwd.hpp>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::threads::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A pending change of the state of a thread at a given point in time.
+    // Timer entries are reference counted, they are kept alive by the timer
+    // wheel (or timer service) they have been scheduled with and by anybody
+    // who might want to cancel them.
+    class HPX_CORE_EXPORT timer_entry
+    {
+    public:
+        timer_entry(std::chrono::steady_clock::time_point abs_time,
+            thread_id_ref_type thrd, thread_schedule_state newstate,
+            thread_restart_state newstate_ex, thread_priority priority,
+            thread_schedule_hint schedulehint, bool retry_on_active) noexcept;
+
+        timer_entry(timer_entry const&) = delete;
+        timer_entry(timer_entry&&) = delete;
+        timer_entry& operator=(timer_entry const&) = delete;
+        timer_entry& operator=(timer_entry&&) = delete;
+
+        ~timer_entry();
+
+        // Prevent the thread state change from happening. This is an O(1)
+        // operation which can be invoked from any thread, the entry itself
+        // is removed from its timer wheel lazily. Returns false if the timer
+        // has already fired (or was canceled before).
+        bool cancel() noexcept;
+
+        // Apply the requested thread state change, if the timer has not been
+        // canceled yet. If 'statex' is thread_restart_state::abort the timer
+        // is discarded without changing the state of the thread.
+        void fire(thread_restart_state statex) noexcept;
+
+        [[nodiscard]] bool is_pending() const noexcept
+        {
+            return state_.load(std::memory_order_acquire) == state::pending;
+        }
+
+        [[nodiscard]] std::chrono::steady_clock::time_point expiration()
+            const noexcept
+        {
+            return abs_time_;
+        }
+
+    private:
+        friend class timer_wheel;
+
+        friend void intrusive_ptr_add_ref(timer_entry* p) noexcept
+        {
+            ++p->count_;
+        }
+
+        friend void intrusive_ptr_release(timer_entry* p) noexcept
+        {
+            if (0 == --p->count_)
+            {
+                delete p;
+            }
+        }
+
+        enum class state : std::uint8_t
+        {
+            pending = 0,
+            fired = 1,
+            canceled = 2
+        };
+
+        std::chrono::steady_clock::time_point abs_time_;
+        thread_id_ref_type thrd_;
+        thread_schedule_state newstate_;
+        thread_restart_state newstate_ex_;
+        thread_priority priority_;
+        thread_schedule_hint schedulehint_;
+        bool retry_on_active_;
+
+        std::atomic<state> state_;
+        hpx::util::atomic_count count_;
+
+        // managed by the owning timer wheel only
+        timer_entry* next_ = nullptr;
+        std::uint64_t tick_ = 0;
+    };
+
+    using timer_entry_ptr = hpx::intrusive_ptr<timer_entry>;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Hierarchical timing wheel holding the timers of one worker thread.
+    // Timers are added by the owning worker thread (either from its
+    // scheduling loop or from any HPX thread currently running on it), which
+    // also polls the wheel on every iteration of its scheduling loop. Other
+    // worker threads fire the expired timers of a wheel whose owner is busy
+    // running a task (see poll_expired), therefore all modifications of the
+    // wheel are protected by a spinlock, which is uncontended in the common
+    // case.
+    //
+    // The wheel consists of 'num_levels' levels of 'num_slots' slots each.
+    // A slot on level 0 covers one tick, a slot on level n covers
+    // num_slots^n ticks. Timers are moved to the next lower level whenever
+    // the slots of the lower level wrap around. Timers expiring too far in
+    // the future to be represented by the wheel are kept in an overflow
+    // list which is revisited whenever the top level wraps around.
+    class HPX_CORE_EXPORT timer_wheel
+    {
+    public:
+        static constexpr std::size_t slot_bits = 6;
+        static constexpr std::size_t num_slots = std::size_t(1) << slot_bits;
+        static constexpr std::size_t num_levels = 4;
+
+        // the duration of one tick is 2^14ns (~16us)
+        static constexpr std::size_t tick_bits = 14;
+
+        timer_wheel();
+
+        timer_wheel(timer_wheel const&) = delete;
+        timer_wheel(timer_wheel&&) = delete;
+        timer_wheel& operator=(timer_wheel const&) = delete;
+        timer_wheel& operator=(timer_wheel&&) = delete;
+
+        // Any timers which have not fired yet are handed over to the default
+        // timer service (see get_default_timer_service).
+        ~timer_wheel();
+
+        // Schedule the given timer.
+        void add(timer_entry_ptr entry);
+
+        // Fire all timers which have expired since the last invocation.
+        // Returns the number of timers fired.
+        std::size_t poll();
+
+        // Same as poll, but returns immediately if the wheel is being
+        // modified concurrently.
+        std::size_t try_poll();
+
+        // Return whether the wheel currently holds any (possibly canceled)
+        // timers.
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return next_tick_.load(std::memory_order_relaxed) == no_timers;
+        }
+
+        // Return the earliest point in time at which polling the wheel may
+        // fire a timer. This is a lower bound, time_point::max() is returned
+        // if the wheel holds no timers.
+        [[nodiscard]] std::chrono::steady_clock::time_point next_expiration()
+            const noexcept;
+
+        // Fire the expired timers of all timer wheels, this is invoked by
+        // worker threads which have run out of work or which have been busy
+        // for a while. Wheels being polled concurrently are skipped. Returns
+        // immediately if no timer is due. Returns the number of timers fired.
+        static std::size_t poll_expired();
+
+        // Return the earliest point in time at which any of the existing
+        // timer wheels may fire a timer. This is a lower bound which is
+        // maintained without locking. Worker threads do not sleep past this
+        // point in time while idling.
+        [[nodiscard]] static std::chrono::steady_clock::time_point
+        next_expiration_all() noexcept;
+
+        // Return the timer wheel owned by the calling worker thread, if any.
+        [[nodiscard]] static timer_wheel* get_current() noexcept;
+
+        // Make this the timer wheel of the calling worker thread for the
+        // lifetime of the returned object.
+        class scoped_current
+        {
+        public:
+            explicit scoped_current(timer_wheel& wheel) noexcept;
+            ~scoped_current();
+
+            scoped_current(scoped_current const&) = delete;
+            scoped_current(scoped_current&&) = delete;
+            scoped_current& operator=(scoped_current const&) = delete;
+            scoped_current& operator=(scoped_current&&) = delete;
+
+        private:
+            timer_wheel* previous_;
+        };
+
+    private:
+        using mutex_type = hpx::util::detail::spinlock;
+
+        static constexpr std::uint64_t no_timers =
+            (std::numeric_limits<std::uint64_t>::max)();
+
+        static std::uint64_t now_ticks() noexcept;
+
+        std::size_t poll_locked(std::unique_lock<mutex_type>& l);
+        void update_next_tick() noexcept;
+        static void update_next_tick_all() noexcept;
+
+        void insert(timer_entry* entry);
+        void cascade(std::size_t level);
+        void expire(timer_entry* list, timer_entry*& expired);
+
+        std::array<std::array<timer_entry*, num_slots>, num_levels> slots_;
+        timer_entry* overflow_;
+        timer_entry* due_;
+        std::uint64_t current_tick_;
+        std::size_t count_;
+        std::array<std::size_t, num_levels> level_count_;
+
+        mutable mutex_type mtx_;
+
+        // the earliest tick at which polling may fire a timer
+        std::atomic<std::uint64_t> next_tick_;
+    };
+}    // namespace hpx::threads::detail
+
+#include <hpx/config/warnings_suffix.hpp>
@@ -14,6 +14,7 @@
 #include <hpx/modules/format.hpp>
 #include <hpx/threading_base/scheduler_mode.hpp>
 #include <hpx/threading_base/scheduler_state.hpp>
+#include <hpx/threading_base/steal_distance.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_init_data.hpp>
 #include <hpx/threading_base/thread_pool_base.hpp>
@@ -182,6 +183,15 @@ namespace hpx::threads::policies {
             std::size_t num_thread, bool reset) = 0;
         virtual std::int64_t get_num_stolen_to_staged(
             std::size_t num_thread, bool reset) = 0;
+
+        // number of tasks stolen from cores at the given distance, only
+        // schedulers supporting hierarchical stealing keep track of this
+        virtual std::int64_t get_num_stolen_by_distance(
+            std::size_t /* num_thread */, steal_distance /* distance */,
+            bool /* reset */)
+        {
+            return 0;
+        }
 #endif
 
         virtual std::int64_t get_queue_length(
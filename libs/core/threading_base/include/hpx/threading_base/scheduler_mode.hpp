@@ -80,6 +80,12 @@ namespace hpx::threads::policies {
         /// 'normal' work scheduling is performed.
         do_background_work_only = 0x1000,
 
+        /// This option tells schedulers that support it to order the cores
+        /// to steal from by their topological distance (same core, shared
+        /// cache, same NUMA domain, other NUMA domains) and to steal up to
+        /// half of the available tasks of a core at once.
+        steal_hierarchical = 0x2000,
+
         // clang-format off
         /// This option represents the default mode.
         default_ =
@@ -106,7 +112,8 @@ namespace hpx::threads::policies {
             steal_high_priority_first |
             steal_after_local |
             enable_idle_backoff |
-            do_background_work_only
+            do_background_work_only |
+            steal_hierarchical
         // clang-format on
     };
 
@@ -10,6 +10,7 @@
 #include <hpx/coroutines/coroutine.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/timing.hpp>
+#include <hpx/threading_base/detail/timer_wheel.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
 #include <hpx/threading_base/set_thread_state.hpp>
 #include <hpx/threading_base/threading_base_fwd.hpp>
@@ -18,8 +19,27 @@
 
 namespace hpx::threads::detail {
 
+    /// Create a timer setting the state of the given \a thread to the given
+    /// new value after it expired (at the given time). If invoked on a worker
+    /// thread the timer is managed by the timer wheel of that worker thread,
+    /// otherwise it is handed to the default timer service. The returned
+    /// timer can be used to cancel the state change.
+    HPX_CORE_EXPORT timer_entry_ptr create_thread_timer(
+        hpx::chrono::steady_time_point const& abs_time,
+        thread_id_type const& thrd, thread_schedule_state newstate,
+        thread_restart_state newstate_ex, thread_priority priority,
+        thread_schedule_hint schedulehint, bool retry_on_active,
+        error_code& ec);
+
+    /// Let the default timer service fire the given timer.
+    HPX_CORE_EXPORT void schedule_on_timer_service(timer_entry_ptr entry);
+
     /// Set a timer to set the state of the given \a thread to the given
     /// new value after it expired (at the given time)
+    ///
+    /// \note No helper thread is involved in managing the timer anymore,
+    ///       the returned thread id is always invalid. Use
+    ///       create_thread_timer if the timer may have to be canceled.
     HPX_CORE_EXPORT thread_id_ref_type set_thread_state_timed(
         policies::scheduler_base* scheduler,
         hpx::chrono::steady_time_point const& abs_time,
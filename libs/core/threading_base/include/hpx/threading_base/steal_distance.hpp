@@ -0,0 +1,34 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace hpx::threads::policies {
+
+    /// This enumeration describes the topological distance between a worker
+    /// thread stealing work and the worker thread the work is stolen from.
+    enum class steal_distance : std::uint8_t
+    {
+        /// Both worker threads run on the same core
+        core = 0,
+
+        /// Both worker threads share the last level cache
+        cache = 1,
+
+        /// Both worker threads run in the same NUMA domain
+        numa = 2,
+
+        /// The worker threads run in different NUMA domains
+        remote_numa = 3
+    };
+
+    inline constexpr std::size_t num_steal_distances = 4;
+}    // namespace hpx::threads::policies
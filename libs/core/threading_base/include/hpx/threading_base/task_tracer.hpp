@@ -0,0 +1,213 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file task_tracer.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/hardware/timestamp.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+#include <hpx/threading_base/thread_description.hpp>
+#include <hpx/threading_base/threading_base_fwd.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::threads {
+
+    /// The kinds of events recorded by the task tracer
+    enum class task_trace_event_type : std::uint16_t
+    {
+        start = 0,      ///< a task (phase) started running on a worker
+        stop = 1,       ///< a task finished running
+        suspend = 2,    ///< a task was suspended (or yielded)
+        steal = 3       ///< a task was stolen from another worker
+    };
+
+    /// Enable continuous tracing of the tasks executed by the worker threads.
+    /// Each worker thread records its events into a ring buffer of its own,
+    /// once a buffer is full the oldest events are overwritten.
+    ///
+    /// \param num_workers  The (global) number of worker threads to trace.
+    /// \param buffer_size  The number of events each of the ring buffers can
+    ///                     hold (rounded up to the next power of two).
+    ///
+    /// \note This function has to be called before the worker threads are
+    ///       started, worker threads pick up their buffer only when entering
+    ///       their scheduling loop.
+    HPX_CORE_EXPORT void enable_task_tracing(
+        std::size_t num_workers, std::size_t buffer_size);
+
+    /// Stop recording task events. The events recorded so far are retained
+    /// and can still be written using \a write_task_trace.
+    HPX_CORE_EXPORT void disable_task_tracing() noexcept;
+
+    /// Return whether task tracing is currently enabled.
+    HPX_CORE_EXPORT bool is_task_tracing_enabled() noexcept;
+
+    /// Write the events currently held by the ring buffers to the given
+    /// file. The file uses a compact binary format which can be converted
+    /// into the Chrome trace event format (readable by chrome://tracing and
+    /// Perfetto) using tools/trace/hpx_trace_to_json.py.
+    ///
+    /// \returns Whether the file was successfully written.
+    HPX_CORE_EXPORT bool write_task_trace(std::string const& filename);
+
+    namespace detail {
+
+        /// \cond NOINTERNAL
+
+        // A single trace event, this is also the layout used in the trace
+        // files
+        struct task_trace_event
+        {
+            std::uint64_t timestamp;
+            std::uint64_t task;    // address of the thread_data instance
+            std::uint64_t data;    // description or victim worker
+            std::uint32_t phase;
+            std::uint16_t type;
+            std::uint16_t flags;    // task_trace_data_is_description
+        };
+
+        // The event's data refers to a description string owned by the
+        // trace buffer
+        inline constexpr std::uint16_t task_trace_data_is_description = 0x1;
+
+        static_assert(sizeof(task_trace_event) == 32,
+            "task_trace_event is expected to occupy 32 bytes");
+
+        // Ring buffer holding the events of one worker thread. Only the
+        // owning worker thread records events, while the events may be
+        // read concurrently by any other thread.
+        class task_trace_buffer
+        {
+        public:
+            explicit task_trace_buffer(std::size_t size);
+
+            HPX_FORCEINLINE void record(task_trace_event_type type,
+                void const* task, std::uint64_t data, std::size_t phase,
+                std::uint16_t flags = 0) noexcept
+            {
+                std::uint64_t const head =
+                    head_.load(std::memory_order_relaxed);
+
+                task_trace_event& e = events_[head & mask_];
+                e.timestamp = util::hardware::timestamp();
+                e.task = reinterpret_cast<std::uint64_t>(task);
+                e.data = data;
+                e.phase = static_cast<std::uint32_t>(phase);
+                e.type = static_cast<std::uint16_t>(type);
+                e.flags = flags;
+
+                head_.store(head + 1, std::memory_order_release);
+            }
+
+            // Copy the events currently held by the buffer, oldest first.
+            // The snapshot may contain torn events if the owning worker
+            // thread is still recording.
+            std::vector<task_trace_event> snapshot() const;
+
+            // Return a copy of the given description owned by the buffer
+            // (or nullptr if it could not be created). Descriptions are not
+            // necessarily static, they may be released before the trace is
+            // written.
+            //
+            // Tasks usually share a handful of description strings, the
+            // copies are looked up by the address of the description first.
+            // The contents are compared only if the address is not cached,
+            // which assumes that the memory of a description is not reused
+            // for a different one while tracing.
+            HPX_FORCEINLINE char const* intern_description(
+                char const* desc) noexcept
+            {
+                // Fibonacci hashing, string literals may be packed densely
+                std::uint64_t const h =
+                    static_cast<std::uint64_t>(
+                        reinterpret_cast<std::uintptr_t>(desc)) *
+                    0x9e3779b97f4a7c15ull;
+                description_cache_entry& entry =
+                    description_cache_[h >> (64 - description_cache_bits)];
+                if (entry.desc == desc)
+                {
+                    return entry.copy;
+                }
+                return intern_description_slow(desc, entry);
+            }
+
+        private:
+            struct description_cache_entry
+            {
+                char const* desc = nullptr;
+                char const* copy = nullptr;
+            };
+
+            static constexpr std::size_t description_cache_bits = 6;
+            static constexpr std::size_t description_cache_size =
+                std::size_t(1) << description_cache_bits;
+
+            char const* intern_description_slow(
+                char const* desc, description_cache_entry& entry) noexcept;
+
+            std::unique_ptr<task_trace_event[]> events_;
+            std::uint64_t mask_;
+            std::atomic<std::uint64_t> head_;
+
+            // accessed by the owning worker thread only, the copies are
+            // never released while the buffer is alive
+            description_cache_entry description_cache_[description_cache_size];
+            std::unordered_map<std::string_view, std::unique_ptr<char[]>>
+                descriptions_;
+        };
+
+        // Record that the given task starts running on the worker thread
+        // owning the buffer.
+        HPX_FORCEINLINE void trace_task_start(
+            task_trace_buffer& buffer, thread_data const* thrdptr) noexcept
+        {
+#if defined(HPX_HAVE_THREAD_DESCRIPTION)
+            thread_description const desc = thrdptr->get_description();
+            if (desc.kind() == thread_description::data_type::description)
+            {
+                buffer.record(task_trace_event_type::start, thrdptr,
+                    reinterpret_cast<std::uint64_t>(
+                        buffer.intern_description(desc.get_description())),
+                    thrdptr->get_thread_phase(),
+                    task_trace_data_is_description);
+                return;
+            }
+            buffer.record(task_trace_event_type::start, thrdptr,
+                desc.get_address(), thrdptr->get_thread_phase());
+#else
+            buffer.record(task_trace_event_type::start, thrdptr, 0,
+                thrdptr->get_thread_phase());
+#endif
+        }
+
+        // Return the trace buffer for the given worker thread, or nullptr
+        // if tracing is disabled. This also makes the returned buffer the
+        // one used for events recorded by the calling OS thread.
+        HPX_CORE_EXPORT task_trace_buffer* get_task_trace_buffer(
+            std::size_t global_thread_num) noexcept;
+
+        // Record that the given task was stolen from the worker thread
+        // 'victim' by the calling worker thread.
+        HPX_CORE_EXPORT void trace_task_steal(
+            thread_id_ref_type const& thrd, std::size_t victim) noexcept;
+
+        /// \endcond
+    }    // namespace detail
+}    // namespace hpx::threads
+
+#include <hpx/config/warnings_suffix.hpp>
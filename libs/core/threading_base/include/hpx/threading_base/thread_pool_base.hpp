@@ -16,6 +16,7 @@
 #include <hpx/threading_base/network_background_callback.hpp>
 #include <hpx/threading_base/scheduler_mode.hpp>
 #include <hpx/threading_base/scheduler_state.hpp>
+#include <hpx/threading_base/steal_distance.hpp>
 #include <hpx/threading_base/thread_init_data.hpp>
 #include <hpx/timing/steady_clock.hpp>
 #include <hpx/topology/cpu_mask.hpp>
@@ -397,6 +398,12 @@ namespace hpx::threads {
         {
             return 0;
         }
+        virtual std::int64_t get_num_stolen_by_distance(
+            std::size_t /*thread_num*/, policies::steal_distance /*distance*/,
+            bool /*reset*/)
+        {
+            return 0;
+        }
 #endif
         virtual std::int64_t get_thread_count(thread_schedule_state /*state*/,
             thread_priority /*priority*/, std::size_t /*num_thread*/,
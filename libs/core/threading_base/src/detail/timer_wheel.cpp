@@ -0,0 +1,547 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/threading_base/detail/timer_wheel.hpp>
+#include <hpx/threading_base/set_thread_state.hpp>
+#include <hpx/threading_base/set_thread_state_timed.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace hpx::threads::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    timer_entry::timer_entry(std::chrono::steady_clock::time_point abs_time,
+        thread_id_ref_type thrd, thread_schedule_state newstate,
+        thread_restart_state newstate_ex, thread_priority priority,
+        thread_schedule_hint schedulehint, bool retry_on_active) noexcept
+      : abs_time_(abs_time)
+      , thrd_(HPX_MOVE(thrd))
+      , newstate_(newstate)
+      , newstate_ex_(newstate_ex)
+      , priority_(priority)
+      , schedulehint_(schedulehint)
+      , retry_on_active_(retry_on_active)
+      , state_(state::pending)
+      , count_(1)
+    {
+    }
+
+    timer_entry::~timer_entry() = default;
+
+    bool timer_entry::cancel() noexcept
+    {
+        state expected = state::pending;
+        if (!state_.compare_exchange_strong(
+                expected, state::canceled, std::memory_order_acq_rel))
+        {
+            return false;
+        }
+
+        // no need to keep the thread alive anymore
+        thrd_ = thread_id_ref_type();
+        return true;
+    }
+
+    void timer_entry::fire(thread_restart_state statex) noexcept
+    {
+        state expected = state::pending;
+        if (!state_.compare_exchange_strong(
+                expected, state::fired, std::memory_order_acq_rel))
+        {
+            return;    // the timer was canceled
+        }
+
+        thread_id_ref_type const thrd = HPX_MOVE(thrd_);
+        if (statex == thread_restart_state::abort)
+        {
+            return;
+        }
+
+        error_code ec(throwmode::lightweight);    // do not throw
+        detail::set_thread_state(thrd.noref(), newstate_, newstate_ex_,
+            priority_, schedulehint_, retry_on_active_, ec);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace {
+
+        constexpr std::uint64_t slot_mask = timer_wheel::num_slots - 1;
+
+        std::uint64_t to_ticks(
+            std::chrono::steady_clock::time_point abs_time) noexcept
+        {
+            auto const ns =
+                std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    abs_time.time_since_epoch())
+                    .count();
+            if (ns <= 0)
+            {
+                return 0;
+            }
+
+            // round up, timers may fire late but never early
+            constexpr std::uint64_t tick = std::uint64_t(1)
+                << timer_wheel::tick_bits;
+            return (static_cast<std::uint64_t>(ns) + tick - 1) >>
+                timer_wheel::tick_bits;
+        }
+
+        timer_wheel*& current_timer_wheel() noexcept
+        {
+            thread_local timer_wheel* wheel = nullptr;
+            return wheel;
+        }
+
+        // all existing timer wheels, allowing for worker threads to fire the
+        // expired timers of other worker threads
+        struct timer_wheel_registry
+        {
+            hpx::util::detail::spinlock mtx_;
+            std::vector<timer_wheel*> wheels_;
+
+            // A lower bound of the earliest tick at which polling any of the
+            // wheels may fire a timer. This is lowered whenever a timer is
+            // added and recomputed while holding the lock after polling the
+            // wheels, which allows idle worker threads to skip taking the
+            // lock if no timer is due.
+            std::atomic<std::uint64_t> next_tick_{
+                (std::numeric_limits<std::uint64_t>::max)()};
+        };
+
+        timer_wheel_registry& get_timer_wheel_registry()
+        {
+            static timer_wheel_registry registry;
+            return registry;
+        }
+
+        void lower_next_tick(
+            std::atomic<std::uint64_t>& next_tick, std::uint64_t tick) noexcept
+        {
+            std::uint64_t current = next_tick.load();
+            while (tick < current &&
+                !next_tick.compare_exchange_weak(current, tick))
+            {
+            }
+        }
+
+        std::chrono::steady_clock::time_point from_ticks(
+            std::uint64_t ticks) noexcept
+        {
+            if (ticks >= (std::uint64_t(1) << (63 - timer_wheel::tick_bits)))
+            {
+                return (std::chrono::steady_clock::time_point::max)();
+            }
+            return std::chrono::steady_clock::time_point(
+                std::chrono::duration_cast<
+                    std::chrono::steady_clock::duration>(
+                    std::chrono::nanoseconds(static_cast<std::int64_t>(
+                        ticks << timer_wheel::tick_bits))));
+        }
+    }    // namespace
+
+    timer_wheel::timer_wheel()
+      : slots_()
+      , overflow_(nullptr)
+      , due_(nullptr)
+      , current_tick_(now_ticks())
+      , count_(0)
+      , level_count_()
+      , next_tick_(no_timers)
+    {
+        auto& registry = get_timer_wheel_registry();
+        std::lock_guard<hpx::util::detail::spinlock> l(registry.mtx_);
+        registry.wheels_.push_back(this);
+    }
+
+    timer_wheel::~timer_wheel()
+    {
+        // no other worker thread can access the wheel after this
+        {
+            auto& registry = get_timer_wheel_registry();
+            std::lock_guard<hpx::util::detail::spinlock> l(registry.mtx_);
+            auto const it = std::find(
+                registry.wheels_.begin(), registry.wheels_.end(), this);
+            HPX_ASSERT(it != registry.wheels_.end());
+            registry.wheels_.erase(it);
+            update_next_tick_all();
+        }
+
+        auto hand_over = [](timer_entry* list) {
+            while (list != nullptr)
+            {
+                timer_entry* entry = list;
+                list = list->next_;
+
+                // take over the reference held by the wheel
+                timer_entry_ptr const p(entry, false);
+                if (p->is_pending())
+                {
+                    try
+                    {
+                        schedule_on_timer_service(p);
+                    }
+                    catch (...)
+                    {
+                        // no timer service available, the timer is
+                        // discarded, as it would have been by a timer
+                        // service which has been shut down
+                        p->fire(thread_restart_state::abort);
+                    }
+                }
+            }
+        };
+
+        for (auto& level : slots_)
+        {
+            for (timer_entry*& slot : level)
+            {
+                hand_over(std::exchange(slot, nullptr));
+            }
+        }
+        hand_over(std::exchange(overflow_, nullptr));
+        hand_over(std::exchange(due_, nullptr));
+    }
+
+    std::uint64_t timer_wheel::now_ticks() noexcept
+    {
+        auto const ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch())
+                            .count();
+        return static_cast<std::uint64_t>(ns) >> tick_bits;
+    }
+
+    void timer_wheel::add(timer_entry_ptr entry)
+    {
+        timer_entry* p = entry.detach();
+        p->tick_ = to_ticks(p->abs_time_);
+
+        std::lock_guard<mutex_type> l(mtx_);
+
+        ++count_;
+        if (p->tick_ <= current_tick_)
+        {
+            // already expired, fire on next invocation of poll
+            p->next_ = due_;
+            due_ = p;
+            next_tick_.store(current_tick_);
+        }
+        else
+        {
+            insert(p);
+            if (p->tick_ >= next_tick_.load(std::memory_order_relaxed))
+            {
+                return;
+            }
+            next_tick_.store(p->tick_);
+        }
+
+        // the new next tick has to be stored before the global one is
+        // lowered (see poll_expired)
+        lower_next_tick(get_timer_wheel_registry().next_tick_,
+            next_tick_.load(std::memory_order_relaxed));
+    }
+
+    // Place the given entry into the slot corresponding to its expiration
+    // tick. The entry is expected to expire not before the current tick.
+    void timer_wheel::insert(timer_entry* entry)
+    {
+        std::uint64_t const delta =
+            entry->tick_ > current_tick_ ? entry->tick_ - current_tick_ : 0;
+
+        for (std::size_t level = 0; level != num_levels; ++level)
+        {
+            if (delta < (std::uint64_t(1) << (slot_bits * (level + 1))))
+            {
+                // entries expiring in the current tick end up in the slot
+                // which is processed next
+                std::uint64_t const tick = (std::max)(
+                    entry->tick_, current_tick_);
+                std::size_t const slot = static_cast<std::size_t>(
+                    (tick >> (slot_bits * level)) & slot_mask);
+
+                entry->next_ = slots_[level][slot];
+                slots_[level][slot] = entry;
+                ++level_count_[level];
+                return;
+            }
+        }
+
+        entry->next_ = overflow_;
+        overflow_ = entry;
+    }
+
+    // Move the entries of the slot of the given level corresponding to the
+    // current tick to the lower levels.
+    void timer_wheel::cascade(std::size_t level)
+    {
+        std::size_t const slot = static_cast<std::size_t>(
+            (current_tick_ >> (slot_bits * level)) & slot_mask);
+
+        timer_entry* list = std::exchange(slots_[level][slot], nullptr);
+        while (list != nullptr)
+        {
+            timer_entry* entry = list;
+            list = list->next_;
+
+            --level_count_[level];
+            if (!entry->is_pending())
+            {
+                --count_;
+                intrusive_ptr_release(entry);    // canceled
+                continue;
+            }
+            insert(entry);
+        }
+    }
+
+    // Remove all entries from the given list, adding the ones which are
+    // still pending to the list of expired entries.
+    void timer_wheel::expire(timer_entry* list, timer_entry*& expired)
+    {
+        while (list != nullptr)
+        {
+            timer_entry* entry = list;
+            list = list->next_;
+
+            --count_;
+            if (!entry->is_pending())
+            {
+                intrusive_ptr_release(entry);    // canceled
+                continue;
+            }
+
+            entry->next_ = expired;
+            expired = entry;
+        }
+    }
+
+    std::size_t timer_wheel::poll()
+    {
+        std::unique_lock<mutex_type> l(mtx_);
+        return poll_locked(l);
+    }
+
+    std::size_t timer_wheel::try_poll()
+    {
+        std::unique_lock<mutex_type> l(mtx_, std::try_to_lock);
+        if (!l.owns_lock())
+        {
+            return 0;
+        }
+        return poll_locked(l);
+    }
+
+    // Compute the earliest tick at which the next invocation of poll has to
+    // touch any of the slots. Entries on level n are cascaded whenever the
+    // lower levels wrap around, which happens before any of them expires.
+    void timer_wheel::update_next_tick() noexcept
+    {
+        if (count_ == 0)
+        {
+            next_tick_.store(no_timers, std::memory_order_relaxed);
+            return;
+        }
+
+        std::size_t lowest = 0;
+        while (lowest != num_levels - 1 && level_count_[lowest] == 0)
+        {
+            ++lowest;
+        }
+
+        next_tick_.store(((current_tick_ >> (slot_bits * lowest)) + 1)
+                << (slot_bits * lowest),
+            std::memory_order_relaxed);
+    }
+
+    std::size_t timer_wheel::poll_locked(std::unique_lock<mutex_type>& l)
+    {
+        timer_entry* expired = nullptr;
+        expire(std::exchange(due_, nullptr), expired);
+
+        std::uint64_t const now = now_ticks();
+        while (current_tick_ < now)
+        {
+            if (count_ == 0)
+            {
+                current_tick_ = now;
+                break;
+            }
+
+            // skip ticks for which there is nothing to do: the entries of
+            // a level are touched only whenever all lower levels wrap around
+            std::size_t lowest = 0;
+            while (lowest != num_levels - 1 && level_count_[lowest] == 0)
+            {
+                ++lowest;
+            }
+
+            std::uint64_t const next =
+                ((current_tick_ >> (slot_bits * lowest)) + 1)
+                << (slot_bits * lowest);
+            if (next > now)
+            {
+                current_tick_ = now;
+                break;
+            }
+            current_tick_ = next;
+
+            // cascade the higher levels whenever the lower levels wrap
+            std::size_t level = 1;
+            for (/**/; level != num_levels; ++level)
+            {
+                if (((current_tick_ >> (slot_bits * (level - 1))) &
+                        slot_mask) != 0)
+                {
+                    break;
+                }
+                cascade(level);
+            }
+
+            // revisit timers expiring too far in the future whenever the
+            // top level wraps
+            if (level == num_levels)
+            {
+                timer_entry* list = std::exchange(overflow_, nullptr);
+                while (list != nullptr)
+                {
+                    timer_entry* entry = list;
+                    list = list->next_;
+                    insert(entry);
+                }
+            }
+
+            std::size_t const slot =
+                static_cast<std::size_t>(current_tick_ & slot_mask);
+            timer_entry* list = std::exchange(slots_[0][slot], nullptr);
+            while (list != nullptr)
+            {
+                timer_entry* entry = list;
+                list = list->next_;
+
+                --level_count_[0];
+                --count_;
+                if (!entry->is_pending())
+                {
+                    intrusive_ptr_release(entry);    // canceled
+                    continue;
+                }
+
+                entry->next_ = expired;
+                expired = entry;
+            }
+        }
+
+        update_next_tick();
+
+        // fire the expired timers only after the wheel has been updated
+        l.unlock();
+
+        std::size_t fired = 0;
+        while (expired != nullptr)
+        {
+            timer_entry* entry = expired;
+            expired = expired->next_;
+
+            entry->fire(thread_restart_state::timeout);
+            intrusive_ptr_release(entry);
+            ++fired;
+        }
+        return fired;
+    }
+
+    std::chrono::steady_clock::time_point timer_wheel::next_expiration()
+        const noexcept
+    {
+        return from_ticks(next_tick_.load(std::memory_order_relaxed));
+    }
+
+    std::size_t timer_wheel::poll_expired()
+    {
+        // nothing to do if no timer is due
+        auto& registry = get_timer_wheel_registry();
+        std::uint64_t const now = now_ticks();
+        if (registry.next_tick_.load(std::memory_order_relaxed) > now)
+        {
+            return 0;
+        }
+
+        // some other worker thread is busy doing this already
+        std::unique_lock<hpx::util::detail::spinlock> l(
+            registry.mtx_, std::try_to_lock);
+        if (!l.owns_lock())
+        {
+            return 0;
+        }
+
+        std::size_t fired = 0;
+        for (timer_wheel* wheel : registry.wheels_)
+        {
+            if (wheel->next_tick_.load(std::memory_order_relaxed) <= now)
+            {
+                fired += wheel->try_poll();
+            }
+        }
+
+        update_next_tick_all();
+        return fired;
+    }
+
+    // Recompute the global next tick, the registry has to be locked.
+    void timer_wheel::update_next_tick_all() noexcept
+    {
+        auto& registry = get_timer_wheel_registry();
+
+        std::uint64_t next = no_timers;
+        for (timer_wheel const* wheel : registry.wheels_)
+        {
+            next = (std::min)(
+                next, wheel->next_tick_.load(std::memory_order_relaxed));
+        }
+        registry.next_tick_.store(next);
+
+        // Timers added concurrently may have lowered the global next tick
+        // before it was overwritten above, their wheels have stored the new
+        // next tick before that, though.
+        for (timer_wheel const* wheel : registry.wheels_)
+        {
+            lower_next_tick(registry.next_tick_, wheel->next_tick_.load());
+        }
+    }
+
+    std::chrono::steady_clock::time_point
+    timer_wheel::next_expiration_all() noexcept
+    {
+        return from_ticks(
+            get_timer_wheel_registry().next_tick_.load(
+                std::memory_order_relaxed));
+    }
+
+    timer_wheel* timer_wheel::get_current() noexcept
+    {
+        return current_timer_wheel();
+    }
+
+    timer_wheel::scoped_current::scoped_current(timer_wheel& wheel) noexcept
+      : previous_(std::exchange(current_timer_wheel(), &wheel))
+    {
+    }
+
+    timer_wheel::scoped_current::~scoped_current()
+    {
+        current_timer_wheel() = previous_;
+    }
+}    // namespace hpx::threads::detail
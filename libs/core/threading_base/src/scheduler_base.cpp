@@ -7,6 +7,7 @@
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/execution_base/this_thread.hpp>
+#include <hpx/threading_base/detail/timer_wheel.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
 #include <hpx/threading_base/scheduler_mode.hpp>
 #include <hpx/threading_base/scheduler_state.hpp>
@@ -78,7 +79,8 @@ namespace hpx::threads::policies {
             policies::scheduler_mode::enable_idle_backoff)
         {
             // Put this thread to sleep for some time, additionally it gets
-            // woken up on new work.
+            // woken up on new work. The thread does not sleep past the
+            // expiration of the next pending timer.
 
             idle_backoff_data& data = wait_counts_[num_thread].data_;
 
@@ -94,8 +96,12 @@ namespace hpx::threads::policies {
 
             ++data.wait_count_;
 
+            auto const deadline =
+                (std::min)(std::chrono::steady_clock::now() + period,
+                    threads::detail::timer_wheel::next_expiration_all());
+
             std::unique_lock<pu_mutex_type> l(mtx_);
-            if (cond_.wait_for(l, period) ==    //-V1089
+            if (cond_.wait_until(l, deadline) ==    //-V1089
                 std::cv_status::no_timeout)
             {
                 // reset counter if thread was woken up
@@ -0,0 +1,267 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/hardware/timestamp.hpp>
+#include <hpx/threading_base/task_tracer.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace hpx::threads {
+
+    namespace detail {
+
+        task_trace_buffer::task_trace_buffer(std::size_t size)
+          : mask_(0)
+          , head_(0)
+        {
+            // round up to the next power of two
+            std::uint64_t capacity = 2;
+            while (capacity < size)
+                capacity <<= 1;
+
+            events_.reset(new task_trace_event[capacity]);
+            mask_ = capacity - 1;
+        }
+
+        std::vector<task_trace_event> task_trace_buffer::snapshot() const
+        {
+            std::uint64_t const head = head_.load(std::memory_order_acquire);
+            std::uint64_t const capacity = mask_ + 1;
+            std::uint64_t const first = head > capacity ? head - capacity : 0;
+
+            std::vector<task_trace_event> result;
+            result.reserve(static_cast<std::size_t>(head - first));
+            for (std::uint64_t i = first; i != head; ++i)
+            {
+                result.push_back(events_[i & mask_]);
+            }
+            return result;
+        }
+
+        char const* task_trace_buffer::intern_description_slow(
+            char const* desc, description_cache_entry& entry) noexcept
+        {
+            if (desc == nullptr)
+            {
+                return nullptr;
+            }
+
+            std::string_view const name(desc);
+            auto it = descriptions_.find(name);
+            if (it == descriptions_.end())
+            {
+                try
+                {
+                    std::unique_ptr<char[]> copy(new char[name.size() + 1]);
+                    std::memcpy(copy.get(), name.data(), name.size());
+                    copy[name.size()] = '\0';
+
+                    std::string_view const key(copy.get(), name.size());
+                    it = descriptions_.emplace(key, HPX_MOVE(copy)).first;
+                }
+                catch (...)
+                {
+                    return nullptr;    // record the event without description
+                }
+            }
+
+            entry.desc = desc;
+            entry.copy = it->second.get();
+            return entry.copy;
+        }
+
+        namespace {
+
+            // A pair of corresponding readings of the timestamp counter and
+            // of the steady clock, two of those allow to convert the
+            // recorded timestamps into nanoseconds.
+            struct task_trace_calibration
+            {
+                std::uint64_t timestamp = 0;
+                std::uint64_t time = 0;
+
+                static task_trace_calibration now() noexcept
+                {
+                    task_trace_calibration result;
+                    result.timestamp = util::hardware::timestamp();
+                    result.time = static_cast<std::uint64_t>(
+                        std::chrono::duration_cast<std::chrono::nanoseconds>(
+                            std::chrono::steady_clock::now()
+                                .time_since_epoch())
+                            .count());
+                    return result;
+                }
+            };
+
+            struct task_tracer_data
+            {
+                std::atomic<bool> enabled{false};
+                std::vector<std::unique_ptr<task_trace_buffer>> buffers;
+                task_trace_calibration start;
+            };
+
+            task_tracer_data& get_task_tracer_data()
+            {
+                static task_tracer_data data;
+                return data;
+            }
+
+            task_trace_buffer*& current_task_trace_buffer() noexcept
+            {
+                thread_local task_trace_buffer* buffer = nullptr;
+                return buffer;
+            }
+
+            template <typename T>
+            void write_value(std::ofstream& out, T const& value)
+            {
+                out.write(reinterpret_cast<char const*>(&value), sizeof(T));
+            }
+        }    // namespace
+
+        task_trace_buffer* get_task_trace_buffer(
+            std::size_t global_thread_num) noexcept
+        {
+            task_tracer_data& data = get_task_tracer_data();
+
+            task_trace_buffer* buffer = nullptr;
+            if (data.enabled.load(std::memory_order_acquire) &&
+                global_thread_num < data.buffers.size())
+            {
+                buffer = data.buffers[global_thread_num].get();
+            }
+
+            current_task_trace_buffer() = buffer;
+            return buffer;
+        }
+
+        void trace_task_steal(
+            thread_id_ref_type const& thrd, std::size_t victim) noexcept
+        {
+            if (task_trace_buffer* buffer = current_task_trace_buffer())
+            {
+                buffer->record(task_trace_event_type::steal,
+                    get_thread_id_data(thrd), victim, 0);
+            }
+        }
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    void enable_task_tracing(std::size_t num_workers, std::size_t buffer_size)
+    {
+        detail::task_tracer_data& data = detail::get_task_tracer_data();
+
+        data.enabled.store(false, std::memory_order_relaxed);
+
+        data.buffers.clear();
+        data.buffers.reserve(num_workers);
+        for (std::size_t i = 0; i != num_workers; ++i)
+        {
+            data.buffers.push_back(
+                std::make_unique<detail::task_trace_buffer>(buffer_size));
+        }
+
+        data.start = detail::task_trace_calibration::now();
+        data.enabled.store(true, std::memory_order_release);
+    }
+
+    void disable_task_tracing() noexcept
+    {
+        detail::get_task_tracer_data().enabled.store(
+            false, std::memory_order_release);
+    }
+
+    bool is_task_tracing_enabled() noexcept
+    {
+        return detail::get_task_tracer_data().enabled.load(
+            std::memory_order_relaxed);
+    }
+
+    // The trace file consists of
+    //  - a header: the magic "HPXTRACE", the format version, the number of
+    //    worker threads, and two calibration pairs (timestamp, nanoseconds),
+    //  - for each worker thread: its number, the number of events, and the
+    //    events themselves (see detail::task_trace_event),
+    //  - a string table mapping the description addresses referred to by the
+    //    events to the corresponding strings (the copies owned by the trace
+    //    buffers).
+    // All values are stored using the byte order of the tracing machine.
+    bool write_task_trace(std::string const& filename)
+    {
+        detail::task_tracer_data& data = detail::get_task_tracer_data();
+        if (data.buffers.empty())
+        {
+            return false;
+        }
+
+        std::ofstream out(filename, std::ios::binary | std::ios::trunc);
+        if (!out)
+        {
+            return false;
+        }
+
+        auto const stop = detail::task_trace_calibration::now();
+
+        out.write("HPXTRACE", 8);
+        detail::write_value(out, static_cast<std::uint32_t>(1));
+        detail::write_value(
+            out, static_cast<std::uint32_t>(data.buffers.size()));
+        detail::write_value(out, data.start.timestamp);
+        detail::write_value(out, data.start.time);
+        detail::write_value(out, stop.timestamp);
+        detail::write_value(out, stop.time);
+
+        std::map<std::uint64_t, std::string> descriptions;
+        for (std::size_t i = 0; i != data.buffers.size(); ++i)
+        {
+            std::vector<detail::task_trace_event> const events =
+                data.buffers[i]->snapshot();
+
+            detail::write_value(out, static_cast<std::uint32_t>(i));
+            detail::write_value(out, static_cast<std::uint32_t>(0));
+            detail::write_value(
+                out, static_cast<std::uint64_t>(events.size()));
+            out.write(reinterpret_cast<char const*>(events.data()),
+                static_cast<std::streamsize>(
+                    events.size() * sizeof(detail::task_trace_event)));
+
+            for (auto const& e : events)
+            {
+                if ((e.flags & detail::task_trace_data_is_description) &&
+                    e.data != 0 && descriptions.count(e.data) == 0)
+                {
+                    descriptions.emplace(
+                        e.data, reinterpret_cast<char const*>(e.data));
+                }
+            }
+        }
+
+        detail::write_value(
+            out, static_cast<std::uint64_t>(descriptions.size()));
+        for (auto const& [address, name] : descriptions)
+        {
+            detail::write_value(out, address);
+            detail::write_value(out, static_cast<std::uint32_t>(name.size()));
+            out.write(name.data(), static_cast<std::streamsize>(name.size()));
+        }
+
+        return static_cast<bool>(out);
+    }
+}    // namespace hpx::threads
@@ -546,12 +546,12 @@ namespace hpx::this_thread {
             threads::detail::reset_backtrace bt(id, ec);
 #endif
 
-            std::atomic<bool> timer_started(false);
-            threads::thread_id_ref_type const timer_id =
-                threads::set_thread_state(id.noref(), abs_time, &timer_started,
+            threads::detail::timer_entry_ptr const timer =
+                threads::detail::create_thread_timer(abs_time, id.noref(),
                     threads::thread_schedule_state::pending,
                     threads::thread_restart_state::timeout,
-                    threads::thread_priority::boost, true, ec);
+                    threads::thread_priority::boost,
+                    threads::thread_schedule_hint(), true, ec);
             if (ec)
                 return threads::thread_restart_state::unknown;
 
@@ -582,14 +582,8 @@ namespace hpx::this_thread {
                 HPX_ASSERT(statex == threads::thread_restart_state::abort ||
                     statex == threads::thread_restart_state::signaled);
 
-                error_code ec1(throwmode::lightweight);    // do not throw
-                hpx::util::yield_while<true>(
-                    [&timer_started]() { return !timer_started.load(); },
-                    "set_thread_state_timed");
-                threads::set_thread_state(timer_id.noref(),
-                    threads::thread_schedule_state::pending,
-                    threads::thread_restart_state::abort,
-                    threads::thread_priority::boost, true, ec1);
+                // the timer has not fired yet, cancel it
+                timer->cancel();
             }
         }
 
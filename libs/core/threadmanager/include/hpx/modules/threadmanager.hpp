@@ -16,6 +16,7 @@
 #include <hpx/thread_pools/scheduled_thread_pool.hpp>
 #include <hpx/threading_base/scheduler_mode.hpp>
 #include <hpx/threading_base/scheduler_state.hpp>
+#include <hpx/threading_base/steal_distance.hpp>
 #include <hpx/threading_base/thread_init_data.hpp>
 #include <hpx/threading_base/thread_num_tss.hpp>
 #include <hpx/threading_base/thread_pool_base.hpp>
@@ -277,6 +278,8 @@ namespace hpx::threads {
         std::int64_t get_num_stolen_from_staged(bool reset) const;
         std::int64_t get_num_stolen_to_pending(bool reset) const;
         std::int64_t get_num_stolen_to_staged(bool reset) const;
+        std::int64_t get_num_stolen_by_distance(
+            policies::steal_distance distance, bool reset) const;
 #endif
 
     private:
@@ -22,6 +22,7 @@
 #include <hpx/runtime_configuration/runtime_configuration.hpp>
 #include <hpx/thread_pool_util/thread_pool_suspension_helpers.hpp>
 #include <hpx/thread_pools/scheduled_thread_pool.hpp>
+#include <hpx/threading_base/task_tracer.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_helpers.hpp>
 #include <hpx/threading_base/thread_init_data.hpp>
@@ -657,6 +658,8 @@ namespace hpx::threads {
 
         std::size_t const numa_sensitive = hpx::util::get_entry_as<std::size_t>(
             rtcfg_, "hpx.numa_sensitive", 0);
+        bool const hierarchical_stealing = hpx::util::get_entry_as<int>(rtcfg_,
+            "hpx.thread_queue.hierarchical_stealing", 0) != 0;
 
         policies::thread_queue_init_parameters const thread_queue_init =
             get_init_parameters();
@@ -678,8 +681,12 @@ namespace hpx::threads {
             resource::scheduling_policy const sched_type =
                 rp.which_scheduler(name);
             std::size_t num_threads_in_pool = rp.get_num_threads(i);
-            policies::scheduler_mode const scheduler_mode =
-                rp.get_scheduler_mode(i);
+            policies::scheduler_mode scheduler_mode = rp.get_scheduler_mode(i);
+            if (hierarchical_stealing)
+            {
+                scheduler_mode = scheduler_mode |
+                    policies::scheduler_mode::steal_hierarchical;
+            }
             resource::background_work_function background_work =
                 rp.get_background_work(i);
 
@@ -1463,6 +1470,16 @@ namespace hpx::threads {
             result += pool_iter->get_num_stolen_to_staged(all_threads, reset);
         return result;
     }
+
+    std::int64_t threadmanager::get_num_stolen_by_distance(
+        policies::steal_distance distance, bool reset) const
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result += pool_iter->get_num_stolen_by_distance(
+                all_threads, distance, reset);
+        return result;
+    }
 #endif
 
     ///////////////////////////////////////////////////////////////////////////
@@ -1475,6 +1492,19 @@ namespace hpx::threads {
         auto const& rp = hpx::resource::get_partitioner();
         init_tss(rp.get_num_threads());
 
+        // the task tracer has to be enabled before the worker threads are
+        // started
+        if (!hpx::util::get_entry_as<std::string>(
+                rtcfg_, "hpx.trace.destination", "")
+                 .empty() &&
+            !threads::is_task_tracing_enabled())
+        {
+            LTM_(info).format("run: enabling task tracing");
+            threads::enable_task_tracing(rp.get_num_threads(),
+                hpx::util::get_entry_as<std::size_t>(
+                    rtcfg_, "hpx.trace.buffer_size", 65536));
+        }
+
 #ifdef HPX_HAVE_TIMER_POOL
         LTM_(info).format("run: running timer pool");
         timer_pool_.run(false);
@@ -1517,6 +1547,22 @@ namespace hpx::threads {
         {
             pool_iter->stop(lk, blocking);
         }
+
+        // write the collected task trace, if any
+        if (threads::is_task_tracing_enabled())
+        {
+            threads::disable_task_tracing();
+
+            std::string const destination =
+                hpx::util::get_entry_as<std::string>(
+                    rtcfg_, "hpx.trace.destination", "");
+            if (!destination.empty() &&
+                !threads::write_task_trace(destination))
+            {
+                LTM_(error).format(
+                    "stop: failed to write task trace to: {}", destination);
+            }
+        }
         deinit_tss();
     }
 
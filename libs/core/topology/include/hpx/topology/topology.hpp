@@ -275,6 +275,16 @@ namespace hpx::threads {
         /// Return the size of the cache associated with the given mask.
         std::size_t get_cache_size(mask_cref_type mask, int level) const;
 
+        /// \brief Return a bit mask where each set bit corresponds to a
+        ///        processing unit sharing the cache of the given level with
+        ///        the given thread. Returns the core affinity mask of the
+        ///        thread if no such cache is known to the topology.
+        ///
+        /// \param num_thread [in]
+        /// \param level      [in] the cache level (1 to 5)
+        mask_type get_cache_affinity_mask(
+            std::size_t num_thread, int level) const;
+
         mask_type get_cpubind_mask(error_code& ec = throws) const;
         mask_type get_cpubind_mask(
             std::thread& handle, error_code& ec = throws) const;
@@ -79,6 +79,7 @@ namespace hpx::actions {
         primary_namespace_end_migration_action_id,
         primary_namespace_increment_credit_action_id,
         primary_namespace_resolve_gid_action_id,
+        primary_namespace_resolve_gids_action_id,
         primary_namespace_route_action_id,
         primary_namespace_unbind_gid_action_id,
         primary_namespace_statistics_counter_action_id,
@@ -156,6 +157,8 @@ namespace hpx::actions {
         base_lco_with_value_naming_address_set,
         base_lco_with_value_gva_tuple_get,
         base_lco_with_value_gva_tuple_set,
+        base_lco_with_value_vector_gva_tuple_get,
+        base_lco_with_value_vector_gva_tuple_set,
         base_lco_with_value_std_pair_address_id_type_get,
         base_lco_with_value_std_pair_address_id_type_set,
         base_lco_with_value_std_pair_gid_type_get,
@@ -11,6 +11,9 @@
 
 #include <hpx/config.hpp>
 #include <hpx/agas/agas_fwd.hpp>
+#include <hpx/agas/detail/refcnt_requests_table.hpp>
+#include <hpx/agas/detail/resolve_requests_table.hpp>
+#include <hpx/cache/concurrent_lru_cache.hpp>
 #include <hpx/cache/lru_cache.hpp>
 #include <hpx/cache/statistics/local_full_statistics.hpp>
 #include <hpx/components_base/pinned_ptr.hpp>
@@ -62,17 +65,29 @@ namespace hpx { namespace agas {
 
         using mutex_type = hpx::spinlock;
 
-        // gva cache
+        // gva cache, holds ranges of global ids (entries with a count larger
+        // than one)
         struct gva_cache_key;
 
         using gva_cache_type = hpx::util::cache::lru_cache<gva_cache_key, gva,
             hpx::util::cache::statistics::local_full_statistics>;
 
+        // gva cache for single objects, this is looked up without acquiring
+        // any lock
+        struct gva_object_cache_key;
+        struct gva_object_cache_hash;
+        struct gva_object_cache_entry;
+
+        using gva_object_cache_type =
+            hpx::util::cache::concurrent_lru_cache<gva_object_cache_key,
+                gva_object_cache_entry, gva_object_cache_hash>;
+
         using migrated_objects_table_type = std::set<naming::gid_type>;
-        using refcnt_requests_type = std::map<naming::gid_type, std::int64_t>;
+        using refcnt_requests_type = detail::refcnt_requests_table;
 
         mutable hpx::shared_mutex gva_cache_mtx_;
         std::shared_ptr<gva_cache_type> gva_cache_;
+        std::shared_ptr<gva_object_cache_type> gva_object_cache_;
 
         mutable mutex_type migrated_objects_mtx_;
         migrated_objects_table_type migrated_objects_table_;
@@ -82,11 +97,20 @@ namespace hpx { namespace agas {
 
         std::size_t const max_refcnt_requests_;
 
+        // serializes sending the pending reference count requests
         mutex_type refcnt_requests_mtx_;
-        std::size_t refcnt_requests_count_;
-        bool enable_refcnt_caching_;
+        std::atomic<std::size_t> refcnt_requests_count_;
+        std::atomic<bool> enable_refcnt_caching_;
+
+        refcnt_requests_type refcnt_requests_;
 
-        std::shared_ptr<refcnt_requests_type> refcnt_requests_;
+        // pending resolve requests, grouped by the locality hosting the
+        // responsible primary namespace service instance
+        detail::resolve_requests_table resolve_requests_;
+
+        // statistics of the batched AGAS requests
+        std::atomic<std::int64_t> decref_batch_count_;
+        std::atomic<std::int64_t> decref_batch_requests_;
 
         service_mode const service_type;
         runtime_mode const runtime_type;
@@ -231,9 +255,7 @@ namespace hpx { namespace agas {
         bool was_object_migrated_locked(naming::gid_type const& id);
 
     private:
-        /// Assumes that \a refcnt_requests_mtx_ is locked.
-        void send_refcnt_requests(
-            std::unique_lock<mutex_type>& l, error_code& ec = throws);
+        void send_refcnt_requests(error_code& ec = throws);
 
         /// Assumes that \a refcnt_requests_mtx_ is locked.
         void send_refcnt_requests_non_blocking(
@@ -265,6 +287,13 @@ namespace hpx { namespace agas {
         std::uint64_t get_cache_update_entry_time(bool reset) const;
         std::uint64_t get_cache_erase_entry_time(bool reset) const;
 
+        // Helper functions to access the statistics of batched requests
+        std::int64_t get_resolve_batch_count(bool reset);
+        std::int64_t get_resolve_batch_requests(bool reset);
+        std::int64_t get_resolve_batch_time(bool reset);
+        std::int64_t get_decref_batch_count(bool reset);
+        std::int64_t get_decref_batch_requests(bool reset);
+
     public:
         /// \brief Add a locality to the runtime.
         bool register_locality(parcelset::endpoints_type const& endpoints,
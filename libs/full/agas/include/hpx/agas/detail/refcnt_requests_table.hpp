@@ -0,0 +1,144 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/cache/concurrent_lru_cache.hpp>
+#include <hpx/naming_base/gid_type.hpp>
+#include <hpx/thread_support/spinlock.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace hpx::agas::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The refcnt_requests_table holds the credits of all reference count
+    // requests which were not sent to AGAS yet. The table is split into
+    // independently locked shards, such that concurrent requests referring to
+    // different global ids do not contend on a single lock.
+    class refcnt_requests_table
+    {
+        using map_type = std::unordered_map<naming::gid_type, std::int64_t>;
+
+        struct alignas(threads::get_cache_line_size()) shard
+        {
+            hpx::util::detail::spinlock mtx;
+            map_type requests;
+        };
+
+    public:
+        using value_type = std::pair<naming::gid_type, std::int64_t>;
+        using requests_type = std::vector<value_type>;
+
+        explicit refcnt_requests_table(std::size_t num_shards = 64)
+          : num_shards_(hpx::util::cache::detail::next_power_of_two(
+                num_shards == 0 ? std::size_t(1) : num_shards))
+          , shards_(new shard[num_shards_])
+        {
+        }
+
+        refcnt_requests_table(refcnt_requests_table const&) = delete;
+        refcnt_requests_table(refcnt_requests_table&&) = delete;
+        refcnt_requests_table& operator=(refcnt_requests_table const&) = delete;
+        refcnt_requests_table& operator=(refcnt_requests_table&&) = delete;
+
+        ~refcnt_requests_table() = default;
+
+        // Atomically modify the pending credit of the given id. The function
+        // is invoked with a reference to the pending credit (zero if there
+        // is no pending request for the id). Entries whose credit ends up
+        // being zero are removed from the table.
+        template <typename F>
+        void update(naming::gid_type const& id, F&& f)
+        {
+            shard& s = get_shard(id);
+            std::lock_guard<hpx::util::detail::spinlock> l(s.mtx);
+
+            auto const it = s.requests.find(id);
+            bool const found = it != s.requests.end();
+
+            std::int64_t credit = found ? it->second : 0;
+            f(credit);
+
+            if (found)
+            {
+                if (credit == 0)
+                {
+                    s.requests.erase(it);
+                    size_.fetch_sub(1, std::memory_order_relaxed);
+                }
+                else
+                {
+                    it->second = credit;
+                }
+            }
+            else if (credit != 0)
+            {
+                s.requests.emplace(id, credit);
+                size_.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+
+        // Remove all pending requests from the table and return them.
+        requests_type extract_all()
+        {
+            requests_type result;
+            result.reserve(size_.load(std::memory_order_relaxed));
+
+            for (std::size_t i = 0; i != num_shards_; ++i)
+            {
+                shard& s = shards_[i];
+
+                map_type requests;
+                {
+                    std::lock_guard<hpx::util::detail::spinlock> l(s.mtx);
+                    if (s.requests.empty())
+                    {
+                        continue;
+                    }
+                    requests.swap(s.requests);
+                    size_.fetch_sub(requests.size(), std::memory_order_relaxed);
+                }
+
+                result.insert(result.end(), requests.begin(), requests.end());
+            }
+            return result;
+        }
+
+        // The returned value may be outdated as soon as it is returned if
+        // other threads concurrently modify the table.
+        [[nodiscard]] std::size_t size() const noexcept
+        {
+            return size_.load(std::memory_order_relaxed);
+        }
+
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return size() == 0;
+        }
+
+    private:
+        shard& get_shard(naming::gid_type const& id) const noexcept
+        {
+            std::size_t const h = hpx::util::cache::detail::mix_hash(
+                std::hash<naming::gid_type>()(id));
+            return shards_[h & (num_shards_ - 1)];
+        }
+
+        std::size_t num_shards_;
+        std::unique_ptr<shard[]> shards_;
+        std::atomic<std::size_t> size_{0};
+    };
+}    // namespace hpx::agas::detail
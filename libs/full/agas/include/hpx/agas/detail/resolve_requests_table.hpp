@@ -0,0 +1,277 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/functional/function.hpp>
+#include <hpx/modules/agas_base.hpp>
+#include <hpx/modules/futures.hpp>
+#include <hpx/naming_base/gid_type.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <map>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace hpx::agas::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The resolve_requests_table coalesces concurrent address resolutions
+    // directed to the same (remote) primary namespace instance. A request is
+    // sent right away if no other request to the same locality is in flight.
+    // Otherwise it is queued, and all queued requests are sent as a single
+    // batch as soon as a request in flight has completed or once
+    // max_batch_size requests have been queued. An isolated request is
+    // therefore never delayed, batching kicks in under contention only.
+    //
+    // If a batch fails, all of its ids are resolved separately to make sure
+    // errors are reported for the offending ids only.
+    class resolve_requests_table
+    {
+    public:
+        using resolved_type = primary_namespace::resolved_type;
+
+        using resolve_function =
+            hpx::function<hpx::future<resolved_type>(naming::gid_type const&)>;
+        using resolve_batch_function =
+            hpx::function<hpx::future<std::vector<resolved_type>>(
+                std::uint32_t, std::vector<naming::gid_type>)>;
+
+    private:
+        using mutex_type = hpx::spinlock;
+        using request_type =
+            std::pair<naming::gid_type, hpx::promise<resolved_type>>;
+
+        struct pending_requests
+        {
+            // number of requests (single or batched) currently in flight
+            std::size_t in_flight = 0;
+            std::vector<request_type> requests;
+        };
+
+    public:
+        resolve_requests_table(std::size_t max_batch_size,
+            resolve_function resolve, resolve_batch_function resolve_batch)
+          : max_batch_size_(max_batch_size)
+          , resolve_(HPX_MOVE(resolve))
+          , resolve_batch_(HPX_MOVE(resolve_batch))
+        {
+        }
+
+        resolve_requests_table(resolve_requests_table const&) = delete;
+        resolve_requests_table(resolve_requests_table&&) = delete;
+        resolve_requests_table& operator=(
+            resolve_requests_table const&) = delete;
+        resolve_requests_table& operator=(resolve_requests_table&&) = delete;
+
+        ~resolve_requests_table() = default;
+
+        // Resolving the ids of a single locality in batches requires at least
+        // two requests per batch.
+        [[nodiscard]] bool enabled() const noexcept
+        {
+            return max_batch_size_ > 1;
+        }
+
+        // Resolve the given id, which is managed by the primary namespace
+        // instance on the given locality.
+        hpx::future<resolved_type> resolve(
+            std::uint32_t locality_id, naming::gid_type const& id)
+        {
+            {
+                std::unique_lock<mutex_type> l(mtx_);
+
+                pending_requests& pending = requests_[locality_id];
+                if (pending.in_flight != 0)
+                {
+                    // another request is in flight, queue this one to be sent
+                    // as part of the next batch
+                    hpx::promise<resolved_type> p;
+                    hpx::future<resolved_type> f = p.get_future();
+                    pending.requests.emplace_back(id, HPX_MOVE(p));
+
+                    if (pending.requests.size() >= max_batch_size_)
+                    {
+                        std::vector<request_type> requests;
+                        requests.swap(pending.requests);
+                        ++pending.in_flight;
+
+                        l.unlock();
+                        send_batch(locality_id, HPX_MOVE(requests));
+                    }
+                    return f;
+                }
+                ++pending.in_flight;
+            }
+
+            // no other request is in flight, send this one right away
+            hpx::future<resolved_type> f;
+            try
+            {
+                f = resolve_(id);
+            }
+            catch (...)
+            {
+                completed(locality_id);
+                throw;
+            }
+
+            return f.then(hpx::launch::sync,
+                [this, locality_id](hpx::future<resolved_type>&& f) {
+                    completed(locality_id);
+                    return f.get();
+                });
+        }
+
+        // statistics of the batched requests
+        std::int64_t get_batch_count(bool reset)
+        {
+            return util::get_and_reset_value(batch_count_, reset);
+        }
+
+        std::int64_t get_batch_requests(bool reset)
+        {
+            return util::get_and_reset_value(batch_requests_, reset);
+        }
+
+        std::int64_t get_batch_time(bool reset)
+        {
+            return util::get_and_reset_value(batch_time_, reset);
+        }
+
+    private:
+        // A request in flight to the given locality has completed, send the
+        // requests queued in the meantime (if any).
+        void completed(std::uint32_t locality_id)
+        {
+            std::vector<request_type> requests;
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+
+                pending_requests& pending = requests_[locality_id];
+                HPX_ASSERT(pending.in_flight != 0);
+
+                if (pending.requests.empty())
+                {
+                    --pending.in_flight;
+                    return;
+                }
+
+                // the batch takes over the slot of the completed request
+                requests.swap(pending.requests);
+            }
+
+            send_batch(locality_id, HPX_MOVE(requests));
+        }
+
+        void send_batch(
+            std::uint32_t locality_id, std::vector<request_type> requests)
+        {
+            std::vector<naming::gid_type> ids;
+            ids.reserve(requests.size());
+            for (auto const& request : requests)
+            {
+                ids.push_back(request.first);
+            }
+
+            batch_count_.fetch_add(1, std::memory_order_relaxed);
+            batch_requests_.fetch_add(
+                static_cast<std::int64_t>(requests.size()),
+                std::memory_order_relaxed);
+
+            std::uint64_t const start =
+                hpx::chrono::high_resolution_clock::now();
+
+            auto on_resolved = [this, locality_id, start,
+                                   requests = HPX_MOVE(requests)](
+                                   auto&& f) mutable {
+                batch_time_.fetch_add(
+                    static_cast<std::int64_t>(
+                        hpx::chrono::high_resolution_clock::now() - start),
+                    std::memory_order_relaxed);
+
+                completed(locality_id);
+
+                if (f.has_exception())
+                {
+                    for (auto& request : requests)
+                    {
+                        resolve_unbatched(
+                            request.first, HPX_MOVE(request.second));
+                    }
+                    return;
+                }
+
+                auto results = f.get();
+                HPX_ASSERT(results.size() == requests.size());
+
+                for (std::size_t i = 0; i != requests.size(); ++i)
+                {
+                    requests[i].second.set_value(HPX_MOVE(results[i]));
+                }
+            };
+
+            try
+            {
+                resolve_batch_(locality_id, HPX_MOVE(ids))
+                    .then(hpx::launch::sync, HPX_MOVE(on_resolved));
+            }
+            catch (...)
+            {
+                on_resolved(hpx::make_exceptional_future<
+                    std::vector<resolved_type>>(std::current_exception()));
+            }
+        }
+
+        // resolve a single id, used if a batched request has failed
+        void resolve_unbatched(
+            naming::gid_type const& id, hpx::promise<resolved_type> p)
+        {
+            hpx::future<resolved_type> f;
+            try
+            {
+                f = resolve_(id);
+            }
+            catch (...)
+            {
+                p.set_exception(std::current_exception());
+                return;
+            }
+
+            f.then(hpx::launch::sync,
+                [p = HPX_MOVE(p)](hpx::future<resolved_type>&& f) mutable {
+                    try
+                    {
+                        p.set_value(f.get());
+                    }
+                    catch (...)
+                    {
+                        p.set_exception(std::current_exception());
+                    }
+                });
+        }
+
+        std::size_t const max_batch_size_;
+        resolve_function resolve_;
+        resolve_batch_function resolve_batch_;
+
+        mutex_type mtx_;
+        std::map<std::uint32_t, pending_requests> requests_;
+
+        std::atomic<std::int64_t> batch_count_{0};
+        std::atomic<std::int64_t> batch_requests_{0};
+        std::atomic<std::int64_t> batch_time_{0};
+    };
+}    // namespace hpx::agas::detail
@@ -34,12 +34,15 @@
 #include <hpx/serialization/vector.hpp>
 #include <hpx/synchronization/shared_mutex.hpp>
 #include <hpx/thread_support/unlock_guard.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
 #include <hpx/type_support/assert_owns_lock.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
 #include <hpx/util/get_entry_as.hpp>
 #include <hpx/util/insert_checked.hpp>
 
 #include <cstddef>
 #include <cstdint>
+#include <exception>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -115,14 +118,92 @@ namespace hpx::agas {
         }
     };
 
+    ///////////////////////////////////////////////////////////////////////////
+    // Entries of the object cache have to be trivially copyable as they are
+    // read without holding a lock.
+    struct addressing_service::gva_object_cache_key
+    {
+        std::uint64_t msb = 0;
+        std::uint64_t lsb = 0;
+
+        gva_object_cache_key() = default;
+
+        explicit gva_object_cache_key(naming::gid_type const& id) noexcept
+        {
+            naming::gid_type const gid = naming::detail::get_stripped_gid(id);
+            msb = gid.get_msb();
+            lsb = gid.get_lsb();
+        }
+
+        friend bool operator==(gva_object_cache_key const& lhs,
+            gva_object_cache_key const& rhs) noexcept
+        {
+            return lhs.msb == rhs.msb && lhs.lsb == rhs.lsb;
+        }
+    };
+
+    struct addressing_service::gva_object_cache_hash
+    {
+        std::size_t operator()(gva_object_cache_key const& key) const noexcept
+        {
+            return static_cast<std::size_t>(key.lsb ^ (key.msb << 1));
+        }
+    };
+
+    struct addressing_service::gva_object_cache_entry
+    {
+        std::uint64_t prefix_msb = 0;
+        std::uint64_t prefix_lsb = 0;
+        std::uint64_t count = 0;
+        std::uint64_t lva = 0;
+        std::uint64_t offset = 0;
+        gva::component_type type = 0;
+
+        gva_object_cache_entry() = default;
+
+        explicit gva_object_cache_entry(gva const& g) noexcept
+          : prefix_msb(g.prefix.get_msb())
+          , prefix_lsb(g.prefix.get_lsb())
+          , count(g.count)
+          , lva(reinterpret_cast<std::uint64_t>(g.lva()))
+          , offset(g.offset)
+          , type(g.type)
+        {
+        }
+
+        gva get() const noexcept
+        {
+            return gva(naming::gid_type(prefix_msb, prefix_lsb), type, count,
+                lva, offset);
+        }
+    };
+
     addressing_service::addressing_service(
         util::runtime_configuration const& ini_)
       : gva_cache_(new gva_cache_type)
+      , gva_object_cache_(new gva_object_cache_type)
       , console_cache_(naming::invalid_locality_id)
       , max_refcnt_requests_(ini_.get_agas_max_pending_refcnt_requests())
       , refcnt_requests_count_(0)
       , enable_refcnt_caching_(true)
-      , refcnt_requests_(new refcnt_requests_type)
+      , resolve_requests_(
+            ini_.get_agas_max_resolve_batch_size(),
+            [this](naming::gid_type const& gid)
+                -> hpx::future<primary_namespace::resolved_type> {
+                auto result = primary_ns_.resolve_full(gid);
+                if (result.has_value())
+                {
+                    return hpx::make_ready_future(
+                        HPX_MOVE(result).get_value());
+                }
+                return HPX_MOVE(result).get_future();
+            },
+            [this](std::uint32_t locality_id,
+                std::vector<naming::gid_type> ids) {
+                return primary_ns_.resolve_full(locality_id, HPX_MOVE(ids));
+            })
+      , decref_batch_count_(0)
+      , decref_batch_requests_(0)
       , service_type(ini_.get_agas_service_mode())
       , runtime_type(ini_.mode_)
       , caching_(ini_.get_agas_caching_mode())
@@ -132,7 +213,11 @@ namespace hpx::agas {
       , state_(hpx::state::starting)
     {
         if (caching_)
-            gva_cache_->reserve(ini_.get_agas_local_cache_size());
+        {
+            std::size_t const cache_size = ini_.get_agas_local_cache_size();
+            gva_cache_->reserve(cache_size);
+            gva_object_cache_->reserve(cache_size);
+        }
     }
 
     void addressing_service::bootstrap(
@@ -190,8 +275,10 @@ namespace hpx::agas {
         // create the hierarchy based on the topology
         if (caching_)
         {
-            std::size_t const previous = gva_cache_->size();
+            std::size_t const previous =
+                gva_cache_->size() + gva_object_cache_->size();
             gva_cache_->reserve(cache_size);
+            gva_object_cache_->reserve(cache_size);
 
             LAGAS_(info).format(
                 "addressing_service::adjust_local_cache_size, previous size: "
@@ -1171,6 +1258,24 @@ namespace hpx::agas {
             return naming::address();
         }
 
+        // coalesce concurrent requests for objects managed by a remote
+        // primary namespace instance into batched requests
+        if (resolve_requests_.enabled() &&
+            state_.load(std::memory_order_relaxed) == hpx::state::running)
+        {
+            std::uint32_t const locality_id =
+                naming::get_locality_id_from_gid(gid);
+            if (locality_id != naming::invalid_locality_id &&
+                locality_id !=
+                    naming::get_locality_id_from_gid(get_local_locality()))
+            {
+                return resolve_requests_.resolve(locality_id, gid).then(
+                    hpx::launch::sync, [this, gid](auto&& f) {
+                        return resolve_full_postproc(gid, f.get());
+                    });
+            }
+        }
+
         // ask server
         auto result = primary_ns_.resolve_full(gid);
 
@@ -1376,8 +1481,6 @@ namespace hpx::agas {
 
         HPX_ASSERT(keep_alive != hpx::invalid_id);
 
-        using mapping = refcnt_requests_type::value_type;
-
         // Some examples of calculating the compensated credits below
         //
         //  case   pending   credits   remaining   sent to   compensated
@@ -1388,61 +1491,33 @@ namespace hpx::agas {
         //   3        10        10        0           0        10
         //   4        10        11        0           1        10
 
-        std::pair<naming::gid_type, std::int64_t> pending_incref;
-        bool has_pending_incref = false;
+        std::int64_t pending_incref = 0;
         std::int64_t pending_decrefs = 0;
 
-        {
-            std::lock_guard<mutex_type> l(refcnt_requests_mtx_);
-
-            if (auto const matches = refcnt_requests_->find(raw);
-                matches != refcnt_requests_->end())
-            {
-                pending_decrefs = matches->second;
-                matches->second += credit;
-
-                // Increment requests need to be handled immediately.
+        refcnt_requests_.update(raw, [&](std::int64_t& pending) {
+            pending_decrefs = pending;
+            pending += credit;
 
-                // If the given incref was fully compensated by a pending decref
-                // (i.e. match_data is less than 0) then there is no need to do
-                // anything more.
-                if (matches->second > 0)
-                {
-                    // credit > decrefs (case no 4): store the remaining incref
-                    // to be handled below.
-                    pending_incref = mapping(matches->first, matches->second);
-                    has_pending_incref = true;
+            // Increment requests need to be handled immediately.
 
-                    refcnt_requests_->erase(matches);
-                }
-                else if (matches->second == 0)
-                {
-                    // credit == decref (case no. 3): if the incref offsets any
-                    // pending decref, just remove the pending decref request.
-                    refcnt_requests_->erase(matches);
-                }
-                else
-                {
-                    // credit < decref (case no. 2): do nothing
-                }
-            }
-            else
+            // If the given incref was fully compensated by a pending decref
+            // (i.e. the pending credit is less than or equal to 0) then there
+            // is no need to do anything more (cases no. 2 and 3). Otherwise,
+            // the remaining incref is handled below (cases no. 1 and 4).
+            if (pending > 0)
             {
-                // case no. 1
-                pending_incref = mapping(raw, credit);
-                has_pending_incref = true;
+                pending_incref = pending;
+                pending = 0;
             }
-        }
+        });
 
         // no need to talk to AGAS, acknowledge the incref immediately
-        if (!has_pending_incref)
+        if (pending_incref == 0)
         {
             return pending_decrefs;
         }
 
-        naming::gid_type const e_lower = pending_incref.first;
-        auto result = primary_ns_.increment_credit(
-            pending_incref.second, e_lower, e_lower);
+        auto result = primary_ns_.increment_credit(pending_incref, raw, raw);
 
         // pass the amount of compensated decrefs to the callback
         if (result.has_value())
@@ -1490,35 +1565,11 @@ namespace hpx::agas {
 
         try
         {
-            std::unique_lock<mutex_type> l(refcnt_requests_mtx_);
-
             // Match the decref request with entries in the incref table
-            if (auto const matches = refcnt_requests_->find(raw);
-                matches != refcnt_requests_->end())
-            {
-                matches->second -= credit;
-            }
-            else
-            {
-                using iterator = refcnt_requests_type::iterator;
-                using mapping = refcnt_requests_type::value_type;
-
-                std::pair<iterator, bool> const p =
-                    refcnt_requests_->insert(mapping(raw, -credit));
-
-                if (HPX_UNLIKELY(!p.second))
-                {
-                    l.unlock();
-
-                    HPX_THROWS_IF(ec, hpx::error::bad_parameter,
-                        "addressing_service::decref",
-                        "couldn't insert decref request for {1} ({2})", raw,
-                        credit);
-                    return;
-                }
-            }
+            refcnt_requests_.update(
+                raw, [credit](std::int64_t& pending) { pending -= credit; });
 
-            send_refcnt_requests(l, ec);
+            send_refcnt_requests(ec);
         }
         catch (hpx::exception const& e)
         {
@@ -1749,6 +1800,53 @@ namespace hpx::agas {
 
             gva_cache_key const key(gid, count);
 
+            // single objects are stored in the (lock-free) object cache
+            if (count == 1)
+            {
+                std::unique_lock<hpx::shared_mutex> lock(
+                    gva_cache_mtx_, std::defer_lock);
+
+                // An object must not be cached separately if it is part of a
+                // range held by the range cache. The lock is held while the
+                // object cache is updated to keep a colliding range from
+                // being inserted concurrently.
+                if (range_caching_)
+                {
+                    lock.lock();
+                    if (gva_cache_->holds_key(key))
+                    {
+                        if (LAGAS_ENABLED(warning))
+                        {
+                            // Figure out who we collided with.
+                            addressing_service::gva_cache_key idbase;
+                            addressing_service::gva_cache_type::entry_type e;
+
+                            if (gva_cache_->get_entry(key, idbase, e))
+                            {
+                                LAGAS_(warning).format(
+                                    "addressing_service::update_cache_entry, "
+                                    "aborting update due to key collision in "
+                                    "cache, new_gid({1}), new_count({2}), "
+                                    "old_gid({3}), old_count({4})",
+                                    gid, count, idbase.get_gid(),
+                                    idbase.get_count());
+                            }
+                        }
+
+                        if (&ec != &throws)
+                            ec = make_success_code();
+                        return;
+                    }
+                }
+
+                gva_object_cache_->update(
+                    gva_object_cache_key(gid), gva_object_cache_entry(g));
+
+                if (&ec != &throws)
+                    ec = make_success_code();
+                return;
+            }
+
             {
                 std::unique_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
                 if (!gva_cache_->update_if(key, g, check_for_collisions))
@@ -1778,6 +1876,31 @@ namespace hpx::agas {
                             gid, count, idbase.get_gid(), idbase.get_count());
                     }
                 }
+                else
+                {
+                    // The object cache is looked up first, objects cached
+                    // separately before the range holding them was known
+                    // would shadow the new range. Holding the lock keeps
+                    // such objects from being inserted concurrently.
+                    std::size_t const cached = gva_object_cache_->size();
+                    if (count <= cached)
+                    {
+                        for (std::uint64_t i = 0; i != count; ++i)
+                        {
+                            gva_object_cache_->erase(
+                                gva_object_cache_key(gid + i));
+                        }
+                    }
+                    else if (cached != 0)
+                    {
+                        naming::gid_type const last = gid + (count - 1);
+                        gva_object_cache_->erase([&](auto const& p) {
+                            naming::gid_type const id(
+                                p.first.msb, p.first.lsb);
+                            return gid <= id && id <= last;
+                        });
+                    }
+                }
             }
 
             if (&ec != &throws)
@@ -1801,6 +1924,20 @@ namespace hpx::agas {
         // don't look at cache if gid is marked as non-cache-able
         HPX_ASSERT(naming::detail::store_in_cache(gid));
 
+        if (gva_object_cache_entry e;
+            gva_object_cache_->get_entry(gva_object_cache_key(gid), e))
+        {
+            gva = e.get();
+            idbase = naming::detail::get_stripped_gid(gid);
+            return true;
+        }
+
+        // ranges are cached only if range caching is enabled
+        if (!range_caching_)
+        {
+            return false;
+        }
+
         gva_cache_key const k(gid);
 
         std::unique_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
@@ -1846,6 +1983,8 @@ namespace hpx::agas {
             LAGAS_(warning).format(
                 "addressing_service::clear_cache, clearing cache");
 
+            gva_object_cache_->clear();
+
             std::unique_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
 
             gva_cache_->clear();
@@ -1895,6 +2034,8 @@ namespace hpx::agas {
         {
             LAGAS_(warning).format("addressing_service::remove_cache_entry");
 
+            gva_object_cache_->erase(gva_object_cache_key(gid));
+
             std::unique_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
 
             gva_cache_->erase([&gid](std::pair<gva_cache_key, gva> const& p) {
@@ -1918,7 +2059,7 @@ namespace hpx::agas {
             return;
 
         std::unique_lock<mutex_type> l(refcnt_requests_mtx_);
-        enable_refcnt_caching_ = false;
+        enable_refcnt_caching_.store(false);
         send_refcnt_requests_sync(l, ec);
     }
 
@@ -1927,31 +2068,39 @@ namespace hpx::agas {
     std::uint64_t addressing_service::get_cache_entries(bool /* reset */) const
     {
         std::shared_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
-        return gva_cache_->size();
+        return gva_cache_->size() + gva_object_cache_->size();
     }
 
     std::uint64_t addressing_service::get_cache_hits(bool reset) const
     {
         std::shared_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().hits(reset);
+        return gva_cache_->get_statistics().hits(reset) +
+            gva_object_cache_->hits(reset);
     }
 
     std::uint64_t addressing_service::get_cache_misses(bool reset) const
     {
+        // every miss in the object cache is followed by a lookup in the range
+        // cache if range caching is enabled
         std::shared_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().misses(reset);
+        std::uint64_t const object_misses = gva_object_cache_->misses(reset);
+        std::uint64_t const range_misses =
+            gva_cache_->get_statistics().misses(reset);
+        return range_caching_ ? range_misses : object_misses;
     }
 
     std::uint64_t addressing_service::get_cache_evictions(bool reset) const
     {
         std::shared_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().evictions(reset);
+        return gva_cache_->get_statistics().evictions(reset) +
+            gva_object_cache_->evictions(reset);
     }
 
     std::uint64_t addressing_service::get_cache_insertions(bool reset) const
     {
         std::shared_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().insertions(reset);
+        return gva_cache_->get_statistics().insertions(reset) +
+            gva_object_cache_->insertions(reset);
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -2010,6 +2159,33 @@ namespace hpx::agas {
         return gva_cache_->get_statistics().get_erase_entry_time(reset);
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    // Helper functions to access the statistics of batched requests
+    std::int64_t addressing_service::get_resolve_batch_count(bool reset)
+    {
+        return resolve_requests_.get_batch_count(reset);
+    }
+
+    std::int64_t addressing_service::get_resolve_batch_requests(bool reset)
+    {
+        return resolve_requests_.get_batch_requests(reset);
+    }
+
+    std::int64_t addressing_service::get_resolve_batch_time(bool reset)
+    {
+        return resolve_requests_.get_batch_time(reset);
+    }
+
+    std::int64_t addressing_service::get_decref_batch_count(bool reset)
+    {
+        return util::get_and_reset_value(decref_batch_count_, reset);
+    }
+
+    std::int64_t addressing_service::get_decref_batch_requests(bool reset)
+    {
+        return util::get_and_reset_value(decref_batch_requests_, reset);
+    }
+
     void addressing_service::register_server_instances()
     {
         // register root server
@@ -2039,42 +2215,44 @@ namespace hpx::agas {
         send_refcnt_requests_sync(l, ec);
     }
 
-    void addressing_service::send_refcnt_requests(
-        std::unique_lock<addressing_service::mutex_type>& l, error_code& ec)
+    void addressing_service::send_refcnt_requests(error_code& ec)
     {
-        if (!l.owns_lock())
+        if (!enable_refcnt_caching_.load(std::memory_order_relaxed))
         {
-            HPX_THROWS_IF(ec, hpx::error::lock_error,
-                "addressing_service::send_refcnt_requests",
-                "mutex is not locked");
+            std::unique_lock<mutex_type> l(refcnt_requests_mtx_);
+            send_refcnt_requests_non_blocking(l, ec);
             return;
         }
 
-        if (!enable_refcnt_caching_ ||
-            max_refcnt_requests_ == ++refcnt_requests_count_)
-            send_refcnt_requests_non_blocking(l, ec);
+        if (refcnt_requests_count_.fetch_add(1, std::memory_order_relaxed) +
+                1 >=
+            max_refcnt_requests_)
+        {
+            // no need to compete with a concurrent flush of the requests
+            std::unique_lock<mutex_type> l(
+                refcnt_requests_mtx_, std::try_to_lock);
+            if (l.owns_lock())
+            {
+                send_refcnt_requests_non_blocking(l, ec);
+                return;
+            }
+        }
 
-        else if (&ec != &throws)
+        if (&ec != &throws)
             ec = make_success_code();
     }
 
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
     void dump_refcnt_requests(
-        std::unique_lock<addressing_service::mutex_type>& l,
-        addressing_service::refcnt_requests_type const& requests,
+        addressing_service::refcnt_requests_type::requests_type const& requests,
         char const* func_name)
     {
-        HPX_ASSERT(l.owns_lock());
-
         std::stringstream ss;
         hpx::util::format_to(ss,
             "{1}, dumping client-side refcnt table, requests({2}):", func_name,
             requests.size());
 
-        typedef addressing_service::refcnt_requests_type::const_reference
-            const_reference;
-
-        for (const_reference e : requests)
+        for (auto const& e : requests)
         {
             // The [client] tag is in there to make it easier to filter
             // through the logs.
@@ -2086,6 +2264,33 @@ namespace hpx::agas {
     }
 #endif
 
+    namespace detail {
+
+        // collect all decref requests for each locality
+        using decref_requests_type = std::map<hpx::id_type,
+            std::vector<
+                hpx::tuple<std::int64_t, naming::gid_type, naming::gid_type>>>;
+
+        decref_requests_type group_decref_requests(
+            addressing_service::refcnt_requests_type::requests_type const& p)
+        {
+            decref_requests_type requests;
+            for (auto const& e : p)
+            {
+                HPX_ASSERT(e.second < 0);
+
+                naming::gid_type raw(e.first);
+
+                hpx::id_type target(
+                    primary_namespace::get_service_instance(raw),
+                    hpx::id_type::management_type::unmanaged);
+
+                requests[target].emplace_back(e.second, raw, raw);
+            }
+            return requests;
+        }
+    }    // namespace detail
+
     // 26110: Caller failing to hold lock 'l' before calling function
 #if defined(HPX_MSVC)
 #pragma warning(push)
@@ -2100,47 +2305,33 @@ namespace hpx::agas {
 
         try
         {
-            if (refcnt_requests_->empty())
+            auto const p = refcnt_requests_.extract_all();
+            refcnt_requests_count_.store(0, std::memory_order_relaxed);
+
+            l.unlock();
+
+            if (p.empty())
             {
-                l.unlock();
                 return;
             }
 
-            auto p = std::make_shared<refcnt_requests_type>();
-
-            p.swap(refcnt_requests_);
-            refcnt_requests_count_ = 0;
-
-            l.unlock();
-
             LAGAS_(info).format("addressing_service::send_refcnt_requests_non_"
                                 "blocking, requests({1})",
-                p->size());
+                p.size());
 
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
             if (LAGAS_ENABLED(debug))
-                dump_refcnt_requests(l, *p,
-                    "addressing_service::send_refcnt_requests_non_blocking");
+                dump_refcnt_requests(
+                    p, "addressing_service::send_refcnt_requests_non_blocking");
 #endif
 
-            // collect all requests for each locality
-            using requests_type = std::map<hpx::id_type,
-                std::vector<hpx::tuple<std::int64_t, naming::gid_type,
-                    naming::gid_type>>>;
-            requests_type requests;
-
-            for (refcnt_requests_type::const_reference e : *p)
-            {
-                HPX_ASSERT(e.second < 0);
-
-                naming::gid_type raw(e.first);
+            auto requests = detail::group_decref_requests(p);
 
-                hpx::id_type target(
-                    primary_namespace::get_service_instance(raw),
-                    hpx::id_type::management_type::unmanaged);
-
-                requests[target].emplace_back(e.second, raw, raw);
-            }
+            decref_batch_count_.fetch_add(
+                static_cast<std::int64_t>(requests.size()),
+                std::memory_order_relaxed);
+            decref_batch_requests_.fetch_add(
+                static_cast<std::int64_t>(p.size()), std::memory_order_relaxed);
 
             // send requests to all locality
             auto const end = requests.end();
@@ -2155,7 +2346,8 @@ namespace hpx::agas {
         }
         catch (hpx::exception const& e)
         {
-            l.unlock();
+            if (l.owns_lock())
+                l.unlock();
             HPX_RETHROWS_IF(
                 ec, e, "addressing_service::send_refcnt_requests_non_blocking");
         }
@@ -2171,49 +2363,38 @@ namespace hpx::agas {
 #if !defined(HPX_COMPUTE_DEVICE_CODE)
         HPX_ASSERT_OWNS_LOCK(l);
 
-        if (refcnt_requests_->empty())
+        auto const p = refcnt_requests_.extract_all();
+        refcnt_requests_count_.store(0, std::memory_order_relaxed);
+
+        l.unlock();
+
+        if (p.empty())
         {
-            l.unlock();
             return std::vector<hpx::future<std::vector<std::int64_t>>>();
         }
 
-        auto p = std::make_shared<refcnt_requests_type>();
-
-        p.swap(refcnt_requests_);
-        refcnt_requests_count_ = 0;
-
-        l.unlock();
-
         LAGAS_(info).format(
             "addressing_service::send_refcnt_requests_async, requests({1})",
-            p->size());
+            p.size());
 
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
         if (LAGAS_ENABLED(debug))
             dump_refcnt_requests(
-                l, *p, "addressing_service::send_refcnt_requests_sync");
+                p, "addressing_service::send_refcnt_requests_sync");
 #endif
 
-        // collect all requests for each locality
-        using requests_type = std::map<hpx::id_type,
-            std::vector<
-                hpx::tuple<std::int64_t, naming::gid_type, naming::gid_type>>>;
-        requests_type requests;
-
-        std::vector<hpx::future<std::vector<std::int64_t>>> lazy_results;
-        for (refcnt_requests_type::const_reference e : *p)
-        {
-            HPX_ASSERT(e.second < 0);
+        auto requests = detail::group_decref_requests(p);
 
-            naming::gid_type raw(e.first);
-
-            hpx::id_type target(primary_namespace::get_service_instance(raw),
-                hpx::id_type::management_type::unmanaged);
-
-            requests[target].emplace_back(e.second, raw, raw);
-        }
+        decref_batch_count_.fetch_add(
+            static_cast<std::int64_t>(requests.size()),
+            std::memory_order_relaxed);
+        decref_batch_requests_.fetch_add(
+            static_cast<std::int64_t>(p.size()), std::memory_order_relaxed);
 
         // send requests to all locality
+        std::vector<hpx::future<std::vector<std::int64_t>>> lazy_results;
+        lazy_results.reserve(requests.size());
+
         auto const end = requests.end();
         for (auto it = requests.begin(); it != end; ++it)
         {
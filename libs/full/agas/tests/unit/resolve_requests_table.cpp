@@ -0,0 +1,283 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that address resolutions are sent right away if there is no other
+// request in flight for the same locality, that concurrent requests are
+// combined into batches, and that the ids of a failed batch are resolved
+// individually.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/agas/detail/resolve_requests_table.hpp>
+#include <hpx/hpx_main.hpp>
+#include <hpx/modules/futures.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+using hpx::agas::detail::resolve_requests_table;
+using resolved_type = resolve_requests_table::resolved_type;
+
+///////////////////////////////////////////////////////////////////////////////
+// Records all requests sent by the table, the test decides when (and how)
+// the requests complete.
+struct requests_recorder
+{
+    struct single_request
+    {
+        hpx::naming::gid_type id;
+        hpx::promise<resolved_type> p;
+    };
+
+    struct batch_request
+    {
+        std::uint32_t locality_id = 0;
+        std::vector<hpx::naming::gid_type> ids;
+        hpx::promise<std::vector<resolved_type>> p;
+    };
+
+    resolve_requests_table make_table(std::size_t max_batch_size)
+    {
+        return resolve_requests_table(
+            max_batch_size,
+            [this](hpx::naming::gid_type const& id) {
+                single_request& r = singles.emplace_back();
+                r.id = id;
+                return r.p.get_future();
+            },
+            [this](std::uint32_t locality_id,
+                std::vector<hpx::naming::gid_type> ids) {
+                batch_request& r = batches.emplace_back();
+                r.locality_id = locality_id;
+                r.ids = std::move(ids);
+                return r.p.get_future();
+            });
+    }
+
+    void complete_single(std::size_t i)
+    {
+        singles[i].p.set_value(resolve(singles[i].id));
+    }
+
+    void fail_single(std::size_t i)
+    {
+        singles[i].p.set_exception(
+            std::make_exception_ptr(std::runtime_error("single failed")));
+    }
+
+    void complete_batch(std::size_t i)
+    {
+        std::vector<resolved_type> results;
+        for (auto const& id : batches[i].ids)
+        {
+            results.push_back(resolve(id));
+        }
+        batches[i].p.set_value(std::move(results));
+    }
+
+    void fail_batch(std::size_t i)
+    {
+        batches[i].p.set_exception(
+            std::make_exception_ptr(std::runtime_error("batch failed")));
+    }
+
+    static resolved_type resolve(hpx::naming::gid_type const& id)
+    {
+        return resolved_type(id, hpx::agas::gva(), id);
+    }
+
+    // completing a request may send new ones, std::deque keeps the
+    // references to the recorded requests valid
+    std::deque<single_request> singles;
+    std::deque<batch_request> batches;
+};
+
+hpx::naming::gid_type make_id(std::uint64_t lsb)
+{
+    return hpx::naming::gid_type(0, lsb);
+}
+
+bool is_resolved(hpx::future<resolved_type>& f, std::uint64_t lsb)
+{
+    return f.is_ready() && !f.has_exception() &&
+        hpx::get<0>(f.get()) == make_id(lsb);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Requests are not batched unless another request is in flight.
+void test_no_contention()
+{
+    requests_recorder r;
+    resolve_requests_table table = r.make_table(16);
+
+    for (std::uint64_t i = 1; i != 4; ++i)
+    {
+        hpx::future<resolved_type> f = table.resolve(1, make_id(i));
+        HPX_TEST_EQ(r.singles.size(), std::size_t(i));
+        HPX_TEST(!f.is_ready());
+
+        r.complete_single(i - 1);
+        HPX_TEST(is_resolved(f, i));
+    }
+
+    HPX_TEST(r.batches.empty());
+    HPX_TEST_EQ(table.get_batch_count(false), 0);
+}
+
+// Requests issued while another one is in flight are sent as a single batch
+// once the request in flight has completed.
+void test_batched()
+{
+    requests_recorder r;
+    resolve_requests_table table = r.make_table(16);
+
+    hpx::future<resolved_type> f1 = table.resolve(1, make_id(1));
+    hpx::future<resolved_type> f2 = table.resolve(1, make_id(2));
+    hpx::future<resolved_type> f3 = table.resolve(1, make_id(3));
+
+    // requests for other localities are not affected
+    hpx::future<resolved_type> f4 = table.resolve(2, make_id(4));
+
+    HPX_TEST_EQ(r.singles.size(), std::size_t(2));
+    HPX_TEST(r.batches.empty());
+
+    r.complete_single(0);
+    HPX_TEST(is_resolved(f1, 1));
+
+    HPX_TEST_EQ(r.batches.size(), std::size_t(1));
+    HPX_TEST_EQ(r.batches[0].locality_id, std::uint32_t(1));
+    HPX_TEST_EQ(r.batches[0].ids.size(), std::size_t(2));
+    HPX_TEST(!f2.is_ready());
+    HPX_TEST(!f3.is_ready());
+
+    // new requests wait for the batch in flight
+    hpx::future<resolved_type> f5 = table.resolve(1, make_id(5));
+    HPX_TEST_EQ(r.singles.size(), std::size_t(2));
+
+    r.complete_batch(0);
+    HPX_TEST(is_resolved(f2, 2));
+    HPX_TEST(is_resolved(f3, 3));
+
+    HPX_TEST_EQ(r.batches.size(), std::size_t(2));
+    HPX_TEST_EQ(r.batches[1].ids.size(), std::size_t(1));
+
+    r.complete_batch(1);
+    HPX_TEST(is_resolved(f5, 5));
+
+    r.complete_single(1);
+    HPX_TEST(is_resolved(f4, 4));
+
+    HPX_TEST_EQ(table.get_batch_count(false), 2);
+    HPX_TEST_EQ(table.get_batch_requests(false), 3);
+
+    // nothing is in flight anymore, the next request is sent right away
+    hpx::future<resolved_type> f6 = table.resolve(1, make_id(6));
+    HPX_TEST_EQ(r.singles.size(), std::size_t(3));
+
+    r.complete_single(2);
+    HPX_TEST(is_resolved(f6, 6));
+    HPX_TEST_EQ(r.batches.size(), std::size_t(2));
+}
+
+// A batch is sent right away once the maximum batch size is reached.
+void test_max_batch_size()
+{
+    requests_recorder r;
+    resolve_requests_table table = r.make_table(2);
+
+    std::vector<hpx::future<resolved_type>> futures;
+    for (std::uint64_t i = 1; i != 6; ++i)
+    {
+        futures.push_back(table.resolve(1, make_id(i)));
+    }
+
+    HPX_TEST_EQ(r.singles.size(), std::size_t(1));
+    HPX_TEST_EQ(r.batches.size(), std::size_t(2));
+    HPX_TEST_EQ(r.batches[0].ids.size(), std::size_t(2));
+    HPX_TEST_EQ(r.batches[1].ids.size(), std::size_t(2));
+
+    r.complete_batch(1);
+    r.complete_batch(0);
+    r.complete_single(0);
+
+    for (std::uint64_t i = 1; i != 6; ++i)
+    {
+        HPX_TEST(is_resolved(futures[i - 1], i));
+    }
+    HPX_TEST_EQ(table.get_batch_count(true), 2);
+    HPX_TEST_EQ(table.get_batch_count(false), 0);
+}
+
+// The ids of a failed batch are resolved individually, errors are reported
+// for the offending ids only.
+void test_failed_batch()
+{
+    requests_recorder r;
+    resolve_requests_table table = r.make_table(16);
+
+    hpx::future<resolved_type> f1 = table.resolve(1, make_id(1));
+    hpx::future<resolved_type> f2 = table.resolve(1, make_id(2));
+    hpx::future<resolved_type> f3 = table.resolve(1, make_id(3));
+
+    r.complete_single(0);
+    HPX_TEST(is_resolved(f1, 1));
+    HPX_TEST_EQ(r.batches.size(), std::size_t(1));
+
+    r.fail_batch(0);
+    HPX_TEST_EQ(r.singles.size(), std::size_t(3));
+    HPX_TEST(r.singles[1].id == make_id(2));
+    HPX_TEST(r.singles[2].id == make_id(3));
+    HPX_TEST(!f2.is_ready());
+    HPX_TEST(!f3.is_ready());
+
+    r.complete_single(1);
+    r.fail_single(2);
+
+    HPX_TEST(is_resolved(f2, 2));
+    HPX_TEST(f3.is_ready() && f3.has_exception());
+
+    // the failed batch does not block subsequent requests
+    hpx::future<resolved_type> f4 = table.resolve(1, make_id(4));
+    HPX_TEST_EQ(r.singles.size(), std::size_t(4));
+
+    r.complete_single(3);
+    HPX_TEST(is_resolved(f4, 4));
+}
+
+// A failed request in flight still sends the requests queued in the meantime.
+void test_failed_single()
+{
+    requests_recorder r;
+    resolve_requests_table table = r.make_table(16);
+
+    hpx::future<resolved_type> f1 = table.resolve(1, make_id(1));
+    hpx::future<resolved_type> f2 = table.resolve(1, make_id(2));
+
+    r.fail_single(0);
+    HPX_TEST(f1.is_ready() && f1.has_exception());
+    HPX_TEST_EQ(r.batches.size(), std::size_t(1));
+
+    r.complete_batch(0);
+    HPX_TEST(is_resolved(f2, 2));
+}
+
+int main()
+{
+    test_no_contention();
+    test_batched();
+    test_max_batch_size();
+    test_failed_batch();
+    test_failed_single();
+
+    return hpx::util::report_errors();
+}
+#endif
@@ -75,6 +75,12 @@ namespace hpx { namespace agas {
         resolved_type resolve_gid(naming::gid_type const& id);
         hpx::future_or_value<resolved_type> resolve_full(naming::gid_type id);
 
+        // resolve all given ids using a single request sent to the service
+        // instance located on the given locality
+        hpx::future<std::vector<resolved_type>> resolve_full(
+            std::uint32_t service_locality_id,
+            std::vector<naming::gid_type> ids);
+
         hpx::future_or_value<id_type> colocate(naming::gid_type id);
 
         naming::address unbind_gid(
@@ -285,6 +285,9 @@ namespace hpx::agas::server {
 
         resolved_type resolve_gid(naming::gid_type const& id);
 
+        std::vector<resolved_type> resolve_gids(
+            std::vector<naming::gid_type> const& ids);
+
         hpx::id_type colocate(naming::gid_type const& id);
 
         naming::address unbind_gid(std::uint64_t count, naming::gid_type id);
@@ -354,6 +357,7 @@ namespace hpx::agas::server {
         HPX_DEFINE_COMPONENT_ACTION(primary_namespace, decrement_credit)
         HPX_DEFINE_COMPONENT_ACTION(primary_namespace, increment_credit)
         HPX_DEFINE_COMPONENT_ACTION(primary_namespace, resolve_gid)
+        HPX_DEFINE_COMPONENT_ACTION(primary_namespace, resolve_gids)
         HPX_DEFINE_COMPONENT_ACTION(primary_namespace, unbind_gid)
 #if defined(HPX_HAVE_NETWORKING)
         HPX_DEFINE_COMPONENT_ACTION(primary_namespace, route)
@@ -410,6 +414,13 @@ HPX_REGISTER_ACTION_DECLARATION(
     hpx::agas::server::primary_namespace::resolve_gid_action,
     primary_namespace_resolve_gid_action)
 
+HPX_ACTION_USES_MEDIUM_STACK(
+    hpx::agas::server::primary_namespace::resolve_gids_action)
+
+HPX_REGISTER_ACTION_DECLARATION(
+    hpx::agas::server::primary_namespace::resolve_gids_action,
+    primary_namespace_resolve_gids_action)
+
 HPX_ACTION_USES_MEDIUM_STACK(
     hpx::agas::server::primary_namespace::colocate_action)
 
@@ -437,6 +448,8 @@ HPX_REGISTER_BASE_LCO_WITH_VALUE_DECLARATION(
 typedef hpx::tuple<hpx::naming::gid_type, hpx::agas::gva, hpx::naming::gid_type>
     gva_tuple_type;
 HPX_REGISTER_BASE_LCO_WITH_VALUE_DECLARATION(gva_tuple_type, gva_tuple)
+HPX_REGISTER_BASE_LCO_WITH_VALUE_DECLARATION(
+    std::vector<gva_tuple_type>, vector_gva_tuple)
 typedef std::pair<hpx::id_type, hpx::naming::address> std_pair_address_id_type;
 HPX_REGISTER_BASE_LCO_WITH_VALUE_DECLARATION(
     std_pair_address_id_type, std_pair_address_id_type)
@@ -61,6 +61,10 @@ HPX_REGISTER_ACTION_ID(primary_namespace::resolve_gid_action,
     primary_namespace_resolve_gid_action,
     hpx::actions::primary_namespace_resolve_gid_action_id)
 
+HPX_REGISTER_ACTION_ID(primary_namespace::resolve_gids_action,
+    primary_namespace_resolve_gids_action,
+    hpx::actions::primary_namespace_resolve_gids_action_id)
+
 HPX_REGISTER_ACTION_ID(primary_namespace::colocate_action,
     primary_namespace_colocate_action,
     hpx::actions::primary_namespace_colocate_action_id)
@@ -81,6 +85,10 @@ HPX_REGISTER_BASE_LCO_WITH_VALUE_ID(hpx::naming::address, naming_address,
 HPX_REGISTER_BASE_LCO_WITH_VALUE_ID(gva_tuple_type, gva_tuple,
     hpx::actions::base_lco_with_value_gva_tuple_get,
     hpx::actions::base_lco_with_value_gva_tuple_set)
+HPX_REGISTER_BASE_LCO_WITH_VALUE_ID(std::vector<gva_tuple_type>,
+    vector_gva_tuple,
+    hpx::actions::base_lco_with_value_vector_gva_tuple_get,
+    hpx::actions::base_lco_with_value_vector_gva_tuple_set)
 HPX_REGISTER_BASE_LCO_WITH_VALUE_ID(std_pair_address_id_type,
     std_pair_address_id_type,
     hpx::actions::base_lco_with_value_std_pair_address_id_type_get,
@@ -259,6 +267,28 @@ namespace hpx { namespace agas {
 #endif
     }
 
+    hpx::future<std::vector<primary_namespace::resolved_type>>
+    primary_namespace::resolve_full(
+        std::uint32_t service_locality_id, std::vector<naming::gid_type> ids)
+    {
+        if (service_locality_id == agas::get_locality_id())
+        {
+            return hpx::make_ready_future(server_->resolve_gids(ids));
+        }
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+        hpx::id_type dest =
+            hpx::id_type(get_service_instance(service_locality_id),
+                hpx::id_type::management_type::unmanaged);
+
+        server::primary_namespace::resolve_gids_action action;
+        return hpx::async(action, HPX_MOVE(dest), HPX_MOVE(ids));
+#else
+        HPX_ASSERT(false);
+        return hpx::make_ready_future(std::vector<resolved_type>{});
+#endif
+    }
+
     hpx::future_or_value<id_type> primary_namespace::colocate(
         naming::gid_type id)
     {
@@ -445,6 +445,19 @@ namespace hpx::agas::server {
         return r;
     }    // }}}
 
+    std::vector<primary_namespace::resolved_type>
+    primary_namespace::resolve_gids(std::vector<naming::gid_type> const& ids)
+    {
+        std::vector<resolved_type> result;
+        result.reserve(ids.size());
+
+        for (naming::gid_type const& id : ids)
+        {
+            result.push_back(resolve_gid(id));
+        }
+        return result;
+    }
+
     hpx::id_type primary_namespace::colocate(naming::gid_type const& id)
     {
         return {hpx::get<2>(resolve_gid(id)),
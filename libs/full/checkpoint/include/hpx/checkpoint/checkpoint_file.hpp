@@ -0,0 +1,419 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// This header defines checkpoint_file, a checkpoint stored in a memory mapped
+/// file, and the save_checkpoint and restore_checkpoint overloads operating on
+/// it. The objects are serialized directly into the mapped file (or chunk by
+/// chunk, in incremental mode) instead of into an in-memory byte stream,
+/// writing the file back to disk happens in the background.
+
+/// \file hpx/checkpoint/checkpoint_file.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/async_distributed/dataflow.hpp>
+#include <hpx/checkpoint/checkpoint.hpp>
+#include <hpx/checkpoint_base/checkpoint_data.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/futures/promise.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/traits/serialization_access_data.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::util {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Forward declarations
+    class checkpoint_file;
+
+    namespace detail {
+
+        class mapped_file;
+        struct save_file_funct_obj;
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// The way a checkpoint_file stores the serialized data.
+    enum class checkpoint_file_mode : std::uint8_t
+    {
+        /// Every checkpoint writes all of its data to the file.
+        full,
+
+        /// The serialized data is split into chunks of a fixed size. Only
+        /// chunks whose content hash differs from the one of the same chunk
+        /// of the previous checkpoint are written to the file.
+        incremental
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Checkpoint File Object
+    ///
+    /// A checkpoint_file stores a checkpoint in a memory mapped file. Each
+    /// call to save_checkpoint replaces the checkpoint held by the file and
+    /// restore_checkpoint deserializes the objects directly from the mapped
+    /// file. Pages of the file are read only once they are accessed during
+    /// deserialization, the file is never copied into memory as a whole.
+    ///
+    /// The file stays mapped for the lifetime of the checkpoint_file and may
+    /// be used for any number of subsequent checkpoints. Opening an existing
+    /// checkpoint file allows to restore the checkpoint it contains and, in
+    /// incremental mode, to continue to write only the changed chunks.
+    ///
+    /// Writing the file back to disk is done on a separate operating system
+    /// thread. The next checkpoint is started only after the previous one has
+    /// been written. A checkpoint_file must not be used by concurrent calls to
+    /// save_checkpoint or restore_checkpoint.
+    class HPX_EXPORT checkpoint_file
+    {
+    public:
+        static constexpr std::size_t default_chunk_size = 1024 * 1024;
+
+        ///////////////////////////////////////////////////////////////////////
+        /// Open the checkpoint file with the given name, create it if it does
+        /// not exist.
+        ///
+        /// \param path          Name of the file to store the checkpoint in.
+        ///
+        /// \param mode          Whether to write all or only the changed
+        ///                      chunks of the serialized data.
+        ///
+        /// \param chunk_size    Size of the chunks the serialized data is
+        ///                      split into in incremental mode.
+        ///
+        /// \throws hpx::exception (filesystem_error) if the file can't be
+        ///         opened or mapped, (invalid_data) if an existing file is
+        ///         not a checkpoint file.
+        explicit checkpoint_file(std::string path,
+            checkpoint_file_mode mode = checkpoint_file_mode::incremental,
+            std::size_t chunk_size = default_chunk_size);
+
+        checkpoint_file(checkpoint_file const&) = delete;
+        checkpoint_file(checkpoint_file&&) = delete;
+        checkpoint_file& operator=(checkpoint_file const&) = delete;
+        checkpoint_file& operator=(checkpoint_file&&) = delete;
+
+        /// Waits for the last checkpoint to be written to disk.
+        ~checkpoint_file();
+
+        [[nodiscard]] std::string const& path() const noexcept
+        {
+            return path_;
+        }
+
+        [[nodiscard]] checkpoint_file_mode mode() const noexcept
+        {
+            return mode_;
+        }
+
+        [[nodiscard]] std::size_t chunk_size() const noexcept
+        {
+            return chunk_size_;
+        }
+
+        /// Returns the number of bytes of serialized data of the checkpoint
+        /// held by the file.
+        [[nodiscard]] std::size_t size() const noexcept
+        {
+            return size_;
+        }
+
+        /// Returns the number of checkpoints written to the file.
+        [[nodiscard]] std::uint64_t generation() const noexcept
+        {
+            return generation_;
+        }
+
+        /// Returns the number of chunks written by the last checkpoint. In
+        /// incremental mode this is the number of chunks which have changed.
+        [[nodiscard]] std::size_t chunks_written() const noexcept
+        {
+            return chunks_written_;
+        }
+
+        /// Returns whether the file holds a checkpoint which was completely
+        /// written to disk.
+        [[nodiscard]] bool is_valid() const noexcept;
+
+        /// Returns a future which becomes ready once the last checkpoint was
+        /// written to disk.
+        [[nodiscard]] hpx::shared_future<void> flush() const
+        {
+            return flushed_;
+        }
+
+        /// Returns a pointer to the mapped serialized data.
+        [[nodiscard]] char const* data() const noexcept;
+
+    private:
+        friend struct hpx::traits::serialization_access_data<checkpoint_file>;
+        friend struct detail::save_file_funct_obj;
+
+        template <typename T, typename... Ts>
+        friend void restore_checkpoint(
+            checkpoint_file const& f, T& t, Ts&... ts);
+
+        // functions used by the serialization archive
+        void resize(std::size_t count) noexcept
+        {
+            size_ += count;
+        }
+
+        void write(std::size_t current, void const* address, std::size_t count)
+        {
+            // writes are strictly sequential, the window covers either the
+            // whole mapped data region or the chunk currently being staged
+            HPX_ASSERT(current >= window_begin_ && current + count == size_);
+            if (current + count <= window_end_)
+            {
+                std::memcpy(
+                    window_ + (current - window_begin_), address, count);
+                return;
+            }
+            write_slow(current, address, count);
+        }
+
+        void write_slow(
+            std::size_t current, void const* address, std::size_t count);
+
+        // store the given data as the next chunk, if it has changed
+        void commit_chunk(char const* data, std::size_t size);
+
+        // make sure the data region of the file can hold the given number of
+        // bytes
+        void reserve(std::size_t size);
+
+        void begin_save();
+        void end_save(hpx::promise<void>&& flushed);
+        void begin_restore() const;
+
+        // executed on an operating system thread
+        void sync();
+
+        std::string path_;
+        checkpoint_file_mode mode_;
+        std::size_t chunk_size_;
+        std::unique_ptr<detail::mapped_file> file_;
+
+        // offset of the serialized data in the file, a multiple of the page
+        // size
+        std::size_t data_offset_ = 0;
+
+        std::size_t size_ = 0;
+        std::uint64_t generation_ = 0;
+        std::size_t chunks_written_ = 0;
+
+        // the memory the serialization archive currently writes to
+        char* window_ = nullptr;
+        std::size_t window_begin_ = 0;
+        std::size_t window_end_ = 0;
+
+        // chunk hashes of the current and the previous checkpoint
+        std::vector<std::uint64_t> hashes_;
+        std::vector<std::uint64_t> previous_hashes_;
+        std::vector<char> staging_;
+
+        hpx::shared_future<void> flushed_;
+    };
+
+    namespace detail {
+
+        struct save_file_funct_obj
+        {
+            static hpx::shared_future<void> exchange_flushed(
+                checkpoint_file& f, hpx::shared_future<void> flushed) noexcept
+            {
+                return std::exchange(f.flushed_, HPX_MOVE(flushed));
+            }
+
+            template <typename... Ts>
+            void operator()(checkpoint_file* f, hpx::promise<void>&& flushed,
+                hpx::shared_future<void> const& /* previous */,
+                Ts&&... ts) const
+            {
+                try
+                {
+                    f->begin_save();
+                    hpx::util::save_checkpoint_data(*f, HPX_FORWARD(Ts, ts)...);
+                }
+                catch (...)
+                {
+                    flushed.set_exception(std::current_exception());
+                    throw;
+                }
+                f->end_save(HPX_MOVE(flushed));
+            }
+        };
+
+        template <typename Policy, typename T, typename... Ts>
+        hpx::future<void> save_checkpoint_file(
+            Policy&& p, checkpoint_file& f, T&& t, Ts&&... ts)
+        {
+            // the new checkpoint is started once the previous one has been
+            // written to disk
+            hpx::promise<void> flushed;
+            hpx::shared_future<void> previous =
+                save_file_funct_obj::exchange_flushed(
+                    f, flushed.get_future().share());
+
+            return hpx::dataflow(HPX_FORWARD(Policy, p), save_file_funct_obj{},
+                &f, HPX_MOVE(flushed), HPX_MOVE(previous),
+                prepare_client(HPX_FORWARD(T, t)),
+                prepare_client(HPX_FORWARD(Ts, ts))...);
+        }
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Save_checkpoint - Memory mapped file overload
+    ///
+    /// \tparam T            Containers passed to save_checkpoint to be
+    ///                      serialized and placed into the checkpoint file.
+    ///
+    /// \tparam Ts           More containers passed to save_checkpoint
+    ///                      to be serialized and placed into the
+    ///                      checkpoint file.
+    ///
+    /// \param f             The checkpoint file to write to.
+    ///
+    /// \param t             A container to save.
+    ///
+    /// \param ts            Other containers to save.
+    ///
+    /// Save_checkpoint serializes the given objects into the mapped file,
+    /// replacing the checkpoint it held before. Components may be stored by
+    /// passing a shared_ptr to the component or a client instance.
+    ///
+    /// \returns Save_checkpoint returns a future which becomes ready once all
+    ///          objects were serialized, at this point they may be modified
+    ///          again. Use checkpoint_file::flush to wait for the data to be
+    ///          written to disk.
+    template <typename T, typename... Ts>
+    hpx::future<void> save_checkpoint(checkpoint_file& f, T&& t, Ts&&... ts)
+    {
+        return detail::save_checkpoint_file(hpx::launch::async, f,
+            HPX_FORWARD(T, t), HPX_FORWARD(Ts, ts)...);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Save_checkpoint - Memory mapped file & policy overload
+    ///
+    /// \param p             Takes an HPX launch policy. Allows the user
+    ///                      to change the way the function is launched
+    ///                      i.e. async, sync, etc.
+    ///
+    /// \param f             The checkpoint file to write to.
+    ///
+    /// \param t             A container to save.
+    ///
+    /// \param ts            Other containers to save.
+    ///
+    /// \returns Save_checkpoint returns a future which becomes ready once all
+    ///          objects were serialized.
+    template <typename T, typename... Ts>
+    hpx::future<void> save_checkpoint(
+        hpx::launch p, checkpoint_file& f, T&& t, Ts&&... ts)
+    {
+        return detail::save_checkpoint_file(
+            p, f, HPX_FORWARD(T, t), HPX_FORWARD(Ts, ts)...);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Save_checkpoint - Memory mapped file & sync policy overload
+    ///
+    /// \param sync_p        The hpx::launch::sync policy.
+    ///
+    /// \param f             The checkpoint file to write to.
+    ///
+    /// \param t             A container to save.
+    ///
+    /// \param ts            Other containers to save.
+    ///
+    /// Save_checkpoint returns once all objects were serialized, the data is
+    /// written to disk in the background.
+    template <typename T, typename... Ts>
+    void save_checkpoint(hpx::launch::sync_policy sync_p, checkpoint_file& f,
+        T&& t, Ts&&... ts)
+    {
+        detail::save_checkpoint_file(
+            sync_p, f, HPX_FORWARD(T, t), HPX_FORWARD(Ts, ts)...)
+            .get();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Restore_checkpoint - Memory mapped file overload
+    ///
+    /// \tparam T            A container to restore.
+    ///
+    /// \tparam Ts           Other containers to restore.
+    ///
+    /// \param f             The checkpoint file to read from.
+    ///
+    /// \param t             A container to restore.
+    ///
+    /// \param ts            Other containers to restore. Containers
+    ///                      must be in the same order that they were
+    ///                      inserted into the checkpoint.
+    ///
+    /// Restore_checkpoint waits for a pending checkpoint to be written and
+    /// deserializes the objects directly from the mapped file.
+    ///
+    /// \throws hpx::exception (invalid_data) if the file does not hold a
+    ///         complete checkpoint.
+    template <typename T, typename... Ts>
+    void restore_checkpoint(checkpoint_file const& f, T& t, Ts&... ts)
+    {
+        f.begin_restore();
+        hpx::util::restore_checkpoint_data_func(
+            f, detail::restore_impl{}, t, ts...);
+    }
+}    // namespace hpx::util
+
+namespace hpx::traits {
+
+    // A checkpoint_file is used directly as the container of the serialization
+    // archives.
+    template <>
+    struct serialization_access_data<hpx::util::checkpoint_file>
+      : default_serialization_access_data<hpx::util::checkpoint_file>
+    {
+        [[nodiscard]] static std::size_t size(
+            hpx::util::checkpoint_file const& cont) noexcept
+        {
+            return cont.size();
+        }
+
+        static void resize(
+            hpx::util::checkpoint_file& cont, std::size_t count) noexcept
+        {
+            cont.resize(count);
+        }
+
+        static void write(hpx::util::checkpoint_file& cont, std::size_t count,
+            std::size_t current, void const* address)
+        {
+            cont.write(current, address, count);
+        }
+
+        static void read(hpx::util::checkpoint_file const& cont,
+            std::size_t count, std::size_t current, void* address) noexcept
+        {
+            std::memcpy(address, cont.data() + current, count);
+        }
+    };
+}    // namespace hpx::traits
+
+#include <hpx/config/warnings_suffix.hpp>
@@ -0,0 +1,600 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/checkpoint/checkpoint_file.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/futures/promise.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/runtime_local/run_as_os_thread.hpp>
+
+#if defined(HPX_WINDOWS)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+namespace hpx::util {
+
+    namespace detail {
+
+        inline constexpr std::uint64_t checkpoint_file_magic =
+            0x746e696f706b6863;    // "chkpoint"
+        inline constexpr std::uint32_t checkpoint_file_version = 2;
+
+        // The file consists of the header, the serialized data, and (in
+        // incremental mode) the hashes of the chunks of the serialized data.
+        // The serialized data starts at the page following the header, the
+        // hashes start at the first chunk boundary after the data.
+        struct checkpoint_file_header
+        {
+            std::uint64_t magic;
+            std::uint32_t version;
+
+            // set once the checkpoint has been written to disk
+            std::uint32_t complete;
+
+            std::uint64_t data_offset;
+            std::uint64_t chunk_size;
+            std::uint64_t size;
+            std::uint64_t num_hashes;
+            std::uint64_t generation;
+        };
+
+        constexpr std::size_t round_up(
+            std::size_t value, std::size_t alignment) noexcept
+        {
+            return (value + alignment - 1) / alignment * alignment;
+        }
+
+        constexpr std::size_t round_down(
+            std::size_t value, std::size_t alignment) noexcept
+        {
+            return value / alignment * alignment;
+        }
+
+        // Ranges passed to msync and madvise have to start at a page
+        // boundary, views of a file mapping start at a multiple of the
+        // allocation granularity on Windows.
+        std::size_t page_size() noexcept
+        {
+            static std::size_t const size = []() -> std::size_t {
+#if defined(HPX_WINDOWS)
+                SYSTEM_INFO info;
+                ::GetSystemInfo(&info);
+                return info.dwAllocationGranularity;
+#else
+                long const size = ::sysconf(_SC_PAGESIZE);
+                return size > 0 ? static_cast<std::size_t>(size) : 4096;
+#endif
+            }();
+            return size;
+        }
+
+        // A simple multiplicative hash processing eight bytes at a time. It
+        // is used to detect modified chunks only.
+        std::uint64_t hash_chunk(char const* data, std::size_t size) noexcept
+        {
+            constexpr std::uint64_t prime = 0x100000001b3;
+
+            std::uint64_t h = 0xcbf29ce484222325 ^ size;
+            std::size_t i = 0;
+            for (/**/; i + sizeof(std::uint64_t) <= size;
+                 i += sizeof(std::uint64_t))
+            {
+                std::uint64_t word;
+                std::memcpy(&word, data + i, sizeof(std::uint64_t));
+                h = (h ^ word) * prime;
+                h ^= h >> 29;
+            }
+            for (/**/; i != size; ++i)
+            {
+                h = (h ^ static_cast<unsigned char>(data[i])) * prime;
+            }
+            return h ^ (h >> 32);
+        }
+
+        [[noreturn]] void throw_filesystem_error(
+            std::string const& path, char const* what, int error)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::filesystem_error,
+                "checkpoint_file", "{}: {} failed: {}", path, what,
+                std::error_code(error, std::system_category()).message());
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // A file mapped into memory as a whole, resizing the file remaps it.
+        class mapped_file
+        {
+        public:
+            explicit mapped_file(std::string const& path)
+              : path_(path)
+            {
+#if defined(HPX_WINDOWS)
+                file_ = ::CreateFileA(path.c_str(),
+                    GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr,
+                    OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+                if (file_ == INVALID_HANDLE_VALUE)
+                {
+                    throw_filesystem_error(path_, "CreateFile",
+                        static_cast<int>(::GetLastError()));
+                }
+
+                LARGE_INTEGER size;
+                if (!::GetFileSizeEx(file_, &size))
+                {
+                    int const error = static_cast<int>(::GetLastError());
+                    ::CloseHandle(file_);
+                    throw_filesystem_error(path_, "GetFileSizeEx", error);
+                }
+                size_ = static_cast<std::size_t>(size.QuadPart);
+#else
+                fd_ = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+                if (fd_ == -1)
+                {
+                    throw_filesystem_error(path_, "open", errno);
+                }
+
+                struct stat st;
+                if (::fstat(fd_, &st) == -1)
+                {
+                    int const error = errno;
+                    ::close(fd_);
+                    throw_filesystem_error(path_, "fstat", error);
+                }
+                size_ = static_cast<std::size_t>(st.st_size);
+#endif
+                if (size_ != 0)
+                {
+                    try
+                    {
+                        map();
+                    }
+                    catch (...)
+                    {
+                        close();
+                        throw;
+                    }
+                }
+            }
+
+            mapped_file(mapped_file const&) = delete;
+            mapped_file& operator=(mapped_file const&) = delete;
+
+            ~mapped_file()
+            {
+                unmap();
+                close();
+            }
+
+            [[nodiscard]] char* data() const noexcept
+            {
+                return data_;
+            }
+
+            [[nodiscard]] std::size_t size() const noexcept
+            {
+                return size_;
+            }
+
+            void resize(std::size_t size)
+            {
+                unmap();
+#if defined(HPX_WINDOWS)
+                LARGE_INTEGER new_size;
+                new_size.QuadPart = static_cast<LONGLONG>(size);
+                if (!::SetFilePointerEx(
+                        file_, new_size, nullptr, FILE_BEGIN) ||
+                    !::SetEndOfFile(file_))
+                {
+                    throw_filesystem_error(path_, "SetEndOfFile",
+                        static_cast<int>(::GetLastError()));
+                }
+#else
+                if (::ftruncate(fd_, static_cast<off_t>(size)) == -1)
+                {
+                    throw_filesystem_error(path_, "ftruncate", errno);
+                }
+#endif
+                size_ = size;
+                map();
+            }
+
+            // synchronously write the given range of the file back to disk
+            void sync(std::size_t offset, std::size_t count) const
+            {
+                if (count == 0)
+                    return;
+
+                std::size_t const begin = round_down(offset, page_size());
+#if defined(HPX_WINDOWS)
+                if (!::FlushViewOfFile(
+                        data_ + begin, offset + count - begin) ||
+                    !::FlushFileBuffers(file_))
+                {
+                    throw_filesystem_error(path_, "FlushViewOfFile",
+                        static_cast<int>(::GetLastError()));
+                }
+#else
+                if (::msync(data_ + begin, offset + count - begin, MS_SYNC) ==
+                    -1)
+                {
+                    throw_filesystem_error(path_, "msync", errno);
+                }
+#endif
+            }
+
+            // the given range of the file will be read sequentially
+            void advise_sequential(
+                [[maybe_unused]] std::size_t offset,
+                [[maybe_unused]] std::size_t count) const noexcept
+            {
+#if !defined(HPX_WINDOWS)
+                if (count != 0)
+                {
+                    std::size_t const begin = round_down(offset, page_size());
+                    ::posix_madvise(data_ + begin, offset + count - begin,
+                        POSIX_MADV_SEQUENTIAL);
+                }
+#endif
+            }
+
+        private:
+            void map()
+            {
+#if defined(HPX_WINDOWS)
+                mapping_ = ::CreateFileMappingA(
+                    file_, nullptr, PAGE_READWRITE, 0, 0, nullptr);
+                if (mapping_ == nullptr)
+                {
+                    throw_filesystem_error(path_, "CreateFileMapping",
+                        static_cast<int>(::GetLastError()));
+                }
+
+                void* p =
+                    ::MapViewOfFile(mapping_, FILE_MAP_ALL_ACCESS, 0, 0, 0);
+                if (p == nullptr)
+                {
+                    int const error = static_cast<int>(::GetLastError());
+                    ::CloseHandle(mapping_);
+                    mapping_ = nullptr;
+                    throw_filesystem_error(path_, "MapViewOfFile", error);
+                }
+#else
+                void* p = ::mmap(nullptr, size_, PROT_READ | PROT_WRITE,
+                    MAP_SHARED, fd_, 0);
+                if (p == MAP_FAILED)
+                {
+                    throw_filesystem_error(path_, "mmap", errno);
+                }
+#endif
+                data_ = static_cast<char*>(p);
+            }
+
+            void unmap() noexcept
+            {
+                if (data_ == nullptr)
+                    return;
+#if defined(HPX_WINDOWS)
+                ::UnmapViewOfFile(data_);
+                ::CloseHandle(mapping_);
+                mapping_ = nullptr;
+#else
+                ::munmap(data_, size_);
+#endif
+                data_ = nullptr;
+            }
+
+            void close() noexcept
+            {
+#if defined(HPX_WINDOWS)
+                ::CloseHandle(file_);
+#else
+                ::close(fd_);
+#endif
+            }
+
+            std::string path_;
+#if defined(HPX_WINDOWS)
+            HANDLE file_ = INVALID_HANDLE_VALUE;
+            HANDLE mapping_ = nullptr;
+#else
+            int fd_ = -1;
+#endif
+            char* data_ = nullptr;
+            std::size_t size_ = 0;
+        };
+
+        checkpoint_file_header* get_header(mapped_file const& file) noexcept
+        {
+            return reinterpret_cast<checkpoint_file_header*>(file.data());
+        }
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    checkpoint_file::checkpoint_file(
+        std::string path, checkpoint_file_mode mode, std::size_t chunk_size)
+      : path_(HPX_MOVE(path))
+      , mode_(mode)
+      , chunk_size_(detail::round_up(
+            (std::max) (chunk_size, std::size_t(1)), sizeof(std::uint64_t)))
+      , file_(std::make_unique<detail::mapped_file>(path_))
+      , flushed_(hpx::make_ready_future())
+    {
+        if (file_->size() == 0)
+        {
+            // a new file, the header occupies the first page(s)
+            data_offset_ = detail::round_up(
+                sizeof(detail::checkpoint_file_header), detail::page_size());
+            file_->resize(data_offset_);
+
+            detail::checkpoint_file_header* header =
+                detail::get_header(*file_);
+            header->magic = detail::checkpoint_file_magic;
+            header->version = detail::checkpoint_file_version;
+            header->complete = 0;
+            header->data_offset = data_offset_;
+            header->chunk_size = chunk_size_;
+            header->size = 0;
+            header->num_hashes = 0;
+            header->generation = 0;
+            return;
+        }
+
+        detail::checkpoint_file_header const* header =
+            detail::get_header(*file_);
+        if (file_->size() < sizeof(detail::checkpoint_file_header) ||
+            header->magic != detail::checkpoint_file_magic ||
+            header->version != detail::checkpoint_file_version ||
+            header->data_offset < sizeof(detail::checkpoint_file_header) ||
+            header->data_offset > file_->size())
+        {
+            HPX_THROW_EXCEPTION(hpx::error::invalid_data,
+                "checkpoint_file::checkpoint_file",
+                "{}: the file is not a checkpoint file", path_);
+        }
+
+        // the offset of the data depends on the page size of the system
+        // the file was created on
+        data_offset_ = header->data_offset;
+
+        std::size_t const hashes_offset = data_offset_ +
+            detail::round_up(header->size, header->chunk_size);
+        if (header->complete == 0 ||
+            hashes_offset + header->num_hashes * sizeof(std::uint64_t) >
+                file_->size())
+        {
+            // an incomplete checkpoint can't be restored from and has to be
+            // written as a whole
+            return;
+        }
+
+        size_ = header->size;
+        generation_ = header->generation;
+
+        // continue with the hashes of the stored checkpoint if the chunks
+        // are compatible
+        if (header->chunk_size == chunk_size_)
+        {
+            auto const* hashes = reinterpret_cast<std::uint64_t const*>(
+                file_->data() + hashes_offset);
+            hashes_.assign(hashes, hashes + header->num_hashes);
+        }
+    }
+
+    checkpoint_file::~checkpoint_file()
+    {
+        flushed_.wait();
+    }
+
+    bool checkpoint_file::is_valid() const noexcept
+    {
+        return detail::get_header(*file_)->complete != 0;
+    }
+
+    char const* checkpoint_file::data() const noexcept
+    {
+        return file_->data() + data_offset_;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void checkpoint_file::reserve(std::size_t size)
+    {
+        std::size_t const capacity = file_->size() - data_offset_;
+        if (size <= capacity)
+            return;
+
+        // grow the file geometrically to amortize remapping it
+        file_->resize(data_offset_ +
+            detail::round_up((std::max) (size, 2 * capacity), chunk_size_));
+
+        if (mode_ == checkpoint_file_mode::full)
+        {
+            window_ = file_->data() + data_offset_;
+            window_end_ = file_->size() - data_offset_;
+        }
+    }
+
+    void checkpoint_file::commit_chunk(char const* data, std::size_t size)
+    {
+        std::size_t const index = hashes_.size();
+        std::uint64_t const hash = detail::hash_chunk(data, size);
+
+        if (index >= previous_hashes_.size() ||
+            previous_hashes_[index] != hash)
+        {
+            std::size_t const offset = index * chunk_size_;
+            reserve(offset + size);
+            std::memcpy(
+                file_->data() + data_offset_ + offset, data, size);
+            ++chunks_written_;
+        }
+        hashes_.push_back(hash);
+    }
+
+    void checkpoint_file::write_slow(
+        std::size_t current, void const* address, std::size_t count)
+    {
+        if (mode_ == checkpoint_file_mode::full)
+        {
+            reserve(current + count);
+            std::memcpy(window_ + current, address, count);
+            return;
+        }
+
+        char const* data = static_cast<char const*>(address);
+        while (count != 0)
+        {
+            // complete chunks of large writes are not copied to the staging
+            // buffer
+            if (current == window_begin_ && count >= chunk_size_)
+            {
+                commit_chunk(data, chunk_size_);
+            }
+            else
+            {
+                std::size_t const n = (std::min) (count, window_end_ - current);
+                std::memcpy(window_ + (current - window_begin_), data, n);
+                if (current + n != window_end_)
+                {
+                    return;
+                }
+                commit_chunk(window_, chunk_size_);
+                data += n;
+                current += n;
+                count -= n;
+                window_begin_ = current;
+                window_end_ = current + chunk_size_;
+                continue;
+            }
+
+            data += chunk_size_;
+            current += chunk_size_;
+            count -= chunk_size_;
+            window_begin_ = current;
+            window_end_ = current + chunk_size_;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void checkpoint_file::begin_save()
+    {
+        // the file does not hold a valid checkpoint until this one is
+        // written completely, this has to reach the disk before any of the
+        // data of the previous checkpoint is overwritten
+        detail::checkpoint_file_header* header = detail::get_header(*file_);
+        if (header->complete != 0)
+        {
+            header->complete = 0;
+            file_->sync(0, sizeof(detail::checkpoint_file_header));
+        }
+
+        size_ = 0;
+        chunks_written_ = 0;
+        window_begin_ = 0;
+
+        if (mode_ == checkpoint_file_mode::full)
+        {
+            hashes_.clear();
+            window_ = file_->data() + data_offset_;
+            window_end_ = file_->size() - data_offset_;
+        }
+        else
+        {
+            // the hashes of the previous checkpoint describe the content of
+            // the file
+            std::swap(hashes_, previous_hashes_);
+            hashes_.clear();
+
+            staging_.resize(chunk_size_);
+            window_ = staging_.data();
+            window_end_ = chunk_size_;
+        }
+    }
+
+    void checkpoint_file::end_save(hpx::promise<void>&& flushed)
+    {
+        if (mode_ == checkpoint_file_mode::full)
+        {
+            chunks_written_ = (size_ + chunk_size_ - 1) / chunk_size_;
+        }
+        else
+        {
+            if (size_ != window_begin_)
+            {
+                commit_chunk(window_, size_ - window_begin_);
+            }
+
+            // store the hashes behind the data for subsequent checkpoints to
+            // compare with
+            std::size_t const offset = detail::round_up(size_, chunk_size_);
+            std::size_t const count = hashes_.size() * sizeof(std::uint64_t);
+            reserve(offset + count);
+            std::memcpy(file_->data() + data_offset_ + offset,
+                hashes_.data(), count);
+        }
+
+        ++generation_;
+
+        detail::checkpoint_file_header* header = detail::get_header(*file_);
+        header->chunk_size = chunk_size_;
+        header->size = size_;
+        header->num_hashes = hashes_.size();
+        header->generation = generation_;
+
+        hpx::run_as_os_thread([this]() { sync(); })
+            .then(hpx::launch::sync,
+                [flushed = HPX_MOVE(flushed)](hpx::future<void>&& f) mutable {
+                    if (f.has_exception())
+                    {
+                        flushed.set_exception(f.get_exception_ptr());
+                    }
+                    else
+                    {
+                        flushed.set_value();
+                    }
+                });
+    }
+
+    void checkpoint_file::sync()
+    {
+        // write the data before marking the checkpoint as complete
+        detail::checkpoint_file_header* header = detail::get_header(*file_);
+        file_->sync(data_offset_,
+            detail::round_up(size_, chunk_size_) +
+                hashes_.size() * sizeof(std::uint64_t));
+
+        header->complete = 1;
+        file_->sync(0, sizeof(detail::checkpoint_file_header));
+    }
+
+    void checkpoint_file::begin_restore() const
+    {
+        flushed_.wait();
+        if (!is_valid())
+        {
+            HPX_THROW_EXCEPTION(hpx::error::invalid_data,
+                "checkpoint_file::restore_checkpoint",
+                "{}: the file does not hold a complete checkpoint", path_);
+        }
+        file_->advise_sequential(data_offset_, size_);
+    }
+}    // namespace hpx::util
@@ -0,0 +1,237 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// This example tests the functionality of save_checkpoint and
+// restore_checkpoint operating on memory mapped checkpoint files.
+//
+
+#include <hpx/hpx_main.hpp>
+
+#include <hpx/modules/checkpoint.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using hpx::util::checkpoint_file;
+using hpx::util::checkpoint_file_mode;
+using hpx::util::restore_checkpoint;
+using hpx::util::save_checkpoint;
+
+constexpr std::size_t chunk_size = 4096;
+constexpr char const* file_name = "checkpoint_file_test.chk";
+
+void test_checkpoint_file(checkpoint_file_mode mode)
+{
+    std::remove(file_name);
+
+    bool const incremental = mode == checkpoint_file_mode::incremental;
+
+    std::vector<double> values(100000);
+    for (std::size_t i = 0; i != values.size(); ++i)
+    {
+        values[i] = static_cast<double>(i);
+    }
+    std::string str = "I am a string of characters";
+
+    std::size_t num_chunks = 0;
+    {
+        checkpoint_file f(file_name, mode, chunk_size);
+        HPX_TEST(!f.is_valid());
+
+        // test basic functionality
+        save_checkpoint(f, values, str).get();
+        f.flush().get();
+        HPX_TEST(f.is_valid());
+        HPX_TEST_EQ(f.generation(), std::uint64_t(1));
+
+        num_chunks = (f.size() + chunk_size - 1) / chunk_size;
+        HPX_TEST_EQ(f.chunks_written(), num_chunks);
+
+        std::vector<double> values2;
+        std::string str2;
+        restore_checkpoint(f, values2, str2);
+        HPX_TEST(values == values2);
+        HPX_TEST_EQ(str, str2);
+
+        // changing a single value writes a single chunk in incremental mode
+        values[values.size() / 2] = -1.0;
+        save_checkpoint(hpx::launch::sync, f, values, str);
+        HPX_TEST_EQ(f.chunks_written(), incremental ? 1 : num_chunks);
+
+        restore_checkpoint(f, values2, str2);
+        HPX_TEST(values == values2);
+        HPX_TEST_EQ(str, str2);
+
+        // growing and shrinking checkpoints
+        values.resize(150000, 42.0);
+        save_checkpoint(hpx::launch::async, f, values, str).get();
+
+        restore_checkpoint(f, values2, str2);
+        HPX_TEST(values == values2);
+
+        values.resize(1000);
+        str = "I am a different string";
+        save_checkpoint(f, values, str).get();
+
+        restore_checkpoint(f, values2, str2);
+        HPX_TEST(values == values2);
+        HPX_TEST_EQ(str, str2);
+        HPX_TEST_EQ(f.generation(), std::uint64_t(4));
+    }
+
+    // the checkpoint can be restored after reopening the file
+    {
+        checkpoint_file f(file_name, mode, chunk_size);
+        HPX_TEST(f.is_valid());
+        HPX_TEST_EQ(f.generation(), std::uint64_t(4));
+
+        std::vector<double> values2;
+        std::string str2;
+        restore_checkpoint(f, values2, str2);
+        HPX_TEST(values == values2);
+        HPX_TEST_EQ(str, str2);
+
+        // nothing has changed since the last checkpoint
+        save_checkpoint(f, values, str).get();
+        num_chunks = (f.size() + chunk_size - 1) / chunk_size;
+        HPX_TEST_EQ(f.chunks_written(), incremental ? 0 : num_chunks);
+    }
+
+    std::remove(file_name);
+}
+
+// An object whose serialization fails after its data has been written.
+struct interrupting
+{
+    std::vector<double>* values = nullptr;
+
+    template <typename Archive>
+    void serialize(Archive& ar, unsigned)
+    {
+        ar & *values;
+        throw std::runtime_error("interrupted checkpoint");
+    }
+};
+
+// A checkpoint file whose last save was interrupted can't be restored from,
+// even though parts of the previous checkpoint are still in place.
+void test_interrupted_save(checkpoint_file_mode mode)
+{
+    std::remove(file_name);
+
+    std::vector<double> values(100000, 1.0);
+    {
+        checkpoint_file f(file_name, mode, chunk_size);
+        save_checkpoint(f, values).get();
+        f.flush().get();
+        HPX_TEST(f.is_valid());
+
+        // modify the data such that chunks are overwritten in place
+        values[values.size() / 2] = 2.0;
+
+        bool caught_exception = false;
+        try
+        {
+            save_checkpoint(f, interrupting{&values}).get();
+        }
+        catch (...)
+        {
+            caught_exception = true;
+        }
+        HPX_TEST(caught_exception);
+        HPX_TEST(!f.is_valid());
+    }
+
+    {
+        checkpoint_file f(file_name, mode, chunk_size);
+        HPX_TEST(!f.is_valid());
+
+        bool caught_exception = false;
+        try
+        {
+            std::vector<double> values2;
+            restore_checkpoint(f, values2);
+        }
+        catch (hpx::exception const& e)
+        {
+            HPX_TEST_EQ(e.get_error(), hpx::error::invalid_data);
+            caught_exception = true;
+        }
+        HPX_TEST(caught_exception);
+
+        // the file is written as a whole by the next checkpoint
+        save_checkpoint(f, values).get();
+        HPX_TEST_EQ(f.chunks_written(),
+            (f.size() + chunk_size - 1) / chunk_size);
+
+        std::vector<double> values2;
+        restore_checkpoint(f, values2);
+        HPX_TEST(values == values2);
+    }
+
+    std::remove(file_name);
+}
+
+void test_invalid_file()
+{
+    std::remove(file_name);
+
+    // an empty file does not hold a checkpoint
+    {
+        checkpoint_file f(file_name);
+
+        bool caught_exception = false;
+        try
+        {
+            int i = 0;
+            restore_checkpoint(f, i);
+        }
+        catch (hpx::exception const& e)
+        {
+            HPX_TEST_EQ(e.get_error(), hpx::error::invalid_data);
+            caught_exception = true;
+        }
+        HPX_TEST(caught_exception);
+    }
+
+    // files which are not checkpoint files are rejected
+    {
+        std::FILE* file = std::fopen(file_name, "w");
+        std::fputs("not a checkpoint file", file);
+        std::fclose(file);
+
+        bool caught_exception = false;
+        try
+        {
+            checkpoint_file f(file_name);
+        }
+        catch (hpx::exception const& e)
+        {
+            HPX_TEST_EQ(e.get_error(), hpx::error::invalid_data);
+            caught_exception = true;
+        }
+        HPX_TEST(caught_exception);
+    }
+
+    std::remove(file_name);
+}
+
+int main()
+{
+    test_checkpoint_file(checkpoint_file_mode::incremental);
+    test_checkpoint_file(checkpoint_file_mode::full);
+    test_interrupted_save(checkpoint_file_mode::incremental);
+    test_interrupted_save(checkpoint_file_mode::full);
+    test_invalid_file();
+
+    return hpx::util::report_errors();
+}
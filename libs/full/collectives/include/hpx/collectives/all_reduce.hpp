@@ -210,6 +210,69 @@ namespace hpx { namespace collectives {
     decltype(auto) all_reduce(hpx::launch::sync_policy, communicator comm,
         T&& result, F&& op, generation_arg generation,
         this_site_arg this_site = this_site_arg());
+
+    /// AllReduce a set of values from different call sites
+    ///
+    /// This function receives a set of values from all call sites operating on
+    /// the given channel communicator. The values are exchanged using the
+    /// point-to-point channels of the communicator, no central support object
+    /// is involved.
+    ///
+    /// \param  comm        A communicator object returned from
+    ///                     \a create_channel_communicator
+    /// \param  result      The value to transmit to all
+    ///                     participating sites from this call site.
+    /// \param  op          Reduction operation to apply to all values supplied
+    ///                     from all participating sites, it has to be
+    ///                     associative.
+    /// \param  generation  The generational counter identifying the sequence
+    ///                     number of the all_reduce operation performed on the
+    ///                     given communicator. This is optional and needs to be
+    ///                     supplied only if the all_reduce operation on the
+    ///                     given communicator has to be performed more than
+    ///                     once. The generation number (if given) must be a
+    ///                     positive number greater than zero.
+    /// \param  algorithm   The algorithm to use for the operation. This is
+    ///                     optional and defaults to an algorithm selected based
+    ///                     on the number of sites and the size of the values
+    ///                     (see \a select_collective_algorithm). The same
+    ///                     algorithm has to be used on all sites.
+    ///
+    /// \returns    This function returns a future holding the reduced value.
+    ///             It will become ready once the all_reduce operation has been
+    ///             completed.
+    ///
+    template <typename T, typename F>
+    hpx::future<std::decay_t<T>> all_reduce(channel_communicator comm,
+        T&& result, F&& op, generation_arg generation = generation_arg(),
+        collective_algorithm algorithm = collective_algorithm::automatic);
+
+    /// AllReduce a set of values from different call sites
+    ///
+    /// This function receives a set of values from all call sites operating on
+    /// the given channel communicator.
+    ///
+    /// \param  policy      The execution policy specifying synchronous execution.
+    /// \param  comm        A communicator object returned from
+    ///                     \a create_channel_communicator
+    /// \param  result      The value to transmit to all
+    ///                     participating sites from this call site.
+    /// \param  op          Reduction operation to apply to all values supplied
+    ///                     from all participating sites, it has to be
+    ///                     associative.
+    /// \param  generation  The generational counter identifying the sequence
+    ///                     number of the all_reduce operation performed on the
+    ///                     given communicator.
+    /// \param  algorithm   The algorithm to use for the operation.
+    ///
+    /// \returns    This function returns the reduced value. This function
+    ///             executes synchronously and directly returns the result.
+    ///
+    template <typename T, typename F>
+    decltype(auto) all_reduce(hpx::launch::sync_policy,
+        channel_communicator comm, T&& result, F&& op,
+        generation_arg generation = generation_arg(),
+        collective_algorithm algorithm = collective_algorithm::automatic);
 }}    // namespace hpx::collectives
 
 // clang-format on
@@ -223,9 +286,13 @@ namespace hpx { namespace collectives {
 #include <hpx/async_base/launch_policy.hpp>
 #include <hpx/async_distributed/async.hpp>
 #include <hpx/collectives/argument_types.hpp>
+#include <hpx/collectives/channel_communicator.hpp>
+#include <hpx/collectives/collective_algorithm.hpp>
 #include <hpx/collectives/create_communicator.hpp>
+#include <hpx/collectives/detail/collective_algorithms.hpp>
 #include <hpx/components_base/agas_interface.hpp>
 #include <hpx/futures/future.hpp>
+#include <hpx/modules/errors.hpp>
 #include <hpx/parallel/algorithms/reduce.hpp>
 #include <hpx/type_support/unused.hpp>
 
@@ -406,6 +473,49 @@ namespace hpx::collectives {
             HPX_FORWARD(T, local_result), HPX_FORWARD(F, op), this_site)
             .get();
     }
+
+    ////////////////////////////////////////////////////////////////////////////
+    // all_reduce using the point-to-point channels of a channel_communicator
+    template <typename T, typename F>
+    hpx::future<std::decay_t<T>> all_reduce(channel_communicator comm,
+        T&& local_result, F&& op, generation_arg generation = generation_arg(),
+        collective_algorithm algorithm = collective_algorithm::automatic)
+    {
+        using arg_type = std::decay_t<T>;
+
+        if (generation == 0)
+        {
+            return hpx::make_exceptional_future<arg_type>(HPX_GET_EXCEPTION(
+                hpx::error::bad_parameter, "hpx::collectives::all_reduce",
+                "the generation number shouldn't be zero"));
+        }
+
+        return hpx::async([comm = HPX_MOVE(comm),
+                              local_result = HPX_FORWARD(T, local_result),
+                              op = HPX_FORWARD(F, op), generation,
+                              algorithm]() mutable -> arg_type {
+            return detail::all_reduce(
+                comm, HPX_MOVE(local_result), op, generation, algorithm);
+        });
+    }
+
+    template <typename T, typename F>
+    decltype(auto) all_reduce(hpx::launch::sync_policy,
+        channel_communicator comm, T&& local_result, F&& op,
+        generation_arg generation = generation_arg(),
+        collective_algorithm algorithm = collective_algorithm::automatic)
+    {
+        if (generation == 0)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                "hpx::collectives::all_reduce",
+                "the generation number shouldn't be zero");
+        }
+
+        return detail::all_reduce(comm,
+            std::decay_t<T>(HPX_FORWARD(T, local_result)), op, generation,
+            algorithm);
+    }
 }    // namespace hpx::collectives
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -201,6 +201,40 @@ namespace hpx { namespace collectives {
     std::vector<T> all_to_all(hpx::launch::sync_policy, communicator fid,
         std::vector<T>&& local_result, generation_arg generation,
         this_site_arg this_site = this_site_arg());
+
+    /// AllToAll a set of values from different call sites
+    ///
+    /// This function receives a set of values from all call sites operating on
+    /// the given channel communicator. The values are exchanged using the
+    /// point-to-point channels of the communicator, no central support object
+    /// is involved.
+    ///
+    /// \param  comm        A communicator object returned from
+    ///                     \a create_channel_communicator
+    /// \param  result      The values to transmit to all participating sites
+    ///                     from this call site, one for each site.
+    /// \param  generation  The generational counter identifying the sequence
+    ///                     number of the all_to_all operation performed on the
+    ///                     given communicator. This is optional and needs to be
+    ///                     supplied only if the all_to_all operation on the
+    ///                     given communicator has to be performed more than
+    ///                     once. The generation number (if given) must be a
+    ///                     positive number greater than zero.
+    /// \param  algorithm   The algorithm to use for the operation. This is
+    ///                     optional and defaults to an algorithm selected based
+    ///                     on the number of sites and the size of the values
+    ///                     (see \a select_collective_algorithm). The same
+    ///                     algorithm has to be used on all sites.
+    ///
+    /// \returns    This function returns a future holding a vector with all
+    ///             values sent to this site by all participating sites. It
+    ///             will become ready once the all_to_all operation has been
+    ///             completed.
+    ///
+    template <typename T>
+    hpx::future<std::vector<T>> all_to_all(channel_communicator comm,
+        std::vector<T>&& result, generation_arg generation = generation_arg(),
+        collective_algorithm algorithm = collective_algorithm::automatic);
 }}    // namespace hpx::collectives
 
 // clang-format on
@@ -214,9 +248,13 @@ namespace hpx { namespace collectives {
 #include <hpx/async_distributed/async.hpp>
 #include <hpx/async_distributed/sync.hpp>
 #include <hpx/collectives/argument_types.hpp>
+#include <hpx/collectives/channel_communicator.hpp>
+#include <hpx/collectives/collective_algorithm.hpp>
 #include <hpx/collectives/create_communicator.hpp>
+#include <hpx/collectives/detail/collective_algorithms.hpp>
 #include <hpx/components_base/agas_interface.hpp>
 #include <hpx/futures/future.hpp>
+#include <hpx/modules/errors.hpp>
 #include <hpx/type_support/unused.hpp>
 
 #include <cstddef>
@@ -375,6 +413,47 @@ namespace hpx::collectives {
             HPX_MOVE(local_result), this_site)
             .get();
     }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // all_to_all using the point-to-point channels of a channel_communicator
+    template <typename T>
+    hpx::future<std::vector<T>> all_to_all(channel_communicator comm,
+        std::vector<T>&& local_result,
+        generation_arg generation = generation_arg(),
+        collective_algorithm algorithm = collective_algorithm::automatic)
+    {
+        if (generation == 0)
+        {
+            return hpx::make_exceptional_future<std::vector<T>>(
+                HPX_GET_EXCEPTION(hpx::error::bad_parameter,
+                    "hpx::collectives::all_to_all",
+                    "the generation number shouldn't be zero"));
+        }
+
+        return hpx::async(
+            [comm = HPX_MOVE(comm), local_result = HPX_MOVE(local_result),
+                generation, algorithm]() mutable -> std::vector<T> {
+                return detail::all_to_all(
+                    comm, HPX_MOVE(local_result), generation, algorithm);
+            });
+    }
+
+    template <typename T>
+    std::vector<T> all_to_all(hpx::launch::sync_policy,
+        channel_communicator comm, std::vector<T>&& local_result,
+        generation_arg generation = generation_arg(),
+        collective_algorithm algorithm = collective_algorithm::automatic)
+    {
+        if (generation == 0)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                "hpx::collectives::all_to_all",
+                "the generation number shouldn't be zero");
+        }
+
+        return detail::all_to_all(
+            comm, HPX_MOVE(local_result), generation, algorithm);
+    }
 }    // namespace hpx::collectives
 
 ////////////////////////////////////////////////////////////////////////////////
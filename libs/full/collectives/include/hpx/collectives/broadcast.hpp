@@ -376,6 +376,85 @@ namespace hpx { namespace collectives {
     template <typename T>
     T broadcast_from(hpx::launch::sync_policy, communicator comm,
         generation_arg generation, this_site_arg this_site = this_site_arg());
+
+    /// Broadcast a value to different call sites
+    ///
+    /// This function sends a set of values to all call sites operating on
+    /// the given channel communicator. The value is forwarded using the
+    /// point-to-point channels of the communicator, no central support object
+    /// is involved.
+    ///
+    /// \param  comm        A communicator object returned from
+    ///                     \a create_channel_communicator
+    /// \param  local_result A value to transmit to all participating sites
+    ///                     from this call site.
+    /// \param  generation  The generational counter identifying the sequence
+    ///                     number of the broadcast operation performed on the
+    ///                     given communicator. This is optional and needs to be
+    ///                     supplied only if the broadcast operation on the
+    ///                     given communicator has to be performed more than
+    ///                     once. The generation number (if given) must be a
+    ///                     positive number greater than zero.
+    /// \param  algorithm   The algorithm to use for the operation. This is
+    ///                     optional and defaults to an algorithm selected based
+    ///                     on the number of sites (see
+    ///                     \a select_collective_algorithm). The same
+    ///                     algorithm has to be used on all sites.
+    ///
+    /// \returns    This function returns a future that will become
+    ///             ready once the broadcast operation has been completed.
+    ///
+    template <typename T>
+    hpx::future<std::decay_t<T>> broadcast_to(channel_communicator comm,
+        T&& local_result, generation_arg generation = generation_arg(),
+        collective_algorithm algorithm = collective_algorithm::automatic);
+
+    /// Receive a value that was broadcast to different call sites
+    ///
+    /// This function receives a value from the root site operating on the
+    /// given channel communicator.
+    ///
+    /// \param  comm        A communicator object returned from
+    ///                     \a create_channel_communicator
+    /// \param  generation  The generational counter identifying the sequence
+    ///                     number of the broadcast operation performed on the
+    ///                     given communicator.
+    /// \param  root_site   The site that sends the value. This value is
+    ///                     optional and defaults to '0' (zero).
+    /// \param  algorithm   The algorithm to use for the operation.
+    ///
+    /// \returns    This function returns a future holding the value that was
+    ///             sent to all participating sites. It will become
+    ///             ready once the broadcast operation has been completed.
+    ///
+    template <typename T>
+    hpx::future<T> broadcast_from(channel_communicator comm,
+        generation_arg generation = generation_arg(),
+        root_site_arg root_site = root_site_arg(),
+        collective_algorithm algorithm = collective_algorithm::automatic);
+
+    /// Broadcast a value from the root site to all call sites
+    ///
+    /// This function sends the given value from the root site to all call
+    /// sites operating on the given channel communicator. It replaces the
+    /// value on all sites but the root site.
+    ///
+    /// \param  comm        A communicator object returned from
+    ///                     \a create_channel_communicator
+    /// \param  value       The value to send (on the root site), or the value
+    ///                     to receive (on all other sites).
+    /// \param  root_site   The site that sends the value. This value is
+    ///                     optional and defaults to '0' (zero).
+    /// \param  generation  The generational counter identifying the sequence
+    ///                     number of the broadcast operation performed on the
+    ///                     given communicator.
+    /// \param  algorithm   The algorithm to use for the operation.
+    ///
+    template <typename T>
+    void broadcast(channel_communicator comm, T& value,
+        root_site_arg root_site = root_site_arg(),
+        generation_arg generation = generation_arg(),
+        collective_algorithm algorithm = collective_algorithm::automatic);
 }}    // namespace hpx::collectives
 
 // clang-format on
@@ -389,9 +468,13 @@ namespace hpx { namespace collectives {
 #include <hpx/async_base/launch_policy.hpp>
 #include <hpx/async_distributed/async.hpp>
 #include <hpx/collectives/argument_types.hpp>
+#include <hpx/collectives/channel_communicator.hpp>
+#include <hpx/collectives/collective_algorithm.hpp>
 #include <hpx/collectives/create_communicator.hpp>
+#include <hpx/collectives/detail/collective_algorithms.hpp>
 #include <hpx/components_base/agas_interface.hpp>
 #include <hpx/futures/future.hpp>
+#include <hpx/modules/errors.hpp>
 #include <hpx/type_support/unused.hpp>
 
 #include <cstddef>
@@ -666,6 +749,75 @@ namespace hpx::collectives {
                 hpx::launch::sync, HPX_MOVE(fid), this_site, generation);
         }
     }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // broadcast using the point-to-point channels of a channel_communicator
+    template <typename T>
+    hpx::future<std::decay_t<T>> broadcast_to(channel_communicator comm,
+        T&& local_result, generation_arg generation = generation_arg(),
+        collective_algorithm algorithm = collective_algorithm::automatic)
+    {
+        using arg_type = std::decay_t<T>;
+
+        if (generation == 0)
+        {
+            return hpx::make_exceptional_future<arg_type>(HPX_GET_EXCEPTION(
+                hpx::error::bad_parameter, "hpx::collectives::broadcast_to",
+                "the generation number shouldn't be zero"));
+        }
+
+        return hpx::async([comm = HPX_MOVE(comm),
+                              local_result = HPX_FORWARD(T, local_result),
+                              generation, algorithm]() mutable -> arg_type {
+            std::size_t const root = comm.get_info().second;
+            return detail::broadcast(
+                comm, root, HPX_MOVE(local_result), generation, algorithm);
+        });
+    }
+
+    template <typename T>
+    hpx::future<T> broadcast_from(channel_communicator comm,
+        generation_arg generation = generation_arg(),
+        root_site_arg root_site = root_site_arg(),
+        collective_algorithm algorithm = collective_algorithm::automatic)
+    {
+        if (generation == 0)
+        {
+            return hpx::make_exceptional_future<T>(HPX_GET_EXCEPTION(
+                hpx::error::bad_parameter, "hpx::collectives::broadcast_from",
+                "the generation number shouldn't be zero"));
+        }
+
+        return hpx::async(
+            [comm = HPX_MOVE(comm), generation, root_site, algorithm]() -> T {
+                return detail::broadcast(
+                    comm, root_site, T(), generation, algorithm);
+            });
+    }
+
+    template <typename T>
+    void broadcast(channel_communicator comm, T& value,
+        root_site_arg root_site = root_site_arg(),
+        generation_arg generation = generation_arg(),
+        collective_algorithm algorithm = collective_algorithm::automatic)
+    {
+        if (generation == 0)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                "hpx::collectives::broadcast",
+                "the generation number shouldn't be zero");
+        }
+
+        if (comm.get_info().second == root_site)
+        {
+            detail::broadcast(comm, root_site, T(value), generation, algorithm);
+        }
+        else
+        {
+            value = detail::broadcast(
+                comm, root_site, T(), generation, algorithm);
+        }
+    }
 }    // namespace hpx::collectives
 
 ////////////////////////////////////////////////////////////////////////////////
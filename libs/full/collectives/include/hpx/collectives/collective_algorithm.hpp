@@ -0,0 +1,83 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file collective_algorithm.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::collectives {
+
+    /// The algorithms available for the collective operations performed on a
+    /// \a channel_communicator. The ring algorithm is implemented for
+    /// all_to_all, recursive doubling for all_reduce only. Operations that
+    /// don't implement the requested algorithm fall back to the tree (or the
+    /// direct) algorithm.
+    enum class collective_algorithm : std::uint8_t
+    {
+        /// pick the algorithm based on the number of participating sites and
+        /// the type of the exchanged values
+        automatic = 0,
+
+        /// all participants directly talk to each other (or to the root
+        /// site), best for few sites
+        direct = 1,
+
+        /// the data is forwarded along the tree spanned by the communication
+        /// set (see \a create_communication_set), the arity of the tree is
+        /// configured by hpx.lcos.collectives.arity
+        tree = 2,
+
+        /// pairs of sites exchange their data in log2(num_sites) steps, best
+        /// for small values
+        recursive_doubling = 3,
+
+        /// every site sends to its right neighbor and receives from its left
+        /// neighbor in num_sites - 1 steps, best for large values
+        ring = 4
+    };
+
+    /// The collective operations implemented by the algorithms above
+    enum class collective_operation : std::uint8_t
+    {
+        all_reduce = 0,
+        all_to_all = 1,
+        broadcast = 2,
+        gather = 3
+    };
+
+    /// The message size passed to \a select_collective_algorithm if the size
+    /// of the exchanged values is not known in advance.
+    inline constexpr std::size_t unknown_message_size =
+        static_cast<std::size_t>(-1);
+
+    /// Return the algorithm used for the given collective operation if
+    /// \a collective_algorithm::automatic was specified. The selection depends
+    /// on the number of participating sites and on the number of bytes sent by
+    /// each of the sites only. All sites have to select the same algorithm,
+    /// therefore the collective operations derive the message size from the
+    /// type of the exchanged values, not from the values themselves. Values
+    /// of types that may hold a varying amount of data (e.g. std::vector) are
+    /// passed as \a unknown_message_size and are treated as being large.
+    ///
+    /// The thresholds used for the selection can be configured with
+    /// hpx.lcos.collectives.direct_sites (the number of sites up to which
+    /// all sites directly exchange their data, default: 4) and
+    /// hpx.lcos.collectives.small_message_size (the largest value in bytes
+    /// that is handled by the latency optimized algorithms, default: 16384).
+    HPX_EXPORT collective_algorithm select_collective_algorithm(
+        collective_operation op, std::size_t num_sites,
+        std::size_t message_size);
+
+    /// Return the name of the given algorithm
+    HPX_EXPORT char const* get_collective_algorithm_name(
+        collective_algorithm algorithm) noexcept;
+}    // namespace hpx::collectives
@@ -0,0 +1,621 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+
+#include <hpx/assert.hpp>
+#include <hpx/collectives/argument_types.hpp>
+#include <hpx/collectives/channel_communicator.hpp>
+#include <hpx/collectives/collective_algorithm.hpp>
+#include <hpx/collectives/detail/communication_set_node.hpp>
+#include <hpx/futures/future.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// The algorithms below implement the collective operations on top of the
+// point-to-point channels of a channel_communicator. None of the sites is
+// involved in more than O(log(num_sites)) (tree, recursive doubling), or O(1)
+// (ring) concurrent data transfers, as opposed to the central communicator
+// component used by the other overloads of the collective operations.
+namespace hpx::collectives::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Return the arity of the communication set tree used by the algorithms
+    // (hpx.lcos.collectives.arity)
+    HPX_EXPORT std::size_t get_collective_tree_arity();
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The tags of the messages exchanged by the algorithms are distinct from
+    // any tag used for explicit point-to-point communication (the most
+    // significant bit is set). They are unique for the operation, its
+    // generation, and the step of the algorithm.
+    constexpr std::size_t make_algorithm_tag(collective_operation op,
+        std::size_t generation, std::size_t step) noexcept
+    {
+        constexpr std::size_t algorithm_tag =
+            ~(static_cast<std::size_t>(-1) >> 1);
+
+        if (generation == static_cast<std::size_t>(-1))
+        {
+            generation = 0;
+        }
+
+        HPX_ASSERT(step < (static_cast<std::size_t>(1) << 24));
+        return algorithm_tag | ((generation << 28) & ~algorithm_tag) |
+            (static_cast<std::size_t>(op) << 24) | step;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The number of bytes sent for a value of the given type, this is used to
+    // select the algorithm for collective_algorithm::automatic. All sites
+    // have to select the same algorithm, thus the size is derived from the
+    // type only. The size of types that may hold a varying amount of data
+    // (e.g. std::vector) is unknown, these are treated as being large.
+    template <typename T>
+    constexpr std::size_t get_message_size() noexcept
+    {
+        if constexpr (std::is_trivially_copyable_v<T>)
+        {
+            return sizeof(T);
+        }
+        else
+        {
+            return unknown_message_size;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The communication set tree (see create_communication_set) is built on
+    // the site numbers relative to the root site. The parent of a site is
+    // calculated by clearing the lowest non-zero digit of the base-arity
+    // representation of the site number. Consequently, the sites depending
+    // on a site form a contiguous range starting at the site itself.
+    constexpr std::size_t tree_span(
+        std::size_t site, std::size_t num_sites, std::size_t arity) noexcept
+    {
+        std::size_t span = 1;
+        while (span < num_sites && (site % (span * arity)) == 0)
+        {
+            span *= arity;
+        }
+        return span;
+    }
+
+    // Invoke the given function for all direct children of the given site,
+    // the children are visited in ascending order. The function is invoked
+    // with the site number of the child and the number of sites depending on
+    // it (including itself).
+    template <typename F>
+    void for_each_tree_child(
+        std::size_t site, std::size_t num_sites, std::size_t arity, F&& f)
+    {
+        std::size_t const span = tree_span(site, num_sites, arity);
+        for (std::size_t step = 1; step < span; step *= arity)
+        {
+            for (std::size_t digit = 1; digit != arity; ++digit)
+            {
+                std::size_t const child = site + digit * step;
+                if (child >= num_sites)
+                {
+                    return;
+                }
+                f(child, (std::min) (step, num_sites - child));
+            }
+        }
+    }
+
+    constexpr std::size_t to_relative_site(
+        std::size_t site, std::size_t root, std::size_t num_sites) noexcept
+    {
+        return (site + num_sites - root) % num_sites;
+    }
+
+    constexpr std::size_t to_absolute_site(
+        std::size_t site, std::size_t root, std::size_t num_sites) noexcept
+    {
+        return (site + root) % num_sites;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // broadcast: the root site sends the value to all other sites
+    template <typename T>
+    T broadcast_tree(channel_communicator const& comm, std::size_t this_site,
+        std::size_t num_sites, std::size_t root, T value, std::size_t tag)
+    {
+        std::size_t const arity = get_collective_tree_arity();
+        std::size_t const site = to_relative_site(this_site, root, num_sites);
+
+        if (site != 0)
+        {
+            std::size_t const parent = to_absolute_site(
+                calculate_connected_node(site, arity), root, num_sites);
+            value = collectives::get<T>(
+                comm, that_site_arg(parent), tag_arg(tag))
+                        .get();
+        }
+
+        std::vector<hpx::future<void>> sent;
+        for_each_tree_child(site, num_sites, arity,
+            [&](std::size_t child, std::size_t) {
+                sent.push_back(collectives::set(comm,
+                    that_site_arg(to_absolute_site(child, root, num_sites)),
+                    value, tag_arg(tag)));
+            });
+
+        for (auto& f : sent)
+        {
+            f.get();
+        }
+        return value;
+    }
+
+    template <typename T>
+    T broadcast_direct(channel_communicator const& comm, std::size_t this_site,
+        std::size_t num_sites, std::size_t root, T value, std::size_t tag)
+    {
+        if (this_site != root)
+        {
+            return collectives::get<T>(comm, that_site_arg(root), tag_arg(tag))
+                .get();
+        }
+
+        std::vector<hpx::future<void>> sent;
+        sent.reserve(num_sites);
+        for (std::size_t i = 0; i != num_sites; ++i)
+        {
+            if (i != root)
+            {
+                sent.push_back(collectives::set(
+                    comm, that_site_arg(i), value, tag_arg(tag)));
+            }
+        }
+
+        for (auto& f : sent)
+        {
+            f.get();
+        }
+        return value;
+    }
+
+    template <typename T>
+    T broadcast(channel_communicator const& comm, std::size_t root, T value,
+        std::size_t generation, collective_algorithm algorithm)
+    {
+        auto const [num_sites, this_site] = comm.get_info();
+        HPX_ASSERT(root < num_sites);
+
+        if (algorithm == collective_algorithm::automatic)
+        {
+            algorithm = select_collective_algorithm(
+                collective_operation::broadcast, num_sites,
+                get_message_size<T>());
+        }
+
+        std::size_t const tag =
+            make_algorithm_tag(collective_operation::broadcast, generation, 0);
+
+        if (algorithm == collective_algorithm::direct)
+        {
+            return broadcast_direct(
+                comm, this_site, num_sites, root, HPX_MOVE(value), tag);
+        }
+        return broadcast_tree(
+            comm, this_site, num_sites, root, HPX_MOVE(value), tag);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // gather: the root site receives the values of all sites
+    template <typename T>
+    std::vector<T> gather_tree(channel_communicator const& comm,
+        std::size_t this_site, std::size_t num_sites, std::size_t root,
+        T value, std::size_t tag)
+    {
+        std::size_t const arity = get_collective_tree_arity();
+        std::size_t const site = to_relative_site(this_site, root, num_sites);
+
+        // receive the values of all sites depending on this site, they are
+        // received from the children in ascending order of the site numbers
+        std::vector<hpx::future<std::vector<T>>> received;
+        for_each_tree_child(site, num_sites, arity,
+            [&](std::size_t child, std::size_t) {
+                received.push_back(collectives::get<std::vector<T>>(comm,
+                    that_site_arg(to_absolute_site(child, root, num_sites)),
+                    tag_arg(tag)));
+            });
+
+        std::vector<T> data;
+        data.reserve(tree_span(site, num_sites, arity));
+        data.push_back(HPX_MOVE(value));
+        for (auto& f : received)
+        {
+            std::vector<T> values = f.get();
+            data.insert(data.end(), std::make_move_iterator(values.begin()),
+                std::make_move_iterator(values.end()));
+        }
+
+        if (site != 0)
+        {
+            std::size_t const parent = to_absolute_site(
+                calculate_connected_node(site, arity), root, num_sites);
+            collectives::set(
+                comm, that_site_arg(parent), HPX_MOVE(data), tag_arg(tag))
+                .get();
+            return {};
+        }
+
+        // the data was collected in the order of the relative site numbers
+        HPX_ASSERT(data.size() == num_sites);
+        std::rotate(data.begin(),
+            data.begin() + static_cast<std::ptrdiff_t>(num_sites - root),
+            data.end());
+        return data;
+    }
+
+    template <typename T>
+    std::vector<T> gather_direct(channel_communicator const& comm,
+        std::size_t this_site, std::size_t num_sites, std::size_t root,
+        T value, std::size_t tag)
+    {
+        if (this_site != root)
+        {
+            collectives::set(
+                comm, that_site_arg(root), HPX_MOVE(value), tag_arg(tag))
+                .get();
+            return {};
+        }
+
+        std::vector<hpx::future<T>> received;
+        received.reserve(num_sites);
+        for (std::size_t i = 0; i != num_sites; ++i)
+        {
+            if (i != root)
+            {
+                received.push_back(collectives::get<T>(
+                    comm, that_site_arg(i), tag_arg(tag)));
+            }
+        }
+
+        std::vector<T> data;
+        data.reserve(num_sites);
+        auto it = received.begin();
+        for (std::size_t i = 0; i != num_sites; ++i)
+        {
+            if (i == root)
+            {
+                data.push_back(HPX_MOVE(value));
+            }
+            else
+            {
+                data.push_back((it++)->get());
+            }
+        }
+        return data;
+    }
+
+    template <typename T>
+    std::vector<T> gather(channel_communicator const& comm, std::size_t root,
+        T value, std::size_t generation, collective_algorithm algorithm)
+    {
+        auto const [num_sites, this_site] = comm.get_info();
+        HPX_ASSERT(root < num_sites);
+
+        if (algorithm == collective_algorithm::automatic)
+        {
+            algorithm = select_collective_algorithm(
+                collective_operation::gather, num_sites,
+                get_message_size<T>());
+        }
+
+        std::size_t const tag =
+            make_algorithm_tag(collective_operation::gather, generation, 0);
+
+        if (algorithm == collective_algorithm::tree)
+        {
+            return gather_tree(
+                comm, this_site, num_sites, root, HPX_MOVE(value), tag);
+        }
+        return gather_direct(
+            comm, this_site, num_sites, root, HPX_MOVE(value), tag);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // all_reduce: all sites receive the reduction of the values of all sites
+    template <typename T, typename F>
+    T all_reduce_direct(channel_communicator const& comm,
+        std::size_t this_site, std::size_t num_sites, T value, F& op,
+        std::size_t generation)
+    {
+        std::size_t const tag =
+            make_algorithm_tag(collective_operation::all_reduce, generation, 0);
+
+        std::vector<hpx::future<void>> sent;
+        std::vector<hpx::future<T>> received;
+        sent.reserve(num_sites);
+        received.reserve(num_sites);
+        for (std::size_t i = 0; i != num_sites; ++i)
+        {
+            if (i != this_site)
+            {
+                sent.push_back(collectives::set(
+                    comm, that_site_arg(i), value, tag_arg(tag)));
+                received.push_back(collectives::get<T>(
+                    comm, that_site_arg(i), tag_arg(tag)));
+            }
+        }
+
+        // reduce the values in the order of the site numbers to produce the
+        // same result everywhere
+        std::vector<T> data;
+        data.reserve(num_sites);
+        auto it = received.begin();
+        for (std::size_t i = 0; i != num_sites; ++i)
+        {
+            data.push_back(i == this_site ? value : (it++)->get());
+        }
+
+        for (auto& f : sent)
+        {
+            f.get();
+        }
+
+        T result = HPX_MOVE(data[0]);
+        for (std::size_t i = 1; i != num_sites; ++i)
+        {
+            result = op(HPX_MOVE(result), HPX_MOVE(data[i]));
+        }
+        return result;
+    }
+
+    // The exchange of values between two sites in one step of the recursive
+    // doubling algorithm, the value of the lower site is the left operand.
+    template <typename T, typename F>
+    T exchange_and_reduce(channel_communicator const& comm,
+        std::size_t this_site, std::size_t partner, T value, F& op,
+        std::size_t tag)
+    {
+        hpx::future<void> sent =
+            collectives::set(comm, that_site_arg(partner), value, tag_arg(tag));
+        T received =
+            collectives::get<T>(comm, that_site_arg(partner), tag_arg(tag))
+                .get();
+        sent.get();
+
+        if (partner < this_site)
+        {
+            return op(HPX_MOVE(received), HPX_MOVE(value));
+        }
+        return op(HPX_MOVE(value), HPX_MOVE(received));
+    }
+
+    template <typename T, typename F>
+    T all_reduce_recursive_doubling(channel_communicator const& comm,
+        std::size_t this_site, std::size_t num_sites, T value, F& op,
+        std::size_t generation)
+    {
+        auto make_tag = [&](std::size_t step) {
+            return make_algorithm_tag(
+                collective_operation::all_reduce, generation, step);
+        };
+
+        // If the number of sites is not a power of two, the first 2 * rem
+        // sites are paired up, the even ones of those hand their value to
+        // their odd neighbor and don't participate in the exchange.
+        std::size_t const num_exchanging =
+            next_power_of_two(num_sites + 1) / 2;
+        std::size_t const rem = num_sites - num_exchanging;
+
+        std::size_t new_site = this_site - rem;
+        if (this_site < 2 * rem)
+        {
+            if ((this_site % 2) == 0)
+            {
+                collectives::set(comm, that_site_arg(this_site + 1),
+                    HPX_MOVE(value), tag_arg(make_tag(0)))
+                    .get();
+
+                return collectives::get<T>(comm,
+                    that_site_arg(this_site + 1), tag_arg(make_tag(1)))
+                    .get();
+            }
+
+            T received = collectives::get<T>(
+                comm, that_site_arg(this_site - 1), tag_arg(make_tag(0)))
+                             .get();
+            value = op(HPX_MOVE(received), HPX_MOVE(value));
+            new_site = this_site / 2;
+        }
+
+        std::size_t step = 2;
+        for (std::size_t mask = 1; mask < num_exchanging; mask <<= 1, ++step)
+        {
+            std::size_t const new_partner = new_site ^ mask;
+            std::size_t const partner = new_partner < rem ?
+                2 * new_partner + 1 :
+                new_partner + rem;
+
+            value = exchange_and_reduce(
+                comm, this_site, partner, HPX_MOVE(value), op, make_tag(step));
+        }
+
+        if (this_site < 2 * rem)
+        {
+            collectives::set(comm, that_site_arg(this_site - 1), value,
+                tag_arg(make_tag(1)))
+                .get();
+        }
+        return value;
+    }
+
+    template <typename T, typename F>
+    T all_reduce_tree(channel_communicator const& comm, std::size_t this_site,
+        std::size_t num_sites, T value, F& op, std::size_t generation)
+    {
+        std::size_t const arity = get_collective_tree_arity();
+        std::size_t const tag =
+            make_algorithm_tag(collective_operation::all_reduce, generation, 0);
+
+        // reduce the values along the tree towards site zero, the partial
+        // results of the children cover the sites following this site
+        std::vector<hpx::future<T>> received;
+        for_each_tree_child(this_site, num_sites, arity,
+            [&](std::size_t child, std::size_t) {
+                received.push_back(collectives::get<T>(
+                    comm, that_site_arg(child), tag_arg(tag)));
+            });
+
+        for (auto& f : received)
+        {
+            value = op(HPX_MOVE(value), f.get());
+        }
+
+        if (this_site != 0)
+        {
+            collectives::set(comm,
+                that_site_arg(calculate_connected_node(this_site, arity)),
+                HPX_MOVE(value), tag_arg(tag))
+                .get();
+        }
+
+        // send the result back down the tree
+        return broadcast_tree(comm, this_site, num_sites, 0, HPX_MOVE(value),
+            make_algorithm_tag(
+                collective_operation::all_reduce, generation, 1));
+    }
+
+    template <typename T, typename F>
+    T all_reduce(channel_communicator const& comm, T value, F&& op,
+        std::size_t generation, collective_algorithm algorithm)
+    {
+        auto const [num_sites, this_site] = comm.get_info();
+
+        if (algorithm == collective_algorithm::automatic)
+        {
+            algorithm = select_collective_algorithm(
+                collective_operation::all_reduce, num_sites,
+                get_message_size<T>());
+        }
+
+        switch (algorithm)
+        {
+        case collective_algorithm::direct:
+            return all_reduce_direct(
+                comm, this_site, num_sites, HPX_MOVE(value), op, generation);
+
+        case collective_algorithm::recursive_doubling:
+            return all_reduce_recursive_doubling(
+                comm, this_site, num_sites, HPX_MOVE(value), op, generation);
+
+        default:
+            break;
+        }
+        return all_reduce_tree(
+            comm, this_site, num_sites, HPX_MOVE(value), op, generation);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // all_to_all: every site sends a separate value to each of the sites
+    template <typename T>
+    std::vector<T> all_to_all_direct(channel_communicator const& comm,
+        std::size_t this_site, std::size_t num_sites, std::vector<T> values,
+        std::size_t tag)
+    {
+        std::vector<hpx::future<void>> sent;
+        std::vector<hpx::future<T>> received;
+        sent.reserve(num_sites);
+        received.reserve(num_sites);
+        for (std::size_t i = 0; i != num_sites; ++i)
+        {
+            if (i != this_site)
+            {
+                sent.push_back(collectives::set(comm, that_site_arg(i),
+                    static_cast<T>(HPX_MOVE(values[i])), tag_arg(tag)));
+                received.push_back(collectives::get<T>(
+                    comm, that_site_arg(i), tag_arg(tag)));
+            }
+        }
+
+        auto it = received.begin();
+        for (std::size_t i = 0; i != num_sites; ++i)
+        {
+            if (i != this_site)
+            {
+                values[i] = (it++)->get();
+            }
+        }
+
+        for (auto& f : sent)
+        {
+            f.get();
+        }
+        return values;
+    }
+
+    template <typename T>
+    std::vector<T> all_to_all_ring(channel_communicator const& comm,
+        std::size_t this_site, std::size_t num_sites, std::vector<T> values,
+        std::size_t generation)
+    {
+        std::vector<T> result(num_sites);
+        result[this_site] = static_cast<T>(HPX_MOVE(values[this_site]));
+
+        // in step k, every site sends to the site k positions to its right
+        // and receives from the site k positions to its left
+        for (std::size_t step = 1; step != num_sites; ++step)
+        {
+            std::size_t const tag = make_algorithm_tag(
+                collective_operation::all_to_all, generation, step);
+            std::size_t const to = (this_site + step) % num_sites;
+            std::size_t const from = (this_site + num_sites - step) % num_sites;
+
+            hpx::future<void> sent = collectives::set(comm, that_site_arg(to),
+                static_cast<T>(HPX_MOVE(values[to])), tag_arg(tag));
+            result[from] =
+                collectives::get<T>(comm, that_site_arg(from), tag_arg(tag))
+                    .get();
+            sent.get();
+        }
+        return result;
+    }
+
+    template <typename T>
+    std::vector<T> all_to_all(channel_communicator const& comm,
+        std::vector<T> values, std::size_t generation,
+        collective_algorithm algorithm)
+    {
+        auto const [num_sites, this_site] = comm.get_info();
+        HPX_ASSERT(values.size() == num_sites);
+
+        if (algorithm == collective_algorithm::automatic)
+        {
+            constexpr std::size_t value_size = get_message_size<T>();
+            std::size_t const message_size =
+                value_size == unknown_message_size ? unknown_message_size :
+                                                     num_sites * value_size;
+            algorithm = select_collective_algorithm(
+                collective_operation::all_to_all, num_sites, message_size);
+        }
+
+        if (algorithm == collective_algorithm::ring)
+        {
+            return all_to_all_ring(
+                comm, this_site, num_sites, HPX_MOVE(values), generation);
+        }
+        return all_to_all_direct(comm, this_site, num_sites, HPX_MOVE(values),
+            make_algorithm_tag(
+                collective_operation::all_to_all, generation, 0));
+    }
+}    // namespace hpx::collectives::detail
+
+#endif    // !HPX_COMPUTE_DEVICE_CODE
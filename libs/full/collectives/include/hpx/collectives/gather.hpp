@@ -394,6 +394,66 @@ namespace hpx { namespace collectives {
     void gather_there(hpx::launch::sync_policy, communicator comm,
         T&& result, generation_arg generation,
         this_site_arg this_site = this_site_arg());
+
+    /// Gather a set of values from different call sites
+    ///
+    /// This function receives a set of values from all call sites operating on
+    /// the given channel communicator. The values are collected using the
+    /// point-to-point channels of the communicator, no central support object
+    /// is involved.
+    ///
+    /// \param  comm        A communicator object returned from
+    ///                     \a create_channel_communicator
+    /// \param  result      The value to transmit to the central gather point
+    ///                     from this call site.
+    /// \param  generation  The generational counter identifying the sequence
+    ///                     number of the gather operation performed on the
+    ///                     given communicator. This is optional and needs to be
+    ///                     supplied only if the gather operation on the
+    ///                     given communicator has to be performed more than
+    ///                     once. The generation number (if given) must be a
+    ///                     positive number greater than zero.
+    /// \param  algorithm   The algorithm to use for the operation. This is
+    ///                     optional and defaults to an algorithm selected based
+    ///                     on the number of sites and the size of the values
+    ///                     (see \a select_collective_algorithm). The same
+    ///                     algorithm has to be used on all sites.
+    ///
+    /// \returns    This function returns a future holding a vector with all
+    ///             gathered values. It will become ready once the gather
+    ///             operation has been completed.
+    ///
+    template <typename T>
+    hpx::future<std::vector<std::decay_t<T>>> gather_here(
+        channel_communicator comm, T&& result,
+        generation_arg generation = generation_arg(),
+        collective_algorithm algorithm = collective_algorithm::automatic);
+
+    /// Gather a given value at the given call site
+    ///
+    /// This function transmits the value given by \a result to a central
+    /// gather site (where the corresponding \a gather_here is executed)
+    ///
+    /// \param  comm        A communicator object returned from
+    ///                     \a create_channel_communicator
+    /// \param  result      The value to transmit to the central gather point
+    ///                     from this call site.
+    /// \param  generation  The generational counter identifying the sequence
+    ///                     number of the gather operation performed on the
+    ///                     given communicator.
+    /// \param  root_site   The sequence number of the central gather point
+    ///                     (usually the locality id). This value is optional
+    ///                     and defaults to 0.
+    /// \param  algorithm   The algorithm to use for the operation.
+    ///
+    /// \returns    This function returns a future that will become
+    ///             ready once the gather operation has been completed.
+    ///
+    template <typename T>
+    hpx::future<void> gather_there(channel_communicator comm, T&& result,
+        generation_arg generation = generation_arg(),
+        root_site_arg root_site = root_site_arg(),
+        collective_algorithm algorithm = collective_algorithm::automatic);
 }}    // namespace hpx::collectives
 
 // clang-format on
@@ -407,9 +467,13 @@ namespace hpx { namespace collectives {
 #include <hpx/async_base/launch_policy.hpp>
 #include <hpx/async_distributed/async.hpp>
 #include <hpx/collectives/argument_types.hpp>
+#include <hpx/collectives/channel_communicator.hpp>
+#include <hpx/collectives/collective_algorithm.hpp>
 #include <hpx/collectives/create_communicator.hpp>
+#include <hpx/collectives/detail/collective_algorithms.hpp>
 #include <hpx/components_base/agas_interface.hpp>
 #include <hpx/futures/future.hpp>
+#include <hpx/modules/errors.hpp>
 #include <hpx/type_support/unused.hpp>
 
 #include <cstddef>
@@ -668,6 +732,91 @@ namespace hpx::collectives {
             HPX_FORWARD(T, local_result), this_site)
             .get();
     }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // gather using the point-to-point channels of a channel_communicator
+    template <typename T>
+    hpx::future<std::vector<std::decay_t<T>>> gather_here(
+        channel_communicator comm, T&& local_result,
+        generation_arg generation = generation_arg(),
+        collective_algorithm algorithm = collective_algorithm::automatic)
+    {
+        using arg_type = std::decay_t<T>;
+
+        if (generation == 0)
+        {
+            return hpx::make_exceptional_future<std::vector<arg_type>>(
+                HPX_GET_EXCEPTION(hpx::error::bad_parameter,
+                    "hpx::collectives::gather_here",
+                    "the generation number shouldn't be zero"));
+        }
+
+        return hpx::async(
+            [comm = HPX_MOVE(comm), local_result = HPX_FORWARD(T, local_result),
+                generation, algorithm]() mutable -> std::vector<arg_type> {
+                std::size_t const root = comm.get_info().second;
+                return detail::gather(
+                    comm, root, HPX_MOVE(local_result), generation, algorithm);
+            });
+    }
+
+    template <typename T>
+    hpx::future<void> gather_there(channel_communicator comm,
+        T&& local_result, generation_arg generation = generation_arg(),
+        root_site_arg root_site = root_site_arg(),
+        collective_algorithm algorithm = collective_algorithm::automatic)
+    {
+        if (generation == 0)
+        {
+            return hpx::make_exceptional_future<void>(HPX_GET_EXCEPTION(
+                hpx::error::bad_parameter, "hpx::collectives::gather_there",
+                "the generation number shouldn't be zero"));
+        }
+
+        return hpx::async([comm = HPX_MOVE(comm),
+                              local_result = HPX_FORWARD(T, local_result),
+                              generation, root_site, algorithm]() mutable {
+            detail::gather(comm, root_site, HPX_MOVE(local_result), generation,
+                algorithm);
+        });
+    }
+
+    template <typename T>
+    std::vector<std::decay_t<T>> gather_here(hpx::launch::sync_policy,
+        channel_communicator comm, T&& local_result,
+        generation_arg generation = generation_arg(),
+        collective_algorithm algorithm = collective_algorithm::automatic)
+    {
+        if (generation == 0)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                "hpx::collectives::gather_here",
+                "the generation number shouldn't be zero");
+        }
+
+        std::size_t const root = comm.get_info().second;
+        return detail::gather(comm, root,
+            std::decay_t<T>(HPX_FORWARD(T, local_result)), generation,
+            algorithm);
+    }
+
+    template <typename T>
+    void gather_there(hpx::launch::sync_policy, channel_communicator comm,
+        T&& local_result, generation_arg generation = generation_arg(),
+        root_site_arg root_site = root_site_arg(),
+        collective_algorithm algorithm = collective_algorithm::automatic)
+    {
+        if (generation == 0)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                "hpx::collectives::gather_there",
+                "the generation number shouldn't be zero");
+        }
+
+        detail::gather(comm, root_site,
+            std::decay_t<T>(HPX_FORWARD(T, local_result)), generation,
+            algorithm);
+    }
 }    // namespace hpx::collectives
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,102 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+
+#include <hpx/assert.hpp>
+#include <hpx/collectives/collective_algorithm.hpp>
+#include <hpx/collectives/detail/collective_algorithms.hpp>
+#include <hpx/collectives/detail/communication_set_node.hpp>
+#include <hpx/runtime_local/config_entry.hpp>
+#include <hpx/util/from_string.hpp>
+
+#include <cstddef>
+
+namespace hpx::collectives {
+
+    collective_algorithm select_collective_algorithm(collective_operation op,
+        std::size_t num_sites, std::size_t message_size)
+    {
+        static std::size_t const direct_sites =
+            hpx::util::from_string<std::size_t>(
+                get_config_entry("hpx.lcos.collectives.direct_sites", 4));
+        static std::size_t const small_message_size =
+            hpx::util::from_string<std::size_t>(get_config_entry(
+                "hpx.lcos.collectives.small_message_size", 16384));
+
+        if (num_sites <= direct_sites)
+        {
+            return collective_algorithm::direct;
+        }
+
+        bool const small_message = message_size <= small_message_size;
+        switch (op)
+        {
+        case collective_operation::all_reduce:
+            // reducing in a tree (followed by a broadcast) sends every value
+            // only twice, recursive doubling needs fewer steps but sends the
+            // full value in each of them
+            return small_message ? collective_algorithm::recursive_doubling :
+                                   collective_algorithm::tree;
+
+        case collective_operation::all_to_all:
+            // the ring bounds the number of messages in flight per site
+            return small_message ? collective_algorithm::direct :
+                                   collective_algorithm::ring;
+
+        case collective_operation::gather:
+            // forwarding large values along the tree costs more than the
+            // contention at the root site
+            return small_message ? collective_algorithm::tree :
+                                   collective_algorithm::direct;
+
+        case collective_operation::broadcast:
+            [[fallthrough]];
+        default:
+            break;
+        }
+        return collective_algorithm::tree;
+    }
+
+    char const* get_collective_algorithm_name(
+        collective_algorithm algorithm) noexcept
+    {
+        switch (algorithm)
+        {
+        case collective_algorithm::automatic:
+            return "automatic";
+        case collective_algorithm::direct:
+            return "direct";
+        case collective_algorithm::tree:
+            return "tree";
+        case collective_algorithm::recursive_doubling:
+            return "recursive_doubling";
+        case collective_algorithm::ring:
+            return "ring";
+        default:
+            break;
+        }
+        return "unknown";
+    }
+
+    namespace detail {
+
+        std::size_t get_collective_tree_arity()
+        {
+            static std::size_t const arity =
+                hpx::util::from_string<std::size_t>(
+                    get_config_entry("hpx.lcos.collectives.arity", 32));
+
+            // the arity has to be a power of two but not equal to zero
+            HPX_ASSERT(arity > 1 && next_power_of_two(arity) == arity);
+            return arity;
+        }
+    }    // namespace detail
+}    // namespace hpx::collectives
+
+#endif
@@ -0,0 +1,344 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures the collective operations for a range of message
+// sizes and numbers of participating sites. It compares the central
+// communicator with the algorithms implemented on top of the channel
+// communicator. All sites are run on the locality the benchmark is started
+// on, each of them in a separate HPX thread.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/modules/collectives.hpp>
+#include <hpx/modules/format.hpp>
+#include <hpx/modules/program_options.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace hpx::collectives;
+
+///////////////////////////////////////////////////////////////////////////////
+using data_type = std::vector<char>;
+
+struct add_elements
+{
+    data_type operator()(data_type lhs, data_type const& rhs) const
+    {
+        for (std::size_t i = 0; i != lhs.size(); ++i)
+        {
+            lhs[i] = static_cast<char>(lhs[i] + rhs[i]);
+        }
+        return lhs;
+    }
+};
+
+char const* get_operation_name(collective_operation op)
+{
+    switch (op)
+    {
+    case collective_operation::all_reduce:
+        return "all_reduce";
+    case collective_operation::all_to_all:
+        return "all_to_all";
+    case collective_operation::broadcast:
+        return "broadcast";
+    case collective_operation::gather:
+        return "gather";
+    default:
+        break;
+    }
+    return "unknown";
+}
+
+// all_to_all sends a block of the given size, divided by the number of sites,
+// to each of the sites
+std::size_t get_block_size(std::size_t size, std::size_t num_sites)
+{
+    return (std::max) (size / num_sites, std::size_t(1));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// run the given operation on one of the sites using the central communicator
+void run_central(collective_operation op, communicator comm,
+    std::size_t site, std::size_t num_sites, std::size_t size,
+    std::size_t generation)
+{
+    auto const this_site = this_site_arg(site);
+    auto const gen = generation_arg(generation);
+    std::size_t const block_size = get_block_size(size, num_sites);
+
+    switch (op)
+    {
+    case collective_operation::all_reduce:
+        all_reduce(comm, data_type(size, 1), add_elements{}, this_site, gen)
+            .get();
+        break;
+
+    case collective_operation::all_to_all:
+        all_to_all(comm,
+            std::vector<data_type>(num_sites, data_type(block_size)),
+            this_site, gen)
+            .get();
+        break;
+
+    case collective_operation::broadcast:
+        if (site == 0)
+        {
+            broadcast_to(comm, data_type(size), this_site, gen).get();
+        }
+        else
+        {
+            broadcast_from<data_type>(comm, this_site, gen).get();
+        }
+        break;
+
+    case collective_operation::gather:
+        if (site == 0)
+        {
+            gather_here(comm, data_type(size), this_site, gen).get();
+        }
+        else
+        {
+            gather_there(comm, data_type(size), this_site, gen).get();
+        }
+        break;
+    }
+}
+
+// run the given operation on one of the sites using the channel communicator
+void run_channel(collective_operation op, channel_communicator comm,
+    std::size_t site, std::size_t num_sites, std::size_t size,
+    std::size_t generation, collective_algorithm algorithm)
+{
+    auto const gen = generation_arg(generation);
+    std::size_t const block_size = get_block_size(size, num_sites);
+
+    switch (op)
+    {
+    case collective_operation::all_reduce:
+        all_reduce(comm, data_type(size, 1), add_elements{}, gen, algorithm)
+            .get();
+        break;
+
+    case collective_operation::all_to_all:
+        all_to_all(comm,
+            std::vector<data_type>(num_sites, data_type(block_size)), gen,
+            algorithm)
+            .get();
+        break;
+
+    case collective_operation::broadcast:
+        if (site == 0)
+        {
+            broadcast_to(comm, data_type(size), gen, algorithm).get();
+        }
+        else
+        {
+            broadcast_from<data_type>(comm, gen, root_site_arg(0), algorithm)
+                .get();
+        }
+        break;
+
+    case collective_operation::gather:
+        if (site == 0)
+        {
+            gather_here(comm, data_type(size), gen, algorithm).get();
+        }
+        else
+        {
+            gather_there(comm, data_type(size), gen, root_site_arg(0),
+                algorithm)
+                .get();
+        }
+        break;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Run all iterations on all sites, return the average time per operation (in
+// microseconds).
+template <typename F>
+double measure(std::size_t num_sites, std::size_t iterations, F&& f)
+{
+    hpx::chrono::high_resolution_timer t;
+
+    std::vector<hpx::future<void>> tasks;
+    tasks.reserve(num_sites);
+    for (std::size_t site = 0; site != num_sites; ++site)
+    {
+        tasks.push_back(hpx::async([&f, site, iterations]() {
+            for (std::size_t i = 0; i != iterations; ++i)
+            {
+                f(site, i + 1);
+            }
+        }));
+    }
+    hpx::wait_all(tasks);
+
+    return t.elapsed() * 1e6 / static_cast<double>(iterations);
+}
+
+void print_result(collective_operation op, char const* algorithm,
+    std::size_t num_sites, std::size_t size, double elapsed)
+{
+    std::cout << hpx::util::format("{},{},{},{},{:.3f}\n",
+        get_operation_name(op), algorithm, num_sites, size, elapsed);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void benchmark_central(collective_operation op, std::size_t num_sites,
+    std::vector<std::size_t> const& sizes, std::size_t iterations)
+{
+    std::string const basename = hpx::util::format(
+        "/benchmark/central/{}/{}", get_operation_name(op), num_sites);
+
+    std::vector<communicator> comms;
+    comms.reserve(num_sites);
+    for (std::size_t site = 0; site != num_sites; ++site)
+    {
+        comms.push_back(create_communicator(
+            basename.c_str(), num_sites_arg(num_sites), this_site_arg(site)));
+    }
+
+    std::size_t generation = 0;
+    for (std::size_t size : sizes)
+    {
+        double const elapsed = measure(num_sites, iterations,
+            [&, generation](std::size_t site, std::size_t i) {
+                run_central(
+                    op, comms[site], site, num_sites, size, generation + i);
+            });
+        generation += iterations;
+
+        print_result(op, "central", num_sites, size, elapsed);
+    }
+}
+
+void benchmark_channel(collective_operation op, std::size_t num_sites,
+    std::vector<std::size_t> const& sizes, std::size_t iterations,
+    collective_algorithm algorithm)
+{
+    std::string const basename =
+        hpx::util::format("/benchmark/channel/{}/{}/{}",
+            get_operation_name(op), get_collective_algorithm_name(algorithm),
+            num_sites);
+
+    std::vector<channel_communicator> comms;
+    comms.reserve(num_sites);
+    for (std::size_t site = 0; site != num_sites; ++site)
+    {
+        comms.push_back(create_channel_communicator(hpx::launch::sync,
+            basename.c_str(), num_sites_arg(num_sites), this_site_arg(site)));
+    }
+
+    std::size_t generation = 0;
+    for (std::size_t size : sizes)
+    {
+        double const elapsed = measure(num_sites, iterations,
+            [&, generation](std::size_t site, std::size_t i) {
+                run_channel(op, comms[site], site, num_sites, size,
+                    generation + i, algorithm);
+            });
+        generation += iterations;
+
+        char const* name = get_collective_algorithm_name(algorithm);
+        if (algorithm == collective_algorithm::automatic)
+        {
+            // report the algorithm that was actually picked, the size of the
+            // exchanged vectors is not taken into account
+            name = get_collective_algorithm_name(select_collective_algorithm(
+                op, num_sites, unknown_message_size));
+        }
+        print_result(op, name, num_sites, size, elapsed);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t const iterations = vm["iterations"].as<std::size_t>();
+    std::size_t const min_sites =
+        (std::max) (vm["min-sites"].as<std::size_t>(), std::size_t(1));
+    std::size_t const max_sites = vm["max-sites"].as<std::size_t>();
+    std::size_t const min_size =
+        (std::max) (vm["min-size"].as<std::size_t>(), std::size_t(1));
+    std::size_t const max_size = vm["max-size"].as<std::size_t>();
+    bool const all_algorithms = vm.count("all-algorithms") != 0;
+
+    std::vector<std::size_t> sizes;
+    for (std::size_t size = min_size; size <= max_size; size *= 2)
+    {
+        sizes.push_back(size);
+    }
+
+    std::vector<collective_algorithm> algorithms = {
+        collective_algorithm::automatic};
+    if (all_algorithms)
+    {
+        algorithms = {collective_algorithm::direct, collective_algorithm::tree,
+            collective_algorithm::recursive_doubling,
+            collective_algorithm::ring};
+    }
+
+    std::cout << "operation,algorithm,sites,bytes,time[us]\n";
+
+    for (collective_operation op :
+        {collective_operation::all_reduce, collective_operation::all_to_all,
+            collective_operation::broadcast, collective_operation::gather})
+    {
+        for (std::size_t num_sites = min_sites; num_sites <= max_sites;
+             num_sites *= 2)
+        {
+            benchmark_central(op, num_sites, sizes, iterations);
+
+            for (collective_algorithm algorithm : algorithms)
+            {
+                benchmark_channel(op, num_sites, sizes, iterations, algorithm);
+            }
+        }
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using hpx::program_options::options_description;
+    using hpx::program_options::value;
+
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("iterations", value<std::size_t>()->default_value(20),
+         "number of times each operation is repeated (default: 20)")
+        ("min-sites", value<std::size_t>()->default_value(2),
+         "smallest number of participating sites (default: 2)")
+        ("max-sites", value<std::size_t>()->default_value(32),
+         "largest number of participating sites (default: 32)")
+        ("min-size", value<std::size_t>()->default_value(8),
+         "smallest message size in bytes (default: 8)")
+        ("max-size", value<std::size_t>()->default_value(65536),
+         "largest message size in bytes (default: 65536)")
+        ("all-algorithms",
+         "measure all algorithms instead of the automatically selected one")
+        ;
+    // clang-format on
+
+    hpx::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+
+    return hpx::init(argc, argv, init_args);
+}
+#endif
@@ -0,0 +1,225 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/modules/collectives.hpp>
+#include <hpx/modules/format.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace hpx::collectives;
+
+///////////////////////////////////////////////////////////////////////////////
+constexpr char const* collective_algorithms_basename =
+    "/test/collective_algorithms/";
+
+constexpr collective_algorithm algorithms[] = {collective_algorithm::automatic,
+    collective_algorithm::direct, collective_algorithm::tree,
+    collective_algorithm::recursive_doubling, collective_algorithm::ring};
+
+///////////////////////////////////////////////////////////////////////////////
+void test_collective_algorithms_comm(std::size_t site, std::size_t num_sites,
+    channel_communicator comm, collective_algorithm algorithm)
+{
+    std::size_t generation = 0;
+
+    // all_reduce, the concatenation of strings is not commutative
+    {
+        std::string expected;
+        for (std::size_t i = 0; i != num_sites; ++i)
+        {
+            expected += static_cast<char>('a' + i % 26);
+        }
+
+        std::string result = all_reduce(comm,
+            std::string(1, static_cast<char>('a' + site % 26)),
+            [](std::string lhs, std::string const& rhs) {
+                return lhs + rhs;
+            },
+            generation_arg(++generation), algorithm)
+                                 .get();
+
+        HPX_TEST_EQ(result, expected);
+    }
+
+    {
+        std::size_t result = all_reduce(hpx::launch::sync, comm, site,
+            std::plus<>{}, generation_arg(++generation), algorithm);
+
+        HPX_TEST_EQ(result, num_sites * (num_sites - 1) / 2);
+    }
+
+    // broadcast from all sites in turn
+    for (std::size_t root = 0; root != num_sites; ++root)
+    {
+        std::vector<std::size_t> value;
+        if (site == root)
+        {
+            value.assign(100, root);
+            broadcast_to(comm, value, generation_arg(++generation), algorithm)
+                .get();
+        }
+        else
+        {
+            value = broadcast_from<std::vector<std::size_t>>(comm,
+                generation_arg(++generation), root_site_arg(root), algorithm)
+                        .get();
+        }
+
+        HPX_TEST_EQ(value.size(), static_cast<std::size_t>(100));
+        HPX_TEST_EQ(value.back(), root);
+
+        std::size_t v = site == root ? root + 1 : 0;
+        broadcast(comm, v, root_site_arg(root), generation_arg(++generation),
+            algorithm);
+        HPX_TEST_EQ(v, root + 1);
+    }
+
+    // gather to the first and the last site
+    for (std::size_t root : {std::size_t(0), num_sites - 1})
+    {
+        if (site == root)
+        {
+            std::vector<std::size_t> result = gather_here(
+                comm, site + 42, generation_arg(++generation), algorithm)
+                                                  .get();
+
+            HPX_TEST_EQ(result.size(), num_sites);
+            for (std::size_t i = 0; i != result.size(); ++i)
+            {
+                HPX_TEST_EQ(result[i], i + 42);
+            }
+        }
+        else
+        {
+            gather_there(comm, site + 42, generation_arg(++generation),
+                root_site_arg(root), algorithm)
+                .get();
+        }
+    }
+
+    // all_to_all
+    {
+        std::vector<std::size_t> values(num_sites);
+        for (std::size_t i = 0; i != num_sites; ++i)
+        {
+            values[i] = site * num_sites + i;
+        }
+
+        std::vector<std::size_t> result = all_to_all(comm, HPX_MOVE(values),
+            generation_arg(++generation), algorithm)
+                                              .get();
+
+        HPX_TEST_EQ(result.size(), num_sites);
+        for (std::size_t i = 0; i != result.size(); ++i)
+        {
+            HPX_TEST_EQ(result[i], i * num_sites + site);
+        }
+    }
+
+    // the sites supply values of different sizes, all of them have to select
+    // the same algorithm nevertheless (see small_message_size below)
+    {
+        std::vector<char> value(site * 16, static_cast<char>(site));
+        if (site == 0)
+        {
+            std::vector<std::vector<char>> result = gather_here(comm,
+                HPX_MOVE(value), generation_arg(++generation), algorithm)
+                                                        .get();
+
+            HPX_TEST_EQ(result.size(), num_sites);
+            for (std::size_t i = 0; i != result.size(); ++i)
+            {
+                HPX_TEST_EQ(result[i].size(), i * 16);
+            }
+        }
+        else
+        {
+            gather_there(comm, HPX_MOVE(value), generation_arg(++generation),
+                root_site_arg(0), algorithm)
+                .get();
+        }
+    }
+
+    {
+        std::vector<std::vector<char>> values(
+            num_sites, std::vector<char>(site * 16, static_cast<char>(site)));
+
+        std::vector<std::vector<char>> result = all_to_all(comm,
+            HPX_MOVE(values), generation_arg(++generation), algorithm)
+                                                    .get();
+
+        HPX_TEST_EQ(result.size(), num_sites);
+        for (std::size_t i = 0; i != result.size(); ++i)
+        {
+            HPX_TEST_EQ(result[i].size(), i * 16);
+        }
+    }
+}
+
+void test_collective_algorithms(
+    std::size_t num_sites, collective_algorithm algorithm)
+{
+    std::string const basename =
+        hpx::util::format("{}{}/{}", collective_algorithms_basename,
+            num_sites, get_collective_algorithm_name(algorithm));
+
+    std::vector<hpx::future<channel_communicator>> comm_fs;
+    comm_fs.reserve(num_sites);
+
+    for (std::size_t i = 0; i != num_sites; ++i)
+    {
+        comm_fs.push_back(create_channel_communicator(
+            basename.c_str(), num_sites_arg(num_sites), this_site_arg(i)));
+    }
+
+    hpx::wait_all(comm_fs);
+
+    std::vector<hpx::future<void>> tasks;
+    tasks.reserve(num_sites);
+
+    for (std::size_t i = 0; i != num_sites; ++i)
+    {
+        tasks.push_back(hpx::async(test_collective_algorithms_comm, i,
+            num_sites, comm_fs[i].get(), algorithm));
+    }
+
+    hpx::wait_all(tasks);
+}
+
+int hpx_main()
+{
+    // cover power-of-two and other numbers of sites as well as trees with
+    // more than one level (see the configured arity below)
+    for (std::size_t num_sites : {1, 2, 3, 7, 8, 13, 33})
+    {
+        for (collective_algorithm algorithm : algorithms)
+        {
+            test_collective_algorithms(num_sites, algorithm);
+        }
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    hpx::init_params init_args;
+    init_args.cfg = {"hpx.lcos.collectives.arity=4",
+        "hpx.lcos.collectives.small_message_size=64"};
+
+    HPX_TEST_EQ(hpx::init(argc, argv, init_args), 0);
+    return hpx::util::report_errors();
+}
+#endif
@@ -429,6 +429,13 @@ namespace hpx {
     defined(__FreeBSD__)
             threads::coroutines::detail::posix::use_guard_pages =
                 cmdline.rtcfg_.use_stack_guard_pages();
+            if (cmdline.rtcfg_.use_stack_pool())
+            {
+                threads::coroutines::detail::posix::init_stack_pool(
+                    cmdline.rtcfg_.get_stack_pool_parameters(),
+                    static_cast<std::size_t>(
+                        cmdline.rtcfg_.get_default_stack_size()));
+            }
 #endif
 #ifdef HPX_HAVE_VERIFY_LOCKS
             if (cmdline.rtcfg_.enable_lock_detection())
@@ -63,6 +63,16 @@ namespace hpx::parcelset::policies::lci {
         static int ndevices;
         // How many completion managers to use
         static int ncomps;
+        // how to assign the devices to the worker threads
+        enum class device_affinity_t
+        {
+            block,    // contiguous blocks of worker threads
+            numa,     // worker threads of the same NUMA domain
+        };
+        static device_affinity_t device_affinity;
+        // Whether to hold back eager messages in the backlog queue so that
+        // they can be aggregated with subsequent messages.
+        static bool enable_aggregation;
         // Whether to enable in-buffer assembly for the header messages.
         static bool enable_in_buffer_assembly;
         // The max retry count of send_nb before yield.
@@ -269,6 +269,8 @@ namespace hpx::traits {
                 "reg_mem = 1\n"
                 "ndevices = 2\n"
                 "ncomps = 1\n"
+                "device_affinity = block\n"
+                "aggregation = 0\n"
                 "enable_in_buffer_assembly = 1\n"
                 "send_nb_max_retry = 32\n"
                 "mbuffer_alloc_max_retry = 32\n"
@@ -36,6 +36,7 @@ namespace hpx::parcelset::policies::lci {
         void done();
         bool tryMerge(
             const std::shared_ptr<sender_connection_base>& other_base);
+        bool isEager();
 
     private:
         enum class connection_state
@@ -45,7 +46,6 @@ namespace hpx::parcelset::policies::lci {
             locked,
         };
         bool can_be_eager_message(size_t max_header_size);
-        bool isEager();
         void cleanup();
         return_t send_msg();
 
@@ -77,6 +77,11 @@ namespace hpx::parcelset::policies::lci {
         virtual void done() = 0;
         virtual bool tryMerge(
             const std::shared_ptr<sender_connection_base>& other_base) = 0;
+        // Whether this message is small enough to be merged with others.
+        virtual bool isEager()
+        {
+            return false;
+        }
         void profile_start_hook(const header& header_);
         void profile_end_hook();
 
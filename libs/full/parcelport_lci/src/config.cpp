@@ -29,6 +29,8 @@ namespace hpx::parcelset::policies::lci {
     bool config_t::reg_mem;
     int config_t::ndevices;
     int config_t::ncomps;
+    config_t::device_affinity_t config_t::device_affinity;
+    bool config_t::enable_aggregation;
     bool config_t::enable_in_buffer_assembly;
     int config_t::send_nb_max_retry;
     int config_t::mbuffer_alloc_max_retry;
@@ -152,6 +154,24 @@ namespace hpx::parcelset::policies::lci {
             rtcfg, "hpx.parcel.lci.ndevices", 1 /* Does not matter*/);
         ncomps = util::get_entry_as(
             rtcfg, "hpx.parcel.lci.ncomps", 1 /* Does not matter*/);
+        // set the way to assign devices to worker threads
+        std::string device_affinity_str = util::get_entry_as<std::string>(
+            rtcfg, "hpx.parcel.lci.device_affinity", "");
+        if (device_affinity_str == "block")
+        {
+            device_affinity = device_affinity_t::block;
+        }
+        else if (device_affinity_str == "numa")
+        {
+            device_affinity = device_affinity_t::numa;
+        }
+        else
+        {
+            throw std::runtime_error(
+                "Unknown device affinity " + device_affinity_str);
+        }
+        enable_aggregation = util::get_entry_as(
+            rtcfg, "hpx.parcel.lci.aggregation", 0 /* Does not matter*/);
         enable_in_buffer_assembly = util::get_entry_as(rtcfg,
             "hpx.parcel.lci.enable_in_buffer_assembly", 1 /* Does not matter*/);
         send_nb_max_retry = util::get_entry_as(
@@ -171,6 +191,14 @@ namespace hpx::parcelset::policies::lci {
             fprintf(
                 stderr, "WARNING: set enable_lci_backlog_queue to false!\n");
         }
+        if (enable_aggregation &&
+            (!enable_lci_backlog_queue || protocol != protocol_t::putva))
+        {
+            enable_aggregation = false;
+            fprintf(stderr,
+                "WARNING: message aggregation needs the backlog queue and "
+                "the putva protocol, set enable_aggregation to false!\n");
+        }
         std::size_t num_threads =
             util::get_entry_as<size_t>(rtcfg, "hpx.os_threads", 1);
         if (progress_type == progress_type_t::rp && num_threads <= 1)
@@ -32,8 +32,10 @@
 
 #include <hpx/assert.hpp>
 
+#include <algorithm>
 #include <atomic>
 #include <cstddef>
+#include <iterator>
 #include <memory>
 #include <string>
 #include <type_traits>
@@ -477,9 +479,71 @@ namespace hpx::parcelset::policies::lci {
         bool ret = false;
         auto device = get_tls_device();
         ret = util::lci_environment::do_progress(device.device) || ret;
+        if (!ret && devices.size() > 1 && is_initialized)
+        {
+            // Not every device is necessarily assigned to a worker thread
+            // (e.g. if a NUMA domain has no worker threads). Idle workers
+            // progress the other devices in a round-robin fashion.
+            static thread_local std::size_t next_device_idx = 0;
+            next_device_idx = (next_device_idx + 1) % devices.size();
+            if (next_device_idx != std::size_t(device.idx))
+            {
+                ret = util::lci_environment::do_progress(
+                    devices[next_device_idx].device);
+            }
+        }
         return ret;
     }
 
+    namespace {
+
+        // Assign the devices to the NUMA domains in contiguous blocks and
+        // distribute the worker threads of each NUMA domain over the devices
+        // assigned to that domain. Only NUMA domains with worker threads are
+        // considered.
+        std::size_t get_numa_device_idx(
+            std::size_t num_thread, std::size_t total_thread_num)
+        {
+            auto& rp = hpx::resource::get_partitioner();
+            auto const& topo = rp.get_topology();
+
+            std::vector<std::size_t> domains(total_thread_num);
+            for (std::size_t i = 0; i != total_thread_num; ++i)
+            {
+                domains[i] = topo.get_numa_node_number(rp.get_pu_num(i));
+            }
+
+            std::vector<std::size_t> active_domains(domains);
+            std::sort(active_domains.begin(), active_domains.end());
+            active_domains.erase(
+                std::unique(active_domains.begin(), active_domains.end()),
+                active_domains.end());
+
+            std::size_t const domain_idx =
+                static_cast<std::size_t>(std::distance(active_domains.begin(),
+                    std::lower_bound(active_domains.begin(),
+                        active_domains.end(), domains[num_thread])));
+            std::size_t const num_domains = active_domains.size();
+            std::size_t const ndevices = config_t::ndevices;
+
+            // if there are fewer devices than NUMA domains, several domains
+            // share a device
+            std::size_t const first = domain_idx * ndevices / num_domains;
+            std::size_t const last =
+                (domain_idx + 1) * ndevices / num_domains;
+            if (last <= first + 1)
+            {
+                return first;
+            }
+
+            // the index of this worker among the workers of its domain
+            std::size_t const local_idx =
+                static_cast<std::size_t>(std::count(domains.begin(),
+                    domains.begin() + num_thread, domains[num_thread]));
+            return first + local_idx % (last - first);
+        }
+    }    // namespace
+
     parcelport::device_t& parcelport::get_tls_device()
     {
         static thread_local std::size_t tls_device_idx = -1;
@@ -500,11 +564,20 @@ namespace hpx::parcelset::policies::lci {
                 hpx::get_worker_thread_num();    // current worker
             std::size_t total_thread_num = rp.get_num_threads();
             HPX_ASSERT(num_thread < total_thread_num);
-            std::size_t nthreads_per_device =
-                (total_thread_num + config_t::ndevices - 1) /
-                config_t::ndevices;
+            if (config_t::device_affinity ==
+                config_t::device_affinity_t::numa)
+            {
+                tls_device_idx =
+                    get_numa_device_idx(num_thread, total_thread_num);
+            }
+            else
+            {
+                std::size_t nthreads_per_device =
+                    (total_thread_num + config_t::ndevices - 1) /
+                    config_t::ndevices;
 
-            tls_device_idx = num_thread / nthreads_per_device;
+                tls_device_idx = num_thread / nthreads_per_device;
+            }
             util::lci_environment::log(
                 util::lci_environment::log_level_t::debug, "device",
                 "Rank %d thread %lu/%lu gets device %lu\n", LCI_RANK,
@@ -92,7 +92,12 @@ namespace hpx::parcelset::policies::lci {
         }
         else
         {
-            if (!backlog_queue::empty(dst_rank))
+            // Eager messages are held back in the backlog queue if
+            // aggregation is enabled, subsequent eager messages to the same
+            // destination are merged into them until the queue is flushed
+            // by the background work.
+            if (!backlog_queue::empty(dst_rank) ||
+                (config_t::enable_aggregation && !in_bg_work && isEager()))
             {
                 backlog_queue::push(shared_from_this());
                 ret = {return_status_t::retry, nullptr};
@@ -16,6 +16,7 @@
 #include <hpx/parcelport_mpi/header.hpp>
 #include <hpx/parcelset/decode_parcels.hpp>
 #include <hpx/parcelset/parcel_buffer.hpp>
+#include <hpx/parcelset/receive_buffer_pool.hpp>
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS)
 #include <hpx/modules/timing.hpp>
 #endif
@@ -23,6 +24,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
+#include <memory>
 #include <utility>
 #include <vector>
 
@@ -43,7 +45,7 @@ namespace hpx::parcelset::policies::mpi {
             acked_data = 6
         };
 
-        using buffer_type = parcel_buffer<>;
+        using buffer_type = parcel_buffer<receive_buffer_type>;
 
         constexpr int ack_tag() const noexcept
         {
@@ -123,7 +125,11 @@ namespace hpx::parcelset::policies::mpi {
                 buffer_.chunks_.resize(num_zero_copy_chunks);
                 if (!pp_.allow_zero_copy_receive_optimizations())
                 {
-                    chunk_buffers_.resize(num_zero_copy_chunks);
+                    // the chunk buffers are shared with the de-serialized
+                    // objects referring to the received data
+                    chunk_buffers_ = std::make_shared<receive_chunk_buffers>(
+                        num_zero_copy_chunks);
+                    buffer_.chunks_owner_ = chunk_buffers_;
                 }
             }
         }
@@ -358,7 +364,8 @@ namespace hpx::parcelset::policies::mpi {
             }
             else
             {
-                HPX_ASSERT(chunk_buffers_.size() == buffer_.chunks_.size());
+                HPX_ASSERT(chunk_buffers_ &&
+                    chunk_buffers_->size() == buffer_.chunks_.size());
                 while (chunks_idx_ < buffer_.chunks_.size())
                 {
                     if (!request_done())
@@ -371,7 +378,7 @@ namespace hpx::parcelset::policies::mpi {
                     std::size_t const chunk_size =
                         buffer_.transmission_chunks_[idx].second;
 
-                    auto& c = chunk_buffers_[idx];
+                    auto& c = (*chunk_buffers_)[idx];
                     c.resize(chunk_size);
 
                     // store buffer for decode_parcels below
@@ -412,7 +419,7 @@ namespace hpx::parcelset::policies::mpi {
                 handle_received_parcels(
                     decode_parcels(pp_, HPX_MOVE(buffer_), num_thread),
                     num_thread);
-                chunk_buffers_.clear();
+                chunk_buffers_.reset();
             }
             else
             {
@@ -474,7 +481,7 @@ namespace hpx::parcelset::policies::mpi {
         Parcelport& pp_;
 
         std::vector<parcelset::parcel> parcels_;
-        std::vector<std::vector<char>> chunk_buffers_;
+        std::shared_ptr<receive_chunk_buffers> chunk_buffers_;
     };
 }    // namespace hpx::parcelset::policies::mpi
 
@@ -0,0 +1,80 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/modules/serialization.hpp>
+
+#include <cstdint>
+#include <iosfwd>
+
+namespace hpx::parcelset::policies::shmem {
+
+    // A locality is identified by the node it runs on and its process id.
+    class locality
+    {
+    public:
+        constexpr locality() noexcept
+          : node_(0)
+          , pid_(-1)
+        {
+        }
+
+        constexpr locality(std::uint64_t node, std::int32_t pid) noexcept
+          : node_(node)
+          , pid_(pid)
+        {
+        }
+
+        [[nodiscard]] constexpr std::uint64_t node() const noexcept
+        {
+            return node_;
+        }
+
+        [[nodiscard]] constexpr std::int32_t pid() const noexcept
+        {
+            return pid_;
+        }
+
+        [[nodiscard]] static constexpr const char* type() noexcept
+        {
+            return "shmem";
+        }
+
+        [[nodiscard]] explicit constexpr operator bool() const noexcept
+        {
+            return pid_ != -1;
+        }
+
+        HPX_EXPORT void save(serialization::output_archive& ar) const;
+        HPX_EXPORT void load(serialization::input_archive& ar);
+
+    private:
+        friend constexpr bool operator==(
+            locality const& lhs, locality const& rhs) noexcept
+        {
+            return lhs.node_ == rhs.node_ && lhs.pid_ == rhs.pid_;
+        }
+
+        friend constexpr bool operator<(
+            locality const& lhs, locality const& rhs) noexcept
+        {
+            return lhs.node_ < rhs.node_ ||
+                (lhs.node_ == rhs.node_ && lhs.pid_ < rhs.pid_);
+        }
+
+        friend HPX_EXPORT std::ostream& operator<<(
+            std::ostream& os, locality const& loc) noexcept;
+
+        std::uint64_t node_;
+        std::int32_t pid_;
+    };
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
@@ -0,0 +1,97 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/assert.hpp>
+#include <hpx/modules/synchronization.hpp>
+#include <hpx/parcelport_shmem/receiver_connection.hpp>
+#include <hpx/parcelport_shmem/segment.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace hpx::parcelset::policies::shmem {
+
+    template <typename Parcelport>
+    class receiver
+    {
+        using connection_type = receiver_connection<Parcelport>;
+
+        struct channel_data
+        {
+            channel_data(Parcelport& pp, channel ch,
+                segment_parameters const& params) noexcept
+              : connection(pp, ch, params)
+            {
+            }
+
+            hpx::spinlock mtx;
+            connection_type connection;
+        };
+
+    public:
+        explicit receiver(Parcelport& pp) noexcept
+          : pp_(pp)
+          , segment_(nullptr)
+        {
+        }
+
+        // Start receiving the data delivered through the given segment.
+        void run(segment* seg)
+        {
+            HPX_ASSERT(segment_ == nullptr);
+            segment_ = seg;
+
+            segment_parameters const& params = segment_->parameters();
+            channels_.reserve(params.num_channels);
+            for (std::uint32_t i = 0; i != params.num_channels; ++i)
+            {
+                channels_.push_back(std::make_unique<channel_data>(
+                    pp_, segment_->get_channel(i), params));
+            }
+        }
+
+        bool background_work(std::size_t num_thread = -1)
+        {
+            bool has_work = false;
+            for (auto& ch : channels_)
+            {
+                if (!ch->connection.has_data())
+                    continue;
+
+                std::unique_lock const l(ch->mtx, std::try_to_lock);
+                if (l)
+                {
+                    has_work = ch->connection.receive(num_thread) || has_work;
+                }
+            }
+            return has_work;
+        }
+
+        // Block the calling thread until new data arrives (or the timeout
+        // expires).
+        void wait(std::chrono::microseconds timeout) noexcept
+        {
+            if (segment_ != nullptr)
+                segment_->wait(timeout);
+        }
+
+    private:
+        Parcelport& pp_;
+        segment* segment_;
+        std::vector<std::unique_ptr<channel_data>> channels_;
+    };
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
@@ -0,0 +1,335 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/assert.hpp>
+#include <hpx/parcelport_shmem/segment.hpp>
+#include <hpx/parcelset/decode_parcels.hpp>
+#include <hpx/parcelset/parcel_buffer.hpp>
+#include <hpx/parcelset/receive_buffer_pool.hpp>
+#include <hpx/parcelset_base/detail/data_point.hpp>
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+#include <hpx/modules/timing.hpp>
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace hpx::parcelset::policies::shmem {
+
+    // The receiving end of a channel, decodes the messages streamed through
+    // the channel. Only one thread may access a receiver_connection at a
+    // time.
+    template <typename Parcelport>
+    class receiver_connection
+    {
+        using buffer_type = parcel_buffer<receive_buffer_type>;
+
+        enum class connection_state : std::uint8_t
+        {
+            rcvd_header = 0,
+            rcvd_data = 1,
+            rcvd_chunks = 2
+        };
+
+        // a part of the message
+        struct piece
+        {
+            char* data;
+            std::size_t size;
+
+            // the data is stored in the bulk region, the ring holds its
+            // position
+            bool bulk;
+        };
+
+    public:
+        receiver_connection(Parcelport& pp, channel ch,
+            segment_parameters const& params) noexcept
+          : state_(connection_state::rcvd_header)
+          , channel_(ch)
+          , params_(params)
+          , current_(0)
+          , offset_(0)
+          , bulk_pos_(0)
+          , pp_(pp)
+        {
+            start_header();
+        }
+
+        [[nodiscard]] bool has_data() const noexcept
+        {
+            return channel_.has_data();
+        }
+
+        // Consume the data available in the channel, returns whether any
+        // progress was made. At most one message is completed per call.
+        bool receive(std::size_t num_thread = -1)
+        {
+            bool progress = false;
+            while (receive_pieces(progress))
+            {
+                switch (state_)
+                {
+                case connection_state::rcvd_header:
+                    handle_header();
+                    break;
+
+                case connection_state::rcvd_data:
+                    handle_data(num_thread);
+                    break;
+
+                case connection_state::rcvd_chunks:
+                    done(num_thread);
+                    return true;
+                }
+
+                if (state_ == connection_state::rcvd_header)
+                    return true;    // message without zero-copy chunks
+            }
+            return progress;
+        }
+
+    private:
+        void add_piece(void* data, std::size_t size, bool bulk = false)
+        {
+            pieces_.push_back(piece{static_cast<char*>(data), size, bulk});
+        }
+
+        void start_header()
+        {
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            parcelset::data_point& data = buffer_.data_point_;
+            data.time_ = timer_.elapsed_nanoseconds();
+            data.serialization_time_ = 0;
+            data.bytes_ = 0;
+            data.num_parcels_ = 0;
+#endif
+            state_ = connection_state::rcvd_header;
+
+            pieces_.clear();
+            current_ = 0;
+
+            add_piece(&buffer_.size_, sizeof(buffer_.size_));
+            add_piece(&buffer_.data_size_, sizeof(buffer_.data_size_));
+            add_piece(&buffer_.num_chunks_, sizeof(buffer_.num_chunks_));
+        }
+
+        // Read the pieces of the current state, returns true once all of
+        // them were received.
+        bool receive_pieces(bool& progress) noexcept
+        {
+            while (current_ != pieces_.size())
+            {
+                piece const& p = pieces_[current_];
+                if (p.bulk)
+                {
+                    std::size_t const n = channel_.read(
+                        reinterpret_cast<char*>(&bulk_pos_) + offset_,
+                        sizeof(bulk_pos_) - offset_);
+                    progress = progress || n != 0;
+
+                    offset_ += n;
+                    if (offset_ != sizeof(bulk_pos_))
+                        return false;
+
+                    std::memcpy(p.data, channel_.bulk_data(bulk_pos_), p.size);
+                    channel_.release_bulk(bulk_pos_, p.size);
+                }
+                else
+                {
+                    std::size_t const n =
+                        channel_.read(p.data + offset_, p.size - offset_);
+                    progress = progress || n != 0;
+
+                    offset_ += n;
+                    if (offset_ != p.size)
+                        return false;
+                }
+
+                offset_ = 0;
+                ++current_;
+            }
+            return true;
+        }
+
+        void handle_header()
+        {
+            state_ = connection_state::rcvd_data;
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            buffer_.data_point_.bytes_ =
+                static_cast<std::size_t>(buffer_.size_);
+#endif
+            pieces_.clear();
+            current_ = 0;
+
+            auto const num_zero_copy_chunks = static_cast<std::size_t>(
+                static_cast<std::uint32_t>(buffer_.num_chunks_.first));
+            auto const num_non_zero_copy_chunks = static_cast<std::size_t>(
+                static_cast<std::uint32_t>(buffer_.num_chunks_.second));
+
+            if (num_zero_copy_chunks != 0)
+            {
+                using transmission_chunk_type =
+                    buffer_type::transmission_chunk_type;
+
+                std::vector<transmission_chunk_type>& chunks =
+                    buffer_.transmission_chunks_;
+
+                chunks.resize(
+                    num_zero_copy_chunks + num_non_zero_copy_chunks);
+                add_piece(chunks.data(),
+                    chunks.size() * sizeof(transmission_chunk_type));
+            }
+
+            // add main buffer holding data that was serialized normally
+            buffer_.data_.resize(static_cast<std::size_t>(buffer_.size_));
+            add_piece(buffer_.data_.data(), buffer_.data_.size());
+        }
+
+        void handle_data(std::size_t num_thread)
+        {
+            auto const num_zero_copy_chunks = static_cast<std::size_t>(
+                static_cast<std::uint32_t>(buffer_.num_chunks_.first));
+            if (num_zero_copy_chunks == 0)
+            {
+                done(num_thread);
+                return;
+            }
+
+            state_ = connection_state::rcvd_chunks;
+
+            pieces_.clear();
+            current_ = 0;
+
+            buffer_.chunks_.resize(num_zero_copy_chunks);
+
+            auto is_bulk = [&](std::size_t chunk_size) {
+                return chunk_size >= params_.bulk_threshold &&
+                    chunk_size <= params_.bulk_size;
+            };
+
+            if (pp_.allow_zero_copy_receive_optimizations())
+            {
+                // De-serialize the parcels such that all data but the
+                // zero-copy chunks are in place. This de-serialization also
+                // allocates all zero-chunk buffers, the data is copied from
+                // the channel directly into those.
+                for (std::size_t i = 0; i != num_zero_copy_chunks; ++i)
+                {
+                    auto const chunk_size = static_cast<std::size_t>(
+                        buffer_.transmission_chunks_[i].second);
+                    buffer_.chunks_[i] = serialization::create_pointer_chunk(
+                        nullptr, chunk_size);
+                }
+
+                parcels_ = decode_parcels_zero_copy(pp_, buffer_, num_thread);
+
+                std::size_t zero_copy_chunks = 0;
+                for (auto& c : buffer_.chunks_)
+                {
+                    if (c.type_ == serialization::chunk_type::chunk_type_index)
+                    {
+                        continue;    // skip non-zero-copy chunks
+                    }
+
+                    auto const chunk_size = static_cast<std::size_t>(
+                        buffer_.transmission_chunks_[zero_copy_chunks++]
+                            .second);
+
+                    HPX_ASSERT_MSG(
+                        c.data() != nullptr && c.size() == chunk_size,
+                        "zero-copy chunk buffers should have been "
+                        "initialized during de-serialization");
+
+                    add_piece(c.data(), chunk_size, is_bulk(chunk_size));
+                }
+                HPX_ASSERT(zero_copy_chunks == num_zero_copy_chunks);
+            }
+            else
+            {
+                // the chunk buffers are shared with the de-serialized
+                // objects referring to the received data
+                chunk_buffers_ = std::make_shared<receive_chunk_buffers>(
+                    num_zero_copy_chunks);
+                for (std::size_t i = 0; i != num_zero_copy_chunks; ++i)
+                {
+                    auto const chunk_size = static_cast<std::size_t>(
+                        buffer_.transmission_chunks_[i].second);
+
+                    auto& chunk_buffer = (*chunk_buffers_)[i];
+                    chunk_buffer.resize(chunk_size);
+                    add_piece(
+                        chunk_buffer.data(), chunk_size, is_bulk(chunk_size));
+
+                    buffer_.chunks_[i] = serialization::create_pointer_chunk(
+                        chunk_buffer.data(), chunk_size);
+                }
+                buffer_.chunks_owner_ = chunk_buffers_;
+            }
+        }
+
+        void done(std::size_t num_thread)
+        {
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            parcelset::data_point& data = buffer_.data_point_;
+            data.time_ = timer_.elapsed_nanoseconds() - data.time_;
+#endif
+            if (parcels_.empty())
+            {
+                // decode and handle received data
+                HPX_ASSERT(buffer_.num_chunks_.first == 0 ||
+                    !pp_.allow_zero_copy_receive_optimizations());
+                handle_received_parcels(
+                    decode_parcels(pp_, HPX_MOVE(buffer_), num_thread),
+                    num_thread);
+            }
+            else
+            {
+                // handle the received zero-copy parcels.
+                HPX_ASSERT(buffer_.num_chunks_.first != 0 &&
+                    pp_.allow_zero_copy_receive_optimizations());
+                handle_received_parcels(HPX_MOVE(parcels_), num_thread);
+            }
+
+            buffer_ = buffer_type{};
+            parcels_.clear();
+            chunk_buffers_.reset();
+
+            start_header();
+        }
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+        hpx::chrono::high_resolution_timer timer_;
+#endif
+        connection_state state_;
+
+        channel channel_;
+        segment_parameters params_;
+
+        std::vector<piece> pieces_;
+        std::size_t current_;
+        std::size_t offset_;
+        std::uint64_t bulk_pos_;
+
+        buffer_type buffer_;
+        Parcelport& pp_;
+
+        std::vector<parcelset::parcel> parcels_;
+        std::shared_ptr<receive_chunk_buffers> chunk_buffers_;
+    };
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
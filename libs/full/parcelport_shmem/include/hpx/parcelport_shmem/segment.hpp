@@ -0,0 +1,192 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+// Every locality using the shared-memory parcelport creates one segment
+// (a POSIX shared memory object) all of its inbound data is delivered
+// through. The segment is divided into a number of channels, each channel is
+// owned by (at most) one sending connection at a time and consists of
+//
+//  - a single-producer/single-consumer byte ring the messages are streamed
+//    through, and
+//  - a bulk region large zero-copy chunks are copied to, the ring carries
+//    the position of the chunk inside the bulk region only.
+//
+// The receiver sleeps on a futex (the 'doorbell' of the segment) whenever
+// there is nothing to do, senders ring the doorbell after having written to
+// one of the channels.
+namespace hpx::parcelset::policies::shmem {
+
+    struct segment_parameters
+    {
+        // number of channels, this limits the number of concurrent
+        // connections to a locality
+        std::uint32_t num_channels = 32;
+
+        // size of the ring of each channel (rounded up to a power of two)
+        std::size_t ring_size = 256 * 1024;
+
+        // size of the bulk region of each channel
+        std::size_t bulk_size = 4 * 1024 * 1024;
+
+        // zero-copy chunks with at least this many bytes are transferred
+        // through the bulk region
+        std::size_t bulk_threshold = 8192;
+    };
+
+    namespace detail {
+
+        struct segment_header;
+        struct channel_header;
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A channel of a segment, both ends of the channel may be accessed by one
+    // thread at a time only.
+    class HPX_EXPORT channel
+    {
+    public:
+        constexpr channel() noexcept = default;
+
+        channel(detail::channel_header* header, char* ring,
+            std::size_t ring_size, char* bulk, std::size_t bulk_size) noexcept
+          : header_(header)
+          , ring_(ring)
+          , ring_size_(ring_size)
+          , bulk_(bulk)
+          , bulk_size_(bulk_size)
+        {
+        }
+
+        // Take ownership of the (sending end of) the channel.
+        [[nodiscard]] bool try_acquire(std::uint32_t owner) noexcept;
+        void release() noexcept;
+
+        // Append (some of) the given data to the ring, returns the number of
+        // bytes written.
+        std::size_t write(void const* data, std::size_t size) noexcept;
+
+        // Reserve space for a chunk of the given size in the bulk region,
+        // returns false if not enough space is available right now. The
+        // returned position has to be passed on to the receiver.
+        [[nodiscard]] bool allocate_bulk(
+            std::size_t size, std::uint64_t& pos) noexcept;
+
+        // Consume (some of) the data available in the ring, returns the
+        // number of bytes read.
+        std::size_t read(void* data, std::size_t size) noexcept;
+
+        // Return whether data is available in the ring.
+        [[nodiscard]] bool has_data() const noexcept;
+
+        // Give the bulk region up to the end of the chunk at the given
+        // position back to the sender.
+        void release_bulk(std::uint64_t pos, std::size_t size) noexcept;
+
+        // Access the chunk stored at the given position of the bulk region.
+        [[nodiscard]] char* bulk_data(std::uint64_t pos) const noexcept
+        {
+            return bulk_ + pos % bulk_size_;
+        }
+
+        [[nodiscard]] constexpr std::size_t bulk_size() const noexcept
+        {
+            return bulk_size_;
+        }
+
+    private:
+        detail::channel_header* header_ = nullptr;
+        char* ring_ = nullptr;
+        std::size_t ring_size_ = 0;
+        char* bulk_ = nullptr;
+        std::size_t bulk_size_ = 0;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    class HPX_EXPORT segment
+    {
+    public:
+        // Create the segment with the given name receiving data for this
+        // process, an existing (stale) segment of the same name is replaced.
+        // Throws std::system_error if the segment can't be created.
+        segment(std::string name, std::uint64_t node, std::int32_t pid,
+            segment_parameters const& params);
+
+        // Open the segment with the given name created by another process.
+        // Throws std::system_error if the segment does not exist or does not
+        // belong to the given node and process.
+        segment(std::string name, std::uint64_t node, std::int32_t pid);
+
+        segment(segment const&) = delete;
+        segment(segment&&) = delete;
+        segment& operator=(segment const&) = delete;
+        segment& operator=(segment&&) = delete;
+
+        ~segment();
+
+        [[nodiscard]] std::string const& name() const noexcept
+        {
+            return name_;
+        }
+
+        [[nodiscard]] segment_parameters const& parameters() const noexcept
+        {
+            return params_;
+        }
+
+        [[nodiscard]] channel get_channel(std::uint32_t index) const noexcept;
+
+        // Mark the segment as closed (no more data will be received) and
+        // remove its name from the system. Called by the creating process.
+        void close() noexcept;
+        [[nodiscard]] bool closed() const noexcept;
+
+        // Ring the doorbell of the segment, wakes the receiver if it is
+        // waiting.
+        void notify() noexcept;
+
+        // Wait for the doorbell to be rung (or the timeout to expire), returns
+        // immediately if any of the channels holds data.
+        void wait(std::chrono::microseconds timeout) noexcept;
+
+    private:
+        void map(int fd, std::size_t size);
+
+        std::string name_;
+        bool owner_;
+
+        detail::segment_header* header_;
+        std::size_t size_;
+        segment_parameters params_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Return an identifier for the node this process is running on.
+    // Processes seeing the same identifier can reach each other through
+    // shared memory.
+    HPX_EXPORT std::uint64_t get_node_id();
+
+    // Return the name of the segment created by the given process.
+    HPX_EXPORT std::string get_segment_name(
+        std::uint64_t node, std::int32_t pid);
+}    // namespace hpx::parcelset::policies::shmem
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
@@ -0,0 +1,176 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/assert.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/functional.hpp>
+#include <hpx/modules/logging.hpp>
+#include <hpx/modules/synchronization.hpp>
+#include <hpx/parcelport_shmem/locality.hpp>
+#include <hpx/parcelport_shmem/segment.hpp>
+#include <hpx/parcelport_shmem/sender_connection.hpp>
+
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <system_error>
+#include <utility>
+
+namespace hpx::parcelset::policies::shmem {
+
+    class sender
+    {
+    public:
+        using connection_type = sender_connection;
+        using connection_ptr = std::shared_ptr<connection_type>;
+        using connection_list = std::deque<connection_ptr>;
+
+        explicit sender(std::uint64_t node) noexcept
+          : node_(node)
+        {
+        }
+
+        // Return whether the given locality can be reached through shared
+        // memory, i.e. whether its segment can be opened.
+        bool can_connect(parcelset::locality const& l)
+        {
+            return get_segment(l) != nullptr;
+        }
+
+        connection_ptr create_connection(parcelset::locality const& l,
+            parcelset::parcelport* pp, error_code& ec)
+        {
+            std::shared_ptr<segment> seg = get_segment(l);
+            if (!seg)
+            {
+                HPX_THROWS_IF(ec, hpx::error::network_error,
+                    "shmem::sender::create_connection",
+                    "the destination {} can't be reached through shared "
+                    "memory",
+                    l);
+                return {};
+            }
+            return std::make_shared<connection_type>(
+                this, HPX_MOVE(seg), l, pp);
+        }
+
+        void add(connection_ptr const& ptr)
+        {
+            std::unique_lock l(connections_mtx_);
+            connections_.push_back(ptr);
+        }
+
+        void send_messages(connection_ptr connection)
+        {
+            // Check if sending has been completed....
+            if (connection->send())
+            {
+                hpx::move_only_function<void(std::error_code const&,
+                    parcelset::locality const&, connection_ptr)>
+                    postprocess_handler;
+                std::swap(
+                    postprocess_handler, connection->postprocess_handler_);
+                if (postprocess_handler)
+                {
+                    std::error_code const ec = connection->error();
+                    postprocess_handler(
+                        ec, connection->destination(), connection);
+                }
+            }
+            else
+            {
+                std::unique_lock l(connections_mtx_);
+                connections_.push_back(HPX_MOVE(connection));
+            }
+        }
+
+        bool background_work() noexcept
+        {
+            connection_ptr connection;
+            {
+                std::unique_lock const l(connections_mtx_, std::try_to_lock);
+                if (l && !connections_.empty())
+                {
+                    connection = HPX_MOVE(connections_.front());
+                    connections_.pop_front();
+                }
+            }
+
+            bool has_work = false;
+            if (connection)
+            {
+                send_messages(HPX_MOVE(connection));
+                has_work = true;
+            }
+            return has_work;
+        }
+
+        // Return whether any of the connections is waiting for space in the
+        // segment of its destination.
+        bool has_pending_writes()
+        {
+            std::unique_lock const l(connections_mtx_);
+            return !connections_.empty();
+        }
+
+        // Release all segments of other localities.
+        void clear()
+        {
+            std::unique_lock const l(segments_mtx_);
+            segments_.clear();
+        }
+
+    private:
+        std::shared_ptr<segment> get_segment(parcelset::locality const& l)
+        {
+            std::unique_lock const lk(segments_mtx_);
+
+            auto it = segments_.find(l);
+            if (it == segments_.end())
+            {
+                // remember unreachable localities as well
+                std::shared_ptr<segment> seg;
+
+                locality const& impl = l.get<locality>();
+                if (impl && impl.node() == node_)
+                {
+                    try
+                    {
+                        seg = std::make_shared<segment>(
+                            get_segment_name(impl.node(), impl.pid()),
+                            impl.node(), impl.pid());
+                    }
+                    catch (std::system_error const& e)
+                    {
+                        LPT_(warning).format(
+                            "shmem: can't open segment of locality {}: {}", l,
+                            e.what());
+                    }
+                }
+
+                it = segments_.emplace(l, HPX_MOVE(seg)).first;
+            }
+            return it->second;
+        }
+
+        std::uint64_t node_;
+
+        hpx::spinlock segments_mtx_;
+        std::map<parcelset::locality, std::shared_ptr<segment>> segments_;
+
+        hpx::spinlock connections_mtx_;
+        connection_list connections_;
+    };
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
@@ -0,0 +1,307 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/assert.hpp>
+#include <hpx/modules/functional.hpp>
+#include <hpx/parcelport_shmem/locality.hpp>
+#include <hpx/parcelport_shmem/segment.hpp>
+#include <hpx/parcelset/parcelport_connection.hpp>
+#include <hpx/parcelset/parcelset_fwd.hpp>
+#include <hpx/parcelset_base/detail/gatherer.hpp>
+#include <hpx/parcelset_base/locality.hpp>
+#include <hpx/parcelset_base/parcelport.hpp>
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+#include <hpx/modules/timing.hpp>
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include <unistd.h>
+
+namespace hpx::parcelset::policies::shmem {
+
+    class sender;
+    class sender_connection;
+
+    void add_connection(sender*, std::shared_ptr<sender_connection> const&);
+
+    // A connection streams messages through one of the channels of the
+    // segment of the destination. The channel is owned by the connection
+    // for the duration of a single write only, this way the number of
+    // channels limits the number of concurrent writes to a locality, not the
+    // number of connections.
+    class sender_connection
+      : public parcelset::parcelport_connection<sender_connection>
+    {
+        // a part of the message
+        struct piece
+        {
+            char const* data;
+            std::size_t size;
+
+            // the data is copied to the bulk region, only its position is
+            // streamed through the ring
+            bool bulk;
+            bool copied;
+            std::uint64_t pos;
+        };
+
+    public:
+        using handler_type =
+            hpx::move_only_function<void(std::error_code const&)>;
+        using post_handler_type =
+            hpx::move_only_function<void(std::error_code const&,
+                parcelset::locality const&,
+                std::shared_ptr<sender_connection>)>;
+
+        sender_connection(sender* s, std::shared_ptr<segment> seg,
+            parcelset::locality const& there,
+            [[maybe_unused]] parcelset::parcelport* pp)
+          : sender_(s)
+          , segment_(HPX_MOVE(seg))
+          , channel_index_(static_cast<std::uint32_t>(::getpid()) %
+                segment_->parameters().num_channels)
+          , acquired_(false)
+          , current_(0)
+          , offset_(0)
+          , there_(there)
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+          , pp_(pp)
+#endif
+        {
+        }
+
+        sender_connection(sender_connection const&) = delete;
+        sender_connection(sender_connection&&) = delete;
+        sender_connection& operator=(sender_connection const&) = delete;
+        sender_connection& operator=(sender_connection&&) = delete;
+
+        ~sender_connection()
+        {
+            if (acquired_)
+                channel_.release();
+        }
+
+        parcelset::locality const& destination() const noexcept
+        {
+            return there_;
+        }
+
+        static constexpr void verify_(
+            parcelset::locality const& /* parcel_locality_id */) noexcept
+        {
+        }
+
+        void async_write(
+            handler_type&& handler, post_handler_type&& parcel_postprocess)
+        {
+            HPX_ASSERT(!handler_);
+            HPX_ASSERT(!buffer_.data_.empty());
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            buffer_.data_point_.time_ = timer_.elapsed_nanoseconds();
+#endif
+            // assemble the message the same way as the TCP parcelport does,
+            // large zero-copy chunks are transferred through the bulk region
+            pieces_.clear();
+            current_ = 0;
+            offset_ = 0;
+            ec_ = std::error_code();
+
+            add_piece(&buffer_.size_, sizeof(buffer_.size_));
+            add_piece(&buffer_.data_size_, sizeof(buffer_.data_size_));
+            add_piece(&buffer_.num_chunks_, sizeof(buffer_.num_chunks_));
+
+            auto const& chunks = buffer_.transmission_chunks_;
+            if (!chunks.empty())
+            {
+                add_piece(chunks.data(),
+                    chunks.size() *
+                        sizeof(parcel_buffer_type::transmission_chunk_type));
+                add_piece(buffer_.data_.data(), buffer_.data_.size());
+
+                segment_parameters const& params = segment_->parameters();
+                for (serialization::serialization_chunk const& c :
+                    buffer_.chunks_)
+                {
+                    if (c.type_ ==
+                        serialization::chunk_type::chunk_type_pointer)
+                    {
+                        add_piece(c.data_.cpos_, c.size_,
+                            c.size_ >= params.bulk_threshold &&
+                                c.size_ <= params.bulk_size);
+                    }
+                }
+            }
+            else
+            {
+                add_piece(buffer_.data_.data(), buffer_.data_.size());
+            }
+
+            handler_ = HPX_MOVE(handler);
+
+            if (!send())
+            {
+                postprocess_handler_ = HPX_MOVE(parcel_postprocess);
+                add_connection(sender_, shared_from_this());
+            }
+            else
+            {
+                HPX_ASSERT(!handler_);
+                if (parcel_postprocess)
+                    parcel_postprocess(ec_, there_, shared_from_this());
+            }
+        }
+
+        // Continue writing the current message, returns true if the message
+        // was completely written (or the write failed).
+        bool send()
+        {
+            if (segment_->closed())
+            {
+                // the destination has stopped receiving data
+                ec_ = std::make_error_code(std::errc::connection_reset);
+                return done();
+            }
+
+            if (!acquire_channel())
+                return false;
+
+            bool progress = false;
+            while (current_ != pieces_.size())
+            {
+                piece& p = pieces_[current_];
+                if (p.bulk && !p.copied)
+                {
+                    if (!channel_.allocate_bulk(p.size, p.pos))
+                        break;
+
+                    std::memcpy(channel_.bulk_data(p.pos), p.data, p.size);
+                    p.copied = true;
+                }
+
+                char const* data = p.bulk ?
+                    reinterpret_cast<char const*>(&p.pos) :
+                    p.data;
+                std::size_t const size = p.bulk ? sizeof(p.pos) : p.size;
+
+                std::size_t const written =
+                    channel_.write(data + offset_, size - offset_);
+                progress = progress || written != 0;
+
+                offset_ += written;
+                if (offset_ != size)
+                    break;
+
+                offset_ = 0;
+                ++current_;
+            }
+
+            if (progress)
+                segment_->notify();
+
+            if (current_ != pieces_.size())
+                return false;
+
+            // the message is complete, let other connections use the channel
+            channel_.release();
+            acquired_ = false;
+
+            return done();
+        }
+
+        // the result of the last write
+        std::error_code const& error() const noexcept
+        {
+            return ec_;
+        }
+
+        post_handler_type postprocess_handler_;
+
+    private:
+        void add_piece(void const* data, std::size_t size, bool bulk = false)
+        {
+            pieces_.push_back(
+                piece{static_cast<char const*>(data), size, bulk, false, 0});
+        }
+
+        bool acquire_channel() noexcept
+        {
+            if (acquired_)
+                return true;
+
+            // prefer the channel used last time
+            auto const owner = static_cast<std::uint32_t>(::getpid());
+            std::uint32_t const num_channels =
+                segment_->parameters().num_channels;
+            for (std::uint32_t i = 0; i != num_channels; ++i)
+            {
+                std::uint32_t const index = (channel_index_ + i) % num_channels;
+                channel ch = segment_->get_channel(index);
+                if (ch.try_acquire(owner))
+                {
+                    channel_ = ch;
+                    channel_index_ = index;
+                    acquired_ = true;
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        bool done()
+        {
+            handler_(ec_);
+            handler_.reset();
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            if (!ec_)
+            {
+                buffer_.data_point_.time_ =
+                    timer_.elapsed_nanoseconds() - buffer_.data_point_.time_;
+                pp_->add_sent_data(buffer_.data_point_);
+            }
+#endif
+            buffer_.clear();
+            pieces_.clear();
+            return true;
+        }
+
+        sender* sender_;
+        std::shared_ptr<segment> segment_;
+
+        channel channel_;
+        std::uint32_t channel_index_;
+        bool acquired_;
+
+        std::vector<piece> pieces_;
+        std::size_t current_;
+        std::size_t offset_;
+
+        handler_type handler_;
+        std::error_code ec_;
+
+        parcelset::locality there_;
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+        hpx::chrono::high_resolution_timer timer_;
+        parcelset::parcelport* pp_;
+#endif
+    };
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
@@ -0,0 +1,326 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/execution_base.hpp>
+#include <hpx/modules/functional.hpp>
+#include <hpx/modules/logging.hpp>
+#include <hpx/modules/resource_partitioner.hpp>
+#include <hpx/modules/runtime_configuration.hpp>
+#include <hpx/modules/runtime_local.hpp>
+#include <hpx/modules/synchronization.hpp>
+#include <hpx/modules/util.hpp>
+#include <hpx/plugin/traits/plugin_config_data.hpp>
+
+#include <hpx/command_line_handling/command_line_handling.hpp>
+#include <hpx/parcelport_shmem/locality.hpp>
+#include <hpx/parcelport_shmem/receiver.hpp>
+#include <hpx/parcelport_shmem/segment.hpp>
+#include <hpx/parcelport_shmem/sender.hpp>
+#include <hpx/parcelset/parcelport_impl.hpp>
+#include <hpx/parcelset_base/locality.hpp>
+#include <hpx/plugin_factories/parcelport_factory.hpp>
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <type_traits>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::parcelset {
+
+    namespace policies::shmem {
+        class HPX_EXPORT parcelport;
+    }    // namespace policies::shmem
+
+    template <>
+    struct connection_handler_traits<policies::shmem::parcelport>
+    {
+        using connection_type = policies::shmem::sender_connection;
+        using send_early_parcel = std::false_type;
+        using do_background_work = std::true_type;
+        using send_immediate_parcels = std::false_type;
+        using is_connectionless = std::false_type;
+
+        static constexpr const char* type() noexcept
+        {
+            return "shmem";
+        }
+
+        static constexpr const char* pool_name() noexcept
+        {
+            return "parcel-pool-shmem";
+        }
+
+        static constexpr const char* pool_name_postfix() noexcept
+        {
+            return "-shmem";
+        }
+    };
+
+    namespace policies::shmem {
+
+        void add_connection(
+            sender* s, std::shared_ptr<sender_connection> const& ptr)
+        {
+            s->add(ptr);
+        }
+
+        class HPX_EXPORT parcelport : public parcelport_impl<parcelport>
+        {
+            using base_type = parcelport_impl<parcelport>;
+
+            static parcelset::locality here()
+            {
+                static std::uint64_t const node = get_node_id();
+                return parcelset::locality(
+                    locality(node, static_cast<std::int32_t>(::getpid())));
+            }
+
+            static segment_parameters parameters(
+                util::runtime_configuration const& ini)
+            {
+                segment_parameters params;
+                params.num_channels = hpx::util::get_entry_as<std::uint32_t>(
+                    ini, "hpx.parcel.shmem.channels", params.num_channels);
+                params.ring_size = hpx::util::get_entry_as<std::size_t>(
+                    ini, "hpx.parcel.shmem.ring_size", params.ring_size);
+                params.bulk_size = hpx::util::get_entry_as<std::size_t>(
+                    ini, "hpx.parcel.shmem.bulk_size", params.bulk_size);
+                params.bulk_threshold = hpx::util::get_entry_as<std::size_t>(
+                    ini, "hpx.parcel.shmem.bulk_threshold",
+                    params.bulk_threshold);
+                return params;
+            }
+
+            static std::size_t spin_count(
+                util::runtime_configuration const& ini)
+            {
+                return hpx::util::get_entry_as<std::size_t>(
+                    ini, "hpx.parcel.shmem.spin_count", 1024);
+            }
+
+        public:
+            parcelport(util::runtime_configuration const& ini,
+                threads::policies::callback_notifier const& notifier)
+              : base_type(ini, here(), notifier)
+              , stopped_(false)
+              , receiver_(*this)
+              , sender_(here().get<locality>().node())
+              , spin_count_(spin_count(ini))
+            {
+                // The segment has to exist before this locality is made
+                // known to the others. If it can't be created, the other
+                // localities don't use this parcelport to reach us.
+                locality const l = here().get<locality>();
+                try
+                {
+                    segment_ = std::make_unique<segment>(
+                        get_segment_name(l.node(), l.pid()), l.node(), l.pid(),
+                        parameters(ini));
+                    receiver_.run(segment_.get());
+                }
+                catch (std::system_error const& e)
+                {
+                    LPT_(warning).format(
+                        "shmem: can't create shared memory segment: {}",
+                        e.what());
+                }
+            }
+
+            parcelport(parcelport const&) = delete;
+            parcelport(parcelport&&) = delete;
+            parcelport& operator=(parcelport const&) = delete;
+            parcelport& operator=(parcelport&&) = delete;
+
+            ~parcelport() override = default;
+
+            // Start the handling of connections.
+            bool do_run()
+            {
+                // the receiving side is driven by a thread of the parcel
+                // pool which sleeps while there is nothing to do
+                if (segment_)
+                {
+                    io_service_pool_.get_io_service(0).post(
+                        hpx::bind(&parcelport::io_service_work, this));
+                }
+                return true;
+            }
+
+            // Stop the handling of connections.
+            void do_stop()
+            {
+                while (do_background_work(0, parcelport_background_mode::all))
+                {
+                    if (threads::get_self_ptr())
+                    {
+                        hpx::this_thread::suspend(
+                            hpx::threads::thread_schedule_state::pending,
+                            "shmem::parcelport::do_stop");
+                    }
+                }
+
+                bool expected = false;
+                if (stopped_.compare_exchange_strong(expected, true))
+                {
+                    // this wakes up the receiving thread as well
+                    if (segment_)
+                        segment_->close();
+                    sender_.clear();
+                }
+            }
+
+            // Shared memory is used for localities running on this node
+            // only, all other destinations are left to the network
+            // parcelports.
+            bool can_connect(parcelset::locality const& l,
+                bool use_alternative_parcelport) override
+            {
+                return use_alternative_parcelport && sender_.can_connect(l);
+            }
+
+            /// Return the name of this locality
+            std::string get_locality_name() const override
+            {
+                char hostname[256] = {};
+                ::gethostname(hostname, sizeof(hostname) - 1);
+                return hostname;
+            }
+
+            std::shared_ptr<sender_connection> create_connection(
+                parcelset::locality const& l, error_code& ec)
+            {
+                return sender_.create_connection(l, this, ec);
+            }
+
+            parcelset::locality agas_locality(
+                util::runtime_configuration const&) const override
+            {
+                // this parcelport is never used for bootstrapping
+                return parcelset::locality(locality());
+            }
+
+            parcelset::locality create_locality() const override
+            {
+                return parcelset::locality(locality());
+            }
+
+            bool background_work(
+                std::size_t num_thread, parcelport_background_mode mode)
+            {
+                if (stopped_.load(std::memory_order_acquire))
+                {
+                    return false;
+                }
+
+                bool has_work = false;
+                if (mode & parcelport_background_mode::send)
+                {
+                    has_work = sender_.background_work();
+                }
+                if (mode & parcelport_background_mode::receive)
+                {
+                    has_work =
+                        receiver_.background_work(num_thread) || has_work;
+                }
+                return has_work;
+            }
+
+        private:
+            void io_service_work()
+            {
+                std::size_t k = 0;
+                while (!stopped_.load(std::memory_order_acquire))
+                {
+                    bool has_work = sender_.background_work();
+                    has_work = receiver_.background_work() || has_work;
+                    if (has_work)
+                    {
+                        k = 0;
+                    }
+                    else if (++k < spin_count_ || sender_.has_pending_writes())
+                    {
+                        util::detail::yield_k((std::min) (k, std::size_t(31)),
+                            "hpx::parcelset::policies::shmem::parcelport::"
+                            "io_service_work");
+                    }
+                    else
+                    {
+                        // wait for a sender to ring the doorbell, the
+                        // timeout is a safety net only
+                        receiver_.wait(std::chrono::milliseconds(100));
+                        k = 0;
+                    }
+                }
+            }
+
+            std::atomic<bool> stopped_;
+
+            std::unique_ptr<segment> segment_;
+            receiver<parcelport> receiver_;
+            sender sender_;
+
+            std::size_t spin_count_;
+        };
+    }    // namespace policies::shmem
+}    // namespace hpx::parcelset
+
+#include <hpx/config/warnings_suffix.hpp>
+
+// Inject additional configuration data into the factory registry for this
+// type. This information ends up in the system-wide configuration database
+// under the plugin specific section:
+//
+//      [hpx.parcel.shmem]
+//      ...
+//      priority = 200
+//
+template <>
+struct hpx::traits::plugin_config_data<
+    hpx::parcelset::policies::shmem::parcelport>
+{
+    // Take precedence over the network parcelports, the shared-memory
+    // parcelport only accepts destinations on the same node.
+    static constexpr char const* priority() noexcept
+    {
+        return "200";
+    }
+
+    // no additional initialization is required
+    static constexpr void init(
+        int*, char***, util::command_line_handling&) noexcept
+    {
+    }
+
+    static constexpr void init(hpx::resource::partitioner&) noexcept {}
+
+    static constexpr void destroy() noexcept {}
+
+    static constexpr char const* call() noexcept
+    {
+        return "channels = ${HPX_PARCELPORT_SHMEM_CHANNELS:32}\n"
+               "ring_size = ${HPX_PARCELPORT_SHMEM_RING_SIZE:262144}\n"
+               "bulk_size = ${HPX_PARCELPORT_SHMEM_BULK_SIZE:4194304}\n"
+               "bulk_threshold = ${HPX_PARCELPORT_SHMEM_BULK_THRESHOLD:8192}\n"
+               "spin_count = ${HPX_PARCELPORT_SHMEM_SPIN_COUNT:1024}\n";
+    }
+};    // namespace hpx::traits
+
+HPX_REGISTER_PARCELPORT(hpx::parcelset::policies::shmem::parcelport, shmem)
+
+#endif
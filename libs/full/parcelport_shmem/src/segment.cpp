@@ -0,0 +1,473 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/assert.hpp>
+
+#include <hpx/parcelport_shmem/segment.hpp>
+
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <system_error>
+#include <utility>
+
+namespace hpx::parcelset::policies::shmem {
+
+    namespace detail {
+
+        inline constexpr std::uint64_t segment_magic = 0x306d68732d787068;
+        inline constexpr std::uint32_t segment_version = 1;
+
+        inline constexpr std::size_t page_size = 4096;
+
+        // The layout of the segment is shared between processes, we
+        // therefore use a fixed cache line size.
+        inline constexpr std::size_t cache_line_size = 64;
+
+        static_assert(std::atomic<std::uint32_t>::is_always_lock_free &&
+                std::atomic<std::uint64_t>::is_always_lock_free,
+            "the shared-memory parcelport relies on address-free atomics");
+
+        struct segment_header
+        {
+            // written last by the creating process
+            std::atomic<std::uint64_t> magic;
+            std::uint32_t version;
+            std::uint32_t num_channels;
+
+            std::uint64_t node;
+            std::int32_t pid;
+            std::uint32_t reserved;
+
+            std::uint64_t ring_size;
+            std::uint64_t bulk_size;
+            std::uint64_t bulk_threshold;
+            std::uint64_t size;
+
+            // incremented by the senders
+            alignas(cache_line_size) std::atomic<std::uint32_t> doorbell;
+
+            // set by the receiver while it is (about to start) waiting
+            alignas(cache_line_size) std::atomic<std::uint32_t> sleeping;
+            std::atomic<std::uint32_t> closed;
+        };
+
+        struct channel_header
+        {
+            // modified by the sender only
+            alignas(cache_line_size) std::atomic<std::uint32_t> owner;
+            std::atomic<std::uint64_t> head;
+            std::atomic<std::uint64_t> bulk_head;
+
+            // modified by the receiver only
+            alignas(cache_line_size) std::atomic<std::uint64_t> tail;
+            std::atomic<std::uint64_t> bulk_tail;
+        };
+
+        constexpr std::size_t round_up(std::size_t n, std::size_t to) noexcept
+        {
+            return (n + to - 1) / to * to;
+        }
+
+        constexpr std::size_t next_power_of_two(std::size_t n) noexcept
+        {
+            std::size_t result = page_size;
+            while (result < n)
+                result <<= 1;
+            return result;
+        }
+
+        constexpr std::size_t channels_offset() noexcept
+        {
+            return round_up(sizeof(segment_header), cache_line_size);
+        }
+
+        constexpr std::size_t data_offset(std::size_t num_channels) noexcept
+        {
+            return round_up(
+                channels_offset() + num_channels * sizeof(channel_header),
+                page_size);
+        }
+
+        constexpr std::size_t segment_size(
+            segment_parameters const& params) noexcept
+        {
+            return data_offset(params.num_channels) +
+                params.num_channels * (params.ring_size + params.bulk_size);
+        }
+
+        [[noreturn]] void throw_system_error(
+            std::string const& name, char const* what)
+        {
+            throw std::system_error(
+                errno, std::system_category(), "shmem: " + name + ": " + what);
+        }
+
+        long sys_futex(std::atomic<std::uint32_t>* addr, int op,
+            std::uint32_t val, timespec const* timeout) noexcept
+        {
+            // the segment is shared between processes, we can't use private
+            // futexes here
+            return ::syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(addr),
+                op, val, timeout, nullptr, 0);
+        }
+
+        void fnv1a(std::uint64_t& hash, std::string const& data) noexcept
+        {
+            for (char const c : data)
+            {
+                hash ^= static_cast<unsigned char>(c);
+                hash *= 0x100000001b3;
+            }
+        }
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    bool channel::try_acquire(std::uint32_t owner) noexcept
+    {
+        HPX_ASSERT(owner != 0);
+
+        std::uint32_t expected = 0;
+        return header_->owner.compare_exchange_strong(
+            expected, owner, std::memory_order_acquire);
+    }
+
+    void channel::release() noexcept
+    {
+        // the next owner continues streaming where we stopped
+        header_->owner.store(0, std::memory_order_release);
+    }
+
+    std::size_t channel::write(void const* data, std::size_t size) noexcept
+    {
+        std::uint64_t const head =
+            header_->head.load(std::memory_order_relaxed);
+        std::uint64_t const tail =
+            header_->tail.load(std::memory_order_acquire);
+
+        std::size_t const n = (std::min) (size,
+            ring_size_ - static_cast<std::size_t>(head - tail));
+        if (n == 0)
+            return 0;
+
+        std::size_t const offset =
+            static_cast<std::size_t>(head & (ring_size_ - 1));
+        std::size_t const first = (std::min) (n, ring_size_ - offset);
+
+        std::memcpy(ring_ + offset, data, first);
+        std::memcpy(ring_, static_cast<char const*>(data) + first, n - first);
+
+        header_->head.store(head + n, std::memory_order_release);
+        return n;
+    }
+
+    bool channel::allocate_bulk(std::size_t size, std::uint64_t& pos) noexcept
+    {
+        HPX_ASSERT(size <= bulk_size_);
+
+        std::uint64_t const head =
+            header_->bulk_head.load(std::memory_order_relaxed);
+        std::uint64_t const tail =
+            header_->bulk_tail.load(std::memory_order_acquire);
+
+        // chunks are never wrapped around the end of the bulk region
+        std::uint64_t start = head;
+        if (std::size_t const offset = head % bulk_size_;
+            offset + size > bulk_size_)
+        {
+            start += bulk_size_ - offset;
+        }
+
+        // the skipped space counts as used until the receiver has released
+        // the chunk, an empty bulk region can always be used, though
+        if (head != tail && start + size - tail > bulk_size_)
+            return false;
+
+        // the position is published through the ring
+        header_->bulk_head.store(start + size, std::memory_order_relaxed);
+        pos = start;
+        return true;
+    }
+
+    std::size_t channel::read(void* data, std::size_t size) noexcept
+    {
+        std::uint64_t const tail =
+            header_->tail.load(std::memory_order_relaxed);
+        std::uint64_t const head =
+            header_->head.load(std::memory_order_acquire);
+
+        std::size_t const n =
+            (std::min) (size, static_cast<std::size_t>(head - tail));
+        if (n == 0)
+            return 0;
+
+        std::size_t const offset =
+            static_cast<std::size_t>(tail & (ring_size_ - 1));
+        std::size_t const first = (std::min) (n, ring_size_ - offset);
+
+        std::memcpy(data, ring_ + offset, first);
+        std::memcpy(static_cast<char*>(data) + first, ring_, n - first);
+
+        header_->tail.store(tail + n, std::memory_order_release);
+        return n;
+    }
+
+    bool channel::has_data() const noexcept
+    {
+        return header_->head.load(std::memory_order_acquire) !=
+            header_->tail.load(std::memory_order_relaxed);
+    }
+
+    void channel::release_bulk(std::uint64_t pos, std::size_t size) noexcept
+    {
+        header_->bulk_tail.store(pos + size, std::memory_order_release);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    segment::segment(std::string name, std::uint64_t node, std::int32_t pid,
+        segment_parameters const& params)
+      : name_(HPX_MOVE(name))
+      , owner_(true)
+      , header_(nullptr)
+      , size_(0)
+      , params_(params)
+    {
+        params_.num_channels = (std::max) (params_.num_channels, 1U);
+        params_.ring_size = detail::next_power_of_two(params_.ring_size);
+        params_.bulk_size =
+            detail::round_up(params_.bulk_size, detail::page_size);
+
+        // a process with the same id as ours must have died without
+        // cleaning up
+        ::shm_unlink(name_.c_str());
+
+        int const fd = ::shm_open(
+            name_.c_str(), O_RDWR | O_CREAT | O_EXCL | O_CLOEXEC, 0600);
+        if (fd == -1)
+            detail::throw_system_error(name_, "shm_open");
+
+        std::size_t const size = detail::segment_size(params_);
+        if (::ftruncate(fd, static_cast<off_t>(size)) == -1)
+        {
+            int const e = errno;
+            ::close(fd);
+            ::shm_unlink(name_.c_str());
+            errno = e;
+            detail::throw_system_error(name_, "ftruncate");
+        }
+
+        try
+        {
+            map(fd, size);
+        }
+        catch (...)
+        {
+            ::shm_unlink(name_.c_str());
+            throw;
+        }
+
+        // the memory is zero-initialized, all channels are free and empty
+        header_->version = detail::segment_version;
+        header_->num_channels = params_.num_channels;
+        header_->node = node;
+        header_->pid = pid;
+        header_->ring_size = params_.ring_size;
+        header_->bulk_size = params_.bulk_size;
+        header_->bulk_threshold = params_.bulk_threshold;
+        header_->size = size;
+
+        header_->magic.store(detail::segment_magic, std::memory_order_release);
+    }
+
+    segment::segment(std::string name, std::uint64_t node, std::int32_t pid)
+      : name_(HPX_MOVE(name))
+      , owner_(false)
+      , header_(nullptr)
+      , size_(0)
+    {
+        int const fd = ::shm_open(name_.c_str(), O_RDWR | O_CLOEXEC, 0);
+        if (fd == -1)
+            detail::throw_system_error(name_, "shm_open");
+
+        struct stat st = {};
+        if (::fstat(fd, &st) == -1)
+        {
+            ::close(fd);
+            detail::throw_system_error(name_, "fstat");
+        }
+
+        if (static_cast<std::size_t>(st.st_size) <
+            sizeof(detail::segment_header))
+        {
+            ::close(fd);
+            errno = EINVAL;
+            detail::throw_system_error(name_, "segment too small");
+        }
+
+        map(fd, static_cast<std::size_t>(st.st_size));
+
+        if (header_->magic.load(std::memory_order_acquire) !=
+                detail::segment_magic ||
+            header_->version != detail::segment_version ||
+            header_->node != node || header_->pid != pid ||
+            header_->size != size_)
+        {
+            errno = EINVAL;
+            detail::throw_system_error(name_, "unexpected segment layout");
+        }
+
+        params_.num_channels = header_->num_channels;
+        params_.ring_size = header_->ring_size;
+        params_.bulk_size = header_->bulk_size;
+        params_.bulk_threshold = header_->bulk_threshold;
+    }
+
+    segment::~segment()
+    {
+        if (owner_)
+            close();
+
+        if (header_ != nullptr)
+            ::munmap(header_, size_);
+    }
+
+    void segment::map(int fd, std::size_t size)
+    {
+        void* addr =
+            ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        int const e = errno;
+        ::close(fd);
+
+        if (addr == MAP_FAILED)
+        {
+            errno = e;
+            detail::throw_system_error(name_, "mmap");
+        }
+
+        header_ = static_cast<detail::segment_header*>(addr);
+        size_ = size;
+    }
+
+    channel segment::get_channel(std::uint32_t index) const noexcept
+    {
+        HPX_ASSERT(index < params_.num_channels);
+
+        char* base = reinterpret_cast<char*>(header_);
+        auto* channels = reinterpret_cast<detail::channel_header*>(
+            base + detail::channels_offset());
+
+        char* ring = base + detail::data_offset(params_.num_channels) +
+            index * (params_.ring_size + params_.bulk_size);
+
+        return {&channels[index], ring, params_.ring_size,
+            ring + params_.ring_size, params_.bulk_size};
+    }
+
+    void segment::close() noexcept
+    {
+        HPX_ASSERT(owner_);
+        if (header_->closed.exchange(1) == 0)
+        {
+            ::shm_unlink(name_.c_str());
+            notify();
+        }
+    }
+
+    bool segment::closed() const noexcept
+    {
+        return header_->closed.load(std::memory_order_acquire) != 0;
+    }
+
+    void segment::notify() noexcept
+    {
+        // this pairs with the store to 'sleeping' and the load of the
+        // doorbell in wait() (Dekker style), either the receiver sees the
+        // new doorbell value or we see it sleeping
+        header_->doorbell.fetch_add(1, std::memory_order_seq_cst);
+        if (header_->sleeping.load(std::memory_order_seq_cst) != 0)
+        {
+            detail::sys_futex(&header_->doorbell, FUTEX_WAKE, 1, nullptr);
+        }
+    }
+
+    void segment::wait(std::chrono::microseconds timeout) noexcept
+    {
+        HPX_ASSERT(owner_);
+
+        header_->sleeping.store(1, std::memory_order_seq_cst);
+        std::uint32_t const doorbell =
+            header_->doorbell.load(std::memory_order_seq_cst);
+
+        bool has_data = closed();
+        for (std::uint32_t i = 0; !has_data && i != params_.num_channels; ++i)
+        {
+            has_data = get_channel(i).has_data();
+        }
+
+        if (!has_data)
+        {
+            auto const s =
+                std::chrono::duration_cast<std::chrono::seconds>(timeout);
+            timespec const ts = {static_cast<std::time_t>(s.count()),
+                static_cast<long>(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        timeout - s)
+                        .count())};
+
+            // returns immediately if the doorbell was rung in between
+            detail::sys_futex(&header_->doorbell, FUTEX_WAIT, doorbell, &ts);
+        }
+
+        header_->sleeping.store(0, std::memory_order_relaxed);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::uint64_t get_node_id()
+    {
+        // all processes on one node share the host name and the boot id
+        std::uint64_t hash = 0xcbf29ce484222325;
+
+        char hostname[256] = {};
+        ::gethostname(hostname, sizeof(hostname) - 1);
+        detail::fnv1a(hash, hostname);
+
+        std::ifstream boot_id("/proc/sys/kernel/random/boot_id");
+        detail::fnv1a(hash,
+            std::string(std::istreambuf_iterator<char>(boot_id),
+                std::istreambuf_iterator<char>()));
+
+        return hash;
+    }
+
+    std::string get_segment_name(std::uint64_t node, std::int32_t pid)
+    {
+        char name[64];
+        std::snprintf(name, sizeof(name), "/hpx.shmem.%016llx.%d",
+            static_cast<unsigned long long>(node), static_cast<int>(pid));
+        return name;
+    }
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
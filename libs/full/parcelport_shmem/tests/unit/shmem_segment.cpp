@@ -0,0 +1,202 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/modules/testing.hpp>
+#include <hpx/parcelport_shmem/segment.hpp>
+
+#include <unistd.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+using hpx::parcelset::policies::shmem::channel;
+using hpx::parcelset::policies::shmem::segment;
+using hpx::parcelset::policies::shmem::segment_parameters;
+
+///////////////////////////////////////////////////////////////////////////////
+constexpr std::size_t num_messages = 2000;
+
+std::size_t message_size(std::size_t i)
+{
+    return (i * 7919) % 65536 + 1;
+}
+
+std::uint64_t const node = hpx::parcelset::policies::shmem::get_node_id();
+auto const pid = static_cast<std::int32_t>(::getpid());
+
+///////////////////////////////////////////////////////////////////////////////
+void test_open()
+{
+    std::string const name =
+        hpx::parcelset::policies::shmem::get_segment_name(node, pid);
+
+    segment_parameters params;
+    params.num_channels = 3;
+    params.ring_size = 5000;
+
+    segment s(name, node, pid, params);
+
+    // the ring size is rounded up to a power of two
+    HPX_TEST_EQ(s.parameters().num_channels, 3U);
+    HPX_TEST_EQ(s.parameters().ring_size, static_cast<std::size_t>(8192));
+
+    segment r(name, node, pid);
+    HPX_TEST_EQ(r.parameters().num_channels, 3U);
+    HPX_TEST_EQ(r.parameters().ring_size, s.parameters().ring_size);
+    HPX_TEST_EQ(r.parameters().bulk_size, s.parameters().bulk_size);
+
+    // a segment is opened only if it belongs to the expected process
+    bool caught_exception = false;
+    try
+    {
+        segment wrong(name, node, pid + 1);
+    }
+    catch (std::system_error const&)
+    {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+
+    // a channel is owned by one sender at a time
+    channel c = r.get_channel(1);
+    HPX_TEST(c.try_acquire(1));
+    HPX_TEST(!c.try_acquire(2));
+    c.release();
+    HPX_TEST(c.try_acquire(2));
+    c.release();
+
+    HPX_TEST(!r.closed());
+    s.close();
+    HPX_TEST(r.closed());
+
+    // the name has been removed
+    caught_exception = false;
+    try
+    {
+        segment closed(name, node, pid);
+    }
+    catch (std::system_error const&)
+    {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_stream()
+{
+    std::string const name =
+        hpx::parcelset::policies::shmem::get_segment_name(node, pid);
+
+    segment_parameters params;
+    params.num_channels = 2;
+    params.ring_size = 8192;
+    params.bulk_size = 70000;
+    params.bulk_threshold = 8192;
+
+    segment s(name, node, pid, params);
+    segment r(name, node, pid);
+
+    // the sender streams the size of each message followed by its data,
+    // large messages are placed in the bulk region
+    std::thread sender([&]() {
+        channel c = r.get_channel(1);
+        HPX_TEST(c.try_acquire(42));
+
+        auto write = [&](void const* data, std::size_t size) {
+            std::size_t offset = 0;
+            while (offset != size)
+            {
+                offset += c.write(
+                    static_cast<char const*>(data) + offset, size - offset);
+                r.notify();
+            }
+        };
+
+        for (std::size_t i = 0; i != num_messages; ++i)
+        {
+            std::size_t const size = message_size(i);
+            std::vector<unsigned char> msg(size);
+            for (std::size_t j = 0; j != size; ++j)
+                msg[j] = static_cast<unsigned char>(i + j);
+
+            std::uint64_t header[2] = {size, 0};
+            if (size >= params.bulk_threshold)
+            {
+                while (!c.allocate_bulk(size, header[1]))
+                    std::this_thread::yield();
+                std::memcpy(c.bulk_data(header[1]), msg.data(), size);
+                write(header, sizeof(header));
+            }
+            else
+            {
+                write(header, sizeof(header));
+                write(msg.data(), size);
+            }
+        }
+        c.release();
+    });
+
+    channel c = s.get_channel(1);
+    auto read = [&](void* data, std::size_t size) {
+        std::size_t offset = 0;
+        while (offset != size)
+        {
+            std::size_t const n =
+                c.read(static_cast<char*>(data) + offset, size - offset);
+            if (n == 0)
+                s.wait(std::chrono::milliseconds(100));
+            offset += n;
+        }
+    };
+
+    std::size_t errors = 0;
+    for (std::size_t i = 0; i != num_messages; ++i)
+    {
+        std::uint64_t header[2] = {};
+        read(header, sizeof(header));
+
+        std::size_t const size = message_size(i);
+        HPX_TEST_EQ(header[0], static_cast<std::uint64_t>(size));
+
+        std::vector<unsigned char> msg(size);
+        if (size >= params.bulk_threshold)
+        {
+            std::memcpy(msg.data(), c.bulk_data(header[1]), size);
+            c.release_bulk(header[1], size);
+        }
+        else
+        {
+            read(msg.data(), size);
+        }
+
+        for (std::size_t j = 0; j != size; ++j)
+        {
+            if (msg[j] != static_cast<unsigned char>(i + j))
+                ++errors;
+        }
+    }
+
+    sender.join();
+
+    HPX_TEST_EQ(errors, static_cast<std::size_t>(0));
+    HPX_TEST(!c.has_data());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_open();
+    test_stream();
+
+    return hpx::util::report_errors();
+}
@@ -13,6 +13,7 @@
 #include <hpx/config.hpp>
 
 #if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_TCP)
+#include <hpx/parcelport_tcp/io_uring_transport.hpp>
 #include <hpx/parcelport_tcp/locality.hpp>
 #include <hpx/parcelport_tcp/sender.hpp>
 #include <hpx/parcelset/parcelport_impl.hpp>
@@ -115,6 +116,13 @@ namespace hpx::parcelset {
             void handle_read_completion(std::error_code const& e,
                 std::shared_ptr<receiver> const& receiver_conn);
 
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+            // return the io_uring transport associated with the given
+            // io_context, nullptr if io_uring is not used
+            io_uring_transport* get_io_uring_transport(
+                asio::execution_context& ctx) const noexcept;
+#endif
+
             /// Acceptor used to listen for incoming connections.
             asio::ip::tcp::acceptor* acceptor_;
 
@@ -129,6 +137,16 @@ namespace hpx::parcelset {
             using write_connections_set = std::set<std::weak_ptr<sender>>;
             write_connections_set write_connections_;
 #endif
+
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+            // one io_uring transport per io_context of the parcel pool, the
+            // transports are kept alive as long as connections may refer to
+            // them
+            bool use_io_uring_;
+            io_uring_parameters io_uring_params_;
+            std::vector<std::unique_ptr<io_uring_transport>>
+                io_uring_transports_;
+#endif
         };
     }    // namespace policies::tcp
 }    // namespace hpx::parcelset
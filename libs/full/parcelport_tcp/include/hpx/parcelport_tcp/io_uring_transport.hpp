@@ -0,0 +1,239 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_TCP) &&        \
+    defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+#include <hpx/modules/functional.hpp>
+#include <hpx/modules/synchronization.hpp>
+
+#include <asio/buffer.hpp>
+#include <asio/io_context.hpp>
+#include <asio/posix/stream_descriptor.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+// The io_uring transport replaces the reactor based asio operations used by
+// the TCP parcelport:
+//
+//  - all buffers of an outgoing message (the gather list assembled by the
+//    sender) are handed to the kernel using a single sendmsg operation, large
+//    zero-copy chunks are sent using zero-copy sends,
+//  - incoming data is received using multishot receive operations into a ring
+//    of buffers registered with the kernel, and
+//  - operations initiated while completions are being processed are
+//    submitted to the kernel in one batch.
+//
+// Completions are signaled through an eventfd which is monitored by the
+// io_context the transport is associated with, all handlers are invoked on
+// the threads running this io_context.
+namespace hpx::parcelset::policies::tcp {
+
+    struct io_uring_parameters
+    {
+        // number of submission queue entries
+        std::uint32_t queue_depth = 256;
+
+        // number and size of the registered receive buffers
+        std::uint32_t num_receive_buffers = 128;
+        std::uint32_t receive_buffer_size = 16384;
+
+        // messages with at least this many bytes of zero-copy chunks are sent
+        // using zero-copy send operations
+        std::size_t zero_copy_threshold = 65536;
+    };
+
+    namespace detail {
+
+        struct io_uring_ring;
+        struct io_uring_operation;
+        struct io_uring_receive_operation;
+        struct io_uring_send_operation;
+    }    // namespace detail
+
+    class io_uring_transport;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A connected socket driven by an io_uring_transport. All data received
+    // on the socket is collected by a multishot receive operation, read
+    // requests are satisfied from the received data.
+    class HPX_EXPORT io_uring_stream
+      : public std::enable_shared_from_this<io_uring_stream>
+    {
+    public:
+        using handler_type =
+            hpx::move_only_function<void(std::error_code const&, std::size_t)>;
+
+        io_uring_stream(io_uring_transport& transport, int fd) noexcept;
+
+        io_uring_stream(io_uring_stream const&) = delete;
+        io_uring_stream(io_uring_stream&&) = delete;
+        io_uring_stream& operator=(io_uring_stream const&) = delete;
+        io_uring_stream& operator=(io_uring_stream&&) = delete;
+
+        ~io_uring_stream() = default;
+
+        // Asynchronously fill all of the given buffers. The handler is never
+        // invoked from inside this function, unless the transport has been
+        // stopped already.
+        void async_read(std::vector<asio::mutable_buffer> const& buffers,
+            handler_type&& handler);
+
+        // Asynchronously send all of the given buffers (gather-write). The
+        // number of bytes stored in zero-copy chunks decides whether a
+        // zero-copy send operation is used. If the transport has been
+        // stopped already the handler is invoked right away with
+        // asio::error::operation_aborted.
+        void async_write(std::vector<asio::const_buffer> const& buffers,
+            handler_type&& handler, std::size_t zero_copy_bytes = 0);
+
+        // Cancel all operations outstanding for this stream, this has to be
+        // called before the socket is closed.
+        void cancel();
+
+    private:
+        friend class io_uring_transport;
+        friend struct detail::io_uring_receive_operation;
+
+        void start_receive();
+
+        // called by the transport for every chunk of received data, a
+        // result of zero signals the end of the stream
+        void on_receive(char const* data, std::size_t size);
+        void on_receive_error(std::error_code const& e);
+
+        // the transport was stopped, abort the pending read request
+        void abort();
+
+        // copy data to the current read request, returns the number of
+        // bytes consumed
+        std::size_t fill_request(char const* data, std::size_t size) noexcept;
+
+        io_uring_transport& transport_;
+        int fd_;
+
+        hpx::spinlock mtx_;
+
+        // data received while no (or a satisfied) read request was pending
+        std::vector<char> pending_;
+        std::size_t pending_offset_ = 0;
+
+        // the current read request
+        std::vector<asio::mutable_buffer> request_;
+        std::size_t request_index_ = 0;
+        std::size_t request_offset_ = 0;
+        std::size_t request_bytes_ = 0;
+        handler_type request_handler_;
+
+        // sticky error (including end of stream)
+        std::error_code error_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    class HPX_EXPORT io_uring_transport
+    {
+    public:
+        // throws std::system_error if io_uring (or one of the required
+        // operations) is not supported by the running kernel
+        io_uring_transport(
+            asio::io_context& io_service, io_uring_parameters const& params);
+
+        io_uring_transport(io_uring_transport const&) = delete;
+        io_uring_transport(io_uring_transport&&) = delete;
+        io_uring_transport& operator=(io_uring_transport const&) = delete;
+        io_uring_transport& operator=(io_uring_transport&&) = delete;
+
+        ~io_uring_transport();
+
+        asio::io_context& get_io_service() noexcept
+        {
+            return io_service_;
+        }
+
+        // Start/stop monitoring completions. Stopping the transport aborts
+        // all outstanding operations, their handlers are invoked with
+        // asio::error::operation_aborted before stop returns. After that
+        // the transport does not refer to the io_context anymore.
+        void start();
+        void stop();
+
+        // create a new stream for the given connected socket
+        std::shared_ptr<io_uring_stream> create_stream(int fd);
+
+    private:
+        friend class io_uring_stream;
+        friend struct detail::io_uring_operation;
+        friend struct detail::io_uring_receive_operation;
+        friend struct detail::io_uring_send_operation;
+
+        template <typename F>
+        void submit(detail::io_uring_operation* op, F&& prepare);
+
+        void submit_receive(detail::io_uring_operation* op, int fd);
+        void submit_send(
+            detail::io_uring_operation* op, int fd, void* msg, bool zero_copy);
+
+        // hand a registered receive buffer back to the kernel
+        void recycle_buffer(std::uint16_t bid) noexcept;
+        char const* get_buffer(std::uint16_t bid) const noexcept;
+
+        // Invoke the given handler from the io_context. Once the transport
+        // is stopped the io_context may not run anymore, the handler is then
+        // invoked directly with asio::error::operation_aborted (or after all
+        // outstanding operations have been released if called from stop).
+        void post(io_uring_stream::handler_type&& handler,
+            std::error_code const& e, std::size_t bytes);
+
+        void release_operations();
+
+        void async_wait();
+        void handle_completions();
+        std::size_t reap_completions();
+        void flush_submissions();
+
+        bool stopped() const noexcept
+        {
+            return stopped_.load(std::memory_order_acquire);
+        }
+
+        asio::io_context& io_service_;
+        io_uring_parameters params_;
+
+        std::unique_ptr<detail::io_uring_ring> ring_;
+
+        // eventfd the kernel signals whenever completions are available,
+        // released when the transport is stopped
+        std::unique_ptr<asio::posix::stream_descriptor> event_;
+
+        hpx::spinlock submit_mtx_;
+        std::mutex completion_mtx_;
+
+        std::atomic<std::size_t> operations_in_flight_;
+        std::atomic<bool> stopped_;
+
+        // handlers of the operations aborted by stop, accessed by the
+        // thread executing stop only
+        std::vector<std::pair<io_uring_stream::handler_type, std::size_t>>
+            aborted_;
+    };
+}    // namespace hpx::parcelset::policies::tcp
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
@@ -21,8 +21,10 @@
 #include <hpx/modules/timing.hpp>
 
 #include <hpx/parcelport_tcp/connection_handler.hpp>
+#include <hpx/parcelport_tcp/io_uring_transport.hpp>
 #include <hpx/parcelset/decode_parcels.hpp>
 #include <hpx/parcelset/parcelport_connection.hpp>
+#include <hpx/parcelset/receive_buffer_pool.hpp>
 #include <hpx/parcelset_base/detail/data_point.hpp>
 
 #if defined(WIN32) || defined(_WIN32) || defined(__WIN32__)
@@ -53,7 +55,8 @@ namespace hpx::parcelset::policies::tcp {
 
     class connection_handler;
 
-    class receiver : public parcelport_connection<receiver>
+    class receiver
+      : public parcelport_connection<receiver, receive_buffer_type>
     {
     public:
         receiver(asio::io_context& io_service, std::uint64_t max_inbound_size,
@@ -82,6 +85,15 @@ namespace hpx::parcelset::policies::tcp {
             return socket_;
         }
 
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+        // Drive the (connected) socket using the given io_uring transport,
+        // from now on no asio operations are used on the socket.
+        void use_io_uring(io_uring_transport& transport)
+        {
+            stream_ = transport.create_stream(socket_.native_handle());
+        }
+#endif
+
         // Asynchronously read a data structure from the socket.
         template <typename Handler>
         void async_read(Handler handler)
@@ -97,7 +109,7 @@ namespace hpx::parcelset::policies::tcp {
             data.num_parcels_ = 0;
 #endif
             parcels_.clear();
-            chunk_buffers_.clear();
+            chunk_buffers_.reset();
 
             // Issue a read operation to read the message size.
             using asio::buffer;
@@ -128,7 +140,7 @@ namespace hpx::parcelset::policies::tcp {
                 void (receiver::*f)(std::error_code const&, std::size_t,
                     Handler) = &receiver::handle_read_header<Handler>;
 
-                asio::async_read(socket_, buffers,
+                async_read_buffers(buffers,
                     hpx::bind(f, shared_from_this(),
                         placeholders::_1,    // error
                         placeholders::_2,    // bytes_transferred
@@ -146,6 +158,10 @@ namespace hpx::parcelset::policies::tcp {
                 std::error_code ec;
                 socket_.shutdown(asio::ip::tcp::socket::shutdown_both, ec);
 
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+                if (stream_)
+                    stream_->cancel();
+#endif
                 // close the socket to give it back to the OS
                 socket_.close(ec);
             }
@@ -156,6 +172,36 @@ namespace hpx::parcelset::policies::tcp {
         }
 
     private:
+        // Start the given read or write operation using either the io_uring
+        // transport (if enabled) or asio.
+        template <typename Handler>
+        void async_read_buffers(
+            std::vector<asio::mutable_buffer> const& buffers, Handler&& handler)
+        {
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+            if (stream_)
+            {
+                stream_->async_read(buffers, HPX_FORWARD(Handler, handler));
+                return;
+            }
+#endif
+            asio::async_read(socket_, buffers, HPX_FORWARD(Handler, handler));
+        }
+
+        template <typename Handler>
+        void async_write_buffers(
+            std::vector<asio::const_buffer> const& buffers, Handler&& handler)
+        {
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+            if (stream_)
+            {
+                stream_->async_write(buffers, HPX_FORWARD(Handler, handler));
+                return;
+            }
+#endif
+            asio::async_write(socket_, buffers, HPX_FORWARD(Handler, handler));
+        }
+
         // Handle a completed read of the message size from the message header.
         template <typename Handler>
         void handle_read_header(std::error_code const& e,
@@ -249,7 +295,7 @@ namespace hpx::parcelset::policies::tcp {
                         quickack(true);
                     socket_.set_option(quickack);
 #endif
-                    asio::async_read(socket_, buffers,
+                    async_read_buffers(buffers,
                         hpx::bind(f, shared_from_this(),
                             placeholders::_1,    // error,
                             util::protect(handler)));
@@ -332,20 +378,24 @@ namespace hpx::parcelset::policies::tcp {
                 }
                 else
                 {
-                    chunk_buffers_.resize(num_zero_copy_chunks);
+                    // the chunk buffers are shared with the de-serialized
+                    // objects referring to the received data
+                    chunk_buffers_ = std::make_shared<receive_chunk_buffers>(
+                        num_zero_copy_chunks);
                     for (std::size_t i = 0; i != num_zero_copy_chunks; ++i)
                     {
                         auto const chunk_size = static_cast<std::size_t>(
                             buffer_.transmission_chunks_[i].second);
 
-                        chunk_buffers_[i].resize(chunk_size);
-                        buffers.emplace_back(
-                            chunk_buffers_[i].data(), chunk_size);
+                        auto& chunk_buffer = (*chunk_buffers_)[i];
+                        chunk_buffer.resize(chunk_size);
+                        buffers.emplace_back(chunk_buffer.data(), chunk_size);
 
                         buffer_.chunks_[i] =
                             serialization::create_pointer_chunk(
-                                chunk_buffers_[i].data(), chunk_size);
+                                chunk_buffer.data(), chunk_size);
                     }
+                    buffer_.chunks_owner_ = chunk_buffers_;
                 }
 
                 // Start an asynchronous call to receive the zero-copy data.
@@ -370,7 +420,7 @@ namespace hpx::parcelset::policies::tcp {
                         quickack(true);
                     socket_.set_option(quickack);
 #endif
-                    asio::async_read(socket_, buffers,
+                    async_read_buffers(buffers,
                         hpx::bind(f, shared_from_this(),
                             placeholders::_1,    // error,
                             util::protect(handler)));
@@ -388,7 +438,7 @@ namespace hpx::parcelset::policies::tcp {
                 --operation_in_flight_;
                 buffer_ = parcel_buffer_type();
                 parcels_.clear();
-                chunk_buffers_.clear();
+                chunk_buffers_.reset();
             }
             else
             {
@@ -430,8 +480,8 @@ namespace hpx::parcelset::policies::tcp {
                         return;
                     }
 
-                    asio::async_write(socket_,
-                        asio::buffer(&ack_, sizeof(ack_)),
+                    async_write_buffers(
+                        {asio::const_buffer(&ack_, sizeof(ack_))},
                         hpx::bind(f, shared_from_this(),
                             placeholders::_1,    // error,
                             util::protect(handler)));
@@ -450,7 +500,7 @@ namespace hpx::parcelset::policies::tcp {
 
             buffer_ = parcel_buffer_type();
             parcels_.clear();
-            chunk_buffers_.clear();
+            chunk_buffers_.reset();
 
             // Issue a read operation to read the next parcel.
             if (!e)
@@ -461,6 +511,9 @@ namespace hpx::parcelset::policies::tcp {
 
         // Socket for the parcelport_connection.
         asio::ip::tcp::socket socket_;
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+        std::shared_ptr<io_uring_stream> stream_;
+#endif
 
         std::uint64_t max_inbound_size_;
 
@@ -477,7 +530,7 @@ namespace hpx::parcelset::policies::tcp {
         hpx::util::atomic_count operation_in_flight_;
 
         std::vector<parcelset::parcel> parcels_;
-        std::vector<std::vector<char>> chunk_buffers_;
+        std::shared_ptr<receive_chunk_buffers> chunk_buffers_;
     };
 }    // namespace hpx::parcelset::policies::tcp
 
@@ -16,9 +16,11 @@
 #include <hpx/modules/asio.hpp>
 #include <hpx/modules/functional.hpp>
 #include <hpx/modules/runtime_local.hpp>
+#include <hpx/modules/serialization.hpp>
 #include <hpx/modules/threading_base.hpp>
 #include <hpx/modules/timing.hpp>
 
+#include <hpx/parcelport_tcp/io_uring_transport.hpp>
 #include <hpx/parcelport_tcp/locality.hpp>
 #include <hpx/parcelset/parcelport_connection.hpp>
 #include <hpx/parcelset_base/detail/data_point.hpp>
@@ -50,7 +52,11 @@
 
 namespace hpx::parcelset::policies::tcp {
 
-    class sender : public parcelset::parcelport_connection<sender>
+    // The serialized data is written into a segmented buffer, its segments
+    // are passed to the socket directly using a gather-write.
+    class sender
+      : public parcelset::parcelport_connection<sender,
+            serialization::segmented_buffer>
     {
         using postprocess_handler_type =
             hpx::move_only_function<void(std::error_code const&)>;
@@ -74,6 +80,10 @@ namespace hpx::parcelset::policies::tcp {
             // gracefully and portably shutdown the socket
             if (socket_.is_open())
             {
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+                if (stream_)
+                    stream_->cancel();
+#endif
                 std::error_code ec;
                 socket_.shutdown(asio::ip::tcp::socket::shutdown_both, ec);
 
@@ -88,6 +98,15 @@ namespace hpx::parcelset::policies::tcp {
             return socket_;
         }
 
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+        // Drive the (connected) socket using the given io_uring transport,
+        // from now on no asio operations are used on the socket.
+        void use_io_uring(io_uring_transport& transport)
+        {
+            stream_ = transport.create_stream(socket_.native_handle());
+        }
+#endif
+
         parcelset::locality const& destination() const noexcept
         {
             return there_;
@@ -144,6 +163,7 @@ namespace hpx::parcelset::policies::tcp {
             // Write the serialized data to the socket. We use "gather-write"
             // to send both the header and the data in a single write operation.
             std::vector<asio::const_buffer> buffers;
+            [[maybe_unused]] std::size_t zero_copy_bytes = 0;
             buffers.emplace_back(&buffer_.size_, sizeof(buffer_.size_));
             buffers.emplace_back(
                 &buffer_.data_size_, sizeof(buffer_.data_size_));
@@ -161,20 +181,23 @@ namespace hpx::parcelset::policies::tcp {
                         sizeof(parcel_buffer_type::transmission_chunk_type));
 
                 // add main buffer holding data which was serialized normally
-                buffers.emplace_back(asio::buffer(buffer_.data_));
+                add_data_buffers(buffers);
 
                 // now add chunks themselves, those hold zero-copy serialized chunks
                 for (serialization::serialization_chunk& c : buffer_.chunks_)
                 {
                     if (c.type_ ==
                         serialization::chunk_type::chunk_type_pointer)
+                    {
                         buffers.emplace_back(c.data_.cpos_, c.size_);
+                        zero_copy_bytes += c.size_;
+                    }
                 }
             }
             else
             {
                 // add main buffer holding data which was serialized normally
-                buffers.emplace_back(asio::buffer(buffer_.data_));
+                add_data_buffers(buffers);
             }
 
             // this additional wrapping of the handler into a bind object is
@@ -183,12 +206,32 @@ namespace hpx::parcelset::policies::tcp {
             void (sender::*f)(std::error_code const&, std::size_t) =
                 &sender::handle_write;
 
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+            if (stream_)
+            {
+                stream_->async_write(buffers,
+                    hpx::bind(f, shared_from_this(), hpx::placeholders::_1,
+                        hpx::placeholders::_2),
+                    zero_copy_bytes);
+                return;
+            }
+#endif
             asio::async_write(socket_, buffers,
                 hpx::bind(f, shared_from_this(), hpx::placeholders::_1,
                     hpx::placeholders::_2));
         }
 
     private:
+        void add_data_buffers(std::vector<asio::const_buffer>& buffers) const
+        {
+            buffers.reserve(buffers.size() + buffer_.data_.num_segments() +
+                buffer_.chunks_.size());
+            buffer_.data_.for_each_segment(
+                [&](char const* data, std::size_t size) {
+                    buffers.emplace_back(data, size);
+                });
+        }
+
         static void reset_handler(postprocess_handler_type handler)
         {
             handler.reset();
@@ -249,6 +292,14 @@ namespace hpx::parcelset::policies::tcp {
             void (sender::*f)(std::error_code const&) =
                 &sender::handle_read_ack;
 
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+            if (stream_)
+            {
+                stream_->async_read({asio::buffer(&ack_, sizeof(ack_))},
+                    hpx::bind(f, shared_from_this(), placeholders::_1));
+                return;
+            }
+#endif
             asio::async_read(socket_, asio::buffer(&ack_, sizeof(ack_)),
                 hpx::bind(f, shared_from_this(), placeholders::_1));
         }
@@ -272,6 +323,9 @@ namespace hpx::parcelset::policies::tcp {
 
         // Socket for the parcelport_connection.
         asio::ip::tcp::socket socket_;
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+        std::shared_ptr<io_uring_stream> stream_;
+#endif
 
         bool ack_;
 
@@ -15,10 +15,12 @@
 #include <hpx/modules/asio.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/functional.hpp>
+#include <hpx/modules/logging.hpp>
 #include <hpx/modules/runtime_configuration.hpp>
 #include <hpx/modules/util.hpp>
 
 #include <hpx/parcelport_tcp/connection_handler.hpp>
+#include <hpx/parcelport_tcp/io_uring_transport.hpp>
 #include <hpx/parcelport_tcp/locality.hpp>
 #include <hpx/parcelport_tcp/receiver.hpp>
 #include <hpx/parcelport_tcp/sender.hpp>
@@ -67,6 +69,11 @@ namespace hpx::parcelset::policies::tcp {
         threads::policies::callback_notifier const& notifier)
       : base_type(ini, parcelport_address(ini), notifier)
       , acceptor_(nullptr)
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+      , use_io_uring_(
+            hpx::util::get_entry_as<int>(ini, "hpx.parcel.tcp.io_uring", 0) !=
+            0)
+#endif
     {
         if (here_.type() != std::string("tcp"))
         {
@@ -76,6 +83,21 @@ namespace hpx::parcelset::policies::tcp {
                 "locality type: {}",
                 here_.type());
         }
+
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+        io_uring_params_.queue_depth = hpx::util::get_entry_as(ini,
+            "hpx.parcel.tcp.io_uring_queue_depth",
+            io_uring_params_.queue_depth);
+        io_uring_params_.num_receive_buffers = hpx::util::get_entry_as(ini,
+            "hpx.parcel.tcp.io_uring_receive_buffers",
+            io_uring_params_.num_receive_buffers);
+        io_uring_params_.receive_buffer_size = hpx::util::get_entry_as(ini,
+            "hpx.parcel.tcp.io_uring_receive_buffer_size",
+            io_uring_params_.receive_buffer_size);
+        io_uring_params_.zero_copy_threshold = hpx::util::get_entry_as(ini,
+            "hpx.parcel.tcp.io_uring_zero_copy_threshold",
+            io_uring_params_.zero_copy_threshold);
+#endif
     }
 
     connection_handler::~connection_handler()
@@ -126,6 +148,32 @@ namespace hpx::parcelset::policies::tcp {
             HPX_THROW_EXCEPTION(hpx::error::network_error,
                 "tcp::parcelport::run", errors.get_message());
         }
+
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+        if (use_io_uring_ && io_uring_transports_.empty())
+        {
+            try
+            {
+                for (std::size_t i = 0; i != io_service_pool_.size(); ++i)
+                {
+                    io_uring_transports_.push_back(
+                        std::make_unique<io_uring_transport>(
+                            io_service_pool_.get_io_service(
+                                static_cast<int>(i)),
+                            io_uring_params_));
+                    io_uring_transports_.back()->start();
+                }
+            }
+            catch (std::system_error const& e)
+            {
+                // fall back to using asio
+                LPT_(warning).format("tcp::parcelport::run: io_uring is not "
+                                     "available, using asio instead: {}",
+                    e.what());
+                io_uring_transports_.clear();
+            }
+        }
+#endif
         return true;
     }
 
@@ -151,8 +199,33 @@ namespace hpx::parcelset::policies::tcp {
             delete acceptor_;
             acceptor_ = nullptr;
         }
+
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+        // outgoing connections may still refer to the transports, they are
+        // released only once the parcelport is destroyed
+        for (auto& transport : io_uring_transports_)
+        {
+            transport->stop();
+        }
+#endif
     }
 
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+    io_uring_transport* connection_handler::get_io_uring_transport(
+        asio::execution_context& ctx) const noexcept
+    {
+        for (auto const& transport : io_uring_transports_)
+        {
+            if (static_cast<asio::execution_context*>(
+                    &transport->get_io_service()) == &ctx)
+            {
+                return transport.get();
+            }
+        }
+        return nullptr;
+    }
+#endif
+
     std::shared_ptr<sender> connection_handler::create_connection(
         parcelset::locality const& l, error_code& ec)
     {
@@ -232,6 +305,14 @@ namespace hpx::parcelset::policies::tcp {
         s.set_option(asio::ip::tcp::no_delay(true));
         s.set_option(asio::socket_base::linger(true, 0));
 
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+        if (io_uring_transport* t =
+                get_io_uring_transport(s.get_executor().context()))
+        {
+            sender_connection->use_io_uring(*t);
+        }
+#endif
+
 #if defined(HPX_HOLDON_TO_OUTGOING_CONNECTIONS)
         {
             std::lock_guard<hpx::spinlock> lock(connections_mtx_);
@@ -307,6 +388,14 @@ namespace hpx::parcelset::policies::tcp {
             s.set_option(asio::ip::tcp::no_delay(true));
             s.set_option(asio::socket_base::linger(true, 0));
 
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+            if (io_uring_transport* t =
+                    get_io_uring_transport(s.get_executor().context()))
+            {
+                c->use_io_uring(*t);
+            }
+#endif
+
             // now accept the incoming connection by starting to read from the
             // socket
             c->async_read(hpx::bind(&connection_handler::handle_read_completion,
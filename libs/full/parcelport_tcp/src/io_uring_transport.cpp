@@ -0,0 +1,1175 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_TCP) &&        \
+    defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+#include <hpx/assert.hpp>
+#include <hpx/modules/functional.hpp>
+
+#include <hpx/parcelport_tcp/io_uring_transport.hpp>
+
+#include <asio/error.hpp>
+#include <asio/post.hpp>
+
+#include <linux/io_uring.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+namespace hpx::parcelset::policies::tcp {
+
+    namespace detail {
+
+        ///////////////////////////////////////////////////////////////////////
+        // We talk to the kernel directly, this avoids depending on liburing.
+        int sys_io_uring_setup(unsigned entries, io_uring_params* p) noexcept
+        {
+            return static_cast<int>(::syscall(__NR_io_uring_setup, entries, p));
+        }
+
+        int sys_io_uring_enter(int fd, unsigned to_submit,
+            unsigned min_complete, unsigned flags) noexcept
+        {
+            return static_cast<int>(::syscall(__NR_io_uring_enter, fd,
+                to_submit, min_complete, flags, nullptr, 0));
+        }
+
+        int sys_io_uring_register(
+            int fd, unsigned opcode, void* arg, unsigned nr_args) noexcept
+        {
+            return static_cast<int>(
+                ::syscall(__NR_io_uring_register, fd, opcode, arg, nr_args));
+        }
+
+        [[noreturn]] void throw_system_error(char const* what)
+        {
+            throw std::system_error(
+                std::error_code(errno, std::system_category()), what);
+        }
+
+        template <typename T>
+        T load_acquire(T const* p) noexcept
+        {
+            return __atomic_load_n(p, __ATOMIC_ACQUIRE);
+        }
+
+        template <typename T>
+        void store_release(T* p, T value) noexcept
+        {
+            __atomic_store_n(p, value, __ATOMIC_RELEASE);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Base class of all operations submitted to the ring, the operation
+        // object is passed as the user data of the submission queue entries.
+        struct io_uring_operation
+        {
+            explicit io_uring_operation(io_uring_transport& transport) noexcept
+              : transport_(transport)
+            {
+            }
+
+            io_uring_operation(io_uring_operation const&) = delete;
+            io_uring_operation(io_uring_operation&&) = delete;
+            io_uring_operation& operator=(io_uring_operation const&) = delete;
+            io_uring_operation& operator=(io_uring_operation&&) = delete;
+
+            virtual ~io_uring_operation() = default;
+
+            // Handle a completion queue entry for this operation, return
+            // whether the operation is finished (no more completions are
+            // expected).
+            virtual bool complete(int result, std::uint32_t flags) = 0;
+
+            io_uring_transport& transport_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        struct io_uring_ring
+        {
+            explicit io_uring_ring(io_uring_parameters const& params)
+            {
+                try
+                {
+                    setup(params);
+                    setup_buffers(params);
+
+                    event_fd = ::eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+                    if (event_fd < 0 ||
+                        sys_io_uring_register(
+                            fd, IORING_REGISTER_EVENTFD, &event_fd, 1) < 0)
+                    {
+                        throw_system_error("io_uring: registering eventfd");
+                    }
+                }
+                catch (...)
+                {
+                    release();
+                    if (event_fd >= 0)
+                        ::close(event_fd);
+                    throw;
+                }
+            }
+
+            io_uring_ring(io_uring_ring const&) = delete;
+            io_uring_ring(io_uring_ring&&) = delete;
+            io_uring_ring& operator=(io_uring_ring const&) = delete;
+            io_uring_ring& operator=(io_uring_ring&&) = delete;
+
+            // the eventfd is owned by the stream_descriptor of the transport
+            ~io_uring_ring()
+            {
+                release();
+            }
+
+            void setup(io_uring_parameters const& params)
+            {
+                io_uring_params p{};
+                p.flags = IORING_SETUP_CLAMP;
+
+                fd = sys_io_uring_setup(params.queue_depth, &p);
+                if (fd < 0)
+                    throw_system_error("io_uring: io_uring_setup");
+
+                // we rely on the kernel not dropping completions
+                if (!(p.features & IORING_FEAT_NODROP))
+                {
+                    throw std::system_error(
+                        std::make_error_code(std::errc::not_supported),
+                        "io_uring: IORING_FEAT_NODROP is not supported");
+                }
+
+                sq_ring_size = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+                cq_ring_size =
+                    p.cq_off.cqes + p.cq_entries * sizeof(io_uring_cqe);
+                if (p.features & IORING_FEAT_SINGLE_MMAP)
+                {
+                    sq_ring_size = cq_ring_size =
+                        (std::max) (sq_ring_size, cq_ring_size);
+                }
+
+                sq_ring = ::mmap(nullptr, sq_ring_size, PROT_READ | PROT_WRITE,
+                    MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+                if (sq_ring == MAP_FAILED)
+                    throw_system_error("io_uring: mapping submission queue");
+
+                if (p.features & IORING_FEAT_SINGLE_MMAP)
+                {
+                    cq_ring = sq_ring;
+                }
+                else
+                {
+                    cq_ring = ::mmap(nullptr, cq_ring_size,
+                        PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd,
+                        IORING_OFF_CQ_RING);
+                    if (cq_ring == MAP_FAILED)
+                    {
+                        throw_system_error(
+                            "io_uring: mapping completion queue");
+                    }
+                }
+
+                sqes_size = p.sq_entries * sizeof(io_uring_sqe);
+                void* sqes_ptr =
+                    ::mmap(nullptr, sqes_size, PROT_READ | PROT_WRITE,
+                        MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+                if (sqes_ptr == MAP_FAILED)
+                    throw_system_error("io_uring: mapping submission entries");
+                sqes = static_cast<io_uring_sqe*>(sqes_ptr);
+
+                char* sq = static_cast<char*>(sq_ring);
+                sq_head = reinterpret_cast<unsigned*>(sq + p.sq_off.head);
+                sq_tail = reinterpret_cast<unsigned*>(sq + p.sq_off.tail);
+                sq_flags = reinterpret_cast<unsigned*>(sq + p.sq_off.flags);
+                sq_mask = *reinterpret_cast<unsigned*>(sq + p.sq_off.ring_mask);
+                sq_entries = p.sq_entries;
+
+                // use an identity mapping for the submission queue indices
+                auto* array = reinterpret_cast<unsigned*>(sq + p.sq_off.array);
+                for (unsigned i = 0; i != sq_entries; ++i)
+                {
+                    array[i] = i;
+                }
+                sqe_tail = *sq_tail;
+
+                char* cq = static_cast<char*>(cq_ring);
+                cq_head = reinterpret_cast<unsigned*>(cq + p.cq_off.head);
+                cq_tail = reinterpret_cast<unsigned*>(cq + p.cq_off.tail);
+                cq_mask = *reinterpret_cast<unsigned*>(cq + p.cq_off.ring_mask);
+                cqes = reinterpret_cast<io_uring_cqe*>(cq + p.cq_off.cqes);
+
+                // make sure all operations we use are supported
+                std::vector<char> probe_data(sizeof(io_uring_probe) +
+                    IORING_OP_LAST * sizeof(io_uring_probe_op));
+                auto* probe =
+                    reinterpret_cast<io_uring_probe*>(probe_data.data());
+                if (sys_io_uring_register(
+                        fd, IORING_REGISTER_PROBE, probe, IORING_OP_LAST) < 0)
+                {
+                    throw_system_error("io_uring: probing operations");
+                }
+
+                for (auto op : {IORING_OP_SENDMSG, IORING_OP_SENDMSG_ZC,
+                         IORING_OP_RECV, IORING_OP_ASYNC_CANCEL})
+                {
+                    if (probe->last_op < op ||
+                        !(probe->ops[op].flags & IO_URING_OP_SUPPORTED))
+                    {
+                        throw std::system_error(
+                            std::make_error_code(std::errc::not_supported),
+                            "io_uring: required operation is not supported");
+                    }
+                }
+            }
+
+            // Set up the ring of buffers used by the multishot receive
+            // operations. The number of buffers has to be a power of two.
+            void setup_buffers(io_uring_parameters const& params)
+            {
+                std::uint32_t num_buffers = 1;
+                while (num_buffers < params.num_receive_buffers &&
+                    num_buffers < 32768)
+                {
+                    num_buffers <<= 1;
+                }
+                buffer_size = (std::max) (params.receive_buffer_size,
+                    static_cast<std::uint32_t>(64));
+                buffer_mask = static_cast<std::uint16_t>(num_buffers - 1);
+
+                buffers_size = std::size_t(num_buffers) * buffer_size;
+                void* buffers_ptr =
+                    ::mmap(nullptr, buffers_size, PROT_READ | PROT_WRITE,
+                        MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+                if (buffers_ptr == MAP_FAILED)
+                    throw_system_error("io_uring: allocating receive buffers");
+                buffers = static_cast<char*>(buffers_ptr);
+
+                buffer_ring_size = num_buffers * sizeof(io_uring_buf);
+                void* ring_ptr =
+                    ::mmap(nullptr, buffer_ring_size, PROT_READ | PROT_WRITE,
+                        MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+                if (ring_ptr == MAP_FAILED)
+                    throw_system_error("io_uring: allocating buffer ring");
+                buffer_ring = static_cast<io_uring_buf_ring*>(ring_ptr);
+
+                io_uring_buf_reg reg{};
+                reg.ring_addr = reinterpret_cast<std::uintptr_t>(buffer_ring);
+                reg.ring_entries = num_buffers;
+                reg.bgid = 0;
+                if (sys_io_uring_register(
+                        fd, IORING_REGISTER_PBUF_RING, &reg, 1) < 0)
+                {
+                    throw_system_error("io_uring: registering buffer ring");
+                }
+
+                for (std::uint32_t i = 0; i != num_buffers; ++i)
+                {
+                    add_buffer(static_cast<std::uint16_t>(i));
+                }
+                publish_buffers();
+            }
+
+            void release() noexcept
+            {
+                if (buffer_ring != nullptr)
+                    ::munmap(buffer_ring, buffer_ring_size);
+                if (buffers != nullptr)
+                    ::munmap(buffers, buffers_size);
+                if (sqes != nullptr)
+                    ::munmap(sqes, sqes_size);
+                if (cq_ring != MAP_FAILED && cq_ring != sq_ring)
+                    ::munmap(cq_ring, cq_ring_size);
+                if (sq_ring != MAP_FAILED)
+                    ::munmap(sq_ring, sq_ring_size);
+                if (fd >= 0)
+                    ::close(fd);
+
+                buffer_ring = nullptr;
+                buffers = nullptr;
+                sqes = nullptr;
+                cq_ring = sq_ring = MAP_FAILED;
+                fd = -1;
+            }
+
+            // Return the next free submission queue entry, nullptr if the
+            // submission queue is full. Requires the submission lock.
+            io_uring_sqe* get_sqe() noexcept
+            {
+                if (sqe_tail - load_acquire(sq_head) >= sq_entries)
+                    return nullptr;
+
+                io_uring_sqe* sqe = &sqes[sqe_tail & sq_mask];
+                ++sqe_tail;
+                std::memset(sqe, 0, sizeof(io_uring_sqe));
+                return sqe;
+            }
+
+            // make the prepared entries visible to the kernel, return the
+            // number of entries not consumed by the kernel yet
+            unsigned publish() noexcept
+            {
+                store_release(sq_tail, sqe_tail);
+                return sqe_tail - load_acquire(sq_head);
+            }
+
+            // buffer ring handling, used by the completion thread only
+            void add_buffer(std::uint16_t bid) noexcept
+            {
+                // The buffer entries overlay the ring header. Don't use
+                // io_uring_buf_ring::bufs, its flexible array declaration is
+                // placed at a different offset when compiled as C++.
+                io_uring_buf* buf =
+                    reinterpret_cast<io_uring_buf*>(buffer_ring) +
+                    (buffer_tail & buffer_mask);
+                buf->addr = reinterpret_cast<std::uintptr_t>(
+                    buffers + std::size_t(bid) * buffer_size);
+                buf->len = buffer_size;
+                buf->bid = bid;
+                ++buffer_tail;
+            }
+
+            void publish_buffers() noexcept
+            {
+                store_release(&buffer_ring->tail, buffer_tail);
+            }
+
+            int fd = -1;
+            int event_fd = -1;
+
+            // submission queue
+            void* sq_ring = MAP_FAILED;
+            std::size_t sq_ring_size = 0;
+            io_uring_sqe* sqes = nullptr;
+            std::size_t sqes_size = 0;
+            unsigned* sq_head = nullptr;
+            unsigned* sq_tail = nullptr;
+            unsigned* sq_flags = nullptr;
+            unsigned sq_mask = 0;
+            unsigned sq_entries = 0;
+            unsigned sqe_tail = 0;
+
+            // operations which did not fit into the submission queue
+            std::deque<std::pair<io_uring_operation*,
+                hpx::move_only_function<void(io_uring_sqe*)>>>
+                backlog;
+
+            // completion queue
+            void* cq_ring = MAP_FAILED;
+            std::size_t cq_ring_size = 0;
+            unsigned* cq_head = nullptr;
+            unsigned* cq_tail = nullptr;
+            unsigned cq_mask = 0;
+            io_uring_cqe* cqes = nullptr;
+
+            // registered receive buffers
+            io_uring_buf_ring* buffer_ring = nullptr;
+            std::size_t buffer_ring_size = 0;
+            char* buffers = nullptr;
+            std::size_t buffers_size = 0;
+            std::uint32_t buffer_size = 0;
+            std::uint16_t buffer_mask = 0;
+            std::uint16_t buffer_tail = 0;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // Send a list of buffers using a single (zero-copy) sendmsg, resubmit
+        // the remaining data after partial sends.
+        struct io_uring_send_operation : io_uring_operation
+        {
+            io_uring_send_operation(io_uring_transport& transport, int fd,
+                std::vector<asio::const_buffer> const& buffers, bool zero_copy,
+                io_uring_stream::handler_type&& handler)
+              : io_uring_operation(transport)
+              , fd_(fd)
+              , zero_copy_(zero_copy)
+              , handler_(HPX_MOVE(handler))
+            {
+                iov_.reserve(buffers.size());
+                for (auto const& b : buffers)
+                {
+                    if (b.size() != 0)
+                    {
+                        iov_.push_back(
+                            iovec{const_cast<void*>(b.data()), b.size()});
+                    }
+                }
+            }
+
+            bool done() const noexcept
+            {
+                return index_ == iov_.size();
+            }
+
+            void submit()
+            {
+                msg_.msg_iov = iov_.data() + index_;
+                msg_.msg_iovlen = iov_.size() - index_;
+                transport_.submit_send(this, fd_, &msg_, zero_copy_);
+            }
+
+            void consume(std::size_t bytes) noexcept
+            {
+                bytes_ += bytes;
+                while (bytes != 0 && index_ != iov_.size())
+                {
+                    iovec& v = iov_[index_];
+                    if (bytes < v.iov_len)
+                    {
+                        v.iov_base = static_cast<char*>(v.iov_base) + bytes;
+                        v.iov_len -= bytes;
+                        return;
+                    }
+                    bytes -= v.iov_len;
+                    ++index_;
+                }
+            }
+
+            bool complete(int result, std::uint32_t flags) override
+            {
+                // zero-copy sends signal the release of the buffers using a
+                // separate notification
+                if (flags & IORING_CQE_F_NOTIF)
+                {
+                    --notifications_;
+                    return finish();
+                }
+                if (flags & IORING_CQE_F_MORE)
+                {
+                    ++notifications_;
+                }
+
+                if (result == -EOPNOTSUPP && zero_copy_ && bytes_ == 0 &&
+                    !transport_.stopped())
+                {
+                    // zero-copy sends are not supported for this socket
+                    zero_copy_ = false;
+                    submit();
+                    return false;
+                }
+
+                if (result == -EINTR || result == -EAGAIN)
+                {
+                    if (!transport_.stopped())
+                    {
+                        submit();
+                        return false;
+                    }
+                    error_ = asio::error::operation_aborted;
+                }
+                else if (result < 0)
+                {
+                    error_ = std::error_code(-result, std::system_category());
+                }
+                else if (result == 0 && !done())
+                {
+                    error_ = asio::error::broken_pipe;
+                }
+                else
+                {
+                    consume(static_cast<std::size_t>(result));
+                    if (!done() && !transport_.stopped())
+                    {
+                        // partial send, send the remaining data
+                        submit();
+                        return false;
+                    }
+                }
+
+                completed_ = true;
+                return finish();
+            }
+
+            // invoke the handler once the data was sent and all buffers were
+            // released by the kernel
+            bool finish()
+            {
+                if (!completed_ || notifications_ != 0)
+                    return false;
+
+                if (transport_.stopped())
+                {
+                    transport_.post(HPX_MOVE(handler_),
+                        asio::error::operation_aborted, bytes_);
+                }
+                else
+                {
+                    handler_(error_, bytes_);
+                }
+                return true;
+            }
+
+            int fd_;
+            bool zero_copy_;
+            bool completed_ = false;
+            int notifications_ = 0;
+
+            std::vector<iovec> iov_;
+            std::size_t index_ = 0;
+            std::size_t bytes_ = 0;
+            msghdr msg_{};
+
+            std::error_code error_;
+            io_uring_stream::handler_type handler_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // Multishot receive operation, hands all received data to the stream
+        struct io_uring_receive_operation : io_uring_operation
+        {
+            io_uring_receive_operation(io_uring_transport& transport,
+                std::shared_ptr<io_uring_stream> stream) noexcept
+              : io_uring_operation(transport)
+              , stream_(HPX_MOVE(stream))
+            {
+            }
+
+            bool complete(int result, std::uint32_t flags) override
+            {
+                bool const stopped = transport_.stopped();
+                if (result > 0)
+                {
+                    HPX_ASSERT(flags & IORING_CQE_F_BUFFER);
+                    auto const bid = static_cast<std::uint16_t>(
+                        flags >> IORING_CQE_BUFFER_SHIFT);
+                    if (!stopped)
+                    {
+                        stream_->on_receive(transport_.get_buffer(bid),
+                            static_cast<std::size_t>(result));
+                    }
+                    transport_.recycle_buffer(bid);
+                }
+                else if (result == 0)
+                {
+                    // end of stream
+                    if (stopped)
+                        return release();
+                    stream_->on_receive(nullptr, 0);
+                    return !(flags & IORING_CQE_F_MORE);
+                }
+                else if (result != -ENOBUFS)
+                {
+                    if (stopped)
+                        return release();
+                    stream_->on_receive_error(
+                        std::error_code(-result, std::system_category()));
+                    return !(flags & IORING_CQE_F_MORE);
+                }
+
+                if (flags & IORING_CQE_F_MORE)
+                    return false;
+
+                // The kernel terminated the multishot operation, either
+                // because it ran out of receive buffers or because of a
+                // completion queue overflow. Re-arm the operation, the
+                // submission is deferred until all pending completions (and
+                // with them the used buffers) have been handled.
+                if (stopped)
+                    return release();
+
+                transport_.submit_receive(this, stream_->fd_);
+                return false;
+            }
+
+            // the transport was stopped, no more data will be received
+            bool release()
+            {
+                stream_->abort();
+                return true;
+            }
+
+            std::shared_ptr<io_uring_stream> stream_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // set while a thread handles the completions of a transport, any
+        // operation submitted by this thread will be submitted in one batch
+        // once all completions have been handled
+        thread_local io_uring_transport* completing_transport = nullptr;
+
+        struct completion_scope
+        {
+            explicit completion_scope(io_uring_transport* transport) noexcept
+              : previous_(completing_transport)
+            {
+                completing_transport = transport;
+            }
+
+            completion_scope(completion_scope const&) = delete;
+            completion_scope(completion_scope&&) = delete;
+            completion_scope& operator=(completion_scope const&) = delete;
+            completion_scope& operator=(completion_scope&&) = delete;
+
+            ~completion_scope()
+            {
+                completing_transport = previous_;
+            }
+
+            io_uring_transport* previous_;
+        };
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    io_uring_stream::io_uring_stream(
+        io_uring_transport& transport, int fd) noexcept
+      : transport_(transport)
+      , fd_(fd)
+    {
+    }
+
+    void io_uring_stream::start_receive()
+    {
+        if (transport_.stopped())
+            return;
+
+        auto op = std::make_unique<detail::io_uring_receive_operation>(
+            transport_, shared_from_this());
+
+        ++transport_.operations_in_flight_;
+        transport_.submit_receive(op.release(), fd_);
+    }
+
+    std::size_t io_uring_stream::fill_request(
+        char const* data, std::size_t size) noexcept
+    {
+        std::size_t consumed = 0;
+        while (request_index_ != request_.size())
+        {
+            asio::mutable_buffer const& b = request_[request_index_];
+            if (request_offset_ == b.size())
+            {
+                ++request_index_;
+                request_offset_ = 0;
+                continue;
+            }
+
+            if (consumed == size)
+                break;
+
+            std::size_t const n =
+                (std::min) (b.size() - request_offset_, size - consumed);
+            std::memcpy(static_cast<char*>(b.data()) + request_offset_,
+                data + consumed, n);
+
+            request_offset_ += n;
+            request_bytes_ += n;
+            consumed += n;
+        }
+        return consumed;
+    }
+
+    void io_uring_stream::async_read(
+        std::vector<asio::mutable_buffer> const& buffers,
+        handler_type&& handler)
+    {
+        std::unique_lock<hpx::spinlock> l(mtx_);
+
+        HPX_ASSERT(!request_handler_);
+        request_ = buffers;
+        request_index_ = 0;
+        request_offset_ = 0;
+        request_bytes_ = 0;
+
+        // satisfy the request from the data received earlier, if possible
+        if (pending_offset_ != pending_.size())
+        {
+            pending_offset_ += fill_request(pending_.data() + pending_offset_,
+                pending_.size() - pending_offset_);
+        }
+        else
+        {
+            fill_request(nullptr, 0);    // skip empty buffers
+        }
+
+        if (pending_offset_ == pending_.size())
+        {
+            pending_.clear();
+            pending_offset_ = 0;
+        }
+
+        if (request_index_ == request_.size() || error_)
+        {
+            std::error_code const e =
+                request_index_ == request_.size() ? std::error_code() : error_;
+            std::size_t const bytes = request_bytes_;
+            request_.clear();
+
+            l.unlock();
+            transport_.post(HPX_MOVE(handler), e, bytes);
+            return;
+        }
+
+        request_handler_ = HPX_MOVE(handler);
+    }
+
+    void io_uring_stream::async_write(
+        std::vector<asio::const_buffer> const& buffers, handler_type&& handler,
+        std::size_t zero_copy_bytes)
+    {
+        if (transport_.stopped())
+        {
+            transport_.post(
+                HPX_MOVE(handler), asio::error::operation_aborted, 0);
+            return;
+        }
+
+        auto op = std::make_unique<detail::io_uring_send_operation>(transport_,
+            fd_, buffers,
+            zero_copy_bytes != 0 &&
+                zero_copy_bytes >= transport_.params_.zero_copy_threshold,
+            HPX_MOVE(handler));
+
+        if (op->done())
+        {
+            // nothing to send
+            transport_.post(HPX_MOVE(op->handler_), std::error_code(), 0);
+            return;
+        }
+
+        ++transport_.operations_in_flight_;
+        op.release()->submit();
+    }
+
+    void io_uring_stream::cancel()
+    {
+        if (transport_.stopped())
+            return;
+
+        int const fd = fd_;
+        transport_.submit(nullptr, [fd](io_uring_sqe* sqe) {
+            sqe->opcode = IORING_OP_ASYNC_CANCEL;
+            sqe->fd = fd;
+            sqe->cancel_flags =
+                IORING_ASYNC_CANCEL_FD | IORING_ASYNC_CANCEL_ALL;
+        });
+    }
+
+    void io_uring_stream::on_receive(char const* data, std::size_t size)
+    {
+        handler_type handler;
+        std::error_code e;
+        std::size_t bytes = 0;
+
+        {
+            std::lock_guard<hpx::spinlock> l(mtx_);
+
+            if (size == 0)
+            {
+                error_ = asio::error::eof;
+            }
+            else
+            {
+                std::size_t consumed = 0;
+                if (request_handler_)
+                    consumed = fill_request(data, size);
+
+                // keep the remaining data for the next read request
+                if (consumed != size)
+                {
+                    pending_.insert(
+                        pending_.end(), data + consumed, data + size);
+                }
+            }
+
+            if (request_handler_ &&
+                (request_index_ == request_.size() || error_))
+            {
+                e = request_index_ == request_.size() ? std::error_code() :
+                                                        error_;
+                bytes = request_bytes_;
+                handler = HPX_MOVE(request_handler_);
+                request_handler_.reset();
+                request_.clear();
+            }
+        }
+
+        if (handler)
+            handler(e, bytes);
+    }
+
+    void io_uring_stream::on_receive_error(std::error_code const& e)
+    {
+        handler_type handler;
+        std::size_t bytes = 0;
+
+        {
+            std::lock_guard<hpx::spinlock> l(mtx_);
+
+            error_ = e;
+            if (request_handler_)
+            {
+                bytes = request_bytes_;
+                handler = HPX_MOVE(request_handler_);
+                request_handler_.reset();
+                request_.clear();
+            }
+        }
+
+        if (handler)
+            handler(e, bytes);
+    }
+
+    void io_uring_stream::abort()
+    {
+        handler_type handler;
+        std::size_t bytes = 0;
+
+        {
+            std::lock_guard<hpx::spinlock> l(mtx_);
+
+            // fail all future read requests as well
+            if (!error_)
+                error_ = asio::error::operation_aborted;
+
+            if (request_handler_)
+            {
+                bytes = request_bytes_;
+                handler = HPX_MOVE(request_handler_);
+                request_handler_.reset();
+                request_.clear();
+            }
+        }
+
+        if (handler)
+        {
+            transport_.post(
+                HPX_MOVE(handler), asio::error::operation_aborted, bytes);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    io_uring_transport::io_uring_transport(
+        asio::io_context& io_service, io_uring_parameters const& params)
+      : io_service_(io_service)
+      , params_(params)
+      , ring_(std::make_unique<detail::io_uring_ring>(params))
+      , event_(std::make_unique<asio::posix::stream_descriptor>(
+            io_service, ring_->event_fd))
+      , operations_in_flight_(0)
+      , stopped_(false)
+    {
+    }
+
+    io_uring_transport::~io_uring_transport()
+    {
+        stop();
+    }
+
+    void io_uring_transport::start()
+    {
+        std::lock_guard<std::mutex> l(completion_mtx_);
+        async_wait();
+    }
+
+    void io_uring_transport::stop()
+    {
+        if (stopped_.exchange(true))
+            return;
+
+        {
+            // the handlers of the aborted operations are collected and
+            // invoked once all operations have been released
+            detail::completion_scope scope(this);
+            release_operations();
+        }
+
+        for (auto& [handler, bytes] : std::exchange(aborted_, {}))
+        {
+            handler(asio::error::operation_aborted, bytes);
+        }
+    }
+
+    // cancel and release all outstanding operations
+    void io_uring_transport::release_operations()
+    {
+        {
+            std::unique_lock<hpx::spinlock> l(submit_mtx_);
+
+            // the operations in the backlog were never seen by the kernel,
+            // (zero-copy sends may still wait for their notifications)
+            for (auto& p : ring_->backlog)
+            {
+                if (p.first != nullptr && p.first->complete(-ECANCELED, 0))
+                {
+                    delete p.first;
+                    --operations_in_flight_;
+                }
+            }
+            ring_->backlog.clear();
+
+            io_uring_sqe* sqe = ring_->get_sqe();
+            while (sqe == nullptr)
+            {
+                unsigned const to_submit = ring_->publish();
+                l.unlock();
+                detail::sys_io_uring_enter(
+                    ring_->fd, to_submit, 1, IORING_ENTER_GETEVENTS);
+                l.lock();
+                sqe = ring_->get_sqe();
+            }
+
+            sqe->opcode = IORING_OP_ASYNC_CANCEL;
+            sqe->fd = -1;
+            sqe->cancel_flags =
+                IORING_ASYNC_CANCEL_ANY | IORING_ASYNC_CANCEL_ALL;
+            sqe->user_data = 0;
+
+            unsigned const to_submit = ring_->publish();
+            l.unlock();
+            detail::sys_io_uring_enter(ring_->fd, to_submit, 0, 0);
+        }
+
+        // release the eventfd while the io_context is still alive, the
+        // transport itself may outlive it
+        std::lock_guard<std::mutex> l(completion_mtx_);
+        event_.reset();
+
+        // wait for all operations to be released
+        while (operations_in_flight_.load(std::memory_order_acquire) != 0)
+        {
+            if (reap_completions() == 0)
+            {
+                detail::sys_io_uring_enter(
+                    ring_->fd, 0, 1, IORING_ENTER_GETEVENTS);
+            }
+        }
+    }
+
+    std::shared_ptr<io_uring_stream> io_uring_transport::create_stream(int fd)
+    {
+        auto stream = std::make_shared<io_uring_stream>(*this, fd);
+        stream->start_receive();
+        return stream;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename F>
+    void io_uring_transport::submit(detail::io_uring_operation* op, F&& prepare)
+    {
+        {
+            std::lock_guard<hpx::spinlock> l(submit_mtx_);
+
+            io_uring_sqe* sqe =
+                ring_->backlog.empty() ? ring_->get_sqe() : nullptr;
+            if (sqe == nullptr)
+            {
+                // the submission queue is full, the operation will be
+                // submitted once the kernel has consumed some entries
+                ring_->backlog.emplace_back(op, HPX_FORWARD(F, prepare));
+            }
+            else
+            {
+                prepare(sqe);
+                sqe->user_data = reinterpret_cast<std::uintptr_t>(op);
+            }
+        }
+
+        // operations initiated while completions are handled are submitted
+        // in one batch
+        if (detail::completing_transport != this)
+            flush_submissions();
+    }
+
+    void io_uring_transport::submit_receive(
+        detail::io_uring_operation* op, int fd)
+    {
+        submit(op, [fd](io_uring_sqe* sqe) {
+            sqe->opcode = IORING_OP_RECV;
+            sqe->fd = fd;
+            sqe->ioprio = IORING_RECV_MULTISHOT;
+            sqe->flags = IOSQE_BUFFER_SELECT;
+            sqe->buf_group = 0;
+        });
+    }
+
+    void io_uring_transport::submit_send(
+        detail::io_uring_operation* op, int fd, void* msg, bool zero_copy)
+    {
+        submit(op, [fd, msg, zero_copy](io_uring_sqe* sqe) {
+            sqe->opcode = zero_copy ? IORING_OP_SENDMSG_ZC : IORING_OP_SENDMSG;
+            sqe->fd = fd;
+            sqe->addr = reinterpret_cast<std::uintptr_t>(msg);
+            sqe->len = 1;
+            sqe->msg_flags = MSG_NOSIGNAL;
+        });
+    }
+
+    void io_uring_transport::flush_submissions()
+    {
+        while (true)
+        {
+            unsigned to_submit = 0;
+            bool backlog = false;
+            {
+                std::lock_guard<hpx::spinlock> l(submit_mtx_);
+
+                // move operations from the backlog into the submission queue
+                auto& pending = ring_->backlog;
+                while (!pending.empty())
+                {
+                    io_uring_sqe* sqe = ring_->get_sqe();
+                    if (sqe == nullptr)
+                        break;
+
+                    pending.front().second(sqe);
+                    sqe->user_data =
+                        reinterpret_cast<std::uintptr_t>(pending.front().first);
+                    pending.pop_front();
+                }
+
+                to_submit = ring_->publish();
+                backlog = !pending.empty();
+            }
+
+            if (to_submit == 0)
+                return;
+
+            int const result =
+                detail::sys_io_uring_enter(ring_->fd, to_submit, 0, 0);
+            if (result < 0 && errno == EINTR)
+                continue;
+
+            // If the kernel was not able to consume any entries (e.g. because
+            // of a completion queue overflow) the remaining entries will be
+            // submitted after the next batch of completions was handled.
+            if (result <= 0 || !backlog)
+                return;
+        }
+    }
+
+    void io_uring_transport::recycle_buffer(std::uint16_t bid) noexcept
+    {
+        ring_->add_buffer(bid);
+        ring_->publish_buffers();
+    }
+
+    char const* io_uring_transport::get_buffer(
+        std::uint16_t bid) const noexcept
+    {
+        return ring_->buffers + std::size_t(bid) * ring_->buffer_size;
+    }
+
+    void io_uring_transport::post(io_uring_stream::handler_type&& handler,
+        std::error_code const& e, std::size_t bytes)
+    {
+        if (stopped())
+        {
+            if (detail::completing_transport == this)
+            {
+                // invoked while stop releases the outstanding operations
+                aborted_.emplace_back(HPX_MOVE(handler), bytes);
+            }
+            else
+            {
+                handler(asio::error::operation_aborted, bytes);
+            }
+            return;
+        }
+
+        asio::post(io_service_,
+            [handler = HPX_MOVE(handler), e, bytes]() mutable {
+                handler(e, bytes);
+            });
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // requires completion_mtx_
+    void io_uring_transport::async_wait()
+    {
+        event_->async_wait(asio::posix::stream_descriptor::wait_read,
+            [this](std::error_code const& e) {
+                if (!e)
+                    handle_completions();
+            });
+    }
+
+    void io_uring_transport::handle_completions()
+    {
+        {
+            std::lock_guard<std::mutex> l(completion_mtx_);
+            if (stopped())
+                return;
+
+            // reset the eventfd before looking for completions, this makes
+            // sure no notification is lost
+            std::uint64_t value = 0;
+            [[maybe_unused]] auto const r =
+                ::read(event_->native_handle(), &value, sizeof(value));
+
+            {
+                detail::completion_scope scope(this);
+                while (reap_completions() != 0)
+                    /**/;
+            }
+
+            async_wait();
+        }
+
+        // submit everything initiated by the completion handlers at once
+        flush_submissions();
+    }
+
+    // handle all available completions, requires completion_mtx_
+    std::size_t io_uring_transport::reap_completions()
+    {
+        std::size_t count = 0;
+
+        unsigned head = *ring_->cq_head;
+        unsigned tail = detail::load_acquire(ring_->cq_tail);
+        while (head != tail)
+        {
+            // release the completion queue entry before handling it, the
+            // handlers may submit new operations
+            io_uring_cqe const cqe = ring_->cqes[head & ring_->cq_mask];
+            detail::store_release(ring_->cq_head, ++head);
+            ++count;
+
+            if (cqe.user_data != 0)    // ignore completed cancellations
+            {
+                auto* op = reinterpret_cast<detail::io_uring_operation*>(
+                    cqe.user_data);
+                if (op->complete(cqe.res, cqe.flags))
+                {
+                    delete op;
+                    --operations_in_flight_;
+                }
+            }
+
+            if (head == tail)
+                tail = detail::load_acquire(ring_->cq_tail);
+        }
+
+        // ask the kernel to flush completions which did not fit into the
+        // completion queue
+        if (detail::load_acquire(ring_->sq_flags) & IORING_SQ_CQ_OVERFLOW)
+        {
+            detail::sys_io_uring_enter(ring_->fd, 0, 0, IORING_ENTER_GETEVENTS);
+            if (count == 0)
+                count = 1;    // look again
+        }
+
+        return count;
+    }
+}    // namespace hpx::parcelset::policies::tcp
+
+#endif
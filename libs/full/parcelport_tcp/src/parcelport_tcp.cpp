@@ -19,6 +19,7 @@
 //      [hpx.parcel.tcp]
 //      ...
 //      priority = 1
+//      io_uring = 0    (if HPX_WITH_PARCELPORT_TCP_IO_URING=ON)
 //
 template <>
 struct hpx::traits::plugin_config_data<
@@ -42,7 +43,19 @@ struct hpx::traits::plugin_config_data<
 
     static constexpr char const* call() noexcept
     {
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+        return "io_uring = ${HPX_PARCELPORT_TCP_IO_URING:0}\n"
+               "io_uring_queue_depth = "
+               "${HPX_PARCELPORT_TCP_IO_URING_QUEUE_DEPTH:256}\n"
+               "io_uring_receive_buffers = "
+               "${HPX_PARCELPORT_TCP_IO_URING_RECEIVE_BUFFERS:128}\n"
+               "io_uring_receive_buffer_size = "
+               "${HPX_PARCELPORT_TCP_IO_URING_RECEIVE_BUFFER_SIZE:16384}\n"
+               "io_uring_zero_copy_threshold = "
+               "${HPX_PARCELPORT_TCP_IO_URING_ZERO_COPY_THRESHOLD:65536}\n";
+#else
         return "";
+#endif
     }
 };    // namespace hpx::traits
 
@@ -0,0 +1,128 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING)
+#include <hpx/modules/synchronization.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::parcelset {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Decides whether the messages carrying the parcels of an action which
+    /// has a serialization filter (compression) assigned are actually
+    /// compressed. Messages smaller than a threshold are always sent
+    /// uncompressed. Additionally, the compression ratio achieved for an
+    /// action is sampled: if it turns out to be insufficient, the messages of
+    /// that action are sent uncompressed until the next sample is taken.
+    class HPX_EXPORT compression_policy
+    {
+    public:
+        // default for hpx.parcel.compression_threshold (bytes)
+        static constexpr std::size_t default_threshold = 4096;
+
+        // default for hpx.parcel.compression_min_ratio
+        static constexpr double default_min_ratio = 1.1;
+
+        // default for hpx.parcel.compression_sample_interval (messages)
+        static constexpr std::size_t default_sample_interval = 64;
+
+        enum statistics_type
+        {
+            // number of messages compressed
+            compressed_messages = 0,
+            // number of messages sent uncompressed because the data of the
+            // action was found to be incompressible
+            skipped_messages = 1,
+            // time spent compressing messages (nanoseconds)
+            compression_time = 2,
+            // ratio of the uncompressed and compressed sizes of all messages
+            // compressed (percent)
+            compression_ratio = 3
+        };
+
+        compression_policy() = default;
+
+        compression_policy(compression_policy const&) = delete;
+        compression_policy(compression_policy&&) = delete;
+        compression_policy& operator=(compression_policy const&) = delete;
+        compression_policy& operator=(compression_policy&&) = delete;
+
+        ~compression_policy() = default;
+
+        /// Return the policy shared by all parcelports of this locality
+        static compression_policy& get();
+
+        /// Set the parameters of the policy, this is expected to be called
+        /// before any messages are sent.
+        ///
+        /// \param threshold    Messages smaller than this (in bytes) are
+        ///                     never compressed.
+        /// \param min_ratio    The minimal ratio of the uncompressed and the
+        ///                     compressed size of a message, actions whose
+        ///                     data compresses worse are considered to be
+        ///                     incompressible.
+        /// \param sample_interval The number of messages of an action
+        ///                     considered to be incompressible which are sent
+        ///                     uncompressed before the next sample is taken.
+        void configure(std::size_t threshold, double min_ratio,
+            std::size_t sample_interval) noexcept;
+
+        /// Return whether a message of the given (estimated) size holding
+        /// parcels of the given action should be compressed.
+        [[nodiscard]] bool should_compress(
+            char const* action, std::size_t size);
+
+        /// Record the outcome of compressing a message holding parcels of
+        /// the given action.
+        void add_data(char const* action, std::size_t uncompressed_size,
+            std::size_t compressed_size, std::int64_t time);
+
+        /// Return the requested statistics for the action with the given
+        /// name, or for all actions if the name is empty.
+        std::int64_t get_statistics(
+            std::string const& action, statistics_type t, bool reset);
+
+    private:
+        struct action_data
+        {
+            // number of messages to send uncompressed before sampling the
+            // compression ratio again
+            std::size_t skip = 0;
+
+            std::int64_t compressed_messages = 0;
+            std::int64_t skipped_messages = 0;
+            std::int64_t uncompressed_bytes = 0;
+            std::int64_t compressed_bytes = 0;
+            std::int64_t compression_time = 0;
+        };
+
+        using mutex_type = hpx::spinlock;
+
+        std::size_t threshold_ = default_threshold;
+        double min_ratio_ = default_min_ratio;
+        std::size_t sample_interval_ = default_sample_interval;
+
+        // The action names are static strings, which allows to use their
+        // addresses as keys. Note that an action instantiated in more than
+        // one module may appear more than once.
+        mutex_type mtx_;
+        std::unordered_map<char const*, action_data> data_;
+    };
+}    // namespace hpx::parcelset
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
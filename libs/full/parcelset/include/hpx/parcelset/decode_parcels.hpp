@@ -19,6 +19,7 @@
 #include <hpx/modules/timing.hpp>
 
 #include <hpx/components_base/agas_interface.hpp>
+#include <hpx/parcelset/receive_buffer_pool.hpp>
 #include <hpx/parcelset_base/detail/data_point.hpp>
 #include <hpx/parcelset_base/detail/parcel_route_handler.hpp>
 #include <hpx/parcelset_base/parcel_interface.hpp>
@@ -426,8 +427,23 @@ namespace hpx::parcelset {
         serialization::input_archive archive(
             buffer.data_, inbound_data_size, &chunks);
 
-        return decode_message_with_chunks(
+        if (!buffer.chunks_owner_)
+        {
+            return decode_message_with_chunks(
+                archive, pp, buffer, parcel_count, num_thread);
+        }
+
+        // the received zero-copy chunks may be referred to by the
+        // de-serialized objects instead of being copied
+        auto& owner = archive.get_extra_data<
+            serialization::detail::receive_chunk_owner>();
+        owner.owner = HPX_MOVE(buffer.chunks_owner_);
+
+        auto parcels = decode_message_with_chunks(
             archive, pp, buffer, parcel_count, num_thread);
+
+        receive_buffer_pool::get().add_chunk_views(owner.views);
+        return parcels;
     }
 
     template <typename Parcelport, typename Buffer>
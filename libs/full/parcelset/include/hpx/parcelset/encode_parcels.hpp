@@ -23,6 +23,7 @@
 #include <hpx/actions_base/basic_action.hpp>
 #include <hpx/naming/detail/preprocess_gid_types.hpp>
 #include <hpx/naming/split_gid.hpp>
+#include <hpx/parcelset/compression_policy.hpp>
 #include <hpx/parcelset/parcel.hpp>
 #include <hpx/parcelset/parcelset_fwd.hpp>
 #include <hpx/parcelset_base/parcelport.hpp>
@@ -69,11 +70,13 @@ namespace hpx::parcelset {
             std::string result;
             if (LPT_ENABLED(debug))
             {
-                result.reserve(buffer.data_.size() * 2 + 1);
-                for (std::uint8_t const byte : buffer.data_)
+                std::size_t const size = buffer.data_.size();
+                result.reserve(size * 2 + 1);
+                for (std::size_t i = 0; i != size; ++i)
                 {
                     char b[3] = {0};
-                    convert_byte(byte, &b[0], &b[3]);
+                    convert_byte(static_cast<std::uint8_t>(buffer.data_[i]),
+                        &b[0], &b[3]);
                     result += b;
                 }
             }
@@ -171,17 +174,9 @@ namespace hpx::parcelset {
         {
             try
             {
-                std::unique_ptr<serialization::binary_filter> const filter(
+                std::unique_ptr<serialization::binary_filter> filter(
                     ps[0].get_serialization_filter());
 
-                int archive_flags = archive_flags_;
-                if (filter)
-                {
-                    archive_flags = archive_flags |
-                        static_cast<int>(
-                            serialization::archive_flags::enable_compression);
-                }
-
                 // preallocate data
                 std::size_t num_chunks = 0;
                 for (/**/; parcels_sent != parcels_size; ++parcels_sent)
@@ -192,6 +187,26 @@ namespace hpx::parcelset {
                     num_chunks += ps[parcels_sent].num_chunks();
                 }
 
+                // compress only if it is expected to pay off
+                char const* action_name = nullptr;
+                if (filter)
+                {
+                    action_name = ps[0].get_action_name();
+                    if (!compression_policy::get().should_compress(
+                            action_name, arg_size))
+                    {
+                        filter.reset();
+                    }
+                }
+
+                int archive_flags = archive_flags_;
+                if (filter)
+                {
+                    archive_flags = archive_flags |
+                        static_cast<int>(
+                            serialization::archive_flags::enable_compression);
+                }
+
                 buffer.data_.reserve(arg_size);
                 buffer.chunks_.reserve(num_chunks);
 
@@ -244,7 +259,20 @@ namespace hpx::parcelset {
                         pp.add_sent_data(ps[i].get_action_name(), action_data);
 #endif
                     }
-                    archive.flush();
+                    if (filter)
+                    {
+                        hpx::chrono::high_resolution_timer const
+                            compression_timer;
+                        archive.flush();
+
+                        compression_policy::get().add_data(action_name,
+                            archive.bytes_written(), buffer.data_.size(),
+                            compression_timer.elapsed_nanoseconds());
+                    }
+                    else
+                    {
+                        archive.flush();
+                    }
                     arg_size = archive.bytes_written();
                 }
 
@@ -11,16 +11,23 @@
 
 #if defined(HPX_HAVE_NETWORKING)
 #include <hpx/modules/serialization.hpp>
+#include <hpx/serialization/detail/default_init_allocator.hpp>
 
 #include <hpx/parcelset_base/detail/data_point.hpp>
 
 #include <cstdint>
+#include <memory>
 #include <utility>
 #include <vector>
 
 namespace hpx::parcelset {
 
-    template <typename BufferType = std::vector<char>,
+    // The data buffer used for sending parcels by default. Growing it while
+    // serializing does not initialize the added memory.
+    using parcel_data_buffer = std::vector<char,
+        serialization::detail::default_init_allocator<char>>;
+
+    template <typename BufferType = parcel_data_buffer,
         typename ChunkType = serialization::serialization_chunk>
     struct parcel_buffer
     {
@@ -65,6 +72,7 @@ namespace hpx::parcelset {
         {
             data_.clear();
             chunks_.clear();
+            chunks_owner_.reset();
             transmission_chunks_.clear();
             num_chunks_ = count_chunks_type(0, 0);
             size_ = 0;
@@ -80,6 +88,10 @@ namespace hpx::parcelset {
         std::vector<ChunkType> chunks_;
         std::vector<transmission_chunk_type> transmission_chunks_;
 
+        // keeps the memory the pointer chunks refer to alive, allows for the
+        // de-serialized objects to refer to the received data directly
+        std::shared_ptr<void> chunks_owner_;
+
         // pair of (zero-copy, non-zero-copy) chunks
         count_chunks_type num_chunks_;
 
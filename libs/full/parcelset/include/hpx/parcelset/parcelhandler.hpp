@@ -22,7 +22,9 @@
 
 #include <hpx/components_base/component_type.hpp>
 #include <hpx/naming_base/gid_type.hpp>
+#include <hpx/parcelset/compression_policy.hpp>
 #include <hpx/parcelset/parcelset_fwd.hpp>
+#include <hpx/parcelset/receive_buffer_pool.hpp>
 #include <hpx/parcelset_base/locality.hpp>
 #include <hpx/parcelset_base/parcel_interface.hpp>
 #include <hpx/parcelset_base/parcelport.hpp>
@@ -384,6 +386,16 @@ namespace hpx::parcelset {
         std::int64_t get_connection_cache_statistics(std::string const& pp_type,
             parcelport::connection_cache_statistics_type stat_type, bool) const;
 
+        // statistics of the pool of receive buffers shared by all parcelports
+        static std::int64_t get_receive_buffer_statistics(
+            receive_buffer_pool::statistics_type stat_type, bool reset);
+
+        // statistics of the compression of messages, either for the given
+        // action or for all actions (if the action name is empty)
+        static std::int64_t get_compression_statistics(
+            compression_policy::statistics_type stat_type,
+            std::string const& action, bool reset);
+
         void list_parcelports(std::ostringstream& strm) const;
         void list_parcelport(std::ostringstream& strm,
             std::string const& ppname, int priority, bool bootstrap) const;
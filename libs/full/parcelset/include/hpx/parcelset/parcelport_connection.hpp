@@ -22,11 +22,11 @@
 
 namespace hpx::parcelset {
 
-    template <typename Connection>
+    template <typename Connection, typename BufferType = std::vector<char>>
     struct parcelport_connection : std::enable_shared_from_this<Connection>
     {
-        using buffer_type = std::vector<char>;
-        using parcel_buffer_type = parcel_buffer<>;
+        using buffer_type = BufferType;
+        using parcel_buffer_type = parcel_buffer<buffer_type>;
 
     protected:
         parcelport_connection(parcelport_connection const&) = delete;
@@ -56,7 +56,8 @@ namespace hpx::parcelset {
         {
         }
 
-        explicit parcelport_connection(buffer_type::allocator_type const& alloc)
+        explicit parcelport_connection(
+            typename buffer_type::allocator_type const& alloc)
           : state_(state_initialized)
           , buffer_(alloc)
         {
@@ -77,7 +78,8 @@ namespace hpx::parcelset {
 #else
         parcelport_connection() = default;
 
-        explicit parcelport_connection(buffer_type::allocator_type const& alloc)
+        explicit parcelport_connection(
+            typename buffer_type::allocator_type const& alloc)
           : buffer_(alloc)
         {
         }
@@ -184,6 +184,11 @@ namespace hpx::parcelset {
                 archive_flags_ = archive_flags_ |
                     serialization::archive_flags::disable_receive_data_chunking;
             }
+
+            // all localities agree on the ids of the polymorphic types as
+            // they are assigned during bootstrap (see big_boot_barrier)
+            archive_flags_ =
+                archive_flags_ | serialization::archive_flags::enable_type_ids;
         }
 
         parcelport_impl(parcelport_impl const&) = delete;
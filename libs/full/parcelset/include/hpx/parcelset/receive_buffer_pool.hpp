@@ -0,0 +1,179 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING)
+#include <hpx/modules/synchronization.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::parcelset {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A pool of the memory blocks used by the parcelports to receive
+    /// messages. Blocks are grouped into power-of-two size classes, released
+    /// blocks are kept (up to a per size class limit) for subsequent messages
+    /// of a similar size instead of being returned to the system.
+    class HPX_EXPORT receive_buffer_pool
+    {
+    public:
+        static constexpr std::size_t min_block_size_log2 = 8;     // 256B
+        static constexpr std::size_t max_block_size_log2 = 24;    // 16MiB
+        static constexpr std::size_t num_size_classes =
+            max_block_size_log2 - min_block_size_log2 + 1;
+
+        // the amount of memory cached for each of the size classes
+        static constexpr std::size_t max_cached_bytes = 16 * 1024 * 1024;
+        static constexpr std::size_t max_cached_blocks = 256;
+
+        enum statistics_type
+        {
+            // number of blocks allocated from the system
+            allocations = 0,
+            // number of blocks served from the pool
+            reuses = 1,
+            // number of bytes served from the pool
+            reused_bytes = 2,
+            // number of zero-copy chunks handed to the application without
+            // being copied
+            chunk_views = 3
+        };
+
+        receive_buffer_pool() = default;
+
+        receive_buffer_pool(receive_buffer_pool const&) = delete;
+        receive_buffer_pool(receive_buffer_pool&&) = delete;
+        receive_buffer_pool& operator=(receive_buffer_pool const&) = delete;
+        receive_buffer_pool& operator=(receive_buffer_pool&&) = delete;
+
+        ~receive_buffer_pool();
+
+        /// Return the pool shared by all parcelports of this locality
+        static receive_buffer_pool& get();
+
+        [[nodiscard]] void* allocate(std::size_t size);
+        void deallocate(void* p, std::size_t size) noexcept;
+
+        void add_chunk_views(std::size_t count) noexcept
+        {
+            chunk_views_.fetch_add(
+                static_cast<std::int64_t>(count), std::memory_order_relaxed);
+        }
+
+        std::int64_t get_statistics(statistics_type t, bool reset) noexcept;
+
+    private:
+        // Return the size class of the given block size, returns
+        // num_size_classes if the block is too large to be pooled.
+        static constexpr std::size_t size_class(std::size_t size) noexcept
+        {
+            std::size_t cls = 0;
+            while (cls != num_size_classes &&
+                (std::size_t(1) << (cls + min_block_size_log2)) < size)
+            {
+                ++cls;
+            }
+            return cls;
+        }
+
+        static constexpr std::size_t class_size(std::size_t cls) noexcept
+        {
+            return std::size_t(1) << (cls + min_block_size_log2);
+        }
+
+        struct size_class_data
+        {
+            hpx::spinlock mtx;
+            std::vector<void*> blocks;
+        };
+
+        std::array<size_class_data, num_size_classes> classes_;
+
+        std::atomic<std::int64_t> allocations_ = 0;
+        std::atomic<std::int64_t> reuses_ = 0;
+        std::atomic<std::int64_t> reused_bytes_ = 0;
+        std::atomic<std::int64_t> chunk_views_ = 0;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Allocator drawing its memory from the receive_buffer_pool. Elements
+    /// are default-initialized as the buffers are always overwritten with the
+    /// received data.
+    template <typename T>
+    struct receive_buffer_allocator
+    {
+        using value_type = T;
+
+        constexpr receive_buffer_allocator() noexcept = default;
+
+        template <typename U>
+        constexpr receive_buffer_allocator(
+            receive_buffer_allocator<U> const&) noexcept
+        {
+        }
+
+        [[nodiscard]] T* allocate(std::size_t n)
+        {
+            return static_cast<T*>(
+                receive_buffer_pool::get().allocate(n * sizeof(T)));
+        }
+
+        void deallocate(T* p, std::size_t n) noexcept
+        {
+            receive_buffer_pool::get().deallocate(p, n * sizeof(T));
+        }
+
+        template <typename U>
+        void construct(U* p) noexcept(
+            std::is_nothrow_default_constructible_v<U>)
+        {
+            ::new (static_cast<void*>(p)) U;
+        }
+
+        template <typename U, typename... Ts>
+        void construct(U* p, Ts&&... ts)
+        {
+            ::new (static_cast<void*>(p)) U(HPX_FORWARD(Ts, ts)...);
+        }
+
+        friend constexpr bool operator==(receive_buffer_allocator const&,
+            receive_buffer_allocator const&) noexcept
+        {
+            return true;
+        }
+
+        friend constexpr bool operator!=(receive_buffer_allocator const&,
+            receive_buffer_allocator const&) noexcept
+        {
+            return false;
+        }
+    };
+
+    /// The type of the buffers used by the parcelports to receive data
+    using receive_buffer_type =
+        std::vector<char, receive_buffer_allocator<char>>;
+
+    /// The buffers holding the zero-copy chunks of a received message. Those
+    /// are shared with the de-serialized objects referring to the chunks.
+    using receive_chunk_buffers = std::vector<receive_buffer_type>;
+}    // namespace hpx::parcelset
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
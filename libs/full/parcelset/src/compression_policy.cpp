@@ -0,0 +1,134 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING)
+#include <hpx/modules/synchronization.hpp>
+#include <hpx/parcelset/compression_policy.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <string>
+
+namespace hpx::parcelset {
+
+    compression_policy& compression_policy::get()
+    {
+        static compression_policy policy;
+        return policy;
+    }
+
+    void compression_policy::configure(std::size_t threshold,
+        double min_ratio, std::size_t sample_interval) noexcept
+    {
+        threshold_ = threshold;
+        min_ratio_ = min_ratio;
+        sample_interval_ = sample_interval;
+    }
+
+    bool compression_policy::should_compress(
+        char const* action, std::size_t size)
+    {
+        if (size < threshold_)
+        {
+            return false;
+        }
+
+        std::lock_guard l(mtx_);
+
+        action_data& data = data_[action];
+        if (data.skip != 0)
+        {
+            --data.skip;
+            ++data.skipped_messages;
+            return false;
+        }
+        return true;
+    }
+
+    void compression_policy::add_data(char const* action,
+        std::size_t uncompressed_size, std::size_t compressed_size,
+        std::int64_t time)
+    {
+        std::lock_guard l(mtx_);
+
+        action_data& data = data_[action];
+
+        ++data.compressed_messages;
+        data.uncompressed_bytes += static_cast<std::int64_t>(uncompressed_size);
+        data.compressed_bytes += static_cast<std::int64_t>(compressed_size);
+        data.compression_time += time;
+
+        // send the next messages uncompressed if compression did not pay off
+        if (static_cast<double>(uncompressed_size) <
+            min_ratio_ * static_cast<double>(compressed_size))
+        {
+            data.skip = sample_interval_;
+        }
+    }
+
+    std::int64_t compression_policy::get_statistics(
+        std::string const& action, statistics_type t, bool reset)
+    {
+        std::int64_t result = 0;
+        std::int64_t uncompressed_bytes = 0;
+        std::int64_t compressed_bytes = 0;
+
+        std::lock_guard l(mtx_);
+        for (auto& [name, data] : data_)
+        {
+            if (!action.empty() && std::strcmp(name, action.c_str()) != 0)
+            {
+                continue;
+            }
+
+            switch (t)
+            {
+            case compressed_messages:
+                result += data.compressed_messages;
+                if (reset)
+                    data.compressed_messages = 0;
+                break;
+
+            case skipped_messages:
+                result += data.skipped_messages;
+                if (reset)
+                    data.skipped_messages = 0;
+                break;
+
+            case compression_time:
+                result += data.compression_time;
+                if (reset)
+                    data.compression_time = 0;
+                break;
+
+            case compression_ratio:
+                uncompressed_bytes += data.uncompressed_bytes;
+                compressed_bytes += data.compressed_bytes;
+                if (reset)
+                {
+                    data.uncompressed_bytes = 0;
+                    data.compressed_bytes = 0;
+                }
+                break;
+
+            default:
+                break;
+            }
+        }
+
+        if (t == compression_ratio && compressed_bytes != 0)
+        {
+            result = (uncompressed_bytes * 100) / compressed_bytes;
+        }
+        return result;
+    }
+}    // namespace hpx::parcelset
+
+#endif
@@ -33,6 +33,7 @@
 
 #include <hpx/components_base/agas_interface.hpp>
 #include <hpx/naming_base/gid_type.hpp>
+#include <hpx/parcelset/compression_policy.hpp>
 #include <hpx/parcelset/init_parcelports.hpp>
 #include <hpx/parcelset/message_handler_fwd.hpp>
 #include <hpx/parcelset/parcelhandler.hpp>
@@ -97,6 +98,16 @@ namespace hpx::parcelset {
       , is_networking_enabled_(false)
 #endif
     {
+        compression_policy::get().configure(
+            util::get_entry_as<std::size_t>(cfg,
+                "hpx.parcel.compression_threshold",
+                compression_policy::default_threshold),
+            util::get_entry_as<double>(cfg, "hpx.parcel.compression_min_ratio",
+                compression_policy::default_min_ratio),
+            util::get_entry_as<std::size_t>(cfg,
+                "hpx.parcel.compression_sample_interval",
+                compression_policy::default_sample_interval));
+
         LPROGRESS_;
     }
 
@@ -1336,6 +1347,20 @@ namespace hpx::parcelset {
         return pp ? pp->get_connection_cache_statistics(stat_type, reset) : 0;
     }
 
+    std::int64_t parcelhandler::get_receive_buffer_statistics(
+        receive_buffer_pool::statistics_type stat_type, bool reset)
+    {
+        return receive_buffer_pool::get().get_statistics(stat_type, reset);
+    }
+
+    std::int64_t parcelhandler::get_compression_statistics(
+        compression_policy::statistics_type stat_type,
+        std::string const& action, bool reset)
+    {
+        return compression_policy::get().get_statistics(
+            action, stat_type, reset);
+    }
+
     std::vector<plugins::parcelport_factory_base*>&
     parcelhandler::get_parcelport_factories()
     {
@@ -1423,6 +1448,12 @@ namespace hpx::parcelset {
                 HPX_ZERO_COPY_SERIALIZATION_THRESHOLD) "}");
         ini_defs.emplace_back("max_background_threads = "
                               "${HPX_PARCEL_MAX_BACKGROUND_THREADS:-1}");
+        ini_defs.emplace_back(
+            "compression_threshold = ${HPX_PARCEL_COMPRESSION_THRESHOLD:4096}");
+        ini_defs.emplace_back(
+            "compression_min_ratio = ${HPX_PARCEL_COMPRESSION_MIN_RATIO:1.1}");
+        ini_defs.emplace_back("compression_sample_interval = "
+                              "${HPX_PARCEL_COMPRESSION_SAMPLE_INTERVAL:64}");
 
         for (plugins::parcelport_factory_base* f :
             parcelhandler::get_parcelport_factories())
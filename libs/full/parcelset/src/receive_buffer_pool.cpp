@@ -0,0 +1,135 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING)
+#include <hpx/modules/synchronization.hpp>
+#include <hpx/modules/util.hpp>
+#include <hpx/parcelset/receive_buffer_pool.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+
+namespace hpx::parcelset {
+
+    receive_buffer_pool::~receive_buffer_pool()
+    {
+        for (auto& data : classes_)
+        {
+            for (void* p : data.blocks)
+            {
+                ::operator delete(p);
+            }
+        }
+    }
+
+    receive_buffer_pool& receive_buffer_pool::get()
+    {
+        // Buffers may be released during the destruction of static objects,
+        // the pool is therefore never destroyed.
+        static receive_buffer_pool* pool = new receive_buffer_pool();
+        return *pool;
+    }
+
+    void* receive_buffer_pool::allocate(std::size_t size)
+    {
+        std::size_t const cls = size_class(size);
+        if (cls == num_size_classes)
+        {
+            allocations_.fetch_add(1, std::memory_order_relaxed);
+            return ::operator new(size);
+        }
+
+        {
+            size_class_data& data = classes_[cls];
+
+            std::unique_lock l(data.mtx);
+            if (!data.blocks.empty())
+            {
+                void* p = data.blocks.back();
+                data.blocks.pop_back();
+                l.unlock();
+
+                reuses_.fetch_add(1, std::memory_order_relaxed);
+                reused_bytes_.fetch_add(
+                    static_cast<std::int64_t>(class_size(cls)),
+                    std::memory_order_relaxed);
+                return p;
+            }
+        }
+
+        allocations_.fetch_add(1, std::memory_order_relaxed);
+        return ::operator new(class_size(cls));
+    }
+
+    void receive_buffer_pool::deallocate(void* p, std::size_t size) noexcept
+    {
+        if (p == nullptr)
+            return;
+
+        std::size_t const cls = size_class(size);
+        if (cls != num_size_classes)
+        {
+            std::size_t const max_blocks = (std::min) (max_cached_blocks,
+                (std::max) (std::size_t(1),
+                    max_cached_bytes / class_size(cls)));
+
+            size_class_data& data = classes_[cls];
+
+            std::unique_lock l(data.mtx);
+            if (data.blocks.size() < max_blocks)
+            {
+                // the capacity is reserved up front, push_back can't throw
+                if (data.blocks.capacity() == 0)
+                {
+                    try
+                    {
+                        data.blocks.reserve(max_blocks);
+                    }
+                    catch (...)
+                    {
+                        l.unlock();
+                        ::operator delete(p);
+                        return;
+                    }
+                }
+                data.blocks.push_back(p);
+                return;
+            }
+        }
+
+        ::operator delete(p);
+    }
+
+    std::int64_t receive_buffer_pool::get_statistics(
+        statistics_type t, bool reset) noexcept
+    {
+        switch (t)
+        {
+        case allocations:
+            return util::get_and_reset_value(allocations_, reset);
+
+        case reuses:
+            return util::get_and_reset_value(reuses_, reset);
+
+        case reused_bytes:
+            return util::get_and_reset_value(reused_bytes_, reset);
+
+        case chunk_views:
+            return util::get_and_reset_value(chunk_views_, reset);
+
+        default:
+            break;
+        }
+        return 0;
+    }
+}    // namespace hpx::parcelset
+
+#endif
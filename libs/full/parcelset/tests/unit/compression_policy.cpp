@@ -0,0 +1,177 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that the compression policy sends exactly 'sample_interval' messages
+// of an action uncompressed after its data turned out to be incompressible.
+
+#include <hpx/config.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parcelset/compression_policy.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+using hpx::parcelset::compression_policy;
+
+// the policy identifies actions by the address of their (static) names
+char const* const incompressible_action = "incompressible_action";
+char const* const compressible_action = "compressible_action";
+
+constexpr std::size_t threshold = 1024;
+constexpr double min_ratio = 2.0;
+constexpr std::size_t sample_interval = 8;
+
+std::int64_t get_statistics(compression_policy& policy, char const* action,
+    compression_policy::statistics_type t, bool reset = false)
+{
+    return policy.get_statistics(action, t, reset);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_threshold()
+{
+    compression_policy policy;
+    policy.configure(threshold, min_ratio, sample_interval);
+
+    HPX_TEST(!policy.should_compress(compressible_action, threshold - 1));
+    HPX_TEST(policy.should_compress(compressible_action, threshold));
+
+    // small messages are not counted as skipped
+    HPX_TEST_EQ(get_statistics(policy, compressible_action,
+                    compression_policy::skipped_messages),
+        std::int64_t(0));
+}
+
+void test_incompressible()
+{
+    compression_policy policy;
+    policy.configure(threshold, min_ratio, sample_interval);
+
+    for (int sample = 1; sample != 4; ++sample)
+    {
+        // the first message (and every sample) is compressed
+        HPX_TEST(policy.should_compress(incompressible_action, threshold));
+        policy.add_data(incompressible_action, threshold, threshold, 100);
+
+        // exactly sample_interval messages are skipped
+        for (std::size_t i = 0; i != sample_interval; ++i)
+        {
+            HPX_TEST(!policy.should_compress(incompressible_action, threshold));
+        }
+
+        HPX_TEST_EQ(get_statistics(policy, incompressible_action,
+                        compression_policy::compressed_messages),
+            std::int64_t(sample));
+        HPX_TEST_EQ(get_statistics(policy, incompressible_action,
+                        compression_policy::skipped_messages),
+            std::int64_t(sample * sample_interval));
+    }
+
+    // a sample with a sufficient ratio re-enables compression
+    HPX_TEST(policy.should_compress(incompressible_action, threshold));
+    policy.add_data(incompressible_action, 4 * threshold, threshold, 100);
+
+    for (std::size_t i = 0; i != 2 * sample_interval; ++i)
+    {
+        HPX_TEST(policy.should_compress(incompressible_action, threshold));
+    }
+    HPX_TEST_EQ(get_statistics(policy, incompressible_action,
+                    compression_policy::skipped_messages),
+        std::int64_t(3 * sample_interval));
+
+    // other actions are not affected
+    HPX_TEST(policy.should_compress(compressible_action, threshold));
+    HPX_TEST_EQ(get_statistics(policy, compressible_action,
+                    compression_policy::skipped_messages),
+        std::int64_t(0));
+}
+
+// A ratio just below the minimum counts as incompressible.
+void test_min_ratio()
+{
+    compression_policy policy;
+    policy.configure(threshold, min_ratio, sample_interval);
+
+    HPX_TEST(policy.should_compress(incompressible_action, threshold));
+    policy.add_data(incompressible_action, 2 * threshold - 1, threshold, 0);
+    HPX_TEST(!policy.should_compress(incompressible_action, threshold));
+
+    HPX_TEST(policy.should_compress(compressible_action, threshold));
+    policy.add_data(compressible_action, 2 * threshold, threshold, 0);
+    HPX_TEST(policy.should_compress(compressible_action, threshold));
+}
+
+// Without sampling, all messages are compressed.
+void test_no_sampling()
+{
+    compression_policy policy;
+    policy.configure(threshold, min_ratio, 0);
+
+    for (int i = 0; i != 4; ++i)
+    {
+        HPX_TEST(policy.should_compress(incompressible_action, threshold));
+        policy.add_data(incompressible_action, threshold, threshold, 0);
+    }
+    HPX_TEST_EQ(get_statistics(policy, incompressible_action,
+                    compression_policy::skipped_messages),
+        std::int64_t(0));
+}
+
+void test_statistics()
+{
+    compression_policy policy;
+    policy.configure(threshold, min_ratio, sample_interval);
+
+    HPX_TEST(policy.should_compress(compressible_action, threshold));
+    policy.add_data(compressible_action, 3 * threshold, threshold, 100);
+
+    HPX_TEST(policy.should_compress(incompressible_action, threshold));
+    policy.add_data(incompressible_action, threshold, threshold, 50);
+    HPX_TEST(!policy.should_compress(incompressible_action, threshold));
+
+    // an empty name refers to all actions
+    HPX_TEST_EQ(
+        get_statistics(policy, "", compression_policy::compressed_messages),
+        std::int64_t(2));
+    HPX_TEST_EQ(
+        get_statistics(policy, "", compression_policy::skipped_messages),
+        std::int64_t(1));
+    HPX_TEST_EQ(
+        get_statistics(policy, "", compression_policy::compression_time),
+        std::int64_t(150));
+
+    // (3 + 1) / (1 + 1) in percent
+    HPX_TEST_EQ(
+        get_statistics(policy, "", compression_policy::compression_ratio),
+        std::int64_t(200));
+    HPX_TEST_EQ(get_statistics(policy, compressible_action,
+                    compression_policy::compression_ratio),
+        std::int64_t(300));
+
+    // actions are looked up by name
+    std::string const name(incompressible_action);
+    HPX_TEST_EQ(policy.get_statistics(
+                    name, compression_policy::compression_time, true),
+        std::int64_t(50));
+    HPX_TEST_EQ(policy.get_statistics(
+                    name, compression_policy::compression_time, false),
+        std::int64_t(0));
+    HPX_TEST_EQ(
+        get_statistics(policy, "", compression_policy::compression_time),
+        std::int64_t(100));
+}
+
+int main()
+{
+    test_threshold();
+    test_incompressible();
+    test_min_ratio();
+    test_no_sampling();
+    test_statistics();
+
+    return hpx::util::report_errors();
+}
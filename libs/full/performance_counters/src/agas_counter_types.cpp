@@ -65,6 +65,21 @@ namespace hpx { namespace performance_counters {
                 &agas::addressing_service::get_cache_erase_entry_time,
                 &client));
 
+        hpx::function<std::int64_t(bool)> resolve_batch_count(hpx::bind_front(
+            &agas::addressing_service::get_resolve_batch_count, &client));
+        hpx::function<std::int64_t(bool)> resolve_batch_requests(
+            hpx::bind_front(
+                &agas::addressing_service::get_resolve_batch_requests,
+                &client));
+        hpx::function<std::int64_t(bool)> resolve_batch_time(hpx::bind_front(
+            &agas::addressing_service::get_resolve_batch_time, &client));
+        hpx::function<std::int64_t(bool)> decref_batch_count(hpx::bind_front(
+            &agas::addressing_service::get_decref_batch_count, &client));
+        hpx::function<std::int64_t(bool)> decref_batch_requests(
+            hpx::bind_front(
+                &agas::addressing_service::get_decref_batch_requests,
+                &client));
+
         using placeholders::_1;
         using placeholders::_2;
         performance_counters::generic_counter_type_data const counter_types[] =
@@ -196,6 +211,56 @@ namespace hpx { namespace performance_counters {
                         &performance_counters::locality_raw_counter_creator, _1,
                         cache_erase_entry_time, _2),
                     &performance_counters::locality_counter_discoverer, ""},
+                {"/agas/count/batch/resolve",
+                    performance_counters::counter_type::
+                        monotonically_increasing,
+                    "returns the number of batched address resolution "
+                    "requests sent to remote AGAS service instances",
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        resolve_batch_count, _2),
+                    &performance_counters::locality_counter_discoverer, ""},
+                {"/agas/count/batch/resolve_requests",
+                    performance_counters::counter_type::
+                        monotonically_increasing,
+                    "returns the number of address resolutions combined into "
+                    "batched requests",
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        resolve_batch_requests, _2),
+                    &performance_counters::locality_counter_discoverer, ""},
+                {"/agas/time/batch/resolve",
+                    performance_counters::counter_type::
+                        monotonically_increasing,
+                    "returns the overall time spent waiting for the responses "
+                    "to batched address resolution requests",
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        resolve_batch_time, _2),
+                    &performance_counters::locality_counter_discoverer, "ns"},
+                {"/agas/count/batch/decrement_credit",
+                    performance_counters::counter_type::
+                        monotonically_increasing,
+                    "returns the number of batched credit decrement requests "
+                    "sent to AGAS service instances",
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        decref_batch_count, _2),
+                    &performance_counters::locality_counter_discoverer, ""},
+                {"/agas/count/batch/decrement_credit_requests",
+                    performance_counters::counter_type::
+                        monotonically_increasing,
+                    "returns the number of credit decrements combined into "
+                    "batched requests",
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        decref_batch_requests, _2),
+                    &performance_counters::locality_counter_discoverer, ""},
             };
 
         performance_counters::install_counter_types(
@@ -598,6 +598,51 @@ namespace hpx::performance_counters {
         hpx::function<std::int64_t(bool)> outgoing_routed_count(
             hpx::bind_front(&parcelhandler::get_parcel_routed_count, &ph));
 
+        using receive_buffer_pool = parcelset::receive_buffer_pool;
+        hpx::function<std::int64_t(bool)> receive_buffer_allocations(
+            hpx::bind_front(&parcelhandler::get_receive_buffer_statistics,
+                receive_buffer_pool::allocations));
+        hpx::function<std::int64_t(bool)> receive_buffer_reuses(
+            hpx::bind_front(&parcelhandler::get_receive_buffer_statistics,
+                receive_buffer_pool::reuses));
+        hpx::function<std::int64_t(bool)> receive_buffer_reused_bytes(
+            hpx::bind_front(&parcelhandler::get_receive_buffer_statistics,
+                receive_buffer_pool::reused_bytes));
+        hpx::function<std::int64_t(bool)> receive_chunk_views(
+            hpx::bind_front(&parcelhandler::get_receive_buffer_statistics,
+                receive_buffer_pool::chunk_views));
+
+        using parcelset::compression_policy;
+#if defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
+        hpx::function<std::int64_t(std::string const&, bool)>
+            compressed_messages(
+                hpx::bind_front(&parcelhandler::get_compression_statistics,
+                    compression_policy::compressed_messages));
+        hpx::function<std::int64_t(std::string const&, bool)> skipped_messages(
+            hpx::bind_front(&parcelhandler::get_compression_statistics,
+                compression_policy::skipped_messages));
+        hpx::function<std::int64_t(std::string const&, bool)> compression_time(
+            hpx::bind_front(&parcelhandler::get_compression_statistics,
+                compression_policy::compression_time));
+        hpx::function<std::int64_t(std::string const&, bool)>
+            compression_ratio(
+                hpx::bind_front(&parcelhandler::get_compression_statistics,
+                    compression_policy::compression_ratio));
+#else
+        hpx::function<std::int64_t(bool)> compressed_messages(
+            hpx::bind_front(&parcelhandler::get_compression_statistics,
+                compression_policy::compressed_messages, std::string()));
+        hpx::function<std::int64_t(bool)> skipped_messages(
+            hpx::bind_front(&parcelhandler::get_compression_statistics,
+                compression_policy::skipped_messages, std::string()));
+        hpx::function<std::int64_t(bool)> compression_time(
+            hpx::bind_front(&parcelhandler::get_compression_statistics,
+                compression_policy::compression_time, std::string()));
+        hpx::function<std::int64_t(bool)> compression_ratio(
+            hpx::bind_front(&parcelhandler::get_compression_statistics,
+                compression_policy::compression_ratio, std::string()));
+#endif
+
         performance_counters::generic_counter_type_data const counter_types[] =
             {{"/parcelqueue/length/receive",
                  performance_counters::counter_type::raw,
@@ -625,7 +670,121 @@ namespace hpx::performance_counters {
                     hpx::bind(
                         &performance_counters::locality_raw_counter_creator, _1,
                         outgoing_routed_count, _2),
-                    &performance_counters::locality_counter_discoverer, ""}};
+                    &performance_counters::locality_counter_discoverer, ""},
+                {"/parcels/count/receive-buffers/allocations",
+                    performance_counters::counter_type::
+                        monotonically_increasing,
+                    "returns the number of receive buffers allocated from the "
+                    "system by all parcelports",
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        receive_buffer_allocations, _2),
+                    &performance_counters::locality_counter_discoverer, ""},
+                {"/parcels/count/receive-buffers/reuses",
+                    performance_counters::counter_type::
+                        monotonically_increasing,
+                    "returns the number of receive buffers reused from the "
+                    "pool of receive buffers by all parcelports",
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        receive_buffer_reuses, _2),
+                    &performance_counters::locality_counter_discoverer, ""},
+                {"/parcels/data/receive-buffers/reused",
+                    performance_counters::counter_type::
+                        monotonically_increasing,
+                    "returns the number of bytes of the receive buffers reused "
+                    "from the pool of receive buffers by all parcelports",
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        receive_buffer_reused_bytes, _2),
+                    &performance_counters::locality_counter_discoverer,
+                    "bytes"},
+                {"/parcels/count/zero-copy-chunks/views",
+                    performance_counters::counter_type::
+                        monotonically_increasing,
+                    "returns the number of received zero-copy chunks handed to "
+                    "the de-serialized objects without being copied",
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        receive_chunk_views, _2),
+                    &performance_counters::locality_counter_discoverer, ""},
+                {"/parcels/count/compression/compressed",
+                    performance_counters::counter_type::
+                        monotonically_increasing,
+                    "returns the number of messages which were sent "
+                    "compressed (for the referenced action or for all "
+                    "actions)",
+                    HPX_PERFORMANCE_COUNTER_V1,
+#if defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
+                    hpx::bind(
+                        &performance_counters::per_action_data_counter_creator,
+                        _1, compressed_messages, _2),
+                    &performance_counters::per_action_data_counter_discoverer,
+#else
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        compressed_messages, _2),
+                    &performance_counters::locality_counter_discoverer,
+#endif
+                    ""},
+                {"/parcels/count/compression/skipped",
+                    performance_counters::counter_type::
+                        monotonically_increasing,
+                    "returns the number of messages which were sent "
+                    "uncompressed even though compression was requested, as "
+                    "the data of the action was found to be incompressible",
+                    HPX_PERFORMANCE_COUNTER_V1,
+#if defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
+                    hpx::bind(
+                        &performance_counters::per_action_data_counter_creator,
+                        _1, skipped_messages, _2),
+                    &performance_counters::per_action_data_counter_discoverer,
+#else
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        skipped_messages, _2),
+                    &performance_counters::locality_counter_discoverer,
+#endif
+                    ""},
+                {"/parcels/time/compression",
+                    performance_counters::counter_type::elapsed_time,
+                    "returns the total time spent compressing messages (for "
+                    "the referenced action or for all actions)",
+                    HPX_PERFORMANCE_COUNTER_V1,
+#if defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
+                    hpx::bind(
+                        &performance_counters::per_action_data_counter_creator,
+                        _1, compression_time, _2),
+                    &performance_counters::per_action_data_counter_discoverer,
+#else
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        compression_time, _2),
+                    &performance_counters::locality_counter_discoverer,
+#endif
+                    "ns"},
+                {"/parcels/compression/ratio",
+                    performance_counters::counter_type::raw,
+                    "returns the ratio of the uncompressed and the "
+                    "compressed size of the compressed messages (for the "
+                    "referenced action or for all actions)",
+                    HPX_PERFORMANCE_COUNTER_V1,
+#if defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
+                    hpx::bind(
+                        &performance_counters::per_action_data_counter_creator,
+                        _1, compression_ratio, _2),
+                    &performance_counters::per_action_data_counter_discoverer,
+#else
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        compression_ratio, _2),
+                    &performance_counters::locality_counter_discoverer,
+#endif
+                    "%"}};
 
         performance_counters::install_counter_types(
             counter_types, std::size(counter_types));
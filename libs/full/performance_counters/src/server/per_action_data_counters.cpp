@@ -66,6 +66,8 @@ namespace hpx { namespace performance_counters {
     {
         switch (info.type_)
         {
+        case counter_type::raw:
+            [[fallthrough]];
         case counter_type::elapsed_time:
             [[fallthrough]];
         case counter_type::monotonically_increasing:
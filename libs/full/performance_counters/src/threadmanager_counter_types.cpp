@@ -10,8 +10,10 @@
 
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
+#include <hpx/coroutines/detail/stack_pool.hpp>
 #include <hpx/functional/bind_back.hpp>
 #include <hpx/functional/bind_front.hpp>
+#include <hpx/functional/function.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/threadmanager.hpp>
 #include <hpx/performance_counters/counter_creators.hpp>
@@ -25,6 +27,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <utility>
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -57,10 +60,13 @@ namespace hpx::performance_counters::detail {
     }
 #endif
 
-    naming::gid_type locality_pool_thread_counter_creator(
-        threads::threadmanager* tm, threadmanager_counter_func total_func,
-        threadpool_counter_func pool_func, counter_info const& info,
-        error_code& ec)
+    using thread_counter_func = hpx::function<std::int64_t(
+        threads::thread_pool_base&, std::size_t, bool)>;
+
+    naming::gid_type locality_pool_thread_counter_creator_impl(
+        threads::threadmanager* tm,
+        hpx::function<std::int64_t(bool)> total_func,
+        thread_counter_func pool_func, counter_info const& info, error_code& ec)
     {
         // verify the validity of the counter instance name
         counter_path_elements paths;
@@ -84,9 +90,7 @@ namespace hpx::performance_counters::detail {
         {
             // overall counter
             using detail::create_raw_counter;
-            hpx::function<std::int64_t(bool)> f =
-                hpx::bind_front(total_func, tm);
-            return create_raw_counter(info, HPX_MOVE(f), ec);
+            return create_raw_counter(info, HPX_MOVE(total_func), ec);
         }
         else if (paths.instancename_ == "pool")
         {
@@ -100,7 +104,8 @@ namespace hpx::performance_counters::detail {
 
                 using detail::create_raw_counter;
                 hpx::function<std::int64_t(bool)> f =
-                    hpx::bind_front(pool_func, &pool_instance,
+                    hpx::bind_front(HPX_MOVE(pool_func),
+                        std::ref(pool_instance),
                         static_cast<std::size_t>(paths.subinstanceindex_));
                 return create_raw_counter(info, HPX_MOVE(f), ec);
             }
@@ -112,8 +117,9 @@ namespace hpx::performance_counters::detail {
         {
             // specific counter from default
             using detail::create_raw_counter;
-            hpx::function<std::int64_t(bool)> f = hpx::bind_front(pool_func,
-                &pool, static_cast<std::size_t>(paths.instanceindex_));
+            hpx::function<std::int64_t(bool)> f =
+                hpx::bind_front(HPX_MOVE(pool_func), std::ref(pool),
+                    static_cast<std::size_t>(paths.instanceindex_));
             return create_raw_counter(info, HPX_MOVE(f), ec);
         }
 
@@ -123,6 +129,39 @@ namespace hpx::performance_counters::detail {
         return naming::invalid_gid;
     }
 
+    naming::gid_type locality_pool_thread_counter_creator(
+        threads::threadmanager* tm, threadmanager_counter_func total_func,
+        threadpool_counter_func pool_func, counter_info const& info,
+        error_code& ec)
+    {
+        return locality_pool_thread_counter_creator_impl(
+            tm, hpx::bind_front(total_func, tm),
+            [pool_func](threads::thread_pool_base& pool,
+                std::size_t num_thread,
+                bool reset) { return (pool.*pool_func)(num_thread, reset); },
+            info, ec);
+    }
+
+#ifdef HPX_HAVE_THREAD_STEALING_COUNTS
+    // /threads{locality#%d/total}/count/stolen-from-core etc.
+    naming::gid_type steal_distance_counter_creator(threads::threadmanager* tm,
+        threads::policies::steal_distance distance, counter_info const& info,
+        error_code& ec)
+    {
+        return locality_pool_thread_counter_creator_impl(
+            tm,
+            [tm, distance](bool reset) {
+                return tm->get_num_stolen_by_distance(distance, reset);
+            },
+            [distance](threads::thread_pool_base& pool,
+                std::size_t num_thread, bool reset) {
+                return pool.get_num_stolen_by_distance(
+                    num_thread, distance, reset);
+            },
+            info, ec);
+    }
+#endif
+
     // scheduler utilization counter creation function
     naming::gid_type scheduler_utilization_counter_creator(
         threads::threadmanager const* tm, counter_info const& info,
@@ -327,6 +366,22 @@ namespace hpx::performance_counters::detail {
                 hpx::bind_front(&threads::coroutine_type::impl_type::
                                     get_stack_unbind_count),
                 hpx::function<std::uint64_t(bool)>(), "", 0},
+#endif
+#if defined(__linux) || defined(linux) || defined(__linux__) ||                \
+    defined(__FreeBSD__)
+            // /threads{locality#%d/total}/count/stack-pool-hits
+            {"count/stack-pool-hits",
+                &threads::coroutines::detail::posix::get_stack_pool_hit_count,
+                hpx::function<std::uint64_t(bool)>(), "", 0},
+            // /threads{locality#%d/total}/count/stack-pool-misses
+            {"count/stack-pool-misses",
+                &threads::coroutines::detail::posix::get_stack_pool_miss_count,
+                hpx::function<std::uint64_t(bool)>(), "", 0},
+            // /threads{locality#%d/total}/count/stack-pool-reclaims
+            {"count/stack-pool-reclaims",
+                &threads::coroutines::detail::posix::
+                    get_stack_pool_reclaim_count,
+                hpx::function<std::uint64_t(bool)>(), "", 0},
 #endif
         };
         std::size_t const data_size = sizeof(data) / sizeof(data[0]);
@@ -615,6 +670,30 @@ namespace hpx::performance_counters {
                 HPX_PERFORMANCE_COUNTER_V1, counts_creator,
                 &locality_counter_discoverer, ""},
 #endif
+#if defined(__linux) || defined(linux) || defined(__linux__) ||                \
+    defined(__FreeBSD__)
+            {"/threads/count/stack-pool-hits",
+                counter_type::monotonically_increasing,
+                "returns the total number of HPX-thread stack allocations "
+                "served from the stack pool of the allocating worker for the "
+                "referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1, counts_creator,
+                &locality_counter_discoverer, ""},
+            {"/threads/count/stack-pool-misses",
+                counter_type::monotonically_increasing,
+                "returns the total number of HPX-thread stack allocations "
+                "that had to refill the stack pool of the allocating worker "
+                "for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1, counts_creator,
+                &locality_counter_discoverer, ""},
+            {"/threads/count/stack-pool-reclaims",
+                counter_type::monotonically_increasing,
+                "returns the total number of HPX-thread stacks released back "
+                "to the operating system by the stack pool for the referenced "
+                "locality",
+                HPX_PERFORMANCE_COUNTER_V1, counts_creator,
+                &locality_counter_discoverer, ""},
+#endif
 #endif
 #ifdef HPX_HAVE_THREAD_STEALING_COUNTS
             {"/threads/count/pending-misses",
@@ -677,6 +756,42 @@ namespace hpx::performance_counters {
                     &tm, &threads::threadmanager::get_num_stolen_to_staged,
                     &threads::thread_pool_base::get_num_stolen_to_staged),
                 &locality_pool_thread_counter_discoverer, ""},
+            {"/threads/count/stolen-from-core",
+                counter_type::monotonically_increasing,
+                "returns the overall number of HPX-threads and task "
+                "descriptions stolen from worker threads running on the same "
+                "core for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::steal_distance_counter_creator, &tm,
+                    threads::policies::steal_distance::core),
+                &locality_pool_thread_counter_discoverer, ""},
+            {"/threads/count/stolen-from-cache",
+                counter_type::monotonically_increasing,
+                "returns the overall number of HPX-threads and task "
+                "descriptions stolen from worker threads sharing the last "
+                "level cache for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::steal_distance_counter_creator, &tm,
+                    threads::policies::steal_distance::cache),
+                &locality_pool_thread_counter_discoverer, ""},
+            {"/threads/count/stolen-from-numa",
+                counter_type::monotonically_increasing,
+                "returns the overall number of HPX-threads and task "
+                "descriptions stolen from worker threads running in the same "
+                "NUMA domain for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::steal_distance_counter_creator, &tm,
+                    threads::policies::steal_distance::numa),
+                &locality_pool_thread_counter_discoverer, ""},
+            {"/threads/count/stolen-from-remote-numa",
+                counter_type::monotonically_increasing,
+                "returns the overall number of HPX-threads and task "
+                "descriptions stolen from worker threads running in other "
+                "NUMA domains for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::steal_distance_counter_creator, &tm,
+                    threads::policies::steal_distance::remote_numa),
+                &locality_pool_thread_counter_discoverer, ""},
 #endif
             // scheduler utilization
             {"/scheduler/utilization/instantaneous", counter_type::raw,
@@ -58,6 +58,10 @@ char const* const locality_pool_thread_counter_names[] =
     "/threads/count/stolen-from-staged",
     "/threads/count/stolen-to-pending",
     "/threads/count/stolen-to-staged",
+    "/threads/count/stolen-from-core",
+    "/threads/count/stolen-from-cache",
+    "/threads/count/stolen-from-numa",
+    "/threads/count/stolen-from-remote-numa",
 #endif
     nullptr
 };
@@ -82,8 +86,17 @@ char const* const locality_counter_names[] = {
 #if !defined(HPX_WINDOWS) && !defined(HPX_HAVE_GENERIC_CONTEXT_COROUTINES)
     "/threads/count/stack-unbinds",
 #endif
+#if defined(__linux) || defined(linux) || defined(__linux__) ||                \
+    defined(__FreeBSD__)
+    "/threads/count/stack-pool-hits",
+    "/threads/count/stack-pool-misses",
+    "/threads/count/stack-pool-reclaims",
 #endif
-    "/scheduler/utilization/instantaneous", nullptr};
+#endif
+    "/scheduler/utilization/instantaneous", "/agas/count/batch/resolve",
+    "/agas/count/batch/resolve_requests", "/agas/time/batch/resolve",
+    "/agas/count/batch/decrement_credit",
+    "/agas/count/batch/decrement_credit_requests", nullptr};
 
 ///////////////////////////////////////////////////////////////////////////////
 void test_all_locality_thread_counters(char const* const* counter_names,
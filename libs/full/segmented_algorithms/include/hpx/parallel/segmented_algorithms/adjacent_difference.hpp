@@ -165,11 +165,23 @@ namespace hpx::parallel {
             using segment_type = std::vector<future<local_iterator_type2>>;
             segment_type segments;
 
-            auto size = std::distance(sit, send);
-            segments.reserve(size);
-
-            std::vector<FwdIter1> between_segments;
-            between_segments.reserve(size);
+            segments.reserve(std::distance(sit, send));
+
+            // The first element of each but the first segment depends on the
+            // last element of the previous segment. It is fixed up as soon
+            // as the segment has been processed, which overlaps this step
+            // with the work on the remaining segments.
+            auto fix_boundary = [=](future<local_iterator_type2>&& f,
+                                    FwdIter1 beginning) {
+                return f.then([=](future<local_iterator_type2>&& f) {
+                    local_iterator_type2 out = f.get();
+
+                    FwdIter2 curr = dest;
+                    std::advance(curr, std::distance(first, beginning));
+                    *curr = HPX_INVOKE(op, *beginning, *std::prev(beginning));
+                    return out;
+                });
+            };
 
             if (sit == send)
             {
@@ -203,10 +215,10 @@ namespace hpx::parallel {
                     ldest = traits2::begin(sdest);
                     if (beg != end)
                     {
-                        between_segments.push_back(traits1::compose(sit, beg));
-                        segments.push_back(
+                        segments.push_back(fix_boundary(
                             dispatch_async(traits2::get_id(sdest), algo, policy,
-                                forced_seq(), beg, end, ldest, op));
+                                forced_seq(), beg, end, ldest, op),
+                            traits1::compose(sit, beg)));
                     }
                 }
 
@@ -216,9 +228,10 @@ namespace hpx::parallel {
                 ldest = traits2::begin(sdest);
                 if (beg != end)
                 {
-                    between_segments.push_back(traits1::compose(sit, beg));
-                    segments.push_back(dispatch_async(traits2::get_id(sdest),
-                        algo, policy, forced_seq(), beg, end, ldest, op));
+                    segments.push_back(fix_boundary(
+                        dispatch_async(traits2::get_id(sdest), algo, policy,
+                            forced_seq(), beg, end, ldest, op),
+                        traits1::compose(sit, beg)));
                 }
             }
 
@@ -229,17 +242,7 @@ namespace hpx::parallel {
                     parallel::util::detail::handle_remote_exceptions<
                         ExPolicy>::call(r, errors);
 
-                    auto ft = r.back().get();
-                    auto odest = traits2::compose(sdest, ft);
-                    auto start = between_segments.begin();
-                    while (start != between_segments.end())
-                    {
-                        FwdIter2 curr = dest;
-                        std::advance(curr, std::distance(first, *start));
-                        *curr = HPX_INVOKE(op, *(*start), *std::prev(*start));
-                        start = std::next(start);
-                    }
-                    return odest;
+                    return traits2::compose(sdest, r.back().get());
                 },
                 HPX_MOVE(segments)));
         }
@@ -0,0 +1,302 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/actions_base/plain_action.hpp>
+#include <hpx/algorithms/traits/segmented_iterator_traits.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/async_distributed/async.hpp>
+#include <hpx/async_distributed/dataflow.hpp>
+#include <hpx/distribution_policies/colocating_distribution_policy.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/functional/invoke_result.hpp>
+#include <hpx/iterator_support/traits/is_iterator.hpp>
+#include <hpx/naming_base/id_type.hpp>
+#include <hpx/serialization/vector.hpp>
+
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/handle_remote_exceptions.hpp>
+#include <hpx/parallel/util/result_types.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <list>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx::parallel::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \cond NOINTERNAL
+
+    // Return whether the data referenced by the given segments lives on the
+    // same locality.
+    template <typename Traits1, typename Traits2>
+    bool segments_are_colocated(typename Traits1::segment_iterator const& sit1,
+        typename Traits2::segment_iterator const& sit2)
+    {
+        return naming::get_locality_id_from_id(Traits1::get_id(sit1)) ==
+            naming::get_locality_id_from_id(Traits2::get_id(sit2));
+    }
+
+    // Return whether all elements of each input segment in [first, last) are
+    // mapped onto a single output segment starting at dest, which in
+    // addition is located on the same locality. In this case each segment can
+    // be processed locally without moving any data between localities.
+    template <typename SegIter, typename SegOutIter>
+    bool segments_are_aligned(SegIter first, SegIter last, SegOutIter dest)
+    {
+        using traits1 = hpx::traits::segmented_iterator_traits<SegIter>;
+        using traits2 = hpx::traits::segmented_iterator_traits<SegOutIter>;
+
+        auto sit = traits1::segment(first);
+        auto send = traits1::segment(last);
+        auto sdest = traits2::segment(dest);
+
+        auto beg = traits1::local(first);
+        auto out = traits2::local(dest);
+
+        while (true)
+        {
+            auto end = sit == send ? traits1::local(last) : traits1::end(sit);
+            auto const count = std::distance(beg, end);
+            if (sit == send && count == 0)
+                return true;
+
+            if (!segments_are_colocated<traits1, traits2>(sit, sdest))
+                return false;
+
+            auto const space = std::distance(out, traits2::end(sdest));
+            if (sit == send)
+                return count <= space;
+
+            if (count != space)
+                return false;
+
+            ++sit;
+            ++sdest;
+
+            beg = traits1::begin(sit);
+            out = traits2::begin(sdest);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Extract the (transformed) values referenced by a range of local
+    // iterators on the locality where the data lives.
+    template <typename LocalIter, typename F, typename Proj>
+    struct segmented_gather
+    {
+        using local_traits =
+            hpx::traits::segmented_local_iterator_traits<LocalIter>;
+        using local_raw_iterator = typename local_traits::local_raw_iterator;
+        using reference = hpx::traits::iter_reference_t<local_raw_iterator>;
+        using value_type = std::decay_t<hpx::util::invoke_result_t<F,
+            hpx::util::invoke_result_t<Proj, reference>>>;
+        using result_type = std::vector<value_type>;
+
+        static result_type call(LocalIter first, LocalIter last, F f, Proj proj)
+        {
+            auto beg = local_traits::local(first);
+            auto end = local_traits::local(last);
+
+            result_type result;
+            result.reserve(std::distance(beg, end));
+            for (/**/; beg != end; ++beg)
+            {
+                result.push_back(HPX_INVOKE(f, HPX_INVOKE(proj, *beg)));
+            }
+            return result;
+        }
+    };
+
+    template <typename LocalIter, typename F, typename Proj>
+    struct segmented_gather_action
+      : hpx::actions::make_action<
+            typename segmented_gather<LocalIter, F, Proj>::result_type (*)(
+                LocalIter, LocalIter, F, Proj),
+            &segmented_gather<LocalIter, F, Proj>::call,
+            segmented_gather_action<LocalIter, F, Proj>>::type
+    {
+    };
+
+    // Store the given values starting at the given local iterator on the
+    // locality where the data lives.
+    template <typename LocalIter, typename T>
+    struct segmented_scatter
+    {
+        using local_traits =
+            hpx::traits::segmented_local_iterator_traits<LocalIter>;
+
+        static void call(LocalIter dest, std::vector<T> values)
+        {
+            std::move(values.begin(), values.end(), local_traits::local(dest));
+        }
+    };
+
+    template <typename LocalIter, typename T>
+    struct segmented_scatter_action
+      : hpx::actions::make_action<void (*)(LocalIter, std::vector<T>),
+            &segmented_scatter<LocalIter, T>::call,
+            segmented_scatter_action<LocalIter, T>>::type
+    {
+    };
+
+    // Asynchronously retrieve the (transformed) values referenced by the
+    // given local iterators.
+    template <typename LocalIter, typename F, typename Proj>
+    future<typename segmented_gather<LocalIter, std::decay_t<F>,
+        std::decay_t<Proj>>::result_type>
+    gather_async(
+        id_type const& id, LocalIter first, LocalIter last, F&& f, Proj&& proj)
+    {
+        segmented_gather_action<LocalIter, std::decay_t<F>, std::decay_t<Proj>>
+            act;
+
+        return hpx::async(act, hpx::colocated(id), HPX_MOVE(first),
+            HPX_MOVE(last), HPX_FORWARD(F, f), HPX_FORWARD(Proj, proj));
+    }
+
+    // Asynchronously move the (transformed) values referenced by the local
+    // iterators [first, last) to the segment referenced by dest. The values
+    // are sent to the destination as soon as they have been extracted, which
+    // allows for overlapping the transfer of several segments with each
+    // other and with local work.
+    template <typename LocalIter, typename LocalOutIter, typename F,
+        typename Proj>
+    future<void> transfer_values_async(id_type const& id, LocalIter first,
+        LocalIter last, id_type const& dest_id, LocalOutIter dest, F&& f,
+        Proj&& proj)
+    {
+        using gather_type =
+            segmented_gather<LocalIter, std::decay_t<F>, std::decay_t<Proj>>;
+        using value_type = typename gather_type::value_type;
+
+        return gather_async(id, HPX_MOVE(first), HPX_MOVE(last),
+            HPX_FORWARD(F, f), HPX_FORWARD(Proj, proj))
+            .then(hpx::launch::sync,
+                [dest_id, dest = HPX_MOVE(dest)](
+                    future<std::vector<value_type>>&& values) -> future<void> {
+                    segmented_scatter_action<LocalOutIter, value_type> act;
+                    return hpx::async(
+                        act, hpx::colocated(dest_id), dest, values.get());
+                });
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Apply a transferring algorithm (copy, move, transform) to segmented
+    // ranges which are not aligned with each other. The input range is split
+    // at all input and output segment boundaries. Pieces for which input and
+    // output live on the same locality are handled by dispatching the given
+    // algorithm to that locality. For all other pieces the values are
+    // extracted (applying f and proj) where the input lives and stored into
+    // the output segment afterwards.
+    template <typename Algo, typename ExPolicy, typename IsSeq,
+        typename SegIter, typename SegOutIter, typename F, typename Proj,
+        typename... Args>
+    typename util::detail::algorithm_result<ExPolicy,
+        util::in_out_result<SegIter, SegOutIter>>::type
+    segmented_transfer_unaligned(Algo&& algo, ExPolicy const& policy, IsSeq,
+        SegIter first, SegIter last, SegOutIter dest, F&& f, Proj&& proj,
+        Args&&... args)
+    {
+        using traits1 = hpx::traits::segmented_iterator_traits<SegIter>;
+        using traits2 = hpx::traits::segmented_iterator_traits<SegOutIter>;
+
+        using result_type = util::in_out_result<SegIter, SegOutIter>;
+        using result = util::detail::algorithm_result<ExPolicy, result_type>;
+
+        using forced_seq = std::integral_constant<bool,
+            IsSeq::value || !hpx::traits::is_forward_iterator_v<SegIter>>;
+
+        auto count = std::distance(first, last);
+        SegOutIter const dest_last = std::next(dest, count);
+
+        std::vector<future<void>> pieces;
+        while (count != 0)
+        {
+            auto sit = traits1::segment(first);
+            auto sdest = traits2::segment(dest);
+
+            auto beg = traits1::local(first);
+            auto out = traits2::local(dest);
+
+            auto const available = std::distance(beg, traits1::end(sit));
+            auto const space = std::distance(out, traits2::end(sdest));
+            if (available == 0 || space == 0)
+            {
+                // skip over the end of the current segment
+                if (available == 0)
+                {
+                    ++sit;
+                    first = traits1::compose(sit, traits1::begin(sit));
+                }
+                if (space == 0)
+                {
+                    ++sdest;
+                    dest = traits2::compose(sdest, traits2::begin(sdest));
+                }
+                continue;
+            }
+
+            auto const n = (std::min)({count,
+                static_cast<decltype(count)>(available),
+                static_cast<decltype(count)>(space)});
+
+            auto end = std::next(beg, n);
+            if (segments_are_colocated<traits1, traits2>(sit, sdest))
+            {
+                pieces.emplace_back(dispatch_async(traits2::get_id(sdest),
+                    algo, policy, forced_seq(), beg, end, out, args...));
+            }
+            else
+            {
+                pieces.push_back(transfer_values_async(traits1::get_id(sit),
+                    beg, end, traits2::get_id(sdest), out, f, proj));
+            }
+
+            if constexpr (IsSeq::value)
+            {
+                // sequenced execution: finish each piece before starting
+                // the next one
+                pieces.back().wait();
+            }
+
+            first = traits1::compose(sit, end);
+            dest = traits2::compose(sdest, std::next(out, n));
+            count -= n;
+        }
+
+        if constexpr (IsSeq::value)
+        {
+            std::list<std::exception_ptr> errors;
+            parallel::util::detail::handle_remote_exceptions<ExPolicy>::call(
+                pieces, errors);
+            return result::get(result_type{last, dest_last});
+        }
+        else
+        {
+            return result::get(hpx::dataflow(
+                [last, dest_last](
+                    std::vector<future<void>>&& r) -> result_type {
+                    // handle any remote exceptions, will throw on error
+                    std::list<std::exception_ptr> errors;
+                    parallel::util::detail::handle_remote_exceptions<
+                        ExPolicy>::call(r, errors);
+                    return result_type{last, dest_last};
+                },
+                HPX_MOVE(pieces)));
+        }
+    }
+    /// \endcond
+}    // namespace hpx::parallel::detail
@@ -10,10 +10,12 @@
 #include <hpx/algorithms/traits/segmented_iterator_traits.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/async_distributed/dataflow.hpp>
+#include <hpx/type_support/identity.hpp>
 
 #include <hpx/executors/execution_policy.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/segmented_algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/redistribute.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/detail/handle_remote_exceptions.hpp>
 #include <hpx/parallel/util/result_types.hpp>
@@ -250,6 +252,15 @@ namespace hpx::parallel {
             }
 
             using is_seq = hpx::is_sequenced_execution_policy<ExPolicy>;
+            if (!segments_are_aligned(first, last, dest))
+            {
+                // the segments of source and destination are distributed
+                // differently, move the data between the localities
+                return segmented_transfer_unaligned(Algo(),
+                    HPX_FORWARD(ExPolicy, policy), is_seq(), first, last, dest,
+                    hpx::identity_v, hpx::identity_v);
+            }
+
             return segmented_transfer(Algo(), HPX_FORWARD(ExPolicy, policy),
                 is_seq(), first, last, dest);
         }
@@ -0,0 +1,157 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file halo_exchange.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/algorithms/traits/segmented_iterator_traits.hpp>
+#include <hpx/async_distributed/dataflow.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/iterator_support/traits/is_iterator.hpp>
+#include <hpx/naming_base/id_type.hpp>
+#include <hpx/type_support/identity.hpp>
+
+#include <hpx/parallel/segmented_algorithms/detail/redistribute.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace hpx::segmented {
+
+    /// The halo of a segment holds copies of the elements of its neighboring
+    /// segments which are adjacent to the segment.
+    ///
+    /// \tparam T       The value type of the segmented range.
+    ///
+    template <typename T>
+    struct halo
+    {
+        /// The last elements of the segment to the left (empty for the first
+        /// segment).
+        std::vector<T> left;
+
+        /// The first elements of the segment to the right (empty for the last
+        /// segment).
+        std::vector<T> right;
+    };
+
+    /// Asynchronously retrieve the halos of all segments of the segmented
+    /// range [first, last).
+    ///
+    /// \tparam SegIter     The type of the segmented iterator.
+    ///
+    /// \param first        Refers to the beginning of the sequence of
+    ///                     elements the halos should be retrieved for.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     halos should be retrieved for.
+    /// \param width        The (maximal) number of elements to retrieve from
+    ///                     each of the neighboring segments.
+    ///
+    /// \returns  One future for each non-empty segment overlapping with
+    ///           [first, last), in the order of the segments. Each future
+    ///           becomes ready as soon as the halo of the corresponding
+    ///           segment has been received. This allows to start working on
+    ///           the interior of the segments (or on segments whose halo has
+    ///           already arrived) while the remaining data is still in flight.
+    ///
+    template <typename SegIter>
+    std::vector<hpx::future<halo<hpx::traits::iter_value_t<SegIter>>>>
+    get_halos(SegIter first, SegIter last, std::size_t width)
+    {
+        static_assert(hpx::traits::is_segmented_iterator_v<SegIter>,
+            "Requires a segmented iterator.");
+
+        using traits = hpx::traits::segmented_iterator_traits<SegIter>;
+        using local_iterator_type = typename traits::local_iterator;
+        using value_type = hpx::traits::iter_value_t<SegIter>;
+        using halo_type = halo<value_type>;
+
+        struct piece
+        {
+            hpx::id_type id;
+            local_iterator_type first;
+            local_iterator_type last;
+        };
+
+        std::vector<piece> pieces;
+        if (first != last)
+        {
+            auto sit = traits::segment(first);
+            auto send = traits::segment(last);
+
+            auto add_piece = [&](local_iterator_type beg,
+                                 local_iterator_type end) {
+                if (beg != end)
+                    pieces.push_back(piece{traits::get_id(sit), beg, end});
+            };
+
+            if (sit == send)
+            {
+                add_piece(traits::local(first), traits::local(last));
+            }
+            else
+            {
+                add_piece(traits::local(first), traits::end(sit));
+                for (++sit; sit != send; ++sit)
+                {
+                    add_piece(traits::begin(sit), traits::end(sit));
+                }
+                add_piece(traits::begin(sit), traits::local(last));
+            }
+        }
+
+        using values_type = std::vector<value_type>;
+        auto retrieve = [](piece const& p, bool front, std::size_t width) {
+            auto const size = static_cast<std::size_t>(
+                std::distance(p.first, p.last));
+            auto const count = static_cast<std::ptrdiff_t>((std::min)(
+                size, width));
+
+            if (count == 0)
+                return hpx::make_ready_future(values_type());
+
+            if (front)
+            {
+                return hpx::parallel::detail::gather_async(p.id, p.first,
+                    std::next(p.first, count), hpx::identity_v,
+                    hpx::identity_v);
+            }
+            return hpx::parallel::detail::gather_async(p.id,
+                std::prev(p.last, count), p.last, hpx::identity_v,
+                hpx::identity_v);
+        };
+
+        // request all halo data up front, the corresponding futures become
+        // ready independently of each other
+        std::size_t const num_pieces = pieces.size();
+
+        std::vector<hpx::future<halo_type>> halos;
+        halos.reserve(num_pieces);
+        for (std::size_t i = 0; i != num_pieces; ++i)
+        {
+            hpx::future<values_type> left = i != 0 ?
+                retrieve(pieces[i - 1], false, width) :
+                hpx::make_ready_future(values_type());
+            hpx::future<values_type> right = i + 1 != num_pieces ?
+                retrieve(pieces[i + 1], true, width) :
+                hpx::make_ready_future(values_type());
+
+            halos.push_back(hpx::dataflow(
+                hpx::launch::sync,
+                [](hpx::future<values_type>&& l,
+                    hpx::future<values_type>&& r) -> halo_type {
+                    return halo_type{l.get(), r.get()};
+                },
+                HPX_MOVE(left), HPX_MOVE(right)));
+        }
+        return halos;
+    }
+}    // namespace hpx::segmented
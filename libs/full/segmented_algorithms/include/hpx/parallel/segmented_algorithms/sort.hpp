@@ -0,0 +1,355 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/actions_base/plain_action.hpp>
+#include <hpx/algorithms/traits/segmented_iterator_traits.hpp>
+#include <hpx/async_combinators/wait_all.hpp>
+#include <hpx/async_distributed/async.hpp>
+#include <hpx/async_distributed/dataflow.hpp>
+#include <hpx/distribution_policies/colocating_distribution_policy.hpp>
+#include <hpx/execution/algorithms/detail/predicates.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/naming_base/id_type.hpp>
+#include <hpx/serialization/vector.hpp>
+#include <hpx/type_support/identity.hpp>
+
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/parallel/algorithms/sort.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/redistribute.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx::parallel::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \cond NOINTERNAL
+
+    // Sort the elements of one segment on the locality where it lives.
+    template <typename LocalIter, typename Comp>
+    struct segmented_sort_local
+    {
+        using local_traits =
+            hpx::traits::segmented_local_iterator_traits<LocalIter>;
+
+        static void call(LocalIter first, LocalIter last, Comp comp, bool par)
+        {
+            auto beg = local_traits::local(first);
+            auto end = local_traits::local(last);
+
+            if (par)
+            {
+                hpx::sort(hpx::execution::par, beg, end, HPX_MOVE(comp));
+            }
+            else
+            {
+                std::sort(beg, end, HPX_MOVE(comp));
+            }
+        }
+    };
+
+    template <typename LocalIter, typename Comp>
+    struct segmented_sort_local_action
+      : hpx::actions::make_action<void (*)(LocalIter, LocalIter, Comp, bool),
+            &segmented_sort_local<LocalIter, Comp>::call,
+            segmented_sort_local_action<LocalIter, Comp>>::type
+    {
+    };
+
+    // Merge the (sorted) elements of a segment with the (sorted) elements of
+    // its right neighbor. The segment keeps the smallest elements, the
+    // remaining elements are returned to be stored in the right neighbor. An
+    // empty result signals that both segments were already ordered with
+    // respect to each other.
+    template <typename LocalIter, typename T, typename Comp>
+    struct segmented_merge_split
+    {
+        using local_traits =
+            hpx::traits::segmented_local_iterator_traits<LocalIter>;
+
+        static std::vector<T> call(
+            LocalIter first, LocalIter last, std::vector<T> right, Comp comp)
+        {
+            auto beg = local_traits::local(first);
+            auto end = local_traits::local(last);
+
+            if (beg == end || right.empty() ||
+                !HPX_INVOKE(comp, right.front(), *std::prev(end)))
+            {
+                return std::vector<T>();
+            }
+
+            std::vector<T> merged;
+            merged.reserve(std::distance(beg, end) + right.size());
+            std::merge(std::make_move_iterator(beg),
+                std::make_move_iterator(end),
+                std::make_move_iterator(right.begin()),
+                std::make_move_iterator(right.end()),
+                std::back_inserter(merged), comp);
+
+            auto mid = std::next(merged.begin(), std::distance(beg, end));
+            std::move(merged.begin(), mid, beg);
+
+            return std::vector<T>(std::make_move_iterator(mid),
+                std::make_move_iterator(merged.end()));
+        }
+    };
+
+    template <typename LocalIter, typename T, typename Comp>
+    struct segmented_merge_split_action
+      : hpx::actions::make_action<std::vector<T> (*)(LocalIter, LocalIter,
+                                      std::vector<T>, Comp),
+            &segmented_merge_split<LocalIter, T, Comp>::call,
+            segmented_merge_split_action<LocalIter, T, Comp>>::type
+    {
+    };
+
+    template <typename LocalIter>
+    struct segmented_sort_piece
+    {
+        id_type id;
+        LocalIter first;
+        LocalIter last;
+    };
+
+    // Exchange elements between two neighboring (sorted) segments such that
+    // all elements of the left segment are not greater than the elements of
+    // the right segment. Returns whether any elements were moved.
+    template <typename LocalIter, typename Comp>
+    future<bool> segmented_merge_split_async(
+        segmented_sort_piece<LocalIter> const& left,
+        segmented_sort_piece<LocalIter> const& right, Comp const& comp)
+    {
+        using gather_type =
+            segmented_gather<LocalIter, hpx::identity, hpx::identity>;
+        using value_type = typename gather_type::value_type;
+
+        return gather_async(right.id, right.first, right.last, hpx::identity_v,
+            hpx::identity_v)
+            .then(hpx::launch::sync,
+                [left, right, comp](future<std::vector<value_type>>&& values) {
+                    segmented_merge_split_action<LocalIter, value_type, Comp>
+                        act;
+                    return hpx::async(act, hpx::colocated(left.id), left.first,
+                        left.last, values.get(), comp);
+                })
+            .then(hpx::launch::sync,
+                [right](future<std::vector<value_type>>&& f) -> future<bool> {
+                    std::vector<value_type> upper = f.get();
+                    if (upper.empty())
+                        return hpx::make_ready_future(false);
+
+                    segmented_scatter_action<LocalIter, value_type> act;
+                    return hpx::async(act, hpx::colocated(right.id),
+                        right.first, HPX_MOVE(upper))
+                        .then(hpx::launch::sync, [](future<void>&& done) {
+                            done.get();    // rethrow any exceptions
+                            return true;
+                        });
+                });
+    }
+
+    // Return whether the last element of each segment is not greater than
+    // the first element of its right neighbor.
+    template <typename LocalIter, typename Comp>
+    bool segmented_boundaries_are_sorted(
+        std::vector<segmented_sort_piece<LocalIter>> const& pieces,
+        Comp const& comp)
+    {
+        using gather_type =
+            segmented_gather<LocalIter, hpx::identity, hpx::identity>;
+        using result_type = typename gather_type::result_type;
+
+        // retrieve the last element of each segment and the first element of
+        // its right neighbor
+        std::vector<future<result_type>> backs, fronts;
+        backs.reserve(pieces.size() - 1);
+        fronts.reserve(pieces.size() - 1);
+        for (std::size_t i = 1; i < pieces.size(); ++i)
+        {
+            auto const& left = pieces[i - 1];
+            backs.push_back(gather_async(left.id, std::prev(left.last),
+                left.last, hpx::identity_v, hpx::identity_v));
+
+            auto const& right = pieces[i];
+            fronts.push_back(gather_async(right.id, right.first,
+                std::next(right.first), hpx::identity_v, hpx::identity_v));
+        }
+
+        bool sorted = true;
+        for (std::size_t i = 0; i != backs.size(); ++i)
+        {
+            result_type back = backs[i].get();
+            result_type front = fronts[i].get();
+            if (HPX_INVOKE(comp, front.front(), back.front()))
+                sorted = false;
+        }
+        return sorted;
+    }
+
+    // Sort the elements referenced by the segmented range [first, last). All
+    // segments are sorted locally first. Afterwards, neighboring segments
+    // exchange elements using an odd-even merge-split scheme. Each step
+    // depends on the previous steps of the two involved segments only, which
+    // allows for the exchanges of one round to overlap with the exchanges of
+    // the next round instead of waiting for all segments at the end of every
+    // round.
+    template <typename SegIter, typename Comp>
+    void segmented_sort(SegIter first, SegIter last, Comp comp, bool par)
+    {
+        using traits = hpx::traits::segmented_iterator_traits<SegIter>;
+        using local_iterator_type = typename traits::local_iterator;
+        using piece_type = segmented_sort_piece<local_iterator_type>;
+
+        auto sit = traits::segment(first);
+        auto send = traits::segment(last);
+
+        std::vector<piece_type> pieces;
+        auto add_piece = [&](local_iterator_type beg, local_iterator_type end) {
+            if (beg != end)
+                pieces.push_back(piece_type{traits::get_id(sit), beg, end});
+        };
+
+        if (sit == send)
+        {
+            add_piece(traits::local(first), traits::local(last));
+        }
+        else
+        {
+            add_piece(traits::local(first), traits::end(sit));
+            for (++sit; sit != send; ++sit)
+            {
+                add_piece(traits::begin(sit), traits::end(sit));
+            }
+            add_piece(traits::begin(sit), traits::local(last));
+        }
+
+        std::size_t const num_pieces = pieces.size();
+
+        std::vector<shared_future<bool>> state;
+        state.reserve(num_pieces);
+        for (auto const& p : pieces)
+        {
+            segmented_sort_local_action<local_iterator_type, Comp> act;
+            future<void> f = hpx::async(
+                act, hpx::colocated(p.id), p.first, p.last, comp, par);
+            state.push_back(f.then(hpx::launch::sync, [](future<void>&& done) {
+                done.get();    // rethrow any exceptions
+                return false;
+            }));
+        }
+
+        // num_pieces rounds are sufficient if all segments have the same
+        // size, otherwise additional rounds may be necessary
+        do
+        {
+            for (std::size_t round = 0; round != num_pieces; ++round)
+            {
+                for (std::size_t i = round % 2; i + 1 < num_pieces; i += 2)
+                {
+                    // the step becomes ready once the exchange has
+                    // finished (dataflow returns a future<future<bool>>
+                    // which is unwrapped here)
+                    future<bool> step = hpx::dataflow(
+                        hpx::launch::sync,
+                        [&pieces, i, comp](shared_future<bool> const& l,
+                            shared_future<bool> const& r) {
+                            l.get();    // rethrow any exceptions
+                            r.get();
+                            return segmented_merge_split_async(
+                                pieces[i], pieces[i + 1], comp);
+                        },
+                        state[i], state[i + 1]);
+
+                    state[i] = step.share();
+                    state[i + 1] = state[i];
+                }
+            }
+
+            hpx::wait_all(state);
+            for (auto const& s : state)
+            {
+                s.get();    // rethrow any exceptions
+            }
+        } while (num_pieces > 1 &&
+            !segmented_boundaries_are_sorted(pieces, comp));
+    }
+    /// \endcond
+}    // namespace hpx::parallel::detail
+
+// The segmented iterators we support all live in namespace hpx::segmented
+namespace hpx::segmented {
+
+    // clang-format off
+    template <typename SegIter,
+        typename Comp = hpx::parallel::detail::less,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::traits::is_iterator_v<SegIter> &&
+            hpx::traits::is_segmented_iterator_v<SegIter>
+        )>
+    // clang-format on
+    void tag_invoke(
+        hpx::sort_t, SegIter first, SegIter last, Comp comp = Comp())
+    {
+        static_assert(hpx::traits::is_random_access_iterator_v<SegIter>,
+            "Requires a random access iterator.");
+
+        if (first == last)
+        {
+            return;
+        }
+
+        hpx::parallel::detail::segmented_sort(
+            first, last, HPX_MOVE(comp), false);
+    }
+
+    // clang-format off
+    template <typename ExPolicy, typename SegIter,
+        typename Comp = hpx::parallel::detail::less,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_execution_policy_v<ExPolicy> &&
+            hpx::traits::is_iterator_v<SegIter> &&
+            hpx::traits::is_segmented_iterator_v<SegIter>
+        )>
+    // clang-format on
+    hpx::parallel::util::detail::algorithm_result_t<ExPolicy> tag_invoke(
+        hpx::sort_t, ExPolicy&&, SegIter first, SegIter last,
+        Comp comp = Comp())
+    {
+        static_assert(hpx::traits::is_random_access_iterator_v<SegIter>,
+            "Requires a random access iterator.");
+
+        using result = hpx::parallel::util::detail::algorithm_result<ExPolicy>;
+
+        constexpr bool par = !hpx::is_sequenced_execution_policy_v<ExPolicy>;
+        if (first == last)
+        {
+            return result::get();
+        }
+
+        if constexpr (hpx::is_async_execution_policy_v<ExPolicy>)
+        {
+            return result::get(hpx::async([=]() mutable {
+                hpx::parallel::detail::segmented_sort(
+                    first, last, HPX_MOVE(comp), par);
+            }));
+        }
+        else
+        {
+            hpx::parallel::detail::segmented_sort(
+                first, last, HPX_MOVE(comp), par);
+            return result::get();
+        }
+    }
+}    // namespace hpx::segmented
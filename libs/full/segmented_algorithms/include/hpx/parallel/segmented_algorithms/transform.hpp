@@ -16,6 +16,7 @@
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/transform.hpp>
 #include <hpx/parallel/segmented_algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/redistribute.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/detail/handle_remote_exceptions.hpp>
 
@@ -699,10 +700,19 @@ namespace hpx { namespace segmented {
         using iterator_traits2 =
             hpx::traits::segmented_iterator_traits<OutIter>;
 
-        return hpx::parallel::detail::segmented_transform(
+        using algo_type =
             hpx::parallel::detail::transform<hpx::parallel::util::in_out_result<
                 typename iterator_traits1::local_iterator,
-                typename iterator_traits2::local_iterator>>(),
+                typename iterator_traits2::local_iterator>>;
+
+        if (!hpx::parallel::detail::segments_are_aligned(first, last, dest))
+        {
+            return hpx::parallel::detail::segmented_transfer_unaligned(
+                algo_type(), hpx::execution::seq, std::true_type{}, first,
+                last, dest, f, hpx::identity_v, f, hpx::identity_v);
+        }
+
+        return hpx::parallel::detail::segmented_transform(algo_type(),
             hpx::execution::seq, first, last, dest, HPX_FORWARD(F, f),
             hpx::identity_v, std::true_type{});
     }
@@ -742,10 +752,22 @@ namespace hpx { namespace segmented {
         using iterator_traits2 =
             hpx::traits::segmented_iterator_traits<OutIter>;
 
-        return hpx::parallel::detail::segmented_transform(
+        using algo_type =
             hpx::parallel::detail::transform<hpx::parallel::util::in_out_result<
                 typename iterator_traits1::local_iterator,
-                typename iterator_traits2::local_iterator>>(),
+                typename iterator_traits2::local_iterator>>;
+
+        if (!hpx::parallel::detail::segments_are_aligned(first, last, dest))
+        {
+            // the segments of source and destination are distributed
+            // differently, the transformed values are computed where the
+            // source lives and sent to the destination
+            return hpx::parallel::detail::segmented_transfer_unaligned(
+                algo_type(), HPX_FORWARD(ExPolicy, policy), is_seq(), first,
+                last, dest, f, hpx::identity_v, f, hpx::identity_v);
+        }
+
+        return hpx::parallel::detail::segmented_transform(algo_type(),
             HPX_FORWARD(ExPolicy, policy), first, last, dest, HPX_FORWARD(F, f),
             hpx::identity_v, is_seq());
     }
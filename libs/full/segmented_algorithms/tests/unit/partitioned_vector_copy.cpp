@@ -132,6 +132,58 @@ void copy_tests_with_policy(
     copy_algo_tests_with_policy_async<T>(size, localities, policy, par);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename ExPolicy>
+void copy_unaligned_tests(std::size_t size,
+    hpx::container_distribution_policy const& policy1,
+    hpx::container_distribution_policy const& policy2,
+    ExPolicy const& copy_policy)
+{
+    hpx::partitioned_vector<T> v1(size, policy1);
+    for (std::size_t i = 0; i != size; ++i)
+        v1.set_value(hpx::launch::sync, i, T(i));
+
+    // copy all elements
+    {
+        hpx::partitioned_vector<T> v2(size, T(0), policy2);
+        auto p =
+            hpx::ranges::copy(copy_policy, v1.begin(), v1.end(), v2.begin());
+        HPX_TEST(p.out == v2.end());
+        compare_vectors(v1, v2);
+    }
+
+    // copy a sub-range to a different offset
+    if (size > 3)
+    {
+        hpx::partitioned_vector<T> v2(size, T(0), policy2);
+        auto p = hpx::copy(
+            copy_policy, v1.begin() + 1, v1.end() - 1, v2.begin() + 2);
+        HPX_TEST(p == v2.end());
+
+        for (std::size_t i = 0; i != size; ++i)
+        {
+            T expected = (i < 2) ? T(0) : T(i - 1);
+            HPX_TEST_EQ(v2.get_value(hpx::launch::sync, i), expected);
+        }
+    }
+}
+
+template <typename T>
+void copy_unaligned_tests(std::vector<hpx::id_type> const& localities)
+{
+    std::size_t const length = 17;
+
+    using namespace hpx::execution;
+
+    auto policy1 = hpx::container_layout(3, localities);
+    auto policy2 = hpx::container_layout(localities.size() + 1, localities);
+
+    copy_unaligned_tests<T>(length, policy1, policy2, seq);
+    copy_unaligned_tests<T>(length, policy1, policy2, par);
+    copy_unaligned_tests<T>(length, policy2, policy1, seq);
+    copy_unaligned_tests<T>(length, policy2, policy1, par);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 template <typename T>
 void copy_tests()
@@ -165,6 +217,8 @@ void copy_tests()
     copy_tests_with_policy<T>(length, 3, hpx::container_layout(3, localities));
     copy_tests_with_policy<T>(
         length, localities.size(), hpx::container_layout(localities));
+
+    copy_unaligned_tests<T>(localities);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
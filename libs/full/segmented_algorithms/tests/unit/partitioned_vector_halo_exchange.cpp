@@ -0,0 +1,117 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/partitioned_vector_predef.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/segmented_algorithms/halo_exchange.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The vector types to be used are defined in partitioned_vector module.
+// HPX_REGISTER_PARTITIONED_VECTOR(double)
+// HPX_REGISTER_PARTITIONED_VECTOR(int)
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void iota_vector(hpx::partitioned_vector<T>& v, T val)
+{
+    typename hpx::partitioned_vector<T>::iterator it = v.begin(), end = v.end();
+    for (/**/; it != end; ++it)
+        *it = val++;
+}
+
+template <typename T>
+void test_halos(hpx::partitioned_vector<T>& v, std::size_t width)
+{
+    iota_vector(v, T(0));
+
+    // compute the ranges of the non-empty partitions
+    std::vector<std::size_t> begins, ends;
+    std::size_t offset = 0;
+    for (std::size_t size : v.get_partition_sizes())
+    {
+        if (size != 0)
+        {
+            begins.push_back(offset);
+            ends.push_back(offset + size);
+        }
+        offset += size;
+    }
+
+    auto halos = hpx::segmented::get_halos(v.begin(), v.end(), width);
+    HPX_TEST_EQ(halos.size(), begins.size());
+
+    for (std::size_t i = 0; i != halos.size(); ++i)
+    {
+        hpx::segmented::halo<T> h = halos[i].get();
+
+        std::vector<T> left, right;
+        if (i != 0)
+        {
+            std::size_t const first = ends[i - 1] -
+                (std::min)(width, ends[i - 1] - begins[i - 1]);
+            for (std::size_t j = first; j != ends[i - 1]; ++j)
+                left.push_back(T(j));
+        }
+        if (i + 1 != halos.size())
+        {
+            std::size_t const last = begins[i + 1] +
+                (std::min)(width, ends[i + 1] - begins[i + 1]);
+            for (std::size_t j = begins[i + 1]; j != last; ++j)
+                right.push_back(T(j));
+        }
+
+        HPX_TEST(h.left == left);
+        HPX_TEST(h.right == right);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void halo_exchange_tests(std::vector<hpx::id_type> const& localities)
+{
+    std::size_t const length = 29;
+
+    {
+        hpx::partitioned_vector<T> v;
+        HPX_TEST(hpx::segmented::get_halos(v.begin(), v.end(), 1).empty());
+    }
+
+    {
+        hpx::partitioned_vector<T> v(length, hpx::container_layout(localities));
+        test_halos(v, 0);
+        test_halos(v, 1);
+        test_halos(v, 3);
+        test_halos(v, length);
+    }
+
+    {
+        hpx::partitioned_vector<T> v(
+            length, hpx::container_layout(4 * localities.size(), localities));
+        test_halos(v, 1);
+        test_halos(v, 2);
+        test_halos(v, length);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+
+    halo_exchange_tests<int>(localities);
+    halo_exchange_tests<double>(localities);
+
+    return hpx::util::report_errors();
+}
+#endif
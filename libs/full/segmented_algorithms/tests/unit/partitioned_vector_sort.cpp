@@ -0,0 +1,168 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/parallel_sort.hpp>
+#include <hpx/include/partitioned_vector_predef.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The vector types to be used are defined in partitioned_vector module.
+// HPX_REGISTER_PARTITIONED_VECTOR(double)
+// HPX_REGISTER_PARTITIONED_VECTOR(int)
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+std::vector<T> fill_random(hpx::partitioned_vector<T>& v)
+{
+    std::uniform_int_distribution<int> dist(-1000, 1000);
+
+    std::vector<T> values(v.size());
+    for (auto& val : values)
+        val = T(dist(gen));
+
+    auto it = v.begin();
+    for (T const& val : values)
+        *it++ = val;
+
+    return values;
+}
+
+template <typename T>
+void verify_values(
+    hpx::partitioned_vector<T> const& v, std::vector<T> const& expected)
+{
+    HPX_TEST_EQ(v.size(), expected.size());
+
+    std::size_t i = 0;
+    for (auto it = v.begin(); it != v.end(); ++it, ++i)
+    {
+        HPX_TEST_EQ(T(*it), expected[i]);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Sort>
+void test_sort(hpx::partitioned_vector<T>& v, Sort&& sort)
+{
+    // default comparison
+    {
+        std::vector<T> expected = fill_random(v);
+        std::sort(expected.begin(), expected.end());
+
+        sort(std::less<T>());
+        verify_values(v, expected);
+    }
+
+    // custom comparison
+    {
+        std::vector<T> expected = fill_random(v);
+        std::sort(expected.begin(), expected.end(), std::greater<T>());
+
+        sort(std::greater<T>());
+        verify_values(v, expected);
+    }
+
+    // already sorted input
+    {
+        std::vector<T> expected = fill_random(v);
+        std::sort(expected.begin(), expected.end());
+
+        sort(std::less<T>());
+        sort(std::less<T>());
+        verify_values(v, expected);
+    }
+}
+
+template <typename T>
+void sort_tests(hpx::partitioned_vector<T>& v)
+{
+    using namespace hpx::execution;
+
+    test_sort(v, [&](auto comp) { hpx::sort(v.begin(), v.end(), comp); });
+    test_sort(v, [&](auto comp) { hpx::sort(seq, v.begin(), v.end(), comp); });
+    test_sort(v, [&](auto comp) { hpx::sort(par, v.begin(), v.end(), comp); });
+    test_sort(v, [&](auto comp) {
+        hpx::sort(seq(task), v.begin(), v.end(), comp).get();
+    });
+    test_sort(v, [&](auto comp) {
+        hpx::sort(par(task), v.begin(), v.end(), comp).get();
+    });
+}
+
+template <typename T>
+void sort_subrange_tests(hpx::partitioned_vector<T>& v)
+{
+    if (v.size() < 4)
+        return;
+
+    std::vector<T> expected = fill_random(v);
+    std::sort(expected.begin() + 1, expected.end() - 2);
+
+    hpx::sort(hpx::execution::par, v.begin() + 1, v.end() - 2);
+    verify_values(v, expected);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void sort_tests(std::vector<hpx::id_type> const& localities)
+{
+    std::size_t const length = 117;
+
+    {
+        hpx::partitioned_vector<T> v;
+        hpx::sort(v.begin(), v.end());
+        hpx::sort(hpx::execution::par, v.begin(), v.end());
+    }
+
+    {
+        hpx::partitioned_vector<T> v(length, hpx::container_layout(localities));
+        sort_tests(v);
+        sort_subrange_tests(v);
+    }
+
+    // partitions of different sizes
+    {
+        hpx::partitioned_vector<T> v(
+            length, hpx::container_layout(5, localities));
+        sort_tests(v);
+        sort_subrange_tests(v);
+    }
+
+    {
+        hpx::partitioned_vector<T> v(
+            7, hpx::container_layout(3 * localities.size(), localities));
+        sort_tests(v);
+        sort_subrange_tests(v);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    std::cout << "using seed: " << seed << std::endl;
+
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+
+    sort_tests<int>(localities);
+    sort_tests<double>(localities);
+
+    return hpx::util::report_errors();
+}
+#endif
@@ -161,6 +161,20 @@ void transform_tests(std::vector<hpx::id_type>& localities)
         test_transform_async(
             hpx::execution::par(hpx::execution::task), v, w, U(1));
     }
+
+    {
+        // source and destination are partitioned differently
+        hpx::partitioned_vector<T> v(
+            length, T(1), hpx::container_layout(localities));
+        hpx::partitioned_vector<U> w(
+            length, hpx::container_layout(5, localities));
+        test_transform(hpx::execution::seq, v, w, U(1));
+        test_transform(hpx::execution::par, v, w, U(1));
+        test_transform_async(
+            hpx::execution::seq(hpx::execution::task), v, w, U(1));
+        test_transform_async(
+            hpx::execution::par(hpx::execution::task), v, w, U(1));
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1,4 +1,5 @@
 //  Copyright (c) 2016 Hartmut Kaiser
+//  Copyright (c) 2026 The STE||AR-Group
 //
 //  SPDX-License-Identifier: BSL-1.0
 //  Distributed under the Boost Software License, Version 1.0. (See accompanying
@@ -14,12 +15,14 @@
 #include <hpx/hpx.hpp>
 #include <hpx/hpx_init.hpp>
 
+#include <hpx/cache/concurrent_lru_cache.hpp>
 #include <hpx/cache/entries/lfu_entry.hpp>
 #include <hpx/cache/local_cache.hpp>
 #include <hpx/cache/statistics/local_full_statistics.hpp>
 #include <hpx/modules/testing.hpp>
 #include <hpx/preprocessor/stringize.hpp>
 #include <hpx/statistics/histogram.hpp>
+#include <hpx/synchronization/shared_mutex.hpp>
 
 #include <hpx/modules/program_options.hpp>
 #include <boost/accumulators/accumulators.hpp>
@@ -30,6 +33,7 @@
 #include <iomanip>
 #include <iostream>
 #include <map>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -126,6 +130,52 @@ typedef hpx::util::cache::local_cache<gva_cache_key, gva_entry_type,
     hpx::util::cache::statistics::local_full_statistics>
     gva_cache_type;
 
+///////////////////////////////////////////////////////////////////////////////
+// The AGAS cache for single objects (trivially copyable keys and entries)
+struct object_cache_key
+{
+    std::uint64_t msb = 0;
+    std::uint64_t lsb = 0;
+
+    object_cache_key() = default;
+
+    explicit object_cache_key(hpx::naming::gid_type const& id)
+    {
+        hpx::naming::gid_type const gid =
+            hpx::naming::detail::get_stripped_gid(id);
+        msb = gid.get_msb();
+        lsb = gid.get_lsb();
+    }
+
+    friend bool operator==(
+        object_cache_key const& lhs, object_cache_key const& rhs)
+    {
+        return lhs.msb == rhs.msb && lhs.lsb == rhs.lsb;
+    }
+};
+
+struct object_cache_hash
+{
+    std::size_t operator()(object_cache_key const& key) const
+    {
+        return static_cast<std::size_t>(key.lsb ^ (key.msb << 1));
+    }
+};
+
+struct object_cache_entry
+{
+    std::uint64_t prefix_msb = 0;
+    std::uint64_t prefix_lsb = 0;
+    std::uint64_t count = 0;
+    std::uint64_t lva = 0;
+    std::uint64_t offset = 0;
+    std::int32_t type = 0;
+};
+
+typedef hpx::util::cache::concurrent_lru_cache<object_cache_key,
+    object_cache_entry, object_cache_hash>
+    object_cache_type;
+
 ///////////////////////////////////////////////////////////////////////////////
 void calculate_histogram(
     std::string const& prefix, std::vector<std::uint64_t> const& timings)
@@ -230,6 +280,130 @@ void test_update(gva_cache_type& cache, hpx::naming::gid_type first_key)
     calculate_histogram("update", timings);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+void test_insert(object_cache_type& cache, std::size_t num_entries)
+{
+    hpx::naming::gid_type locality = hpx::get_locality();
+    std::int32_t ct = to_int(hpx::components::component_enum_type::invalid);
+
+    std::vector<std::uint64_t> timings;
+    timings.reserve(num_entries);
+
+    for (std::size_t i = 0; i != num_entries; ++i)
+    {
+        object_cache_key key(hpx::detail::get_next_id());
+        object_cache_entry value{
+            locality.get_msb(), locality.get_lsb(), 1, 0, 0, ct};
+
+        std::uint64_t t = hpx::chrono::high_resolution_clock::now();
+
+        cache.insert(key, value);
+
+        timings.push_back(hpx::chrono::high_resolution_clock::now() - t);
+    }
+
+    calculate_histogram("concurrent insert", timings);
+}
+
+void test_get(object_cache_type& cache, hpx::naming::gid_type first_key)
+{
+    std::vector<std::uint64_t> timings;
+    timings.reserve(cache.size());
+
+    for (std::size_t i = 0; i != cache.size(); ++i)
+    {
+        object_cache_key key(++first_key);
+        object_cache_entry e;
+
+        std::uint64_t t = hpx::chrono::high_resolution_clock::now();
+
+        cache.get_entry(key, e);
+
+        timings.push_back(hpx::chrono::high_resolution_clock::now() - t);
+    }
+
+    calculate_histogram("concurrent    get", timings);
+}
+
+void test_update(object_cache_type& cache, hpx::naming::gid_type first_key)
+{
+    hpx::naming::gid_type locality = hpx::get_locality();
+    std::int32_t ct = to_int(hpx::components::component_enum_type::invalid);
+
+    std::vector<std::uint64_t> timings;
+    timings.reserve(cache.size());
+
+    for (std::size_t i = 0; i != cache.size(); ++i)
+    {
+        object_cache_key key(++first_key);
+        object_cache_entry value{
+            locality.get_msb(), locality.get_lsb(), 1, 1, 1, ct};
+
+        std::uint64_t t = hpx::chrono::high_resolution_clock::now();
+
+        cache.update(key, value);
+
+        timings.push_back(hpx::chrono::high_resolution_clock::now() - t);
+    }
+
+    calculate_histogram("concurrent update", timings);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Measure the time needed for all worker threads to concurrently look up the
+// given number of entries. The old cache is protected by a mutex, similar to
+// what AGAS used to do.
+template <typename F>
+double concurrent_lookups(F&& f)
+{
+    std::size_t const num_threads = hpx::get_num_worker_threads();
+
+    hpx::chrono::high_resolution_timer t;
+
+    std::vector<hpx::future<void>> lookups;
+    lookups.reserve(num_threads);
+    for (std::size_t i = 0; i != num_threads; ++i)
+    {
+        lookups.push_back(hpx::async(f, i));
+    }
+    hpx::wait_all(lookups);
+
+    return t.elapsed();
+}
+
+void test_concurrent_get(gva_cache_type& cache, object_cache_type& ocache,
+    hpx::naming::gid_type const& first_key, std::size_t num_entries,
+    std::size_t num_lookups)
+{
+    hpx::shared_mutex mtx;
+    double const old_elapsed = concurrent_lookups([&](std::size_t seed) {
+        for (std::size_t i = 0; i != num_lookups; ++i)
+        {
+            gva_cache_key key(first_key + ((i + seed) % num_entries + 1), 1);
+            gva_cache_key idbase;
+            gva_cache_type::entry_type e;
+
+            std::unique_lock<hpx::shared_mutex> l(mtx);
+            cache.get_entry(key, idbase, e);
+        }
+    });
+
+    double const new_elapsed = concurrent_lookups([&](std::size_t seed) {
+        for (std::size_t i = 0; i != num_lookups; ++i)
+        {
+            object_cache_key key(first_key + ((i + seed) % num_entries + 1));
+            object_cache_entry e;
+
+            ocache.get_entry(key, e);
+        }
+    });
+
+    std::cout << "concurrent get (" << hpx::get_num_worker_threads()
+              << " threads, " << num_lookups << " lookups each): locked "
+              << old_elapsed << "s, concurrent " << new_elapsed << "s"
+              << std::endl;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int hpx_main(hpx::program_options::variables_map& vm)
 {
@@ -255,6 +429,33 @@ int hpx_main(hpx::program_options::variables_map& vm)
     double elapsed = t1.elapsed();
     hpx::util::print_cdash_timing("AGASCache", elapsed);
 
+    object_cache_type ocache(cache_size);
+
+    hpx::naming::gid_type first_object_key = hpx::detail::get_next_id();
+
+    hpx::chrono::high_resolution_timer t2;
+
+    test_insert(ocache, num_entries);
+    test_get(ocache, first_object_key);
+    test_update(ocache, first_object_key);
+
+    elapsed = t2.elapsed();
+    hpx::util::print_cdash_timing("AGASConcurrentCache", elapsed);
+
+    // make sure both caches hold the same keys for the concurrent lookups
+    ocache.clear();
+    for (std::size_t i = 0; i != num_entries; ++i)
+    {
+        ocache.insert(
+            object_cache_key(first_key + (i + 1)), object_cache_entry());
+    }
+
+    std::size_t num_lookups = 100000;
+    if (vm.count("num_lookups"))
+        num_lookups = vm["num_lookups"].as<std::size_t>();
+
+    test_concurrent_get(cache, ocache, first_key, num_entries, num_lookups);
+
     return hpx::finalize();
 }
 
@@ -268,7 +469,9 @@ int main(int argc, char* argv[])
         "initial cache size (default: " HPX_PP_STRINGIZE(
             HPX_AGAS_LOCAL_CACHE_SIZE_PER_THREAD) ")")("num_entries,n",
         value<std::size_t>(),
-        "number of items to insert into cache (default: 1000)");
+        "number of items to insert into cache (default: 1000)")(
+        "num_lookups", value<std::size_t>(),
+        "number of concurrent lookups per worker thread (default: 100000)");
 
     // Initialize and run HPX
     hpx::init_params init_args;
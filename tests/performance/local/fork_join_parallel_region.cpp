@@ -0,0 +1,103 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This example benchmarks the time it takes to enter and exit a parallel
+// region of the fork_join_executor. This is meant to be compared to
+// openmp_parallel_region. It also measures the time per parallel region if
+// several threads concurrently submit parallel regions to the same executor.
+
+#include <hpx/algorithm.hpp>
+#include <hpx/chrono.hpp>
+#include <hpx/execution.hpp>
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/program_options.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+using hpx::execution::experimental::fork_join_executor;
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::uint64_t const repetitions = vm["repetitions"].as<std::uint64_t>();
+    std::uint64_t const submitters = vm["submitters"].as<std::uint64_t>();
+
+    fork_join_executor exec;
+    std::size_t const threads = hpx::get_num_worker_threads();
+
+    // Do one warmup iteration
+    std::atomic<int> x(0);
+    hpx::experimental::for_loop(hpx::execution::par.on(exec), std::size_t(0),
+        threads, [&](std::size_t) { ++x; });
+
+    std::cout << "threads, parallel region [s]" << std::endl;
+
+    hpx::chrono::high_resolution_timer timer;
+
+    for (std::size_t i = 0; i < repetitions; ++i)
+    {
+        timer.restart();
+
+        hpx::experimental::for_loop(hpx::execution::par.on(exec),
+            std::size_t(0), threads, [&](std::size_t) { ++x; });
+
+        auto t_parallel = timer.elapsed();
+
+        std::cout << threads << ", " << t_parallel << std::endl;
+    }
+
+    // several threads submitting parallel regions to the same executor
+    std::cout << "threads, submitters, parallel region (shared) [s]"
+              << std::endl;
+
+    timer.restart();
+
+    std::vector<hpx::future<void>> tasks;
+    tasks.reserve(submitters);
+    for (std::size_t i = 0; i != submitters; ++i)
+    {
+        tasks.push_back(hpx::async([&]() {
+            for (std::size_t j = 0; j < repetitions; ++j)
+            {
+                hpx::experimental::for_loop(hpx::execution::par.on(exec),
+                    std::size_t(0), threads, [&](std::size_t) { ++x; });
+            }
+        }));
+    }
+    hpx::wait_all(tasks);
+
+    auto t_shared = timer.elapsed() / (repetitions * submitters);
+
+    std::cout << threads << ", " << submitters << ", " << t_shared
+              << std::endl;
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char** argv)
+{
+    hpx::program_options::options_description desc_commandline;
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("repetitions",
+         hpx::program_options::value<std::uint64_t>()->default_value(100),
+         "Number of repetitions")
+        ("submitters",
+         hpx::program_options::value<std::uint64_t>()->default_value(4),
+         "Number of threads concurrently submitting parallel regions")
+        ;
+    // clang-format on
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+
+    return hpx::local::init(hpx_main, argc, argv, init_args);
+}
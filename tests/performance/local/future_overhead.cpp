@@ -197,6 +197,30 @@ void measure_function_futures_wait_all(
     print_stats("async", "WaitAll", exec_name(exec), count, duration, csv);
 }
 
+// Time attaching continuations to futures, every future is extended by a
+// short chain of continuations which are finally joined using when_all
+template <typename Executor>
+void measure_function_futures_continuations(
+    std::uint64_t count, bool csv, Executor& exec)
+{
+    std::vector<future<double>> futures;
+    futures.reserve(count);
+
+    // start the clock
+    high_resolution_timer const walltime;
+    for (std::uint64_t i = 0; i < count; ++i)
+    {
+        futures.push_back(async(exec, &null_function)
+                .then(hpx::launch::sync,
+                    [](future<double>&& f) { return f.get() + 1.0; })
+                .then(exec, [](future<double>&& f) { return f.get() + 1.0; }));
+    }
+    hpx::when_all(futures).get();
+
+    double const duration = walltime.elapsed();
+    print_stats("then", "WhenAll", exec_name(exec), count, duration, csv);
+}
+
 template <typename Executor>
 void measure_function_futures_limiting_executor(
     std::uint64_t count, bool csv, Executor exec)
@@ -478,6 +502,49 @@ void measure_function_futures_apply_hierarchical_placement(
         duration, csv);
 }
 
+// All worker threads create (and finish) tasks concurrently, each task
+// terminates right away. This measures the overhead of creating and recycling
+// the thread objects of the given stack size, which is dominated by the
+// thread queues once the tasks themselves are empty.
+void measure_function_futures_thread_recycling(std::uint64_t count, bool csv,
+    hpx::threads::thread_stacksize stacksize, char const* executor_name)
+{
+    hpx::latch l(count);
+
+    auto const func = [&l]() {
+        null_function();
+        l.count_down(1);
+    };
+    auto const num_threads = hpx::get_num_worker_threads();
+
+    // start the clock
+    high_resolution_timer const walltime;
+    for (std::size_t t = 0; t < num_threads; ++t)
+    {
+        auto const hint =
+            hpx::threads::thread_schedule_hint(static_cast<std::int16_t>(t));
+        auto spawn_func = [&func, stacksize, hint, t, count, num_threads]() {
+            auto exec = hpx::execution::parallel_executor(stacksize, hint);
+            std::uint64_t const count_start = t * count / num_threads;
+            std::uint64_t const count_end = (t + 1) * count / num_threads;
+
+            for (std::uint64_t i = count_start; i < count_end; ++i)
+            {
+                hpx::post(exec, func);
+            }
+        };
+
+        auto exec = hpx::execution::parallel_executor(hint);
+        hpx::post(exec, spawn_func);
+    }
+    l.wait();
+
+    // stop the clock
+    double const duration = walltime.elapsed();
+    print_stats("thread_recycling", "latch", executor_name, count, duration,
+        csv);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int hpx_main(variables_map& vm)
 {
@@ -526,6 +593,7 @@ int hpx_main(variables_map& vm)
 #endif
                 measure_function_futures_wait_each(count, csv, par);
                 measure_function_futures_wait_all(count, csv, par);
+                measure_function_futures_continuations(count, csv, par);
                 measure_function_futures_sliding_semaphore(count, csv, par);
                 measure_function_futures_for_loop(count, csv, par);
                 measure_function_futures_for_loop(count, csv, sched_exec_tps);
@@ -535,6 +603,12 @@ int hpx_main(variables_map& vm)
                 measure_function_futures_create_thread(count, csv);
                 measure_function_futures_apply_hierarchical_placement(
                     count, csv);
+                measure_function_futures_thread_recycling(count, csv,
+                    hpx::threads::thread_stacksize::small_,
+                    "parallel_executor");
+                measure_function_futures_thread_recycling(count, csv,
+                    hpx::threads::thread_stacksize::nostack,
+                    "parallel_executor_nostack");
             }
         }
     }
@@ -15,6 +15,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <initializer_list>
 #include <iterator>
 #include <stdexcept>
 #include <string>
@@ -60,6 +61,19 @@ std::uint64_t foreach_vector(Policy&& policy, Vector const& v)
     return (hpx::chrono::high_resolution_clock::now() - start) / test_count;
 }
 
+template <typename Policy, typename Vector>
+std::uint64_t copy_vector(Policy&& policy, Vector const& v, Vector& w)
+{
+    std::uint64_t start = hpx::chrono::high_resolution_clock::now();
+
+    for (int i = 0; i != test_count; ++i)
+    {
+        hpx::copy(std::forward<Policy>(policy), v.begin(), v.end(), w.begin());
+    }
+
+    return (hpx::chrono::high_resolution_clock::now() - start) / test_count;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int hpx_main(hpx::program_options::variables_map& vm)
 {
@@ -134,6 +148,41 @@ int hpx_main(hpx::program_options::variables_map& vm)
                     double(par_ref)    //-V106
                       << "\n";
         }
+
+        // distributed runs, the partitions are spread over all localities
+        std::vector<hpx::id_type> localities = hpx::find_all_localities();
+        std::size_t const num_localities = localities.size();
+
+        for (std::size_t partitions_per_locality : {1, 4})
+        {
+            std::size_t const num_partitions =
+                partitions_per_locality * num_localities;
+
+            hpx::partitioned_vector<int> v(
+                vector_size, hpx::container_layout(num_partitions, localities));
+
+            hpx::cout << "hpx::partitioned_vector<int>(execution::par, "
+                      << num_localities << " localities, container_layout("
+                      << num_partitions << ")): "
+                      << foreach_vector(hpx::execution::par.with(cs), v) /
+                    double(par_ref)    //-V106
+                      << "\n";
+        }
+
+        // copy between vectors which are distributed differently, this
+        // requires moving elements between the localities
+        {
+            hpx::partitioned_vector<int> v(
+                vector_size, hpx::container_layout(num_localities, localities));
+            hpx::partitioned_vector<int> w(vector_size,
+                hpx::container_layout(2 * num_localities + 1, localities));
+
+            hpx::cout << "hpx::copy(execution::par, " << num_localities
+                      << " localities, container_layout(" << num_localities
+                      << ") -> container_layout(" << 2 * num_localities + 1
+                      << ")): " << copy_vector(hpx::execution::par, v, w)
+                      << " [ns]\n";
+        }
     }
 
     return hpx::finalize();
@@ -0,0 +1,127 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Measure the per-event overhead of the task tracer: recording an event into
+// a trace buffer, and recording a task start event including the lookup of
+// the copy of the task's description owned by the buffer.
+
+#include <hpx/modules/program_options.hpp>
+#include <hpx/modules/threading_base.hpp>
+#include <hpx/modules/timing.hpp>
+#include <hpx/threading_base/task_tracer.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using hpx::program_options::command_line_parser;
+using hpx::program_options::notify;
+using hpx::program_options::options_description;
+using hpx::program_options::store;
+using hpx::program_options::value;
+using hpx::program_options::variables_map;
+
+using hpx::threads::task_trace_event_type;
+using hpx::threads::detail::task_trace_buffer;
+using hpx::threads::detail::task_trace_data_is_description;
+
+std::uint64_t iterations = 10000000;
+std::size_t buffer_size = 65536;
+
+template <typename F>
+void run(char const* name, F&& f)
+{
+    hpx::chrono::high_resolution_timer t;
+
+    for (std::uint64_t i = 0; i != iterations; ++i)
+        f(i);
+
+    double const elapsed = t.elapsed();
+    std::cout << name << ": " << ((elapsed / iterations) * 1e9)
+              << " ns/event\n";
+}
+
+// record events the way trace_task_start does, cycling through the given
+// descriptions (the number of descriptions has to be a power of two)
+void run_descriptions(char const* name, std::vector<char const*> const& descs)
+{
+    task_trace_buffer buffer(buffer_size);
+    std::size_t const mask = descs.size() - 1;
+
+    run(name, [&](std::uint64_t i) {
+        char const* desc = descs[i & mask];
+        buffer.record(task_trace_event_type::start, &buffer,
+            reinterpret_cast<std::uint64_t>(buffer.intern_description(desc)),
+            0, task_trace_data_is_description);
+    });
+}
+
+int app_main(variables_map&)
+{
+    {
+        task_trace_buffer buffer(buffer_size);
+        run("record", [&](std::uint64_t i) {
+            buffer.record(task_trace_event_type::start, &buffer, i, 0);
+        });
+    }
+
+    // a few static descriptions, the common case
+    std::vector<char const*> const few = {"hpx::async", "hpx::post",
+        "hpx::dataflow", "hpx::parallel::for_each", "run_helper",
+        "background_work", "hpx_main", "hpx::wait_all"};
+    run_descriptions("record with description (8 distinct)", few);
+
+    // more descriptions than fit into the address cache of the buffer, each
+    // lookup compares the contents of the description
+    std::vector<std::string> names;
+    for (int i = 0; i != 1024; ++i)
+    {
+        names.push_back("dynamic description #" + std::to_string(i));
+    }
+    std::vector<char const*> many;
+    for (auto const& n : names)
+    {
+        many.push_back(n.c_str());
+    }
+    run_descriptions("record with description (1024 distinct)", many);
+
+    return 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // Parse command line.
+    variables_map vm;
+
+    options_description cmdline("Usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("help,h", "print out program usage (this message)")
+        ("iterations",
+            value<std::uint64_t>(&iterations)->default_value(10000000),
+            "number of events to record for each test")
+        ("buffer-size", value<std::size_t>(&buffer_size)->default_value(65536),
+            "number of events held by the trace buffer");
+    // clang-format on
+
+    store(command_line_parser(argc, argv).options(cmdline).run(), vm);
+
+    notify(vm);
+
+    // Print help screen.
+    if (vm.count("help"))
+    {
+        std::cout << cmdline;
+        return 0;
+    }
+
+    return app_main(vm);
+}
@@ -11,6 +11,8 @@
 #include <hpx/include/async.hpp>
 #include <hpx/include/serialization.hpp>
 #include <hpx/iostream.hpp>
+#include <hpx/modules/runtime_local.hpp>
+#include <hpx/modules/timing.hpp>
 
 #include <complex>
 #include <cstddef>
@@ -34,7 +36,11 @@ int hpx_main(hpx::program_options::variables_map& vm)
 
     if (0 == hpx::get_locality_id())
     {
-        hpx::cout << "Running With nparcel = " << n << "\n" << std::flush;
+        hpx::cout << "Running With nparcel = " << n << "\n"
+                  << "hpx.parcel.tcp.io_uring = "
+                  << hpx::get_config_entry("hpx.parcel.tcp.io_uring", "0")
+                  << "\n"
+                  << std::flush;
     }
 
     //Create instance of the actions
@@ -47,13 +53,14 @@ int hpx_main(hpx::program_options::variables_map& vm)
     std::vector<hpx::id_type> dummy = hpx::find_remote_localities();
     hpx::id_type other_locality = dummy[0];
 
+    hpx::chrono::high_resolution_timer t;
     for (std::size_t i = 0; i < n; ++i)
     {
         vec.push_back(hpx::async(act, other_locality));
     }
 
     hpx::when_all(vec)
-        .then([&received, n](
+        .then([&received, &t, n](
                   hpx::future<std::vector<hpx::future<std::complex<double>>>>
                       dummy) {
             std::vector<hpx::future<std::complex<double>>> number = dummy.get();
@@ -61,6 +68,10 @@ int hpx_main(hpx::program_options::variables_map& vm)
             {
                 received.push_back(number[i].get());
             }
+            double const elapsed = t.elapsed();
+            hpx::cout << "Elapsed time: " << elapsed << " [s], "
+                      << static_cast<double>(n) / elapsed << " [parcels/s]\n"
+                      << std::flush;
             hpx::evaluate_active_counters(false, " All Futures Done");
             hpx::cout << "Now Done With Lambda and the last received value is "
                       << received[n - 1] << "\n"
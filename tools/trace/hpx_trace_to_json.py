@@ -0,0 +1,138 @@
+#!/usr/bin/env python3
+# Copyright (c) 2026 The STE||AR-Group
+#
+# SPDX-License-Identifier: BSL-1.0
+# Distributed under the Boost Software License, Version 1.0. (See accompanying
+# file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+# ## Synopsis
+# ```
+# usage: hpx_trace_to_json.py [-h] [source] [destination]
+#
+# Convert a task trace written by an HPX application run with --hpx:trace into
+# the Chrome trace event format (viewable with chrome://tracing or Perfetto)
+#
+# positional arguments:
+#   source       File path to read the binary task trace from
+#   destination  File path to write the JSON trace to
+#
+# optional arguments:
+#   -h, --help   show this help message and exit
+# ```
+
+import argparse
+import json
+import struct
+import sys
+
+header_format = struct.Struct('=8sIIQQQQ')
+worker_format = struct.Struct('=IIQ')
+event_format = struct.Struct('=QQQIHH')
+string_format = struct.Struct('=QI')
+
+event_types = ('start', 'stop', 'suspend', 'steal')
+data_is_description = 0x1
+
+
+def read_struct(fh, fmt):
+    data = fh.read(fmt.size)
+    if len(data) != fmt.size:
+        raise ValueError('unexpected end of trace file')
+    return fmt.unpack(data)
+
+
+def read_trace(fh):
+    magic, version, num_workers, ts0, ns0, ts1, ns1 = read_struct(
+        fh, header_format)
+    if magic != b'HPXTRACE':
+        raise ValueError('not an HPX task trace file')
+    if version != 1:
+        raise ValueError('unsupported trace file version: %d' % version)
+
+    # convert timestamps into microseconds relative to the start of tracing
+    scale = (ns1 - ns0) / (ts1 - ts0) if ts1 != ts0 else 1.0
+
+    def to_us(ts):
+        return (ts - ts0) * scale / 1000.0
+
+    workers = {}
+    for _ in range(num_workers):
+        worker, _, count = read_struct(fh, worker_format)
+        events = []
+        for _ in range(count):
+            ts, task, data, phase, kind, flags = read_struct(fh, event_format)
+            events.append((to_us(ts), task, data, phase, kind, flags))
+        events.sort(key=lambda e: e[0])
+        workers[worker] = events
+
+    names = {}
+    num_strings, = read_struct(fh, struct.Struct('=Q'))
+    for _ in range(num_strings):
+        address, length = read_struct(fh, string_format)
+        names[address] = fh.read(length).decode('utf-8', 'replace')
+
+    return workers, names
+
+
+def task_name(data, flags, names):
+    if flags & data_is_description:
+        return names.get(data, '<unknown>')
+    if data != 0:
+        return 'address %#x' % data
+    return '<unknown>'
+
+
+def convert(workers, names):
+    trace = []
+    for worker, events in sorted(workers.items()):
+        trace.append({
+            'name': 'thread_name', 'ph': 'M', 'pid': 0, 'tid': worker,
+            'args': {'name': 'worker thread #%d' % worker}})
+
+        running = None
+        for ts, task, data, phase, kind, flags in events:
+            kind = event_types[kind] if kind < len(event_types) else None
+            if kind == 'start':
+                running = (ts, task, task_name(data, flags, names), phase)
+            elif kind in ('stop', 'suspend'):
+                # ignore events whose start was overwritten in the ring buffer
+                if running is None or running[1] != task:
+                    continue
+                start, _, name, phase = running
+                trace.append({
+                    'name': name, 'cat': 'task', 'ph': 'X', 'pid': 0,
+                    'tid': worker, 'ts': start, 'dur': ts - start,
+                    'args': {'task': '%#x' % task, 'phase': phase,
+                             'state': 'terminated' if kind == 'stop'
+                             else 'suspended'}})
+                running = None
+            elif kind == 'steal':
+                trace.append({
+                    'name': 'steal', 'cat': 'scheduler', 'ph': 'i', 's': 't',
+                    'pid': 0, 'tid': worker, 'ts': ts,
+                    'args': {'task': '%#x' % task, 'victim': data}})
+
+    return {'traceEvents': trace, 'displayTimeUnit': 'ns'}
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Convert a task trace written by an HPX application run '
+        'with --hpx:trace into the Chrome trace event format (viewable with '
+        'chrome://tracing or Perfetto)')
+    parser.add_argument(
+        'source', type=argparse.FileType('rb'), nargs='?',
+        default=sys.stdin.buffer,
+        help='File path to read the binary task trace from')
+    parser.add_argument(
+        'destination', type=argparse.FileType('w'), nargs='?',
+        default=sys.stdout,
+        help='File path to write the JSON trace to')
+    args = parser.parse_args()
+
+    workers, names = read_trace(args.source)
+    json.dump(convert(workers, names), args.destination)
+
+
+if __name__ == '__main__':
+    main()